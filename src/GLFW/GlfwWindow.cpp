@@ -347,6 +347,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetKeyCallback(glfwWindow, [](GLFWwindow* window, int key, int scancode, int action, int mods) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onKey(key, scancode, action, mods);
         }
     });
@@ -356,6 +357,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetCharCallback(glfwWindow, [](GLFWwindow* window, unsigned int codepoint) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onChar(codepoint);
         }
     });
@@ -363,6 +365,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetCharModsCallback(glfwWindow, [](GLFWwindow* window, unsigned int codepoint, int mods) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onCharMods(codepoint, mods);
         }
     });
@@ -370,6 +373,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetCursorPosCallback(glfwWindow, [](GLFWwindow* window, double xpos, double ypos) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onCursorPos(xpos, ypos);
         }
     });
@@ -380,6 +384,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetCursorEnterCallback(glfwWindow, [](GLFWwindow* window, int entered) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onCursorEnter(entered);
         }
     });
@@ -387,6 +392,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetMouseButtonCallback(glfwWindow, [](GLFWwindow* window, int button, int action, int mods) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onMouseButton(button, action, mods);
         }
     });
@@ -395,6 +401,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetScrollCallback(glfwWindow, [](GLFWwindow* window, double xoffset, double yoffset) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onScroll(xoffset, yoffset);
         }
     });
@@ -402,6 +409,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetDropCallback(glfwWindow, [](GLFWwindow* window, int count, const char** paths) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onDrop(count, paths);
         }
     });
@@ -409,6 +417,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetFramebufferSizeCallback(glfwWindow, [](GLFWwindow* window, int width, int height) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onFramebufferSize(width, height);
         }
     });
@@ -416,6 +425,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetWindowContentScaleCallback(glfwWindow, [](GLFWwindow* window, float xscale, float yscale) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->onWindowContentScale(xscale, yscale);
         }
     });
@@ -423,6 +433,7 @@ void GlfwWindow::initialize(const WindowSettings &settings, RenderSystem renderS
     glfwSetWindowMaximizeCallback(glfwWindow, [](GLFWwindow* window, int maximized) {
         void* userPtr = glfwGetWindowUserPointer(window);
         if (userPtr) {
+            reinterpret_cast<GlfwWindow*>(userPtr)->hasReceivedEvent = true;
             reinterpret_cast<GlfwWindow*>(userPtr)->setIsMaximized(maximized == GLFW_TRUE);
         }
     });
@@ -555,6 +566,18 @@ bool GlfwWindow::processEvents() {
     return isRunning;
 }
 
+bool GlfwWindow::waitEvents(int timeoutMs) {
+    // GLFW dispatches the events directly in the wait call and does not report whether an event was received, so the
+    // window callbacks record it. Empty events posted by wakeUp don't invoke any callback.
+    hasReceivedEvent = false;
+    glfwWaitEventsTimeout(double(timeoutMs) * 1e-3);
+    return hasReceivedEvent;
+}
+
+void GlfwWindow::wakeUp() {
+    glfwPostEmptyEvent();
+}
+
 void GlfwWindow::onKey(int key, int scancode, int action, int mods) {
     //if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) {
     //    glfwSetWindowShouldClose(glfwWindow, GLFW_TRUE);
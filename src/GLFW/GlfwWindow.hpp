@@ -67,6 +67,8 @@ public:
     void update() override;
     /// Returns false if the game should quit.
     bool processEvents() override;
+    bool waitEvents(int timeoutMs) override;
+    void wakeUp() override;
     void clear(const Color &color = Color(0, 0, 0)) override;
     void flip() override;
 
@@ -130,6 +132,7 @@ public:
 private:
     RenderSystem renderSystem = RenderSystem::VULKAN;
     WindowSettings windowSettings;
+    bool hasReceivedEvent = false; ///< Set by the window callbacks; reset and returned by @see waitEvents.
     bool usesX11Backend = false;
     bool usesWaylandBackend = false;
     bool usesXWaylandBackend = false;
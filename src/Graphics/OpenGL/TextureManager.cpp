@@ -41,6 +41,7 @@
 #include <Math/Math.hpp>
 #include <Graphics/Texture/TextureManager.hpp>
 #include <Graphics/Texture/Bitmap.hpp>
+#include <Graphics/Texture/TextureContainer.hpp>
 
 #include "SystemGL.hpp"
 #include "Texture.hpp"
@@ -260,7 +261,204 @@ TexturePtr TextureManagerGL::createTexture(
 }
 
 
+struct TextureContainerFormatGL {
+    GLint internalFormat;
+    GLenum pixelFormat;
+    GLenum pixelType;
+};
+
+static bool getTextureContainerFormatGL(
+        TextureContainerFormat format, bool sRGB, TextureContainerFormatGL& formatGL) {
+    bool hasS3tc = SystemGL::get()->isGLExtensionAvailable("GL_EXT_texture_compression_s3tc");
+    bool hasBptc =
+            SystemGL::get()->openglVersionMinimum(4, 2)
+            || SystemGL::get()->isGLExtensionAvailable("GL_ARB_texture_compression_bptc");
+    formatGL.pixelFormat = 0;
+    formatGL.pixelType = 0;
+    switch (format) {
+        case TextureContainerFormat::R8_UNORM:
+            formatGL = { GL_R8, GL_RED, GL_UNSIGNED_BYTE };
+            return true;
+        case TextureContainerFormat::R8G8_UNORM:
+            formatGL = { GL_RG8, GL_RG, GL_UNSIGNED_BYTE };
+            return true;
+        case TextureContainerFormat::R8G8B8A8_UNORM:
+        case TextureContainerFormat::R8G8B8A8_SRGB:
+            sRGB = sRGB || format == TextureContainerFormat::R8G8B8A8_SRGB;
+            formatGL = { sRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE };
+            return true;
+        case TextureContainerFormat::B8G8R8A8_UNORM:
+        case TextureContainerFormat::B8G8R8A8_SRGB:
+            sRGB = sRGB || format == TextureContainerFormat::B8G8R8A8_SRGB;
+            formatGL = { sRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8, GL_BGRA, GL_UNSIGNED_BYTE };
+            return true;
+        case TextureContainerFormat::R16_UNORM:
+            formatGL = { GL_R16, GL_RED, GL_UNSIGNED_SHORT };
+            return true;
+        case TextureContainerFormat::R16_SFLOAT:
+            formatGL = { GL_R16F, GL_RED, GL_HALF_FLOAT };
+            return true;
+        case TextureContainerFormat::R16G16_SFLOAT:
+            formatGL = { GL_RG16F, GL_RG, GL_HALF_FLOAT };
+            return true;
+        case TextureContainerFormat::R16G16B16A16_UNORM:
+            formatGL = { GL_RGBA16, GL_RGBA, GL_UNSIGNED_SHORT };
+            return true;
+        case TextureContainerFormat::R16G16B16A16_SFLOAT:
+            formatGL = { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT };
+            return true;
+        case TextureContainerFormat::R32_SFLOAT:
+            formatGL = { GL_R32F, GL_RED, GL_FLOAT };
+            return true;
+        case TextureContainerFormat::R32G32_SFLOAT:
+            formatGL = { GL_RG32F, GL_RG, GL_FLOAT };
+            return true;
+        case TextureContainerFormat::R32G32B32A32_SFLOAT:
+            formatGL = { GL_RGBA32F, GL_RGBA, GL_FLOAT };
+            return true;
+        case TextureContainerFormat::BC1_RGB_UNORM_BLOCK:
+        case TextureContainerFormat::BC1_RGB_SRGB_BLOCK:
+            sRGB = sRGB || format == TextureContainerFormat::BC1_RGB_SRGB_BLOCK;
+            formatGL.internalFormat = sRGB ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+            return hasS3tc;
+        case TextureContainerFormat::BC1_RGBA_UNORM_BLOCK:
+        case TextureContainerFormat::BC1_RGBA_SRGB_BLOCK:
+            sRGB = sRGB || format == TextureContainerFormat::BC1_RGBA_SRGB_BLOCK;
+            formatGL.internalFormat =
+                    sRGB ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            return hasS3tc;
+        case TextureContainerFormat::BC2_UNORM_BLOCK:
+        case TextureContainerFormat::BC2_SRGB_BLOCK:
+            sRGB = sRGB || format == TextureContainerFormat::BC2_SRGB_BLOCK;
+            formatGL.internalFormat =
+                    sRGB ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT : GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+            return hasS3tc;
+        case TextureContainerFormat::BC3_UNORM_BLOCK:
+        case TextureContainerFormat::BC3_SRGB_BLOCK:
+            sRGB = sRGB || format == TextureContainerFormat::BC3_SRGB_BLOCK;
+            formatGL.internalFormat =
+                    sRGB ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            return hasS3tc;
+        case TextureContainerFormat::BC4_UNORM_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_RED_RGTC1;
+            return true;
+        case TextureContainerFormat::BC4_SNORM_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_SIGNED_RED_RGTC1;
+            return true;
+        case TextureContainerFormat::BC5_UNORM_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_RG_RGTC2;
+            return true;
+        case TextureContainerFormat::BC5_SNORM_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_SIGNED_RG_RGTC2;
+            return true;
+        case TextureContainerFormat::BC6H_UFLOAT_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+            return hasBptc;
+        case TextureContainerFormat::BC6H_SFLOAT_BLOCK:
+            formatGL.internalFormat = GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+            return hasBptc;
+        case TextureContainerFormat::BC7_UNORM_BLOCK:
+        case TextureContainerFormat::BC7_SRGB_BLOCK:
+            sRGB = sRGB || format == TextureContainerFormat::BC7_SRGB_BLOCK;
+            formatGL.internalFormat = sRGB ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+            return hasBptc;
+        default:
+            return false;
+    }
+}
+
+TexturePtr TextureManagerGL::loadAssetContainer(TextureInfo& textureInfo) {
+    TextureContainer container;
+    if (!container.open(textureInfo.filename)) {
+        return {};
+    }
+    if (container.getNumDimensions() != 2 || container.getIsArray() || container.getIsCubeMap()) {
+        Logfile::get()->writeError(
+                "Error in TextureManagerGL::loadAssetContainer: Only 2D textures are supported (file: \""
+                + textureInfo.filename + "\").");
+        return {};
+    }
+    TextureContainerFormatGL formatGL{};
+    if (!getTextureContainerFormatGL(container.getFormat(), textureInfo.sRGB, formatGL)) {
+        Logfile::get()->writeError(
+                "Error in TextureManagerGL::loadAssetContainer: The texel format of the file \""
+                + textureInfo.filename + "\" is not supported by the OpenGL driver.");
+        return {};
+    }
+
+    // The data is read directly into a pixel unpack buffer, so no copy on the CPU side is necessary.
+#ifndef __EMSCRIPTEN__
+    GLuint pbo = 0;
+    glGenBuffers(1, &pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, GLsizeiptr(container.getDataSize()), nullptr, GL_STREAM_DRAW);
+    void* mappedData = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    bool isDataRead = mappedData && container.readData(mappedData);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    uintptr_t dataBase = 0; // Offsets into the bound pixel unpack buffer.
+#else
+    std::vector<uint8_t> dataVector(container.getDataSize());
+    bool isDataRead = container.readData(dataVector.data());
+    auto dataBase = reinterpret_cast<uintptr_t>(dataVector.data());
+#endif
+
+    GLuint oglTexture = 0;
+    if (isDataRead) {
+        glGenTextures(1, &oglTexture);
+        glBindTexture(GL_TEXTURE_2D, oglTexture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureInfo.magnificationFilter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureInfo.minificationFilter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(container.getNumMipLevels()) - 1);
+        if (textureInfo.anisotropicFilter) {
+            float maxAnisotropy = SystemGL::get()->getMaximumAnisotropy();
+            glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureInfo.textureWrapS);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureInfo.textureWrapT);
+
+        const std::vector<TextureContainerLevel>& levels = container.getLevels();
+        for (size_t level = 0; level < levels.size(); level++) {
+            const TextureContainerLevel& levelInfo = levels.at(level);
+            if (container.getIsCompressed()) {
+                glCompressedTexImage2D(
+                        GL_TEXTURE_2D, GLint(level), formatGL.internalFormat,
+                        GLsizei(levelInfo.width), GLsizei(levelInfo.height), 0,
+                        GLsizei(levelInfo.size), reinterpret_cast<const void*>(dataBase + levelInfo.offset));
+            } else {
+                glTexImage2D(
+                        GL_TEXTURE_2D, GLint(level), formatGL.internalFormat,
+                        GLsizei(levelInfo.width), GLsizei(levelInfo.height), 0,
+                        formatGL.pixelFormat, formatGL.pixelType,
+                        reinterpret_cast<const void*>(dataBase + levelInfo.offset));
+            }
+        }
+    }
+
+#ifndef __EMSCRIPTEN__
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &pbo);
+#endif
+    if (!isDataRead) {
+        return {};
+    }
+
+    TextureSettings settings(GL_TEXTURE_2D, textureInfo.minificationFilter, textureInfo.magnificationFilter,
+            textureInfo.textureWrapS, textureInfo.textureWrapT);
+    settings.internalFormat = formatGL.internalFormat;
+    settings.anisotropicFilter = textureInfo.anisotropicFilter;
+    return TexturePtr(new TextureGL(
+            oglTexture, int(container.getWidth()), int(container.getHeight()), settings, 0));
+}
+
 TexturePtr TextureManagerGL::loadAsset(TextureInfo& textureInfo) {
+    if (TextureContainer::getIsTextureContainerFilename(textureInfo.filename)) {
+        return loadAssetContainer(textureInfo);
+    }
+
     GLint format = GL_RGBA;
     int w = 0, h = 0;
 
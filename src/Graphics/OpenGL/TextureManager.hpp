@@ -78,6 +78,10 @@ public:
 
 protected:
     TexturePtr loadAsset(TextureInfo& textureInfo) override;
+
+private:
+    /// Loads KTX2 and DDS files including their stored mip chain (@see TextureContainer).
+    TexturePtr loadAssetContainer(TextureInfo& textureInfo);
 };
 
 }
@@ -377,6 +377,26 @@ bool Camera::isVisible(const Sphere &sphere) const {
     return true;
 }
 
+void Camera::classifyVisibility(const AABB3Array& bounds, std::vector<FrustumTestResult>& results) const {
+    classifyFrustumVisibility(frustumPlanes, 6, bounds, results);
+}
+
+void Camera::classifyVisibility(const SphereArray& bounds, std::vector<FrustumTestResult>& results) const {
+    classifyFrustumVisibility(frustumPlanes, 6, bounds, results);
+}
+
+void Camera::getVisibleIndices(const AABB3Array& bounds, std::vector<uint32_t>& visibleIndices) const {
+    std::vector<FrustumTestResult> results;
+    classifyFrustumVisibility(frustumPlanes, 6, bounds, results);
+    compactVisibleIndices(results, visibleIndices);
+}
+
+void Camera::getVisibleIndices(const SphereArray& bounds, std::vector<uint32_t>& visibleIndices) const {
+    std::vector<FrustumTestResult> results;
+    classifyFrustumVisibility(frustumPlanes, 6, bounds, results);
+    compactVisibleIndices(results, visibleIndices);
+}
+
 bool Camera::isVisible(const glm::vec2 &vert) const {
     return isVisible(glm::vec3(vert.x, vert.y, 1.0f));
 }
@@ -34,6 +34,7 @@
 #include <Math/Geometry/Plane.hpp>
 #include <Math/Geometry/AABB2.hpp>
 #include <Math/Geometry/Sphere.hpp>
+#include <Math/Geometry/FrustumCulling.hpp>
 
 #include "SceneNode.hpp"
 #include "CameraHelper.hpp"
@@ -142,6 +143,13 @@ public:
     [[nodiscard]] virtual bool isVisible(const glm::vec2 &vert) const;
     [[nodiscard]] virtual bool isVisible(const glm::vec3 &vert) const;
 
+    /// Batched frustum culling of many bounds (SIMD plane tests, parallelized for large inputs).
+    void classifyVisibility(const AABB3Array& bounds, std::vector<FrustumTestResult>& results) const;
+    void classifyVisibility(const SphereArray& bounds, std::vector<FrustumTestResult>& results) const;
+    /// Writes the indices of all bounds that are not fully outside of the frustum in ascending order.
+    void getVisibleIndices(const AABB3Array& bounds, std::vector<uint32_t>& visibleIndices) const;
+    void getVisibleIndices(const SphereArray& bounds, std::vector<uint32_t>& visibleIndices) const;
+
     /// AABB of a slice of the view frustum in distance planeDistance
     AABB2 getAABB2(float planeDistance = -1.0f);
     /// Position of the Mouse in the plane with the given distance
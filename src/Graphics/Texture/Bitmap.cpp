@@ -32,8 +32,19 @@
 #include <Math/Geometry/Rectangle.hpp>
 #include <Math/Geometry/Point2.hpp>
 #include <cstring>
+#include <cmath>
 #include <iostream>
 
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_BITMAP_USE_SSE2
+#endif
+
 #ifdef USE_LIBPNG
 #include <png.h>
 #else
@@ -47,6 +58,80 @@
 
 namespace sgl {
 
+// Images below this size are processed on the calling thread.
+static const size_t PARALLEL_MIN_NUM_BYTES = 256 * 1024;
+
+template<class F>
+static void parallelForRows(int numRows, size_t numBytes, F&& processRow) {
+    if (numBytes < PARALLEL_MIN_NUM_BYTES) {
+        for (int y = 0; y < numRows; y++) {
+            processRow(y);
+        }
+        return;
+    }
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<int>(0, numRows), [&](auto const& r) {
+        for (auto y = r.begin(); y != r.end(); y++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numRows, processRow) default(none)
+#endif
+    for (int y = 0; y < numRows; y++) {
+#endif
+        processRow(y);
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+// Exact floor(x / 255) for 0 <= x <= 65535.
+static inline int div255(int x) {
+    return int((uint32_t(x) * 0x8081u) >> 23u);
+}
+
+/*
+ * Alpha-blends RGBA8 source pixels over destination pixels using the same integer arithmetic as
+ * @see Bitmap::blendPixelColor.
+ */
+static void blendRowRgba8(uint8_t* dst, const uint8_t* src, int numPixels) {
+    int x = 0;
+#ifdef SGL_BITMAP_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaqueAlpha = _mm_set1_epi32(int(0xFF000000u));
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i div255Factor = _mm_set1_epi16(short(0x8081));
+    for (; x + 4 <= numPixels; x += 4) {
+        __m128i srcPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+        __m128i dstPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x * 4));
+        // The source alpha channel is set to 255 so that the output alpha is a + d.a * (255 - a) / 255.
+        __m128i srcOpaque = _mm_or_si128(srcPixels, opaqueAlpha);
+        __m128i results[2];
+        for (int i = 0; i < 2; i++) {
+            __m128i src16 = i == 0 ? _mm_unpacklo_epi8(srcOpaque, zero) : _mm_unpackhi_epi8(srcOpaque, zero);
+            __m128i dst16 = i == 0 ? _mm_unpacklo_epi8(dstPixels, zero) : _mm_unpackhi_epi8(dstPixels, zero);
+            __m128i alpha16 = i == 0 ? _mm_unpacklo_epi8(srcPixels, zero) : _mm_unpackhi_epi8(srcPixels, zero);
+            alpha16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(alpha16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i invAlpha16 = _mm_sub_epi16(max, alpha16);
+            __m128i srcTerm = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(src16, alpha16), div255Factor), 7);
+            __m128i dstTerm = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(dst16, invAlpha16), div255Factor), 7);
+            results[i] = _mm_add_epi16(srcTerm, dstTerm);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(results[0], results[1]));
+    }
+#endif
+    for (; x < numPixels; x++) {
+        const uint8_t* s = src + x * 4;
+        uint8_t* d = dst + x * 4;
+        int a = s[3];
+        int ia = 255 - a;
+        d[0] = uint8_t(div255(s[0] * a) + div255(d[0] * ia));
+        d[1] = uint8_t(div255(s[1] * a) + div255(d[1] * ia));
+        d[2] = uint8_t(div255(s[2] * a) + div255(d[2] * ia));
+        d[3] = uint8_t(a + div255(d[3] * ia));
+    }
+}
+
 void Bitmap::allocate(int width, int height, int _bpp /* = 32 */) {
     if (bitmap != nullptr) {
         freeData();
@@ -59,14 +144,20 @@ void Bitmap::allocate(int width, int height, int _bpp /* = 32 */) {
 }
 
 void Bitmap::fill(const Color &color) {
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            *getPixel(x, y) = color.getR();
-            *(getPixel(x, y) + 1) = color.getG();
-            *(getPixel(x, y) + 2) = color.getB();
-            *(getPixel(x, y) + 3) = color.getA();
-        }
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    const uint8_t colorData[4] = { color.getR(), color.getG(), color.getB(), color.getA() };
+    const int numChannels = bpp / 8;
+    const size_t rowSize = size_t(w) * size_t(numChannels);
+
+    // Fill the first row and replicate it.
+    for (int x = 0; x < w; ++x) {
+        memcpy(bitmap + x * numChannels, colorData, std::min(numChannels, 4));
     }
+    parallelForRows(h - 1, rowSize * size_t(h), [&](int y) {
+        memcpy(bitmap + size_t(y + 1) * rowSize, bitmap, rowSize);
+    });
 }
 
 void Bitmap::memset(uint8_t data) {
@@ -105,11 +196,11 @@ void Bitmap::blit(BitmapPtr &aim, const Point2 &pos) {
     int endy = clamp(pos.y+this->h-1, 0, aim->h-1);
 
     // Copy the relevant scanlines
-    for (int y = starty; y <= endy; ++y) {
-        memcpy(
-                aim->getPixel(startx, y), this->getPixel(startx - pos.x, y - pos.y),
-                (endx - startx + 1) * (bpp / 8));
-    }
+    const size_t rowSize = size_t(endx - startx + 1) * size_t(bpp / 8);
+    parallelForRows(endy - starty + 1, rowSize * size_t(endy - starty + 1), [&](int rowIdx) {
+        int y = starty + rowIdx;
+        memcpy(aim->getPixel(startx, y), this->getPixel(startx - pos.x, y - pos.y), rowSize);
+    });
 }
 
 void Bitmap::blit(BitmapPtr &aim, const Rectangle &sourceRectangle, const Rectangle &destinationRectangle) {
@@ -130,58 +221,302 @@ void Bitmap::blit(BitmapPtr &aim, const Rectangle &sourceRectangle, const Rectan
     assert(destX + destW <= aim->getW() && destY + destH <= aim->getH());
     assert(this->getBPP() == aim->getBPP());
 
-    for (int y = 0; y < sourceH - sourceY; ++y) {
-        int x = 0;
-        memcpy(
-                aim->getPixel(destX + x, destY + y), this->getPixel(sourceX + x, sourceY + y),
-                sourceW * (bpp / 8));
+    const size_t rowSize = size_t(sourceW) * size_t(bpp / 8);
+    parallelForRows(sourceH, rowSize * size_t(sourceH), [&](int y) {
+        memcpy(aim->getPixel(destX, destY + y), this->getPixel(sourceX, sourceY + y), rowSize);
+    });
+}
+
+void Bitmap::blitBlended(BitmapPtr &aim, const Point2 &pos) {
+    if (pos.x >= aim->w || pos.x+w <= 0 || pos.y >= aim->h || pos.y+h <= 0) {
+        return;
     }
+    if (bpp != 32 || aim->bpp != 32) {
+        Logfile::get()->writeError("Error in Bitmap::blitBlended: Only 32-bit bitmaps are supported.");
+        return;
+    }
+
+    int startx = clamp(pos.x, 0, aim->w-1);
+    int endx = clamp(pos.x+this->w-1, 0, aim->w-1);
+    int starty = clamp(pos.y, 0, aim->h-1);
+    int endy = clamp(pos.y+this->h-1, 0, aim->h-1);
+    const int numPixels = endx - startx + 1;
+    parallelForRows(endy - starty + 1, size_t(numPixels) * 4 * size_t(endy - starty + 1), [&](int rowIdx) {
+        int y = starty + rowIdx;
+        blendRowRgba8(aim->getPixel(startx, y), this->getPixel(startx - pos.x, y - pos.y), numPixels);
+    });
 }
 
 void Bitmap::colorize(Color color) {
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            Color oldColor = getPixelColor(x, y);
-            oldColor.setR(color.getR());
-            oldColor.setG(color.getG());
-            oldColor.setB(color.getB());
-            setPixelColor(x, y, oldColor);
-        }
+    if (bpp != 32) {
+        Logfile::get()->writeError("Error in Bitmap::colorize: Only 32-bit bitmaps are supported.");
+        return;
     }
+    const uint8_t colorData[4] = { color.getR(), color.getG(), color.getB(), 0 };
+    const uint8_t alphaMaskData[4] = { 0, 0, 0, 255 };
+    uint32_t colorRgb, alphaMask;
+    memcpy(&colorRgb, colorData, sizeof(uint32_t));
+    memcpy(&alphaMask, alphaMaskData, sizeof(uint32_t));
+    const size_t rowSize = size_t(w) * 4;
+    parallelForRows(h, rowSize * size_t(h), [&](int y) {
+        uint8_t* row = bitmap + size_t(y) * rowSize;
+        int x = 0;
+#ifdef SGL_BITMAP_USE_SSE2
+        const __m128i colorRgb128 = _mm_set1_epi32(int(colorRgb));
+        const __m128i alphaMask128 = _mm_set1_epi32(int(alphaMask));
+        for (; x + 4 <= w; x += 4) {
+            auto* pixels = reinterpret_cast<__m128i*>(row + x * 4);
+            _mm_storeu_si128(pixels, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(pixels), alphaMask128), colorRgb128));
+        }
+#endif
+        for (; x < w; x++) {
+            uint32_t pixel;
+            memcpy(&pixel, row + x * 4, sizeof(uint32_t));
+            pixel = (pixel & alphaMask) | colorRgb;
+            memcpy(row + x * 4, &pixel, sizeof(uint32_t));
+        }
+    });
 }
 
 BitmapPtr Bitmap::rotated(int degree) {
     BitmapPtr bitmap(new Bitmap);
 
+    if (degree != 90 && degree != 180 && degree != 270) {
+        return bitmap;
+    }
+    if (this->bpp != 32) {
+        Logfile::get()->writeError("Error in Bitmap::rotated: Only 32-bit bitmaps are supported.");
+        return bitmap;
+    }
+
+    // The destination rows are written in parallel; the source pixels are copied as 32-bit words. For 90 and 270
+    // degrees, blocks of destination rows are processed together, so whole cache lines of the source rows are used.
+    const auto* src = reinterpret_cast<const uint32_t*>(this->bitmap);
+    const size_t numBytes = size_t(w) * size_t(h) * 4;
+    const int blockSize = 16;
+    const int numBlocks = (w + blockSize - 1) / blockSize;
     if (degree == 90) {
         bitmap->allocate(h, w);
-        for (int x = 0; x < w; ++x) {
+        auto* dst = reinterpret_cast<uint32_t*>(bitmap->getPixels());
+        parallelForRows(numBlocks, numBytes, [&](int blockIdx) {
+            // (x,y) -> (y,w-x-1)
+            const int destYStart = blockIdx * blockSize;
+            const int destYEnd = std::min(destYStart + blockSize, w);
             for (int y = 0; y < h; ++y) {
-                // (x,y) -> (y,w-x-1)
-                bitmap->setPixelColor(y, w-x-1, getPixelColor(x,y));
+                const uint32_t* srcRow = src + size_t(y) * size_t(w);
+                for (int destY = destYStart; destY < destYEnd; ++destY) {
+                    dst[size_t(destY) * size_t(h) + size_t(y)] = srcRow[w - destY - 1];
+                }
             }
-        }
+        });
     } else if (degree == 180) {
         bitmap->allocate(w, h);
-        for (int x = 0; x < w; ++x) {
-            for (int y = 0; y < h; ++y) {
-                // (x,y) -> (w-x-1,h-y-1)
-                bitmap->setPixelColor(w-x-1, w-x-1, getPixelColor(x,y));
+        auto* dst = reinterpret_cast<uint32_t*>(bitmap->getPixels());
+        parallelForRows(h, numBytes, [&](int destY) {
+            // (x,y) -> (w-x-1,h-y-1)
+            const uint32_t* srcRow = src + size_t(h - destY - 1) * size_t(w);
+            uint32_t* dstRow = dst + size_t(destY) * size_t(w);
+            for (int x = 0; x < w; ++x) {
+                dstRow[w - x - 1] = srcRow[x];
             }
-        }
+        });
     } else if (degree == 270) {
         bitmap->allocate(h, w);
-        for (int x = 0; x < w; ++x) {
+        auto* dst = reinterpret_cast<uint32_t*>(bitmap->getPixels());
+        parallelForRows(numBlocks, numBytes, [&](int blockIdx) {
+            // (x,y) -> (h-y-1,x)
+            const int destYStart = blockIdx * blockSize;
+            const int destYEnd = std::min(destYStart + blockSize, w);
             for (int y = 0; y < h; ++y) {
-                // (x,y) -> (h-y-1,x)
-                bitmap->setPixelColor(h-y-1, x, getPixelColor(x,y));
+                const uint32_t* srcRow = src + size_t(y) * size_t(w);
+                for (int destY = destYStart; destY < destYEnd; ++destY) {
+                    dst[size_t(destY) * size_t(h) + size_t(h - y - 1)] = srcRow[destY];
+                }
             }
-        }
+        });
     }
 
     return bitmap;
 }
 
+static const float LANCZOS_RADIUS = 3.0f;
+
+static inline float evaluateResampleFilter(BitmapResampleFilter filter, float x) {
+    if (filter == BitmapResampleFilter::BOX) {
+        return x >= -0.5f && x < 0.5f ? 1.0f : 0.0f;
+    }
+    x = std::abs(x);
+    if (x < 1e-6f) {
+        return 1.0f;
+    }
+    if (x >= LANCZOS_RADIUS) {
+        return 0.0f;
+    }
+    float piX = sgl::PI * x;
+    return LANCZOS_RADIUS * std::sin(piX) * std::sin(piX / LANCZOS_RADIUS) / (piX * piX);
+}
+
+/**
+ * Normalized filter taps of a separable resampling pass from srcSize to dstSize pixels. The weights of taps outside of
+ * the image are added to the edge pixels (clamp-to-edge), so no bounds checks are necessary when filtering.
+ */
+struct ResampleWeights {
+    int maxNumTaps = 0;
+    std::vector<int> firstIndices, numTaps;
+    std::vector<float> weights; ///< maxNumTaps weights per destination pixel.
+};
+
+static void computeResampleWeights(
+        int srcSize, int dstSize, BitmapResampleFilter filter, ResampleWeights& resampleWeights) {
+    const float scale = float(srcSize) / float(dstSize);
+    // When downsampling, the filter is stretched to cover all contributing source pixels.
+    const float filterScale = std::max(scale, 1.0f);
+    const float radius = (filter == BitmapResampleFilter::BOX ? 0.5f : LANCZOS_RADIUS) * filterScale;
+    const int maxNumTaps = int(std::ceil(radius * 2.0f)) + 1;
+    resampleWeights.maxNumTaps = maxNumTaps;
+    resampleWeights.firstIndices.resize(dstSize);
+    resampleWeights.numTaps.resize(dstSize);
+    resampleWeights.weights.assign(size_t(dstSize) * size_t(maxNumTaps), 0.0f);
+    for (int dstIdx = 0; dstIdx < dstSize; dstIdx++) {
+        float center = (float(dstIdx) + 0.5f) * scale - 0.5f;
+        int first = int(std::ceil(center - radius));
+        int last = std::min(int(std::floor(center + radius)), first + maxNumTaps - 1);
+        int firstClamped = clamp(first, 0, srcSize - 1);
+        int lastClamped = clamp(last, 0, srcSize - 1);
+        float* weights = resampleWeights.weights.data() + size_t(dstIdx) * size_t(maxNumTaps);
+        float weightSum = 0.0f;
+        for (int srcIdx = first; srcIdx <= last; srcIdx++) {
+            float weight = evaluateResampleFilter(filter, (float(srcIdx) - center) / filterScale);
+            weights[clamp(srcIdx, 0, srcSize - 1) - firstClamped] += weight;
+            weightSum += weight;
+        }
+        if (weightSum != 0.0f) {
+            for (int i = 0; i <= lastClamped - firstClamped; i++) {
+                weights[i] /= weightSum;
+            }
+        }
+        resampleWeights.firstIndices[dstIdx] = firstClamped;
+        resampleWeights.numTaps[dstIdx] = lastClamped - firstClamped + 1;
+    }
+}
+
+// Filters one row of RGBA float pixels horizontally.
+static void resampleRowHorizontal(const float* srcRow, float* dstRow, int dstWidth, const ResampleWeights& weights) {
+    for (int dstX = 0; dstX < dstWidth; dstX++) {
+        const float* srcPixels = srcRow + size_t(weights.firstIndices[dstX]) * 4;
+        const float* tapWeights = weights.weights.data() + size_t(dstX) * size_t(weights.maxNumTaps);
+        const int numTaps = weights.numTaps[dstX];
+#ifdef SGL_BITMAP_USE_SSE2
+        __m128 sum = _mm_setzero_ps();
+        for (int i = 0; i < numTaps; i++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(tapWeights[i]), _mm_loadu_ps(srcPixels + i * 4)));
+        }
+        _mm_storeu_ps(dstRow + dstX * 4, sum);
+#else
+        float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (int i = 0; i < numTaps; i++) {
+            for (int c = 0; c < 4; c++) {
+                sum[c] += tapWeights[i] * srcPixels[i * 4 + c];
+            }
+        }
+        for (int c = 0; c < 4; c++) {
+            dstRow[dstX * 4 + c] = sum[c];
+        }
+#endif
+    }
+}
+
+BitmapPtr Bitmap::resized(int newWidth, int newHeight, BitmapResampleFilter filter) const {
+    if (bpp != 32) {
+        Logfile::get()->writeError("Error in Bitmap::resized: Only 32-bit bitmaps are supported.");
+        return {};
+    }
+    if (w <= 0 || h <= 0 || newWidth <= 0 || newHeight <= 0) {
+        Logfile::get()->writeError("Error in Bitmap::resized: Invalid bitmap size.");
+        return {};
+    }
+
+    ResampleWeights horizontalWeights, verticalWeights;
+    computeResampleWeights(w, newWidth, filter, horizontalWeights);
+    computeResampleWeights(h, newHeight, filter, verticalWeights);
+
+    /*
+     * The destination rows are processed in blocks. For each block, the source rows it depends on are filtered
+     * horizontally into a temporary buffer, which is then filtered vertically. The filtering is done with premultiplied
+     * alpha, so that the color of transparent pixels does not bleed into their neighbors.
+     */
+    const int blockSize = 32;
+    const int numBlocks = (newHeight + blockSize - 1) / blockSize;
+    const size_t tmpRowSize = size_t(newWidth) * 4;
+    BitmapPtr resizedBitmap(new Bitmap(newWidth, newHeight, 32));
+    parallelForRows(numBlocks, size_t(w) * size_t(h) * 4, [&](int blockIdx) {
+        const int dstYStart = blockIdx * blockSize;
+        const int dstYEnd = std::min(dstYStart + blockSize, newHeight);
+        const int srcYStart = verticalWeights.firstIndices[dstYStart];
+        int srcYEnd = srcYStart;
+        for (int dstY = dstYStart; dstY < dstYEnd; dstY++) {
+            srcYEnd = std::max(srcYEnd, verticalWeights.firstIndices[dstY] + verticalWeights.numTaps[dstY]);
+        }
+
+        std::vector<float> srcRow(size_t(w) * 4);
+        std::vector<float> tmpRows(tmpRowSize * size_t(srcYEnd - srcYStart));
+        for (int srcY = srcYStart; srcY < srcYEnd; srcY++) {
+            const uint8_t* srcPixels = getPixelConst(0, srcY);
+            for (int x = 0; x < w; x++) {
+                float alpha = float(srcPixels[x * 4 + 3]) * (1.0f / 255.0f);
+                srcRow[x * 4] = float(srcPixels[x * 4]) * alpha;
+                srcRow[x * 4 + 1] = float(srcPixels[x * 4 + 1]) * alpha;
+                srcRow[x * 4 + 2] = float(srcPixels[x * 4 + 2]) * alpha;
+                srcRow[x * 4 + 3] = float(srcPixels[x * 4 + 3]);
+            }
+            resampleRowHorizontal(
+                    srcRow.data(), tmpRows.data() + size_t(srcY - srcYStart) * tmpRowSize,
+                    newWidth, horizontalWeights);
+        }
+
+        std::vector<float> sumRow(tmpRowSize);
+        for (int dstY = dstYStart; dstY < dstYEnd; dstY++) {
+            std::fill(sumRow.begin(), sumRow.end(), 0.0f);
+            const int first = verticalWeights.firstIndices[dstY];
+            const int numTaps = verticalWeights.numTaps[dstY];
+            const float* weights =
+                    verticalWeights.weights.data() + size_t(dstY) * size_t(verticalWeights.maxNumTaps);
+            for (int i = 0; i < numTaps; i++) {
+                const float weight = weights[i];
+                const float* tmpRow = tmpRows.data() + size_t(first + i - srcYStart) * tmpRowSize;
+                for (size_t j = 0; j < tmpRowSize; j++) {
+                    sumRow[j] += weight * tmpRow[j];
+                }
+            }
+            uint8_t* dstPixels = resizedBitmap->getPixel(0, dstY);
+            for (int x = 0; x < newWidth; x++) {
+                float alpha = std::clamp(sumRow[x * 4 + 3], 0.0f, 255.0f);
+                float invAlpha = alpha > 0.0f ? 255.0f / alpha : 0.0f;
+                for (int c = 0; c < 3; c++) {
+                    dstPixels[x * 4 + c] = uint8_t(std::clamp(sumRow[x * 4 + c] * invAlpha, 0.0f, 255.0f) + 0.5f);
+                }
+                dstPixels[x * 4 + 3] = uint8_t(alpha + 0.5f);
+            }
+        }
+    });
+    return resizedBitmap;
+}
+
+std::vector<BitmapPtr> Bitmap::generateMipChain(BitmapResampleFilter filter) const {
+    std::vector<BitmapPtr> mipLevels;
+    const Bitmap* levelBitmap = this;
+    while (levelBitmap->w > 1 || levelBitmap->h > 1) {
+        BitmapPtr nextLevel = levelBitmap->resized(
+                std::max(levelBitmap->w / 2, 1), std::max(levelBitmap->h / 2, 1), filter);
+        if (!nextLevel) {
+            break;
+        }
+        mipLevels.push_back(nextLevel);
+        levelBitmap = nextLevel.get();
+    }
+    return mipLevels;
+}
+
 void Bitmap::fromFile(const char *filename) {
 #ifdef USE_LIBPNG
     png_byte header[8];
@@ -450,12 +785,11 @@ void Bitmap::blendPixelColor(int x, int y, const Color &color) {
     int a = color.getA();
     int ia = 255 - a;
 
-    Color destCol = getPixelColor(x, y);
-    int destr = ((int)color.getR() * a) / 255 + ((int)destCol.getR() * ia) / 255;
-    int destg = ((int)color.getG() * a) / 255 + ((int)destCol.getG() * ia) / 255;
-    int destb = ((int)color.getB() * a) / 255 + ((int)destCol.getB() * ia) / 255;
-    int desta = a + ((int)destCol.getA() * ia) / 255;
-    setPixelColor(x, y, Color(destr, destg, destb, desta));
+    uint8_t *pixels = getPixel(x, y);
+    pixels[0] = uint8_t(div255(int(color.getR()) * a) + div255(int(pixels[0]) * ia));
+    pixels[1] = uint8_t(div255(int(color.getG()) * a) + div255(int(pixels[1]) * ia));
+    pixels[2] = uint8_t(div255(int(color.getB()) * a) + div255(int(pixels[2]) * ia));
+    pixels[3] = uint8_t(a + div255(int(pixels[3]) * ia));
 }
 
 
@@ -486,11 +820,28 @@ void Bitmap::blendPixelFloor(BitmapPtr &img, int sourceX, int sourceY, int destX
 }
 
 void Bitmap::blitWrap(BitmapPtr &img, int x, int y) {
-    for (int sourceY = 0; sourceY < img->getHeight(); ++sourceY) {
-        int destY = sourceY + y;
-        for (int sourceX = 0; sourceX < img->getWidth(); ++sourceX) {
-            int destX = sourceX + x;
-            blendPixelFloor(img, sourceX, sourceY, destX, destY);
+    if (bpp != 32 || img->bpp != 32) {
+        Logfile::get()->writeError("Error in Bitmap::blitWrap: Only 32-bit bitmaps are supported.");
+        return;
+    }
+
+    // Blends the source rows in segments that do not wrap around. Source rows may only be processed in parallel if
+    // no two of them wrap to the same destination row.
+    auto blendSourceRow = [&](int sourceY) {
+        int destY = floorMod(sourceY + y, h);
+        int sourceX = 0;
+        while (sourceX < img->w) {
+            int destX = floorMod(sourceX + x, w);
+            int numPixels = std::min(img->w - sourceX, w - destX);
+            blendRowRgba8(getPixel(destX, destY), img->getPixel(sourceX, sourceY), numPixels);
+            sourceX += numPixels;
+        }
+    };
+    if (img->h <= h) {
+        parallelForRows(img->h, size_t(img->w) * size_t(img->h) * 4, blendSourceRow);
+    } else {
+        for (int sourceY = 0; sourceY < img->h; ++sourceY) {
+            blendSourceRow(sourceY);
         }
     }
 }
@@ -30,6 +30,7 @@
 #define BITMAP_HPP_
 
 #include <string>
+#include <vector>
 #include <memory>
 #include <cstdint>
 #include <cassert>
@@ -43,6 +44,10 @@ class Rectangle;
 class Bitmap;
 typedef std::shared_ptr<Bitmap> BitmapPtr;
 
+enum class BitmapResampleFilter {
+    BOX, LANCZOS3
+};
+
 /// For now only a bit-depth of 32-bit is properly supported!
 class DLL_OBJECT Bitmap {
 public:
@@ -64,10 +69,19 @@ public:
     /// Operations on pixel data
     void blit(BitmapPtr &aim, const Point2 &pos);
     void blit(BitmapPtr &aim, const Rectangle &sourceRectangle, const Rectangle &destinationRectangle);
+    /// Alpha-blends this bitmap onto 'aim' (same blending as @see blendPixelColor).
+    void blitBlended(BitmapPtr &aim, const Point2 &pos);
     void colorize(Color color);
     /// 90, 180 or 270
     BitmapPtr rotated(int degree);
 
+    /// Resampling with a separable filter in premultiplied alpha. Only 32-bit bitmaps are supported.
+    [[nodiscard]] BitmapPtr resized(
+            int newWidth, int newHeight, BitmapResampleFilter filter = BitmapResampleFilter::LANCZOS3) const;
+    /// Returns the mip levels 1 to n (i.e., excluding this bitmap as the base level) down to a size of 1x1.
+    [[nodiscard]] std::vector<BitmapPtr> generateMipChain(
+            BitmapResampleFilter filter = BitmapResampleFilter::BOX) const;
+
     /// Floor operations
     void floorPixelPosition(int& x, int& y);
     void setPixelFloor(Color col, int x, int y);
@@ -0,0 +1,577 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _FILE_OFFSET_BITS 64
+#define __USE_FILE_OFFSET64
+
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+#include <Utils/StringUtils.hpp>
+#include <Utils/File/Logfile.hpp>
+#ifdef USE_LIBPNG
+#include <Utils/File/Zlib.hpp>
+#endif
+
+#include "TextureContainer.hpp"
+
+namespace sgl {
+
+uint32_t getTextureContainerFormatBlockSize(TextureContainerFormat format) {
+    switch (format) {
+        case TextureContainerFormat::R8_UNORM:
+            return 1;
+        case TextureContainerFormat::R8G8_UNORM:
+        case TextureContainerFormat::R16_UNORM:
+        case TextureContainerFormat::R16_SFLOAT:
+            return 2;
+        case TextureContainerFormat::R8G8B8A8_UNORM:
+        case TextureContainerFormat::R8G8B8A8_SRGB:
+        case TextureContainerFormat::B8G8R8A8_UNORM:
+        case TextureContainerFormat::B8G8R8A8_SRGB:
+        case TextureContainerFormat::R16G16_SFLOAT:
+        case TextureContainerFormat::R32_SFLOAT:
+            return 4;
+        case TextureContainerFormat::R16G16B16A16_UNORM:
+        case TextureContainerFormat::R16G16B16A16_SFLOAT:
+        case TextureContainerFormat::R32G32_SFLOAT:
+        case TextureContainerFormat::BC1_RGB_UNORM_BLOCK:
+        case TextureContainerFormat::BC1_RGB_SRGB_BLOCK:
+        case TextureContainerFormat::BC1_RGBA_UNORM_BLOCK:
+        case TextureContainerFormat::BC1_RGBA_SRGB_BLOCK:
+        case TextureContainerFormat::BC4_UNORM_BLOCK:
+        case TextureContainerFormat::BC4_SNORM_BLOCK:
+            return 8;
+        case TextureContainerFormat::R32G32B32A32_SFLOAT:
+        case TextureContainerFormat::BC2_UNORM_BLOCK:
+        case TextureContainerFormat::BC2_SRGB_BLOCK:
+        case TextureContainerFormat::BC3_UNORM_BLOCK:
+        case TextureContainerFormat::BC3_SRGB_BLOCK:
+        case TextureContainerFormat::BC5_UNORM_BLOCK:
+        case TextureContainerFormat::BC5_SNORM_BLOCK:
+        case TextureContainerFormat::BC6H_UFLOAT_BLOCK:
+        case TextureContainerFormat::BC6H_SFLOAT_BLOCK:
+        case TextureContainerFormat::BC7_UNORM_BLOCK:
+        case TextureContainerFormat::BC7_SRGB_BLOCK:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool getIsTextureContainerFormatCompressed(TextureContainerFormat format) {
+    return uint32_t(format) >= uint32_t(TextureContainerFormat::BC1_RGB_UNORM_BLOCK)
+            && uint32_t(format) <= uint32_t(TextureContainerFormat::BC7_SRGB_BLOCK);
+}
+
+template<class T>
+static inline T readValue(const uint8_t* data, size_t offset) {
+    T value;
+    memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+static inline uint32_t makeFourCC(char c0, char c1, char c2, char c3) {
+    return uint32_t(uint8_t(c0)) | (uint32_t(uint8_t(c1)) << 8u)
+            | (uint32_t(uint8_t(c2)) << 16u) | (uint32_t(uint8_t(c3)) << 24u);
+}
+
+static const uint8_t KTX2_IDENTIFIER[12] = {
+        0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+};
+const uint32_t KTX2_SUPERCOMPRESSION_NONE = 0;
+const uint32_t KTX2_SUPERCOMPRESSION_ZLIB = 3;
+
+const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+const uint32_t DDSD_DEPTH = 0x800000;
+const uint32_t DDPF_ALPHAPIXELS = 0x1;
+const uint32_t DDPF_FOURCC = 0x4;
+const uint32_t DDPF_RGB = 0x40;
+const uint32_t DDPF_LUMINANCE = 0x20000;
+const uint32_t DDSCAPS2_CUBEMAP = 0x200;
+const uint32_t DDSCAPS2_CUBEMAP_ALLFACES = 0xFC00;
+const uint32_t DDSCAPS2_VOLUME = 0x200000;
+const uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+
+static TextureContainerFormat convertDxgiFormat(uint32_t dxgiFormat) {
+    switch (dxgiFormat) {
+        case 2: return TextureContainerFormat::R32G32B32A32_SFLOAT;
+        case 10: return TextureContainerFormat::R16G16B16A16_SFLOAT;
+        case 11: return TextureContainerFormat::R16G16B16A16_UNORM;
+        case 16: return TextureContainerFormat::R32G32_SFLOAT;
+        case 28: return TextureContainerFormat::R8G8B8A8_UNORM;
+        case 29: return TextureContainerFormat::R8G8B8A8_SRGB;
+        case 34: return TextureContainerFormat::R16G16_SFLOAT;
+        case 41: return TextureContainerFormat::R32_SFLOAT;
+        case 49: return TextureContainerFormat::R8G8_UNORM;
+        case 54: return TextureContainerFormat::R16_SFLOAT;
+        case 56: return TextureContainerFormat::R16_UNORM;
+        case 61: return TextureContainerFormat::R8_UNORM;
+        case 71: return TextureContainerFormat::BC1_RGBA_UNORM_BLOCK;
+        case 72: return TextureContainerFormat::BC1_RGBA_SRGB_BLOCK;
+        case 74: return TextureContainerFormat::BC2_UNORM_BLOCK;
+        case 75: return TextureContainerFormat::BC2_SRGB_BLOCK;
+        case 77: return TextureContainerFormat::BC3_UNORM_BLOCK;
+        case 78: return TextureContainerFormat::BC3_SRGB_BLOCK;
+        case 80: return TextureContainerFormat::BC4_UNORM_BLOCK;
+        case 81: return TextureContainerFormat::BC4_SNORM_BLOCK;
+        case 83: return TextureContainerFormat::BC5_UNORM_BLOCK;
+        case 84: return TextureContainerFormat::BC5_SNORM_BLOCK;
+        case 87: return TextureContainerFormat::B8G8R8A8_UNORM;
+        case 91: return TextureContainerFormat::B8G8R8A8_SRGB;
+        case 95: return TextureContainerFormat::BC6H_UFLOAT_BLOCK;
+        case 96: return TextureContainerFormat::BC6H_SFLOAT_BLOCK;
+        case 98: return TextureContainerFormat::BC7_UNORM_BLOCK;
+        case 99: return TextureContainerFormat::BC7_SRGB_BLOCK;
+        default: return TextureContainerFormat::UNDEFINED;
+    }
+}
+
+static TextureContainerFormat convertDdsPixelFormat(
+        uint32_t flags, uint32_t fourCC, uint32_t rgbBitCount,
+        uint32_t rMask, uint32_t gMask, uint32_t bMask, uint32_t aMask) {
+    if ((flags & DDPF_FOURCC) != 0) {
+        if (fourCC == makeFourCC('D', 'X', 'T', '1')) {
+            return TextureContainerFormat::BC1_RGBA_UNORM_BLOCK;
+        } else if (fourCC == makeFourCC('D', 'X', 'T', '2') || fourCC == makeFourCC('D', 'X', 'T', '3')) {
+            return TextureContainerFormat::BC2_UNORM_BLOCK;
+        } else if (fourCC == makeFourCC('D', 'X', 'T', '4') || fourCC == makeFourCC('D', 'X', 'T', '5')) {
+            return TextureContainerFormat::BC3_UNORM_BLOCK;
+        } else if (fourCC == makeFourCC('A', 'T', 'I', '1') || fourCC == makeFourCC('B', 'C', '4', 'U')) {
+            return TextureContainerFormat::BC4_UNORM_BLOCK;
+        } else if (fourCC == makeFourCC('B', 'C', '4', 'S')) {
+            return TextureContainerFormat::BC4_SNORM_BLOCK;
+        } else if (fourCC == makeFourCC('A', 'T', 'I', '2') || fourCC == makeFourCC('B', 'C', '5', 'U')) {
+            return TextureContainerFormat::BC5_UNORM_BLOCK;
+        } else if (fourCC == makeFourCC('B', 'C', '5', 'S')) {
+            return TextureContainerFormat::BC5_SNORM_BLOCK;
+        }
+        // D3DFORMAT values stored directly in the FourCC field.
+        switch (fourCC) {
+            case 36: return TextureContainerFormat::R16G16B16A16_UNORM;
+            case 111: return TextureContainerFormat::R16_SFLOAT;
+            case 112: return TextureContainerFormat::R16G16_SFLOAT;
+            case 113: return TextureContainerFormat::R16G16B16A16_SFLOAT;
+            case 114: return TextureContainerFormat::R32_SFLOAT;
+            case 115: return TextureContainerFormat::R32G32_SFLOAT;
+            case 116: return TextureContainerFormat::R32G32B32A32_SFLOAT;
+            default: return TextureContainerFormat::UNDEFINED;
+        }
+    }
+    if ((flags & DDPF_RGB) != 0 && (flags & DDPF_ALPHAPIXELS) != 0 && rgbBitCount == 32) {
+        if (rMask == 0xFFu && gMask == 0xFF00u && bMask == 0xFF0000u && aMask == 0xFF000000u) {
+            return TextureContainerFormat::R8G8B8A8_UNORM;
+        }
+        if (rMask == 0xFF0000u && gMask == 0xFF00u && bMask == 0xFFu && aMask == 0xFF000000u) {
+            return TextureContainerFormat::B8G8R8A8_UNORM;
+        }
+    }
+    if ((flags & DDPF_LUMINANCE) != 0 && rgbBitCount == 8 && rMask == 0xFFu) {
+        return TextureContainerFormat::R8_UNORM;
+    }
+    if ((flags & DDPF_LUMINANCE) != 0 && rgbBitCount == 16 && rMask == 0xFFFFu) {
+        return TextureContainerFormat::R16_UNORM;
+    }
+    return TextureContainerFormat::UNDEFINED;
+}
+
+
+TextureContainer::~TextureContainer() {
+    close();
+}
+
+bool TextureContainer::getIsTextureContainerFilename(const std::string& filename) {
+    std::string filenameLower = sgl::toLowerCopy(filename);
+    return sgl::endsWith(filenameLower, ".ktx2") || sgl::endsWith(filenameLower, ".dds");
+}
+
+bool TextureContainer::open(const std::string& _filename) {
+    close();
+    filename = _filename;
+
+#if defined(__linux__) || defined(__MINGW32__)
+    file = fopen64(filename.c_str(), "rb");
+    if (!file) {
+#elif defined(_MSC_VER)
+    if (fopen_s(&file, filename.c_str(), "rb") != 0) {
+        file = nullptr;
+#else
+    file = fopen(filename.c_str(), "rb");
+    if (!file) {
+#endif
+        Logfile::get()->writeError(
+                "Error in TextureContainer::open: File \"" + filename + "\" could not be opened.");
+        return false;
+    }
+
+    uint8_t identifier[12];
+    bool isValid = false;
+    if (readFile(0, identifier, sizeof(identifier))) {
+        if (memcmp(identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0) {
+            isValid = parseKtx2();
+        } else if (memcmp(identifier, "DDS ", 4) == 0) {
+            isValid = parseDds();
+        } else {
+            Logfile::get()->writeError(
+                    "Error in TextureContainer::open: File \"" + filename + "\" is neither a KTX2 nor a DDS file.");
+        }
+    }
+
+    uint64_t fileSize = 0;
+    if (isValid && getFileSize(fileSize)) {
+        for (const FileRegion& fileRegion : fileRegions) {
+            if (fileRegion.fileSize > fileSize || fileRegion.fileOffset > fileSize - fileRegion.fileSize) {
+                Logfile::get()->writeError(
+                        "Error in TextureContainer::open: File \"" + filename + "\" is truncated.");
+                isValid = false;
+                break;
+            }
+        }
+    }
+
+    if (!isValid) {
+        close();
+    }
+    return isValid;
+}
+
+void TextureContainer::close() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    format = TextureContainerFormat::UNDEFINED;
+    numDimensions = 2;
+    numArrayLayers = 1;
+    isArray = false;
+    numFaces = 1;
+    levels.clear();
+    fileRegions.clear();
+    dataSize = 0;
+}
+
+bool TextureContainer::readFile(uint64_t offset, void* dst, size_t size) {
+#if defined(_WIN32) && !defined(__MINGW32__)
+    int seekResult = _fseeki64(file, int64_t(offset), SEEK_SET);
+#else
+    int seekResult = fseeko(file, off_t(offset), SEEK_SET);
+#endif
+    if (seekResult != 0 || fread(dst, 1, size, file) != size) {
+        Logfile::get()->writeError(
+                "Error in TextureContainer::readFile: Could not read from file \"" + filename + "\".");
+        return false;
+    }
+    return true;
+}
+
+bool TextureContainer::getFileSize(uint64_t& size) {
+#if defined(_WIN32) && !defined(__MINGW32__)
+    _fseeki64(file, 0, SEEK_END);
+    int64_t fileSize = _ftelli64(file);
+#else
+    fseeko(file, 0, SEEK_END);
+    int64_t fileSize = ftello(file);
+#endif
+    if (fileSize < 0) {
+        return false;
+    }
+    size = uint64_t(fileSize);
+    return true;
+}
+
+/// Computes value *= factor and returns false if the product does not fit into size_t.
+static bool multiplySizeChecked(size_t& value, size_t factor) {
+    if (factor != 0 && value > std::numeric_limits<size_t>::max() / factor) {
+        return false;
+    }
+    value *= factor;
+    return true;
+}
+
+bool TextureContainer::computeLevels(uint32_t width, uint32_t height, uint32_t depth, uint32_t numMipLevels) {
+    const uint32_t blockSize = getTextureContainerFormatBlockSize(format);
+    if (blockSize == 0) {
+        Logfile::get()->writeError(
+                "Error in TextureContainer::computeLevels: Unsupported texel format "
+                + std::to_string(uint32_t(format)) + " in file \"" + filename + "\".");
+        return false;
+    }
+    // A full mip chain has floor(log2(max(width, height, depth))) + 1 levels.
+    uint32_t maxNumMipLevels = 1;
+    for (uint32_t maxDim = std::max(width, std::max(height, depth)); maxDim > 1; maxDim >>= 1) {
+        maxNumMipLevels++;
+    }
+    if (width == 0 || height == 0 || depth == 0 || numMipLevels == 0 || numMipLevels > maxNumMipLevels
+            || numArrayLayers == 0 || (numFaces != 1 && numFaces != 6)
+            || uint64_t(numArrayLayers) * uint64_t(numFaces) > uint64_t(std::numeric_limits<uint32_t>::max())) {
+        Logfile::get()->writeError(
+                "Error in TextureContainer::computeLevels: Invalid texture dimensions in file \"" + filename + "\".");
+        return false;
+    }
+
+    const uint32_t blockDim = getIsTextureContainerFormatCompressed(format) ? 4 : 1;
+    levels.resize(numMipLevels);
+    dataSize = 0;
+    for (uint32_t level = 0; level < numMipLevels; level++) {
+        TextureContainerLevel& levelInfo = levels.at(level);
+        levelInfo.width = std::max(width >> level, 1u);
+        levelInfo.height = std::max(height >> level, 1u);
+        levelInfo.depth = std::max(depth >> level, 1u);
+        size_t numBlocksX = (size_t(levelInfo.width) + blockDim - 1) / blockDim;
+        size_t numBlocksY = (size_t(levelInfo.height) + blockDim - 1) / blockDim;
+        size_t levelSize = numBlocksX;
+        // Vulkan needs buffer offsets aligned to 4 bytes and the texel block size.
+        const size_t alignment = 16;
+        if (!multiplySizeChecked(levelSize, numBlocksY)
+                || !multiplySizeChecked(levelSize, levelInfo.depth)
+                || !multiplySizeChecked(levelSize, blockSize)
+                || !multiplySizeChecked(levelSize, numArrayLayers)
+                || !multiplySizeChecked(levelSize, numFaces)
+                || dataSize > std::numeric_limits<size_t>::max() - (alignment - 1)
+                || levelSize > std::numeric_limits<size_t>::max() - (dataSize + alignment - 1) / alignment * alignment) {
+            Logfile::get()->writeError(
+                    "Error in TextureContainer::computeLevels: The texture size overflows in file \""
+                    + filename + "\".");
+            levels.clear();
+            dataSize = 0;
+            return false;
+        }
+        levelInfo.size = levelSize;
+        levelInfo.offset = (dataSize + alignment - 1) / alignment * alignment;
+        dataSize = levelInfo.offset + levelInfo.size;
+    }
+    return true;
+}
+
+bool TextureContainer::parseKtx2() {
+    const size_t headerSize = 80;
+    uint8_t header[headerSize];
+    if (!readFile(0, header, headerSize)) {
+        return false;
+    }
+
+    auto vkFormat = readValue<uint32_t>(header, 12);
+    auto pixelWidth = readValue<uint32_t>(header, 20);
+    auto pixelHeight = readValue<uint32_t>(header, 24);
+    auto pixelDepth = readValue<uint32_t>(header, 28);
+    auto layerCount = readValue<uint32_t>(header, 32);
+    auto faceCount = readValue<uint32_t>(header, 36);
+    auto levelCount = readValue<uint32_t>(header, 40);
+    auto supercompressionScheme = readValue<uint32_t>(header, 44);
+
+    bool isZlibCompressed = supercompressionScheme == KTX2_SUPERCOMPRESSION_ZLIB;
+#ifndef USE_LIBPNG
+    if (isZlibCompressed) {
+        Logfile::get()->writeError(
+                "Error in TextureContainer::parseKtx2: zlib supercompression is not supported, as sgl was built "
+                "without zlib (file: \"" + filename + "\").");
+        return false;
+    }
+#endif
+    if (supercompressionScheme != KTX2_SUPERCOMPRESSION_NONE && !isZlibCompressed) {
+        Logfile::get()->writeError(
+                "Error in TextureContainer::parseKtx2: Unsupported supercompression scheme "
+                + std::to_string(supercompressionScheme) + " in file \"" + filename + "\".");
+        return false;
+    }
+
+    format = TextureContainerFormat(vkFormat);
+    numDimensions = pixelDepth > 0 ? 3 : (pixelHeight > 0 ? 2 : 1);
+    isArray = layerCount > 0;
+    numArrayLayers = std::max(layerCount, 1u);
+    numFaces = faceCount;
+    // A level count of zero means that the application should generate the mip chain.
+    if (!computeLevels(
+            pixelWidth, std::max(pixelHeight, 1u), std::max(pixelDepth, 1u), std::max(levelCount, 1u))) {
+        return false;
+    }
+
+    const size_t levelIndexEntrySize = 3 * sizeof(uint64_t);
+    std::vector<uint8_t> levelIndex(levels.size() * levelIndexEntrySize);
+    if (!readFile(headerSize, levelIndex.data(), levelIndex.size())) {
+        return false;
+    }
+    for (size_t level = 0; level < levels.size(); level++) {
+        const TextureContainerLevel& levelInfo = levels.at(level);
+        auto byteOffset = readValue<uint64_t>(levelIndex.data(), level * levelIndexEntrySize);
+        auto byteLength = readValue<uint64_t>(levelIndex.data(), level * levelIndexEntrySize + 8);
+        auto uncompressedByteLength = readValue<uint64_t>(levelIndex.data(), level * levelIndexEntrySize + 16);
+        if ((isZlibCompressed && uncompressedByteLength != levelInfo.size)
+                || (!isZlibCompressed && byteLength < levelInfo.size)) {
+            Logfile::get()->writeError(
+                    "Error in TextureContainer::parseKtx2: Invalid size of level " + std::to_string(level)
+                    + " in file \"" + filename + "\".");
+            return false;
+        }
+        FileRegion fileRegion;
+        fileRegion.fileOffset = byteOffset;
+        fileRegion.fileSize = isZlibCompressed ? byteLength : levelInfo.size;
+        fileRegion.dataOffset = levelInfo.offset;
+        fileRegion.dataSize = levelInfo.size;
+        fileRegion.isZlibCompressed = isZlibCompressed;
+        fileRegions.push_back(fileRegion);
+    }
+
+    return true;
+}
+
+bool TextureContainer::parseDds() {
+    // Magic number followed by DDS_HEADER.
+    const size_t headerSize = 128;
+    uint8_t header[headerSize];
+    if (!readFile(0, header, headerSize)) {
+        return false;
+    }
+
+    auto flags = readValue<uint32_t>(header, 8);
+    auto height = readValue<uint32_t>(header, 12);
+    auto width = readValue<uint32_t>(header, 16);
+    auto depth = readValue<uint32_t>(header, 24);
+    auto mipMapCount = readValue<uint32_t>(header, 28);
+    auto pixelFormatFlags = readValue<uint32_t>(header, 80);
+    auto fourCC = readValue<uint32_t>(header, 84);
+    auto caps2 = readValue<uint32_t>(header, 112);
+
+    uint64_t dataFileOffset = headerSize;
+    if ((pixelFormatFlags & DDPF_FOURCC) != 0 && fourCC == makeFourCC('D', 'X', '1', '0')) {
+        // DDS_HEADER_DXT10
+        uint8_t headerDx10[20];
+        if (!readFile(headerSize, headerDx10, sizeof(headerDx10))) {
+            return false;
+        }
+        dataFileOffset += sizeof(headerDx10);
+        auto dxgiFormat = readValue<uint32_t>(headerDx10, 0);
+        auto resourceDimension = readValue<uint32_t>(headerDx10, 4);
+        auto miscFlag = readValue<uint32_t>(headerDx10, 8);
+        auto arraySize = readValue<uint32_t>(headerDx10, 12);
+        format = convertDxgiFormat(dxgiFormat);
+        if (format == TextureContainerFormat::UNDEFINED) {
+            Logfile::get()->writeError(
+                    "Error in TextureContainer::parseDds: Unsupported DXGI format " + std::to_string(dxgiFormat)
+                    + " in file \"" + filename + "\".");
+            return false;
+        }
+        // D3D10_RESOURCE_DIMENSION_TEXTURE1D/2D/3D = 2/3/4.
+        numDimensions = resourceDimension == 2 ? 1 : (resourceDimension == 4 ? 3 : 2);
+        numFaces = (miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) != 0 ? 6 : 1;
+        numArrayLayers = arraySize;
+        isArray = arraySize > 1;
+    } else {
+        format = convertDdsPixelFormat(
+                pixelFormatFlags, fourCC, readValue<uint32_t>(header, 88), readValue<uint32_t>(header, 92),
+                readValue<uint32_t>(header, 96), readValue<uint32_t>(header, 100), readValue<uint32_t>(header, 104));
+        if (format == TextureContainerFormat::UNDEFINED) {
+            Logfile::get()->writeError(
+                    "Error in TextureContainer::parseDds: Unsupported pixel format in file \"" + filename + "\".");
+            return false;
+        }
+        if ((caps2 & DDSCAPS2_CUBEMAP) != 0) {
+            if ((caps2 & DDSCAPS2_CUBEMAP_ALLFACES) != DDSCAPS2_CUBEMAP_ALLFACES) {
+                Logfile::get()->writeError(
+                        "Error in TextureContainer::parseDds: Cube maps with missing faces are not supported "
+                        "(file: \"" + filename + "\").");
+                return false;
+            }
+            numFaces = 6;
+        }
+        if ((caps2 & DDSCAPS2_VOLUME) != 0 && (flags & DDSD_DEPTH) != 0) {
+            numDimensions = 3;
+        }
+    }
+    if (numDimensions != 3) {
+        depth = 1;
+    }
+    if (numDimensions == 1) {
+        height = 1;
+    }
+
+    uint32_t numMipLevels = (flags & DDSD_MIPMAPCOUNT) != 0 ? std::max(mipMapCount, 1u) : 1u;
+    if (!computeLevels(width, height, depth, numMipLevels)) {
+        return false;
+    }
+
+    // Reject truncated files before creating one file region per slice and level (the array size is untrusted).
+    // The level sizes cannot overflow, as their aligned sum (dataSize) fits into size_t.
+    uint64_t fileSize = 0;
+    uint64_t dataFileSize = 0;
+    for (const TextureContainerLevel& levelInfo : levels) {
+        dataFileSize += levelInfo.size;
+    }
+    if (!getFileSize(fileSize) || dataFileOffset > fileSize || dataFileSize > fileSize - dataFileOffset) {
+        Logfile::get()->writeError("Error in TextureContainer::parseDds: File \"" + filename + "\" is truncated.");
+        return false;
+    }
+
+    // In contrast to KTX2, DDS files store the complete mip chain of one array layer or cube map face after another.
+    const uint32_t numSlices = numArrayLayers * numFaces;
+    for (uint32_t sliceIdx = 0; sliceIdx < numSlices; sliceIdx++) {
+        for (const TextureContainerLevel& levelInfo : levels) {
+            size_t sliceSize = levelInfo.size / numSlices;
+            FileRegion fileRegion;
+            fileRegion.fileOffset = dataFileOffset;
+            fileRegion.fileSize = sliceSize;
+            fileRegion.dataOffset = levelInfo.offset + sliceIdx * sliceSize;
+            fileRegion.dataSize = sliceSize;
+            fileRegions.push_back(fileRegion);
+            dataFileOffset += sliceSize;
+        }
+    }
+
+    return true;
+}
+
+bool TextureContainer::readData(void* dst) {
+    if (!file) {
+        Logfile::get()->writeError("Error in TextureContainer::readData: No file is opened.");
+        return false;
+    }
+
+    auto* dstBytes = reinterpret_cast<uint8_t*>(dst);
+    std::vector<uint8_t> compressedData;
+    for (const FileRegion& fileRegion : fileRegions) {
+        if (!fileRegion.isZlibCompressed) {
+            if (!readFile(fileRegion.fileOffset, dstBytes + fileRegion.dataOffset, fileRegion.dataSize)) {
+                return false;
+            }
+            continue;
+        }
+#ifdef USE_LIBPNG
+        compressedData.resize(fileRegion.fileSize);
+        if (!readFile(fileRegion.fileOffset, compressedData.data(), compressedData.size())
+                || !decompressZlibData(
+                        compressedData.data(), compressedData.size(),
+                        dstBytes + fileRegion.dataOffset, fileRegion.dataSize)) {
+            return false;
+        }
+#endif
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,172 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_TEXTURECONTAINER_HPP
+#define SGL_TEXTURECONTAINER_HPP
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+namespace sgl {
+
+/**
+ * Texel formats supported in texture containers. The values match the corresponding VkFormat enum entries, so they can
+ * directly be cast to VkFormat when using Vulkan.
+ */
+enum class TextureContainerFormat : uint32_t {
+    UNDEFINED = 0,
+    R8_UNORM = 9,
+    R8G8_UNORM = 16,
+    R8G8B8A8_UNORM = 37,
+    R8G8B8A8_SRGB = 43,
+    B8G8R8A8_UNORM = 44,
+    B8G8R8A8_SRGB = 50,
+    R16_UNORM = 70,
+    R16_SFLOAT = 76,
+    R16G16_SFLOAT = 83,
+    R16G16B16A16_UNORM = 91,
+    R16G16B16A16_SFLOAT = 97,
+    R32_SFLOAT = 100,
+    R32G32_SFLOAT = 103,
+    R32G32B32A32_SFLOAT = 109,
+    BC1_RGB_UNORM_BLOCK = 131,
+    BC1_RGB_SRGB_BLOCK = 132,
+    BC1_RGBA_UNORM_BLOCK = 133,
+    BC1_RGBA_SRGB_BLOCK = 134,
+    BC2_UNORM_BLOCK = 135,
+    BC2_SRGB_BLOCK = 136,
+    BC3_UNORM_BLOCK = 137,
+    BC3_SRGB_BLOCK = 138,
+    BC4_UNORM_BLOCK = 139,
+    BC4_SNORM_BLOCK = 140,
+    BC5_UNORM_BLOCK = 141,
+    BC5_SNORM_BLOCK = 142,
+    BC6H_UFLOAT_BLOCK = 143,
+    BC6H_SFLOAT_BLOCK = 144,
+    BC7_UNORM_BLOCK = 145,
+    BC7_SRGB_BLOCK = 146,
+};
+
+/// Returns the size of a texel block in bytes (0 if the format is not supported).
+DLL_OBJECT uint32_t getTextureContainerFormatBlockSize(TextureContainerFormat format);
+/// Returns whether the format is a block compressed format (i.e., the texel block size is 4x4).
+DLL_OBJECT bool getIsTextureContainerFormatCompressed(TextureContainerFormat format);
+
+struct DLL_OBJECT TextureContainerLevel {
+    uint32_t width = 1;
+    uint32_t height = 1;
+    uint32_t depth = 1;
+    size_t offset = 0; ///< Offset of the level in the data read by @see TextureContainer::readData.
+    size_t size = 0; ///< Size of the level in bytes (including all array layers and cube map faces).
+};
+
+/**
+ * Loader for the KTX2 and DDS texture container formats. In contrast to @see Bitmap, the texel data is not decoded,
+ * so block compressed formats and the mip chain stored in the file can be uploaded to the GPU as they are.
+ *
+ * The data read by @see readData is laid out like in KTX2 files (and as expected by vkCmdCopyBufferToImage): The
+ * levels are stored one after another (aligned to 16 bytes), starting with the base level. Each level stores its array
+ * layers, each layer its cube map faces, and each face its depth slices without any row padding.
+ *
+ * KTX2 files using zlib supercompression are supported if sgl was built with zlib (USE_LIBPNG). Other
+ * supercompression schemes (Basis Universal, Zstandard) and formats that are only described by the data format
+ * descriptor (vkFormat == VK_FORMAT_UNDEFINED) are not supported.
+ */
+class DLL_OBJECT TextureContainer {
+public:
+    TextureContainer() = default;
+    ~TextureContainer();
+    TextureContainer(const TextureContainer&) = delete;
+    TextureContainer& operator=(const TextureContainer&) = delete;
+
+    /**
+     * Opens the file and parses its header. The texel data is not read until @see readData is called.
+     * @param filename The file name of a .ktx2 or .dds file (the format is detected by the file content).
+     * @return Whether the file could be opened and has a supported format.
+     */
+    bool open(const std::string& filename);
+    void close();
+
+    /**
+     * Reads the texel data of all levels.
+     * @param dst The destination memory (e.g., a mapped staging buffer) of size @see getDataSize.
+     */
+    bool readData(void* dst);
+
+    /// Returns whether the passed file name has a texture container file extension.
+    static bool getIsTextureContainerFilename(const std::string& filename);
+
+    [[nodiscard]] inline TextureContainerFormat getFormat() const { return format; }
+    [[nodiscard]] inline bool getIsCompressed() const { return getIsTextureContainerFormatCompressed(format); }
+    /// Returns 1, 2 or 3 for 1D, 2D or 3D textures.
+    [[nodiscard]] inline uint32_t getNumDimensions() const { return numDimensions; }
+    [[nodiscard]] inline uint32_t getWidth() const { return levels.front().width; }
+    [[nodiscard]] inline uint32_t getHeight() const { return levels.front().height; }
+    [[nodiscard]] inline uint32_t getDepth() const { return levels.front().depth; }
+    [[nodiscard]] inline uint32_t getNumMipLevels() const { return uint32_t(levels.size()); }
+    [[nodiscard]] inline uint32_t getNumArrayLayers() const { return numArrayLayers; }
+    /// Whether the file stores an array texture (even if it has only one layer).
+    [[nodiscard]] inline bool getIsArray() const { return isArray; }
+    [[nodiscard]] inline uint32_t getNumFaces() const { return numFaces; }
+    [[nodiscard]] inline bool getIsCubeMap() const { return numFaces == 6; }
+    [[nodiscard]] inline const std::vector<TextureContainerLevel>& getLevels() const { return levels; }
+    [[nodiscard]] inline size_t getDataSize() const { return dataSize; }
+
+private:
+    // A contiguous region of the file that is copied to the data returned by readData.
+    struct FileRegion {
+        uint64_t fileOffset = 0;
+        uint64_t fileSize = 0;
+        size_t dataOffset = 0;
+        size_t dataSize = 0;
+        bool isZlibCompressed = false;
+    };
+
+    bool parseKtx2();
+    bool parseDds();
+    bool computeLevels(uint32_t width, uint32_t height, uint32_t depth, uint32_t numMipLevels);
+    bool readFile(uint64_t offset, void* dst, size_t size);
+    bool getFileSize(uint64_t& size);
+
+    std::string filename;
+    FILE* file = nullptr;
+    TextureContainerFormat format = TextureContainerFormat::UNDEFINED;
+    uint32_t numDimensions = 2;
+    uint32_t numArrayLayers = 1;
+    bool isArray = false;
+    uint32_t numFaces = 1;
+    std::vector<TextureContainerLevel> levels;
+    std::vector<FileRegion> fileRegions;
+    size_t dataSize = 0;
+};
+
+}
+
+#endif //SGL_TEXTURECONTAINER_HPP
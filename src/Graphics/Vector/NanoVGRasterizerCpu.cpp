@@ -0,0 +1,944 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_NANOVG_CPU_USE_SSE2
+#endif
+
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Texture/Bitmap.hpp>
+
+#include "nanovg/nanovg.h"
+#include "nanovg/nanovg_shared.h"
+#include "NanoVGRasterizerCpu.hpp"
+
+namespace sgl {
+
+/// Coverage values below this threshold are treated as zero (numerical noise of the prefix sum).
+static const float COVERAGE_EPSILON = 1.0f / 1024.0f;
+
+struct NanoVGTextureCpu {
+    int type = NVG_TEXTURE_RGBA;
+    int width = 0;
+    int height = 0;
+    int flags = 0;
+    std::vector<uint8_t> data;
+};
+
+/// Mirrors the fragment shader uniforms of the NanoVG OpenGL backend (@see glnvg__convertPaint).
+struct NanoVGPaintCpu {
+    float scissorMat[6];
+    float scissorExt[2];
+    float scissorScale[2];
+    float paintMat[6];
+    float extent[2];
+    float radius = 0.0f;
+    float feather = 1.0f;
+    float innerCol[4];
+    float outerCol[4];
+    int type = NSVG_SHADER_FILLGRAD;
+    int texType = 0;
+    std::shared_ptr<NanoVGTextureCpu> texture;
+    bool hasScissor = false;
+    bool isSolidColor = false;
+};
+
+enum class NanoVGDrawCallTypeCpu {
+    COVERAGE, ///< Fills and strokes; elements are edges.
+    TRIANGLES ///< Textured triangles; elements are vertices.
+};
+
+struct NanoVGDrawCallCpu {
+    NanoVGDrawCallTypeCpu type = NanoVGDrawCallTypeCpu::COVERAGE;
+    NanoVGPaintCpu paint;
+    NVGcompositeOperationState blend{};
+    bool isSourceOver = true;
+    size_t firstElement = 0;
+    size_t numElements = 0;
+    // Bounding box in pixel coordinates.
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+};
+
+
+// -------------------- Helper functions --------------------
+
+static inline void premultiplyColor(const NVGcolor& color, float* out) {
+    out[0] = color.r * color.a;
+    out[1] = color.g * color.a;
+    out[2] = color.b * color.a;
+    out[3] = color.a;
+}
+
+static inline float clamp01(float value) {
+    return std::min(std::max(value, 0.0f), 1.0f);
+}
+
+static inline float sdRoundRect(float ptX, float ptY, float extX, float extY, float radius) {
+    float dx = std::abs(ptX) - (extX - radius);
+    float dy = std::abs(ptY) - (extY - radius);
+    float dxPos = std::max(dx, 0.0f);
+    float dyPos = std::max(dy, 0.0f);
+    return std::min(std::max(dx, dy), 0.0f) + std::sqrt(dxPos * dxPos + dyPos * dyPos) - radius;
+}
+
+static inline int wrapTexel(int i, int n, bool repeat) {
+    if (repeat) {
+        i %= n;
+        return i < 0 ? i + n : i;
+    }
+    return std::min(std::max(i, 0), n - 1);
+}
+
+static inline void fetchTexel(const NanoVGTextureCpu& texture, int x, int y, float* out) {
+    const float normFactor = 1.0f / 255.0f;
+    if (texture.type == NVG_TEXTURE_ALPHA) {
+        // Equivalent to the shader splatting the red channel (texType == 2).
+        float value = float(texture.data[size_t(y) * size_t(texture.width) + size_t(x)]) * normFactor;
+        out[0] = value;
+        out[1] = value;
+        out[2] = value;
+        out[3] = value;
+    } else {
+        const uint8_t* texel = texture.data.data() + (size_t(y) * size_t(texture.width) + size_t(x)) * 4;
+        out[0] = float(texel[0]) * normFactor;
+        out[1] = float(texel[1]) * normFactor;
+        out[2] = float(texel[2]) * normFactor;
+        out[3] = float(texel[3]) * normFactor;
+    }
+}
+
+/// Samples a texture with normalized coordinates like a GL sampler (linear or nearest, clamp or repeat).
+static void sampleTexture(const NanoVGTextureCpu& texture, float u, float v, float* out) {
+    bool repeatX = (texture.flags & NVG_IMAGE_REPEATX) != 0;
+    bool repeatY = (texture.flags & NVG_IMAGE_REPEATY) != 0;
+    if ((texture.flags & NVG_IMAGE_NEAREST) != 0) {
+        int x = wrapTexel(int(std::floor(u * float(texture.width))), texture.width, repeatX);
+        int y = wrapTexel(int(std::floor(v * float(texture.height))), texture.height, repeatY);
+        fetchTexel(texture, x, y, out);
+        return;
+    }
+
+    float fx = u * float(texture.width) - 0.5f;
+    float fy = v * float(texture.height) - 0.5f;
+    float floorX = std::floor(fx);
+    float floorY = std::floor(fy);
+    float tx = fx - floorX;
+    float ty = fy - floorY;
+    int x0 = wrapTexel(int(floorX), texture.width, repeatX);
+    int x1 = wrapTexel(int(floorX) + 1, texture.width, repeatX);
+    int y0 = wrapTexel(int(floorY), texture.height, repeatY);
+    int y1 = wrapTexel(int(floorY) + 1, texture.height, repeatY);
+
+    float c00[4], c10[4], c01[4], c11[4];
+    fetchTexel(texture, x0, y0, c00);
+    fetchTexel(texture, x1, y0, c10);
+    fetchTexel(texture, x0, y1, c01);
+    fetchTexel(texture, x1, y1, c11);
+    for (int i = 0; i < 4; i++) {
+        float top = c00[i] + (c10[i] - c00[i]) * tx;
+        float bottom = c01[i] + (c11[i] - c01[i]) * tx;
+        out[i] = top + (bottom - top) * ty;
+    }
+}
+
+static void sampleTexturePaint(const NanoVGPaintCpu& paint, float u, float v, float* out) {
+    sampleTexture(*paint.texture, u, v, out);
+    if (paint.texType == 1) {
+        out[0] *= out[3];
+        out[1] *= out[3];
+        out[2] *= out[3];
+    }
+    for (int i = 0; i < 4; i++) {
+        out[i] *= paint.innerCol[i];
+    }
+}
+
+static inline float computeScissorMask(const NanoVGPaintCpu& paint, float fx, float fy) {
+    if (!paint.hasScissor) {
+        return 1.0f;
+    }
+    const float* m = paint.scissorMat;
+    float sx = std::abs(m[0] * fx + m[2] * fy + m[4]) - paint.scissorExt[0];
+    float sy = std::abs(m[1] * fx + m[3] * fy + m[5]) - paint.scissorExt[1];
+    return clamp01(0.5f - sx * paint.scissorScale[0]) * clamp01(0.5f - sy * paint.scissorScale[1]);
+}
+
+/// Evaluates the fill paint (gradient or image pattern) at a position in logical coordinates.
+static void evaluatePaint(const NanoVGPaintCpu& paint, float fx, float fy, float* out) {
+    if (paint.isSolidColor) {
+        std::copy(paint.innerCol, paint.innerCol + 4, out);
+    } else {
+        const float* m = paint.paintMat;
+        float ptX = m[0] * fx + m[2] * fy + m[4];
+        float ptY = m[1] * fx + m[3] * fy + m[5];
+        if (paint.type == NSVG_SHADER_FILLGRAD) {
+            float d = clamp01(
+                    (sdRoundRect(ptX, ptY, paint.extent[0], paint.extent[1], paint.radius) + paint.feather * 0.5f)
+                    / paint.feather);
+            for (int i = 0; i < 4; i++) {
+                out[i] = paint.innerCol[i] + (paint.outerCol[i] - paint.innerCol[i]) * d;
+            }
+        } else {
+            sampleTexturePaint(paint, ptX / paint.extent[0], ptY / paint.extent[1], out);
+        }
+    }
+    float scissor = computeScissorMask(paint, fx, fy);
+    for (int i = 0; i < 4; i++) {
+        out[i] *= scissor;
+    }
+}
+
+static inline float getBlendFactor(int factor, const float* src, const float* dst, int channel) {
+    switch (factor) {
+        case NVG_ZERO:
+            return 0.0f;
+        case NVG_ONE:
+            return 1.0f;
+        case NVG_SRC_COLOR:
+            return src[channel];
+        case NVG_ONE_MINUS_SRC_COLOR:
+            return 1.0f - src[channel];
+        case NVG_DST_COLOR:
+            return dst[channel];
+        case NVG_ONE_MINUS_DST_COLOR:
+            return 1.0f - dst[channel];
+        case NVG_SRC_ALPHA:
+            return src[3];
+        case NVG_ONE_MINUS_SRC_ALPHA:
+            return 1.0f - src[3];
+        case NVG_DST_ALPHA:
+            return dst[3];
+        case NVG_ONE_MINUS_DST_ALPHA:
+            return 1.0f - dst[3];
+        case NVG_SRC_ALPHA_SATURATE:
+            return channel == 3 ? 1.0f : std::min(src[3], 1.0f - dst[3]);
+        default:
+            return 0.0f;
+    }
+}
+
+/// Blends a premultiplied color into the render target with the fixed-function blend equation GL_FUNC_ADD.
+static inline void blendColor(const NVGcompositeOperationState& blend, const float* src, float* dst) {
+    float result[4];
+    for (int i = 0; i < 4; i++) {
+        int srcFactor = i == 3 ? blend.srcAlpha : blend.srcRGB;
+        int dstFactor = i == 3 ? blend.dstAlpha : blend.dstRGB;
+        result[i] = src[i] * getBlendFactor(srcFactor, src, dst, i) + dst[i] * getBlendFactor(dstFactor, src, dst, i);
+    }
+    std::copy(result, result + 4, dst);
+}
+
+/// Source-over blending of (color * coverage) for premultiplied colors.
+static inline void blendSourceOver(const float* color, float coverage, float* dst) {
+#ifdef SGL_NANOVG_CPU_USE_SSE2
+    __m128 src = _mm_mul_ps(_mm_loadu_ps(color), _mm_set1_ps(coverage));
+    __m128 invAlpha = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(src, src, _MM_SHUFFLE(3, 3, 3, 3)));
+    _mm_storeu_ps(dst, _mm_add_ps(src, _mm_mul_ps(_mm_loadu_ps(dst), invAlpha)));
+#else
+    float invAlpha = 1.0f - color[3] * coverage;
+    for (int i = 0; i < 4; i++) {
+        dst[i] = color[i] * coverage + dst[i] * invAlpha;
+    }
+#endif
+}
+
+/**
+ * Accumulates the signed area an edge covers in each pixel of the rows [clipY0, clipY1) (cf. font-rs by Raph Levien).
+ * The prefix sum of a row of the accumulation buffer is the winding number weighted by the pixel coverage.
+ */
+static void accumulateEdge(
+        float* accumulationBuffer, int stride, int tileY0, float clipY0, float clipY1, float width,
+        const glm::vec4& edge) {
+    float x0 = edge.x, y0 = edge.y, x1 = edge.z, y1 = edge.w;
+    if (y0 == y1) {
+        return;
+    }
+    float dir = 1.0f;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1.0f;
+    }
+    float yStart = std::max(y0, clipY0);
+    float yEnd = std::min(y1, clipY1);
+    if (yStart >= yEnd) {
+        return;
+    }
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0 + (yStart - y0) * dxdy;
+    int yIdxStart = int(std::floor(yStart));
+    int yIdxEnd = int(std::ceil(yEnd));
+
+    for (int y = yIdxStart; y < yIdxEnd; y++) {
+        float* row = accumulationBuffer + size_t(y - tileY0) * size_t(stride);
+        float dy = std::min(float(y + 1), yEnd) - std::max(float(y), yStart);
+        float xNext = x + dxdy * dy;
+        float d = dy * dir;
+        float xa = std::min(std::max(std::min(x, xNext), 0.0f), width);
+        float xb = std::min(std::max(std::max(x, xNext), 0.0f), width);
+        float xaFloor = std::floor(xa);
+        int xaIdx = int(xaFloor);
+        float xbCeil = std::ceil(xb);
+        int xbIdx = int(xbCeil);
+        if (xbIdx <= xaIdx + 1) {
+            // The edge segment lies within one pixel.
+            float xmf = 0.5f * (xa + xb) - xaFloor;
+            row[xaIdx] += d - d * xmf;
+            row[xaIdx + 1] += d * xmf;
+        } else {
+            float s = 1.0f / (xb - xa);
+            float xaFrac = xa - xaFloor;
+            float a0 = 0.5f * s * (1.0f - xaFrac) * (1.0f - xaFrac);
+            float xbFrac = xb - xbCeil + 1.0f;
+            float am = 0.5f * s * xbFrac * xbFrac;
+            row[xaIdx] += d * a0;
+            if (xbIdx == xaIdx + 2) {
+                row[xaIdx + 1] += d * (1.0f - a0 - am);
+            } else {
+                float a1 = s * (1.5f - xaFrac);
+                row[xaIdx + 1] += d * (a1 - a0);
+                for (int xi = xaIdx + 2; xi < xbIdx - 1; xi++) {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + float(xbIdx - xaIdx - 3) * s;
+                row[xbIdx - 1] += d * (1.0f - a2 - am);
+            }
+            row[xbIdx] += d * am;
+        }
+        x = xNext;
+    }
+}
+
+/// Computes the coverage of the pixels [x0, x1) as min(1, |prefix sum|) (non-zero winding rule).
+static void computeCoverageRow(const float* row, float* coverage, int x0, int x1) {
+    int x = x0;
+#ifdef SGL_NANOVG_CPU_USE_SSE2
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 offset = _mm_setzero_ps();
+    for (; x + 4 <= x1; x += 4) {
+        __m128 v = _mm_loadu_ps(row + x);
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+        v = _mm_add_ps(v, offset);
+        _mm_storeu_ps(coverage + x, _mm_min_ps(_mm_andnot_ps(signMask, v), one));
+        offset = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    float sum = _mm_cvtss_f32(offset);
+#else
+    float sum = 0.0f;
+#endif
+    for (; x < x1; x++) {
+        sum += row[x];
+        coverage[x] = std::min(std::abs(sum), 1.0f);
+    }
+}
+
+static inline float edgeFunction(const glm::vec4& a, const glm::vec4& b, float px, float py) {
+    return (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+}
+
+/// Tie-breaking rule for pixel centers exactly on an edge, so that pixels on shared edges are drawn only once.
+static inline bool getIsEdgeInclusive(const glm::vec4& a, const glm::vec4& b) {
+    float dy = b.y - a.y;
+    return dy > 0.0f || (dy == 0.0f && b.x < a.x);
+}
+
+
+// -------------------- NanoVG render callbacks --------------------
+
+struct NanoVGRasterizerCpuCallbacks {
+    static int renderCreate(void* uptr) {
+        return 1;
+    }
+
+    static int renderCreateTexture(void* uptr, int type, int w, int h, int imageFlags, const unsigned char* data) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        auto texture = std::make_shared<NanoVGTextureCpu>();
+        texture->type = type;
+        texture->width = w;
+        texture->height = h;
+        texture->flags = imageFlags;
+        size_t numBytes = size_t(w) * size_t(h) * (type == NVG_TEXTURE_RGBA ? 4 : 1);
+        if (data) {
+            texture->data.assign(data, data + numBytes);
+        } else {
+            texture->data.resize(numBytes, 0);
+        }
+
+        auto& textures = rasterizer->textures;
+        auto it = std::find(textures.begin(), textures.end(), nullptr);
+        if (it != textures.end()) {
+            *it = texture;
+            return int(it - textures.begin()) + 1;
+        }
+        textures.push_back(texture);
+        return int(textures.size());
+    }
+
+    static NanoVGTextureCpu* findTexture(NanoVGRasterizerCpu* rasterizer, int image) {
+        if (image <= 0 || image > int(rasterizer->textures.size())) {
+            return nullptr;
+        }
+        return rasterizer->textures.at(image - 1).get();
+    }
+
+    static int renderDeleteTexture(void* uptr, int image) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        if (!findTexture(rasterizer, image)) {
+            return 0;
+        }
+        // Draw calls of the current frame keep a reference, like GL keeps textures alive until they are used.
+        rasterizer->textures.at(image - 1) = {};
+        return 1;
+    }
+
+    static int renderUpdateTexture(void* uptr, int image, int x, int y, int w, int h, const unsigned char* data) {
+        NanoVGTextureCpu* texture = findTexture(static_cast<NanoVGRasterizerCpu*>(uptr), image);
+        if (!texture) {
+            return 0;
+        }
+        // As in the GL backend, 'data' points to the full image and only the passed region is updated.
+        size_t bytesPerPixel = texture->type == NVG_TEXTURE_RGBA ? 4 : 1;
+        size_t rowStride = size_t(texture->width) * bytesPerPixel;
+        for (int row = y; row < y + h; row++) {
+            size_t offset = size_t(row) * rowStride + size_t(x) * bytesPerPixel;
+            memcpy(texture->data.data() + offset, data + offset, size_t(w) * bytesPerPixel);
+        }
+        return 1;
+    }
+
+    static int renderGetTextureSize(void* uptr, int image, int* w, int* h) {
+        NanoVGTextureCpu* texture = findTexture(static_cast<NanoVGRasterizerCpu*>(uptr), image);
+        if (!texture) {
+            return 0;
+        }
+        *w = texture->width;
+        *h = texture->height;
+        return 1;
+    }
+
+    static int renderImportTexture(void* uptr, int type, int w, int h, int imageFlags, void* deviceData) {
+        sgl::Logfile::get()->writeError(
+                "Error in NanoVGRasterizerCpu: Importing device textures is not supported by the CPU backend.");
+        return 0;
+    }
+
+    static void renderViewport(void* uptr, float width, float height, float devicePixelRatio) {
+        static_cast<NanoVGRasterizerCpu*>(uptr)->devicePixelRatio = devicePixelRatio;
+    }
+
+    static void renderCancel(void* uptr) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        rasterizer->drawCalls.clear();
+        rasterizer->edges.clear();
+        rasterizer->triangleVertices.clear();
+    }
+
+    static void renderFlush(void* uptr) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        rasterizer->rasterizeFrame();
+        renderCancel(uptr);
+    }
+
+    static bool convertPaint(
+            NanoVGRasterizerCpu* rasterizer, NanoVGPaintCpu& frag, NVGpaint* paint, NVGscissor* scissor, float fringe) {
+        float invxform[6];
+        premultiplyColor(paint->innerColor, frag.innerCol);
+        premultiplyColor(paint->outerColor, frag.outerCol);
+
+        if (scissor->extent[0] < -0.5f || scissor->extent[1] < -0.5f) {
+            frag.hasScissor = false;
+        } else {
+            frag.hasScissor = true;
+            nvgTransformInverse(frag.scissorMat, scissor->xform);
+            frag.scissorExt[0] = scissor->extent[0];
+            frag.scissorExt[1] = scissor->extent[1];
+            frag.scissorScale[0] =
+                    std::sqrt(scissor->xform[0] * scissor->xform[0] + scissor->xform[2] * scissor->xform[2]) / fringe;
+            frag.scissorScale[1] =
+                    std::sqrt(scissor->xform[1] * scissor->xform[1] + scissor->xform[3] * scissor->xform[3]) / fringe;
+        }
+
+        frag.extent[0] = paint->extent[0];
+        frag.extent[1] = paint->extent[1];
+
+        if (paint->image != 0) {
+            NanoVGTextureCpu* texture = findTexture(rasterizer, paint->image);
+            if (!texture) {
+                return false;
+            }
+            frag.texture = rasterizer->textures.at(paint->image - 1);
+            if ((texture->flags & NVG_IMAGE_FLIPY) != 0) {
+                float m1[6], m2[6];
+                nvgTransformTranslate(m1, 0.0f, frag.extent[1] * 0.5f);
+                nvgTransformMultiply(m1, paint->xform);
+                nvgTransformScale(m2, 1.0f, -1.0f);
+                nvgTransformMultiply(m2, m1);
+                nvgTransformTranslate(m1, 0.0f, -frag.extent[1] * 0.5f);
+                nvgTransformMultiply(m1, m2);
+                nvgTransformInverse(invxform, m1);
+            } else {
+                nvgTransformInverse(invxform, paint->xform);
+            }
+            frag.type = NSVG_SHADER_FILLIMG;
+            if (texture->type == NVG_TEXTURE_RGBA) {
+                frag.texType = (texture->flags & NVG_IMAGE_PREMULTIPLIED) ? 0 : 1;
+            } else {
+                frag.texType = 2;
+            }
+        } else {
+            frag.type = NSVG_SHADER_FILLGRAD;
+            frag.radius = paint->radius;
+            frag.feather = paint->feather;
+            frag.isSolidColor = std::equal(frag.innerCol, frag.innerCol + 4, frag.outerCol);
+            nvgTransformInverse(invxform, paint->xform);
+        }
+        std::copy(invxform, invxform + 6, frag.paintMat);
+        return true;
+    }
+
+    static void addDrawCall(
+            NanoVGRasterizerCpu* rasterizer, NanoVGDrawCallCpu& drawCall,
+            NVGcompositeOperationState compositeOperation) {
+        drawCall.blend = compositeOperation;
+        drawCall.isSourceOver =
+                compositeOperation.srcRGB == NVG_ONE && compositeOperation.srcAlpha == NVG_ONE
+                && compositeOperation.dstRGB == NVG_ONE_MINUS_SRC_ALPHA
+                && compositeOperation.dstAlpha == NVG_ONE_MINUS_SRC_ALPHA;
+        if (drawCall.numElements == 0 || drawCall.maxX <= 0.0f || drawCall.maxY <= 0.0f
+                || drawCall.minX >= float(rasterizer->width) || drawCall.minY >= float(rasterizer->height)) {
+            return;
+        }
+        rasterizer->drawCalls.push_back(std::move(drawCall));
+    }
+
+    static inline void addEdge(NanoVGRasterizerCpu* rasterizer, NanoVGDrawCallCpu& drawCall, float x0, float y0, float x1, float y1) {
+        if (y0 == y1) {
+            // Horizontal edges do not contribute to the coverage.
+            return;
+        }
+        drawCall.minX = std::min(drawCall.minX, std::min(x0, x1));
+        drawCall.maxX = std::max(drawCall.maxX, std::max(x0, x1));
+        drawCall.minY = std::min(drawCall.minY, std::min(y0, y1));
+        drawCall.maxY = std::max(drawCall.maxY, std::max(y0, y1));
+        rasterizer->edges.emplace_back(x0, y0, x1, y1);
+    }
+
+    static void initializeBounds(NanoVGDrawCallCpu& drawCall) {
+        drawCall.minX = std::numeric_limits<float>::max();
+        drawCall.minY = std::numeric_limits<float>::max();
+        drawCall.maxX = std::numeric_limits<float>::lowest();
+        drawCall.maxY = std::numeric_limits<float>::lowest();
+    }
+
+    static void renderFill(
+            void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor,
+            float fringe, const float* bounds, const NVGpath* paths, int npaths) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        NanoVGDrawCallCpu drawCall;
+        drawCall.type = NanoVGDrawCallTypeCpu::COVERAGE;
+        if (!convertPaint(rasterizer, drawCall.paint, paint, scissor, fringe)) {
+            return;
+        }
+        initializeBounds(drawCall);
+        float scale = rasterizer->devicePixelRatio;
+        drawCall.firstElement = rasterizer->edges.size();
+        for (int pathIdx = 0; pathIdx < npaths; pathIdx++) {
+            const NVGpath& path = paths[pathIdx];
+            for (int i = 0; i < path.nfill; i++) {
+                const NVGvertex& v0 = path.fill[i];
+                const NVGvertex& v1 = path.fill[(i + 1) % path.nfill];
+                addEdge(rasterizer, drawCall, v0.x * scale, v0.y * scale, v1.x * scale, v1.y * scale);
+            }
+        }
+        drawCall.numElements = rasterizer->edges.size() - drawCall.firstElement;
+        addDrawCall(rasterizer, drawCall, compositeOperation);
+    }
+
+    static void renderStroke(
+            void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor,
+            float fringe, float strokeWidth, const NVGpath* paths, int npaths) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        NanoVGDrawCallCpu drawCall;
+        drawCall.type = NanoVGDrawCallTypeCpu::COVERAGE;
+        if (!convertPaint(rasterizer, drawCall.paint, paint, scissor, fringe)) {
+            return;
+        }
+        initializeBounds(drawCall);
+        float scale = rasterizer->devicePixelRatio;
+        drawCall.firstElement = rasterizer->edges.size();
+        for (int pathIdx = 0; pathIdx < npaths; pathIdx++) {
+            // The stroke is a triangle strip. All triangles are oriented consistently so that their union is covered.
+            const NVGpath& path = paths[pathIdx];
+            for (int i = 0; i + 2 < path.nstroke; i++) {
+                float x0 = path.stroke[i].x * scale, y0 = path.stroke[i].y * scale;
+                float x1 = path.stroke[i + 1].x * scale, y1 = path.stroke[i + 1].y * scale;
+                float x2 = path.stroke[i + 2].x * scale, y2 = path.stroke[i + 2].y * scale;
+                float area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+                if (area == 0.0f) {
+                    continue;
+                }
+                if (area < 0.0f) {
+                    std::swap(x1, x2);
+                    std::swap(y1, y2);
+                }
+                addEdge(rasterizer, drawCall, x0, y0, x1, y1);
+                addEdge(rasterizer, drawCall, x1, y1, x2, y2);
+                addEdge(rasterizer, drawCall, x2, y2, x0, y0);
+            }
+        }
+        drawCall.numElements = rasterizer->edges.size() - drawCall.firstElement;
+        addDrawCall(rasterizer, drawCall, compositeOperation);
+    }
+
+    static void renderTriangles(
+            void* uptr, NVGpaint* paint, NVGcompositeOperationState compositeOperation, NVGscissor* scissor,
+            const NVGvertex* verts, int nverts, float fringe) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        NanoVGDrawCallCpu drawCall;
+        drawCall.type = NanoVGDrawCallTypeCpu::TRIANGLES;
+        if (!convertPaint(rasterizer, drawCall.paint, paint, scissor, fringe) || !drawCall.paint.texture) {
+            return;
+        }
+        drawCall.paint.isSolidColor = false;
+        initializeBounds(drawCall);
+        float scale = rasterizer->devicePixelRatio;
+        drawCall.firstElement = rasterizer->triangleVertices.size();
+        for (int i = 0; i < nverts; i++) {
+            float x = verts[i].x * scale, y = verts[i].y * scale;
+            drawCall.minX = std::min(drawCall.minX, x);
+            drawCall.maxX = std::max(drawCall.maxX, x);
+            drawCall.minY = std::min(drawCall.minY, y);
+            drawCall.maxY = std::max(drawCall.maxY, y);
+            rasterizer->triangleVertices.emplace_back(x, y, verts[i].u, verts[i].v);
+        }
+        drawCall.numElements = size_t(nverts / 3) * 3;
+        addDrawCall(rasterizer, drawCall, compositeOperation);
+    }
+
+    static void renderDelete(void* uptr) {
+        auto* rasterizer = static_cast<NanoVGRasterizerCpu*>(uptr);
+        rasterizer->textures.clear();
+        renderCancel(uptr);
+    }
+};
+
+
+// -------------------- NanoVGRasterizerCpu --------------------
+
+NanoVGRasterizerCpu::NanoVGRasterizerCpu() = default;
+
+NanoVGRasterizerCpu::~NanoVGRasterizerCpu() {
+    if (vg) {
+        nvgDeleteInternal(vg);
+        vg = nullptr;
+    }
+}
+
+NVGcontext* NanoVGRasterizerCpu::createContext(int flags) {
+    if (vg) {
+        sgl::Logfile::get()->throwError(
+                "Error in NanoVGRasterizerCpu::createContext: The context was already created.");
+    }
+
+    NVGparams params{};
+    params.userPtr = this;
+    // Coverage is computed analytically, so no geometry for anti-aliasing fringes is needed.
+    params.edgeAntiAlias = 0;
+    params.renderCreate = NanoVGRasterizerCpuCallbacks::renderCreate;
+    params.renderCreateTexture = NanoVGRasterizerCpuCallbacks::renderCreateTexture;
+    params.renderDeleteTexture = NanoVGRasterizerCpuCallbacks::renderDeleteTexture;
+    params.renderUpdateTexture = NanoVGRasterizerCpuCallbacks::renderUpdateTexture;
+    params.renderGetTextureSize = NanoVGRasterizerCpuCallbacks::renderGetTextureSize;
+    params.renderImportTexture = NanoVGRasterizerCpuCallbacks::renderImportTexture;
+    params.renderViewport = NanoVGRasterizerCpuCallbacks::renderViewport;
+    params.renderCancel = NanoVGRasterizerCpuCallbacks::renderCancel;
+    params.renderFlush = NanoVGRasterizerCpuCallbacks::renderFlush;
+    params.renderFill = NanoVGRasterizerCpuCallbacks::renderFill;
+    params.renderStroke = NanoVGRasterizerCpuCallbacks::renderStroke;
+    params.renderTriangles = NanoVGRasterizerCpuCallbacks::renderTriangles;
+    params.renderDelete = NanoVGRasterizerCpuCallbacks::renderDelete;
+    (void)flags;
+
+    vg = nvgCreateInternal(&params);
+    if (!vg) {
+        sgl::Logfile::get()->throwError(
+                "Error in NanoVGRasterizerCpu::createContext: nvgCreateInternal failed.");
+    }
+    return vg;
+}
+
+void NanoVGRasterizerCpu::resize(int _width, int _height) {
+    width = std::max(_width, 0);
+    height = std::max(_height, 0);
+    colorBuffer.assign(size_t(width) * size_t(height) * 4, 0.0f);
+    pixels.assign(size_t(width) * size_t(height) * 4, 0);
+}
+
+void NanoVGRasterizerCpu::clear(const glm::vec4& color) {
+    size_t numPixels = size_t(width) * size_t(height);
+    float* data = colorBuffer.data();
+    for (size_t i = 0; i < numPixels; i++) {
+        data[i * 4 + 0] = color.r;
+        data[i * 4 + 1] = color.g;
+        data[i * 4 + 2] = color.b;
+        data[i * 4 + 3] = color.a;
+    }
+}
+
+void NanoVGRasterizerCpu::setTileHeight(int height) {
+    tileHeight = std::max(height, 1);
+}
+
+BitmapPtr NanoVGRasterizerCpu::copyToBitmap(bool premultipliedAlpha) const {
+    auto bitmap = std::make_shared<Bitmap>(width, height, 32);
+    size_t numPixels = size_t(width) * size_t(height);
+    uint8_t* dst = bitmap->getPixels();
+    memcpy(dst, pixels.data(), numPixels * 4);
+    if (!premultipliedAlpha) {
+        for (size_t i = 0; i < numPixels; i++) {
+            uint32_t alpha = dst[i * 4 + 3];
+            if (alpha == 0 || alpha == 255) {
+                continue;
+            }
+            for (int c = 0; c < 3; c++) {
+                dst[i * 4 + c] = uint8_t(std::min((uint32_t(dst[i * 4 + c]) * 255u + alpha / 2u) / alpha, 255u));
+            }
+        }
+    }
+    return bitmap;
+}
+
+void NanoVGRasterizerCpu::rasterizeFrame() {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    int numTiles = (height + tileHeight - 1) / tileHeight;
+
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<int>(0, numTiles), [&](auto const& r) {
+        std::vector<float> accumulationBuffer, coverageRow;
+        for (auto tileIdx = r.begin(); tileIdx != r.end(); tileIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel
+#endif
+    {
+        std::vector<float> accumulationBuffer, coverageRow;
+#if _OPENMP >= 201107
+        #pragma omp for schedule(dynamic)
+#endif
+        for (int tileIdx = 0; tileIdx < numTiles; tileIdx++) {
+#endif
+            rasterizeTile(tileIdx, accumulationBuffer, coverageRow);
+        }
+#ifdef USE_TBB
+    });
+#else
+    }
+#endif
+}
+
+void NanoVGRasterizerCpu::rasterizeTile(
+        int tileIdx, std::vector<float>& accumulationBuffer, std::vector<float>& coverageRow) {
+    int tileY0 = tileIdx * tileHeight;
+    int tileY1 = std::min(tileY0 + tileHeight, height);
+    // Invariant: The accumulation buffer is zero outside of the processing of a draw call.
+    accumulationBuffer.resize(size_t(width + 2) * size_t(tileHeight), 0.0f);
+    coverageRow.resize(size_t(width + 2), 0.0f);
+
+    for (const NanoVGDrawCallCpu& drawCall : drawCalls) {
+        if (drawCall.maxY <= float(tileY0) || drawCall.minY >= float(tileY1)) {
+            continue;
+        }
+        if (drawCall.type == NanoVGDrawCallTypeCpu::COVERAGE) {
+            rasterizeCoverageDrawCall(drawCall, tileY0, tileY1, accumulationBuffer, coverageRow);
+        } else {
+            rasterizeTriangleDrawCall(drawCall, tileY0, tileY1);
+        }
+    }
+
+    resolvePixels(tileY0, tileY1);
+}
+
+void NanoVGRasterizerCpu::rasterizeCoverageDrawCall(
+        const NanoVGDrawCallCpu& drawCall, int tileY0, int tileY1,
+        std::vector<float>& accumulationBuffer, std::vector<float>& coverageRow) {
+    int x0 = std::max(int(std::floor(drawCall.minX)), 0);
+    int maxXCeil = int(std::ceil(std::min(drawCall.maxX, float(width))));
+    int x1 = std::min(maxXCeil + 1, width);
+    int zeroEnd = std::min(maxXCeil + 2, width + 2);
+    int y0 = std::max(int(std::floor(drawCall.minY)), tileY0);
+    int y1 = std::min(int(std::ceil(drawCall.maxY)), tileY1);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const int stride = width + 2;
+    float* accumulationData = accumulationBuffer.data();
+    for (size_t edgeIdx = 0; edgeIdx < drawCall.numElements; edgeIdx++) {
+        accumulateEdge(
+                accumulationData, stride, tileY0, float(y0), float(y1), float(width),
+                edges[drawCall.firstElement + edgeIdx]);
+    }
+
+    const NanoVGPaintCpu& paint = drawCall.paint;
+    const bool isFastPath = paint.isSolidColor && !paint.hasScissor && drawCall.isSourceOver;
+    const float invScale = 1.0f / devicePixelRatio;
+    float* coverage = coverageRow.data();
+    for (int y = y0; y < y1; y++) {
+        float* row = accumulationData + size_t(y - tileY0) * size_t(stride);
+        computeCoverageRow(row, coverage, x0, x1);
+        std::fill(row + x0, row + zeroEnd, 0.0f);
+
+        float* dstRow = colorBuffer.data() + size_t(y) * size_t(width) * 4;
+        if (isFastPath) {
+            for (int x = x0; x < x1; x++) {
+                if (coverage[x] >= COVERAGE_EPSILON) {
+                    blendSourceOver(paint.innerCol, coverage[x], dstRow + x * 4);
+                }
+            }
+        } else {
+            float fy = (float(y) + 0.5f) * invScale;
+            float color[4];
+            for (int x = x0; x < x1; x++) {
+                if (coverage[x] < COVERAGE_EPSILON) {
+                    continue;
+                }
+                evaluatePaint(paint, (float(x) + 0.5f) * invScale, fy, color);
+                if (drawCall.isSourceOver) {
+                    blendSourceOver(color, coverage[x], dstRow + x * 4);
+                } else {
+                    for (float& channel : color) {
+                        channel *= coverage[x];
+                    }
+                    blendColor(drawCall.blend, color, dstRow + x * 4);
+                }
+            }
+        }
+    }
+}
+
+void NanoVGRasterizerCpu::rasterizeTriangleDrawCall(const NanoVGDrawCallCpu& drawCall, int tileY0, int tileY1) {
+    const NanoVGPaintCpu& paint = drawCall.paint;
+    const float invScale = 1.0f / devicePixelRatio;
+    for (size_t triIdx = 0; triIdx < drawCall.numElements; triIdx += 3) {
+        glm::vec4 v0 = triangleVertices[drawCall.firstElement + triIdx];
+        glm::vec4 v1 = triangleVertices[drawCall.firstElement + triIdx + 1];
+        glm::vec4 v2 = triangleVertices[drawCall.firstElement + triIdx + 2];
+        float area = edgeFunction(v0, v1, v2.x, v2.y);
+        if (area == 0.0f) {
+            continue;
+        }
+        if (area < 0.0f) {
+            std::swap(v1, v2);
+            area = -area;
+        }
+        float invArea = 1.0f / area;
+
+        // Pixel centers (x + 0.5, y + 0.5) inside of the bounding box.
+        int x0 = std::max(int(std::ceil(std::min(v0.x, std::min(v1.x, v2.x)) - 0.5f)), 0);
+        int x1 = std::min(int(std::floor(std::max(v0.x, std::max(v1.x, v2.x)) - 0.5f)) + 1, width);
+        int y0 = std::max(int(std::ceil(std::min(v0.y, std::min(v1.y, v2.y)) - 0.5f)), tileY0);
+        int y1 = std::min(int(std::floor(std::max(v0.y, std::max(v1.y, v2.y)) - 0.5f)) + 1, tileY1);
+        bool inclusive0 = getIsEdgeInclusive(v1, v2);
+        bool inclusive1 = getIsEdgeInclusive(v2, v0);
+        bool inclusive2 = getIsEdgeInclusive(v0, v1);
+
+        for (int y = y0; y < y1; y++) {
+            float py = float(y) + 0.5f;
+            float* dstRow = colorBuffer.data() + size_t(y) * size_t(width) * 4;
+            for (int x = x0; x < x1; x++) {
+                float px = float(x) + 0.5f;
+                float w0 = edgeFunction(v1, v2, px, py);
+                float w1 = edgeFunction(v2, v0, px, py);
+                float w2 = edgeFunction(v0, v1, px, py);
+                if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f
+                        || (w0 == 0.0f && !inclusive0) || (w1 == 0.0f && !inclusive1)
+                        || (w2 == 0.0f && !inclusive2)) {
+                    continue;
+                }
+                w0 *= invArea;
+                w1 *= invArea;
+                w2 *= invArea;
+                float u = w0 * v0.z + w1 * v1.z + w2 * v2.z;
+                float v = w0 * v0.w + w1 * v1.w + w2 * v2.w;
+                float color[4];
+                sampleTexturePaint(paint, u, v, color);
+                float scissor = computeScissorMask(paint, px * invScale, py * invScale);
+                if (drawCall.isSourceOver) {
+                    blendSourceOver(color, scissor, dstRow + x * 4);
+                } else {
+                    for (float& channel : color) {
+                        channel *= scissor;
+                    }
+                    blendColor(drawCall.blend, color, dstRow + x * 4);
+                }
+            }
+        }
+    }
+}
+
+void NanoVGRasterizerCpu::resolvePixels(int tileY0, int tileY1) {
+    size_t begin = size_t(tileY0) * size_t(width);
+    size_t end = size_t(tileY1) * size_t(width);
+    const float* src = colorBuffer.data();
+    uint8_t* dst = pixels.data();
+#ifdef SGL_NANOVG_CPU_USE_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (size_t i = begin; i < end; i++) {
+        __m128 color = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i * 4), zero), one);
+        __m128i color32 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(color, scale), half));
+        __m128i color16 = _mm_packs_epi32(color32, color32);
+        __m128i color8 = _mm_packus_epi16(color16, color16);
+        int packed = _mm_cvtsi128_si32(color8);
+        memcpy(dst + i * 4, &packed, 4);
+    }
+#else
+    for (size_t i = begin * 4; i < end * 4; i++) {
+        dst[i] = uint8_t(clamp01(src[i]) * 255.0f + 0.5f);
+    }
+#endif
+}
+
+}
@@ -0,0 +1,127 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_NANOVGRASTERIZERCPU_HPP
+#define SGL_NANOVGRASTERIZERCPU_HPP
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#ifdef USE_GLM
+#include <glm/vec4.hpp>
+#else
+#include <Math/Geometry/fallback/vec4.hpp>
+#endif
+
+struct NVGcontext;
+typedef struct NVGcontext NVGcontext;
+
+namespace sgl {
+
+class Bitmap;
+typedef std::shared_ptr<Bitmap> BitmapPtr;
+
+struct NanoVGTextureCpu;
+struct NanoVGDrawCallCpu;
+struct NanoVGRasterizerCpuCallbacks;
+
+/**
+ * NanoVG render backend rasterizing on the CPU (i.e., without an OpenGL or Vulkan context).
+ *
+ * The fill, stroke and triangle calls NanoVG issues during a frame are recorded and rasterized when the frame ends:
+ * - Fills and strokes are rasterized with a scanline rasterizer computing the exact area coverage of each pixel
+ *   (signed-area accumulation with the non-zero winding rule, as in font-rs). Thus, no MSAA or supersampling is
+ *   necessary for anti-aliasing, and the NanoVG context is created without NVG_ANTIALIAS (no fringe geometry).
+ * - Textured triangles (i.e., text) are sampled at the pixel centers.
+ * - The render target is split into tiles of rows that are processed in parallel (TBB or OpenMP). Within a tile, the
+ *   draw calls are processed in submission order, so blending is deterministic.
+ * - The coverage prefix sums and the blending of the premultiplied RGBA colors use SSE2 if available.
+ *
+ * The result is a premultiplied RGBA8 image with the top row at index 0.
+ */
+class DLL_OBJECT NanoVGRasterizerCpu {
+public:
+    NanoVGRasterizerCpu();
+    ~NanoVGRasterizerCpu();
+    NanoVGRasterizerCpu(const NanoVGRasterizerCpu&) = delete;
+    NanoVGRasterizerCpu& operator=(const NanoVGRasterizerCpu&) = delete;
+
+    /// Creates the NanoVG context rendering through this rasterizer. The context is owned by the rasterizer.
+    NVGcontext* createContext(int flags);
+    [[nodiscard]] inline NVGcontext* getContext() { return vg; }
+
+    /// Resizes the render target. The content is cleared to zero.
+    void resize(int width, int height);
+    /**
+     * Clears the render target with a color that is stored as-is, i.e., it is expected to be premultiplied already.
+     * This matches the OpenGL and Vulkan NanoVG backends, which also clear their render targets with the raw color.
+     */
+    void clear(const glm::vec4& color);
+    /// Sets the number of rows of one tile that is processed by one thread.
+    void setTileHeight(int height);
+
+    [[nodiscard]] inline int getWidth() const { return width; }
+    [[nodiscard]] inline int getHeight() const { return height; }
+    /// Premultiplied RGBA8 pixels (the top row first). Updated at the end of each frame.
+    [[nodiscard]] inline const uint8_t* getPixels() const { return pixels.data(); }
+    /// Copies the render target to a bitmap, optionally converting it to straight (non-premultiplied) alpha.
+    BitmapPtr copyToBitmap(bool premultipliedAlpha = true) const;
+
+private:
+    friend struct NanoVGRasterizerCpuCallbacks;
+
+    void rasterizeFrame();
+    void rasterizeTile(int tileIdx, std::vector<float>& accumulationBuffer, std::vector<float>& coverageRow);
+    void rasterizeCoverageDrawCall(
+            const NanoVGDrawCallCpu& drawCall, int tileY0, int tileY1,
+            std::vector<float>& accumulationBuffer, std::vector<float>& coverageRow);
+    void rasterizeTriangleDrawCall(const NanoVGDrawCallCpu& drawCall, int tileY0, int tileY1);
+    void resolvePixels(int tileY0, int tileY1);
+
+    NVGcontext* vg = nullptr;
+    int width = 0, height = 0;
+    int tileHeight = 32;
+    float devicePixelRatio = 1.0f;
+
+    /// Premultiplied RGBA colors stored as floats (avoids accumulating quantization errors when blending).
+    std::vector<float> colorBuffer;
+    std::vector<uint8_t> pixels;
+
+    // Textures (index = NanoVG image ID - 1).
+    std::vector<std::shared_ptr<NanoVGTextureCpu>> textures;
+
+    // Commands recorded during the current frame.
+    std::vector<NanoVGDrawCallCpu> drawCalls;
+    std::vector<glm::vec4> edges; ///< Line segments (x0, y0, x1, y1) in pixel coordinates.
+    std::vector<glm::vec4> triangleVertices; ///< Vertices (x, y, u, v) in pixel coordinates.
+};
+
+}
+
+#endif //SGL_NANOVGRASTERIZERCPU_HPP
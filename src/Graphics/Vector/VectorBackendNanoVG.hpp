@@ -111,7 +111,7 @@ public:
 
     [[nodiscard]] inline NVGcontext* getContext() { return vg; }
 
-private:
+protected:
     static void _initializeFont(NVGcontext* vgCurrent);
 
     int flags = 0;
@@ -0,0 +1,231 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstring>
+
+#include "nanovg/nanovg.h"
+#include "nanovg/nanovg_shared.h"
+
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Texture/Bitmap.hpp>
+#include <ImGui/Widgets/PropertyEditor.hpp>
+
+#ifdef SUPPORT_OPENGL
+#include <GL/glew.h>
+#include <Graphics/Texture/Texture.hpp>
+#include <Graphics/Texture/TextureManager.hpp>
+#endif
+
+#ifdef SUPPORT_VULKAN
+#include <Graphics/Vulkan/Utils/Swapchain.hpp>
+#include <Graphics/Vulkan/Buffers/Buffer.hpp>
+#include <Graphics/Vulkan/Image/Image.hpp>
+#include <Graphics/Vulkan/Render/Renderer.hpp>
+#endif
+
+#include "VectorWidget.hpp"
+#include "NanoVGRasterizerCpu.hpp"
+#include "VectorBackendNanoVGCpu.hpp"
+
+namespace sgl {
+
+bool VectorBackendNanoVGCpu::checkIsSupported() {
+    return true;
+}
+
+VectorBackendNanoVGCpu::VectorBackendNanoVGCpu(VectorWidget* vectorWidget, const NanoVGSettings& nanoVgSettings)
+        : VectorBackendNanoVG(vectorWidget, nanoVgSettings) {
+    // The coverage is computed analytically, so supersampling is not necessary.
+    supersamplingFactor = 1;
+    RenderSystem renderSystem = sgl::AppSettings::get()->getRenderSystem();
+    renderBackend = renderSystem == RenderSystem::OPENGL ? RenderSystem::OPENGL : RenderSystem::VULKAN;
+}
+
+VectorBackendNanoVGCpu::~VectorBackendNanoVGCpu() = default;
+
+void VectorBackendNanoVGCpu::initialize() {
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+
+    flags = {};
+    if (useDebugging) {
+        flags |= NVG_DEBUG;
+    }
+    rasterizer = std::make_unique<NanoVGRasterizerCpu>();
+    vg = rasterizer->createContext(flags);
+    _initializeFont(vg);
+    vectorWidget->setSupersamplingFactor(supersamplingFactor, false);
+}
+
+void VectorBackendNanoVGCpu::destroy() {
+    if (!initialized) {
+        return;
+    }
+
+#ifdef SUPPORT_OPENGL
+    renderTargetGl = {};
+#endif
+#ifdef SUPPORT_VULKAN
+    renderTargetTextureVk = {};
+    renderTargetImageViewVk = {};
+    stagingBuffersVk.clear();
+#endif
+    vg = nullptr;
+    rasterizer = {};
+
+    initialized = false;
+}
+
+void VectorBackendNanoVGCpu::onResize() {
+    rasterizer->resize(fboWidthInternal, fboHeightInternal);
+
+#if defined(SUPPORT_OPENGL) || defined(SUPPORT_VULKAN)
+    RenderSystem renderSystem = sgl::AppSettings::get()->getRenderSystem();
+#endif
+
+    // If a GPU render system is available, the frames are uploaded to a texture that the widget can blit.
+#ifdef SUPPORT_OPENGL
+    renderTargetGl = {};
+    if (renderSystem == RenderSystem::OPENGL && sgl::TextureManager) {
+        sgl::TextureSettings textureSettingsColor;
+        textureSettingsColor.internalFormat = GL_RGBA8;
+        renderTargetGl = sgl::TextureManager->createEmptyTexture(
+                fboWidthInternal, fboHeightInternal, textureSettingsColor);
+    }
+#endif
+
+#ifdef SUPPORT_VULKAN
+    renderTargetTextureVk = {};
+    renderTargetImageViewVk = {};
+    stagingBuffersVk.clear();
+    sgl::vk::Device* device = sgl::AppSettings::get()->getPrimaryDevice();
+    if (renderSystem == RenderSystem::VULKAN && device) {
+        sgl::vk::ImageSettings imageSettings;
+        imageSettings.width = uint32_t(fboWidthInternal);
+        imageSettings.height = uint32_t(fboHeightInternal);
+        imageSettings.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageSettings.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        sgl::vk::ImageSamplerSettings samplerSettings;
+        renderTargetTextureVk = std::make_shared<sgl::vk::Texture>(device, imageSettings, samplerSettings);
+        renderTargetImageViewVk = renderTargetTextureVk->getImageView();
+
+        vk::Swapchain* swapchain = AppSettings::get()->getSwapchain();
+        int maxNumFramesInFlight = swapchain ? swapchain->getMaxNumFramesInFlight() : 1;
+        size_t imageSizeInBytes = size_t(fboWidthInternal) * size_t(fboHeightInternal) * 4;
+        for (int i = 0; i < maxNumFramesInFlight; i++) {
+            stagingBuffersVk.push_back(std::make_shared<sgl::vk::Buffer>(
+                    device, imageSizeInBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY));
+        }
+    }
+#endif
+}
+
+void VectorBackendNanoVGCpu::renderStart() {
+    if (!initialized) {
+        initialize();
+    }
+    if (shallClearBeforeRender) {
+        rasterizer->clear(clearColor);
+    }
+    nvgBeginFrame(vg, windowWidth, windowHeight, scaleFactor * float(supersamplingFactor));
+}
+
+void VectorBackendNanoVGCpu::renderEnd() {
+    // Rasterizes all recorded draw calls.
+    nvgEndFrame(vg);
+
+#ifdef SUPPORT_OPENGL
+    if (renderTargetGl) {
+        const int width = rasterizer->getWidth();
+        const int height = rasterizer->getHeight();
+        // OpenGL stores the bottom row first.
+        size_t rowSizeInBytes = size_t(width) * 4;
+        flippedPixelsGl.resize(size_t(height) * rowSizeInBytes);
+        const uint8_t* pixels = rasterizer->getPixels();
+        for (int y = 0; y < height; y++) {
+            memcpy(
+                    flippedPixelsGl.data() + size_t(height - y - 1) * rowSizeInBytes,
+                    pixels + size_t(y) * rowSizeInBytes, rowSizeInBytes);
+        }
+        renderTargetGl->uploadPixelData(width, height, flippedPixelsGl.data());
+    }
+#endif
+
+#ifdef SUPPORT_VULKAN
+    if (renderTargetTextureVk && rendererVk) {
+        const int width = rasterizer->getWidth();
+        const int height = rasterizer->getHeight();
+        vk::Swapchain* swapchain = AppSettings::get()->getSwapchain();
+        size_t currentFrameIdx = swapchain ? swapchain->getCurrentFrame() : 0;
+        vk::BufferPtr& stagingBuffer = stagingBuffersVk.at(currentFrameIdx);
+        void* data = stagingBuffer->mapMemory();
+        memcpy(data, rasterizer->getPixels(), size_t(width) * size_t(height) * 4);
+        stagingBuffer->unmapMemory();
+
+        VkCommandBuffer commandBuffer = rendererVk->getVkCommandBuffer();
+        const vk::ImagePtr& image = renderTargetImageViewVk->getImage();
+        image->transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, commandBuffer);
+        image->copyFromBuffer(stagingBuffer, commandBuffer);
+    }
+#endif
+}
+
+BitmapPtr VectorBackendNanoVGCpu::getRenderTargetBitmap(bool premultipliedAlpha) const {
+    if (!rasterizer) {
+        return {};
+    }
+    return rasterizer->copyToBitmap(premultipliedAlpha);
+}
+
+bool VectorBackendNanoVGCpu::renderGuiPropertyEditor(sgl::PropertyEditor& propertyEditor) {
+    bool reRender = VectorBackend::renderGuiPropertyEditor(propertyEditor);
+
+    if (propertyEditor.addSliderIntPowerOfTwo("SSAA Factor", &supersamplingFactor, 1, 4)) {
+        vectorWidget->setSupersamplingFactor(supersamplingFactor, true);
+        reRender = true;
+    }
+
+    return reRender;
+}
+
+void VectorBackendNanoVGCpu::copyVectorBackendSettingsFrom(VectorBackend* backend) {
+    if (getID() != backend->getID()) {
+        sgl::Logfile::get()->throwError(
+                "Error in VectorBackendNanoVGCpu::copyVectorBackendSettingsFrom: Vector backend ID mismatch.");
+    }
+
+    auto* nanovgBackend = static_cast<VectorBackendNanoVGCpu*>(backend);
+    if (supersamplingFactor != nanovgBackend->supersamplingFactor) {
+        supersamplingFactor = nanovgBackend->supersamplingFactor;
+        vectorWidget->setSupersamplingFactor(supersamplingFactor, true);
+    }
+}
+
+}
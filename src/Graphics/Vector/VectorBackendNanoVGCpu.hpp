@@ -0,0 +1,90 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_VECTORBACKENDNANOVGCPU_HPP
+#define SGL_VECTORBACKENDNANOVGCPU_HPP
+
+#include "VectorBackendNanoVG.hpp"
+
+#ifdef SUPPORT_VULKAN
+namespace sgl { namespace vk {
+class Buffer;
+typedef std::shared_ptr<Buffer> BufferPtr;
+}}
+#endif
+
+namespace sgl {
+
+class Bitmap;
+typedef std::shared_ptr<Bitmap> BitmapPtr;
+class NanoVGRasterizerCpu;
+
+/**
+ * NanoVG backend rasterizing on the CPU (@see NanoVGRasterizerCpu). It can be used for headless rendering without
+ * any OpenGL context or Vulkan device, e.g., for generating diagrams for reports on nodes without a GPU.
+ *
+ * As it derives from @see VectorBackendNanoVG and @see VectorWidget reuses the NanoVG render functor for it, widgets
+ * drawing with the NanoVG context (@see VectorBackendNanoVG::getContext) work without changes.
+ * If a GPU render system is available, the rasterized image is uploaded to the render target texture, so the widget
+ * can also be blitted as usual.
+ */
+class DLL_OBJECT VectorBackendNanoVGCpu : public VectorBackendNanoVG {
+public:
+    static const char* getClassID() { return "NanoVG (CPU)"; }
+    [[nodiscard]] const char* getID() const override { return getClassID(); }
+    static bool checkIsSupported();
+
+    explicit VectorBackendNanoVGCpu(
+            VectorWidget* vectorWidget, const NanoVGSettings& nanoVgSettings = NanoVGSettings());
+    ~VectorBackendNanoVGCpu() override;
+    void initialize() override;
+    void destroy() override;
+    void onResize() override;
+    void renderStart() override;
+    void renderEnd() override;
+    bool renderGuiPropertyEditor(sgl::PropertyEditor& propertyEditor) override;
+    void copyVectorBackendSettingsFrom(VectorBackend* backend) override;
+
+    /// Returns a copy of the last rendered frame (with straight alpha, e.g., for saving it as a PNG file).
+    [[nodiscard]] BitmapPtr getRenderTargetBitmap(bool premultipliedAlpha = false) const;
+
+private:
+    std::unique_ptr<NanoVGRasterizerCpu> rasterizer;
+
+#ifdef SUPPORT_OPENGL
+    std::vector<uint8_t> flippedPixelsGl;
+#endif
+
+#ifdef SUPPORT_VULKAN
+    std::vector<vk::BufferPtr> stagingBuffersVk; ///< One per frame in flight.
+#endif
+};
+
+}
+
+#endif //SGL_VECTORBACKENDNANOVGCPU_HPP
@@ -52,6 +52,8 @@
 #include <Graphics/Vulkan/Render/Passes/BlitRenderPass.hpp>
 #endif
 
+#include "VectorBackendNanoVG.hpp"
+#include "VectorBackendNanoVGCpu.hpp"
 #include "VectorWidget.hpp"
 
 namespace sgl {
@@ -93,12 +95,41 @@ void VectorWidget::setDefaultBackendId(const std::string& defaultId) {
     defaultBackendId = defaultId;
 }
 
+/// Whether a GPU render system with a device/context is available (e.g., not the case on GPU-less nodes).
+static bool getIsGpuRenderingAvailable() {
+#if defined(SUPPORT_OPENGL) || defined(SUPPORT_VULKAN)
+    RenderSystem renderSystem = sgl::AppSettings::get()->getRenderSystem();
+#endif
+#ifdef SUPPORT_VULKAN
+    if (renderSystem == RenderSystem::VULKAN) {
+        return sgl::AppSettings::get()->getPrimaryDevice() != nullptr;
+    }
+#endif
+#ifdef SUPPORT_OPENGL
+    if (renderSystem == RenderSystem::OPENGL) {
+        return sgl::Renderer != nullptr;
+    }
+#endif
+    return false;
+}
+
 void VectorWidget::_initialize() {
     if (initialized) {
         return;
     }
     initialized = true;
 
+    // The CPU rasterizer draws the same NanoVG command stream, so the NanoVG render functor can be reused.
+    auto itNanoVG = factories.find(VectorBackendNanoVG::getClassID());
+    if (itNanoVG != factories.end() && factories.find(VectorBackendNanoVGCpu::getClassID()) == factories.end()
+            && VectorBackendNanoVGCpu::checkIsSupported()) {
+        VectorBackendFactory factory;
+        factory.id = VectorBackendNanoVGCpu::getClassID();
+        factory.createBackendFunctor = [this]() { return new VectorBackendNanoVGCpu(this); };
+        factory.renderFunctor = itNanoVG->second.renderFunctor;
+        factories.insert(std::make_pair(factory.id, factory));
+    }
+
     for (const auto& factory : factories) {
         vectorBackendIds.push_back(factory.first);
     }
@@ -118,7 +149,7 @@ void VectorWidget::_initialize() {
 #endif
 
 #ifdef SUPPORT_OPENGL
-    if (renderSystem == RenderSystem::OPENGL) {
+    if (renderSystem == RenderSystem::OPENGL && sgl::ShaderManager) {
         blitShader = sgl::ShaderManager->getShaderProgram(
                 { "BlitPremulAlpha.Vertex", "BlitPremulAlpha.FragmentBlit" });
         blitMsaaShader = sgl::ShaderManager->getShaderProgram(
@@ -131,8 +162,8 @@ void VectorWidget::_initialize() {
 #endif
 
 #if defined(SUPPORT_OPENGL) && defined(SUPPORT_VULKAN)
-    if (renderSystem == RenderSystem::VULKAN) {
-        vk::Device* device = AppSettings::get()->getPrimaryDevice();
+    vk::Device* device = AppSettings::get()->getPrimaryDevice();
+    if (renderSystem == RenderSystem::VULKAN && device) {
         blitMatrixBuffer = std::make_shared<sgl::vk::Buffer>(
                 device, sizeof(glm::mat4), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                 VMA_MEMORY_USAGE_GPU_ONLY);
@@ -141,15 +172,16 @@ void VectorWidget::_initialize() {
 }
 
 void VectorWidget::onWindowSizeChanged() {
+    // Initialize first, as the scale factor and the supersampling factor of the default backend are set there.
+    if (!initialized) {
+        _initialize();
+    }
+
     fboWidthDisplay = int(std::ceil(float(windowWidth) * scaleFactor));
     fboHeightDisplay = int(std::ceil(float(windowHeight) * scaleFactor));
     fboWidthInternal = fboWidthDisplay * supersamplingFactor;
     fboHeightInternal = fboHeightDisplay * supersamplingFactor;
 
-    if (!initialized) {
-        _initialize();
-    }
-
 #if defined(SUPPORT_OPENGL) || defined(SUPPORT_VULKAN)
     RenderSystem renderSystem = sgl::AppSettings::get()->getRenderSystem();
     RenderSystem renderBackend = vectorBackend->getRenderBackend();
@@ -203,7 +235,7 @@ void VectorWidget::syncRendererWithCpu() {
 #ifdef SUPPORT_VULKAN
     RenderSystem renderSystem = sgl::AppSettings::get()->getRenderSystem();
     RenderSystem renderBackend = vectorBackend->getRenderBackend();
-    if (renderSystem == RenderSystem::VULKAN || renderBackend == RenderSystem::VULKAN) {
+    if ((renderSystem == RenderSystem::VULKAN || renderBackend == RenderSystem::VULKAN) && rendererVk) {
         rendererVk->getDevice()->waitGraphicsQueueIdle();
     }
 #endif
@@ -256,6 +288,13 @@ void VectorWidget::createDefaultBackend() {
         if (factories.empty()) {
             sgl::Logfile::get()->throwError("Error in VectorWidget::render: No backend available to create!");
         }
+        if (!getIsGpuRenderingAvailable()) {
+            auto itCpu = factories.find(VectorBackendNanoVGCpu::getClassID());
+            if (itCpu != factories.end()
+                    && (defaultBackendId.empty() || defaultBackendId == VectorBackendNanoVG::getClassID())) {
+                defaultBackendId = itCpu->first;
+            }
+        }
         if (defaultBackendId.empty()) {
             defaultBackendId = factories.begin()->first;
         }
@@ -0,0 +1,401 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <Utils/File/Logfile.hpp>
+#include "../Utils/Device.hpp"
+#include "../Image/Image.hpp"
+#include "Buffer.hpp"
+#include "UploadManager.hpp"
+
+namespace sgl { namespace vk {
+
+static VkDeviceSize roundUpToMultiple(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+static VkDeviceSize getNextPowerOfTwo(VkDeviceSize value) {
+    VkDeviceSize result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+UploadManager::UploadManager(Device* device, const UploadManagerSettings& settings)
+        : device(device), settings(settings) {
+    if (settings.useWorkerThreadQueue) {
+        queue = device->getWorkerThreadGraphicsQueue();
+        queueFamilyIndex = device->getWorkerThreadGraphicsQueueIndex();
+    } else {
+        queue = device->getGraphicsQueue();
+        queueFamilyIndex = device->getGraphicsQueueIndex();
+    }
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = queueFamilyIndex;
+    if (vkCreateCommandPool(device->getVkDevice(), &poolInfo, nullptr, &commandPool) != VK_SUCCESS) {
+        Logfile::get()->throwError("Error in UploadManager::UploadManager: Could not create a command pool.");
+    }
+
+    growStagingBuffer(std::max(settings.stagingBufferSize, VkDeviceSize(1024)));
+}
+
+UploadManager::~UploadManager() {
+    waitAll();
+
+    if (stagingBuffer) {
+        stagingBuffer->unmapMemory();
+        stagingBuffer = {};
+    }
+    for (VkFence fence : freeFences) {
+        vkDestroyFence(device->getVkDevice(), fence, nullptr);
+    }
+    freeFences.clear();
+    if (!freeCommandBuffers.empty()) {
+        vkFreeCommandBuffers(
+                device->getVkDevice(), commandPool, uint32_t(freeCommandBuffers.size()), freeCommandBuffers.data());
+        freeCommandBuffers.clear();
+    }
+    vkDestroyCommandPool(device->getVkDevice(), commandPool, nullptr);
+}
+
+void UploadManager::growStagingBuffer(VkDeviceSize minSize) {
+    // Growing is rare, so it is fine to simply drain the old ring before replacing it.
+    if (stagingBuffer) {
+        if (hasOpenBatch) {
+            flushInternal();
+        }
+        while (!pendingBatches.empty()) {
+            waitForOldestBatch();
+        }
+        stagingBuffer->unmapMemory();
+    }
+
+    stagingBufferSize = getNextPowerOfTwo(std::max(minSize, 2 * stagingBufferSize));
+    stagingBuffer = std::make_shared<Buffer>(
+            device, stagingBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY);
+    stagingBufferMapped = static_cast<uint8_t*>(stagingBuffer->mapMemory());
+    ringHead = 0;
+    ringTail = 0;
+    statistics.stagingBufferSize = stagingBufferSize;
+}
+
+VkDeviceSize UploadManager::allocateStagingMemory(VkDeviceSize sizeInBytes, VkDeviceSize alignment) {
+    if (sizeInBytes + alignment > stagingBufferSize) {
+        growStagingBuffer(sizeInBytes + alignment);
+    }
+
+    while (true) {
+        VkDeviceSize physicalHead = ringHead % stagingBufferSize;
+        VkDeviceSize physicalOffset = roundUpToMultiple(physicalHead, alignment);
+        VkDeviceSize newHead;
+        if (physicalOffset + sizeInBytes > stagingBufferSize) {
+            // Does not fit at the end of the ring; skip the rest and wrap around to the start.
+            physicalOffset = 0;
+            newHead = ringHead + (stagingBufferSize - physicalHead) + sizeInBytes;
+        } else {
+            newHead = ringHead + (physicalOffset - physicalHead) + sizeInBytes;
+        }
+
+        if (newHead - ringTail <= stagingBufferSize) {
+            ringHead = newHead;
+            return physicalOffset;
+        }
+
+        // The ring is full. Submit the open batch if it holds the memory and wait for the oldest batch.
+        retireFinishedBatches();
+        if (newHead - ringTail <= stagingBufferSize) {
+            continue;
+        }
+        statistics.numStalls++;
+        if (pendingBatches.empty()) {
+            if (!hasOpenBatch) {
+                // The ring is empty, so the allocation can restart at the beginning of the buffer.
+                ringHead = roundUpToMultiple(ringHead, stagingBufferSize);
+                ringTail = ringHead;
+                continue;
+            }
+            flushInternal();
+        }
+        waitForOldestBatch();
+    }
+}
+
+void UploadManager::beginBatch() {
+    if (hasOpenBatch) {
+        return;
+    }
+
+    openBatch = Batch();
+    openBatch.token = nextToken++;
+
+    if (!freeCommandBuffers.empty()) {
+        openBatch.commandBuffer = freeCommandBuffers.back();
+        freeCommandBuffers.pop_back();
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(
+                device->getVkDevice(), &allocInfo, &openBatch.commandBuffer) != VK_SUCCESS) {
+            Logfile::get()->throwError(
+                    "Error in UploadManager::beginBatch: Could not allocate a command buffer.");
+        }
+    }
+
+    if (!freeFences.empty()) {
+        openBatch.fence = freeFences.back();
+        freeFences.pop_back();
+    } else {
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(device->getVkDevice(), &fenceInfo, nullptr, &openBatch.fence) != VK_SUCCESS) {
+            Logfile::get()->throwError("Error in UploadManager::beginBatch: Could not create a fence.");
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(openBatch.commandBuffer, &beginInfo);
+    hasOpenBatch = true;
+}
+
+void UploadManager::afterCopyRecorded() {
+    if (settings.autoFlushThreshold > 0 && openBatch.numBytes >= settings.autoFlushThreshold) {
+        flushInternal();
+    }
+}
+
+UploadToken UploadManager::uploadBuffer(
+        const BufferPtr& buffer, const void* data, VkDeviceSize sizeInBytes, VkDeviceSize dstOffset) {
+    if (sizeInBytes == 0) {
+        return 0;
+    }
+    if (dstOffset + sizeInBytes > buffer->getSizeInBytes()) {
+        Logfile::get()->throwError(
+                "Error in UploadManager::uploadBuffer: dstOffset + sizeInBytes > buffer size.");
+    }
+    if ((buffer->getVkBufferUsageFlags() & VK_BUFFER_USAGE_TRANSFER_DST_BIT) == 0) {
+        Logfile::get()->throwError(
+                "Error in UploadManager::uploadBuffer: Buffer usage flag VK_BUFFER_USAGE_TRANSFER_DST_BIT not set!");
+    }
+
+    // Allocate before beginning the batch, as allocating may need to submit the open batch.
+    VkDeviceSize stagingOffset = allocateStagingMemory(sizeInBytes, 16);
+    memcpy(stagingBufferMapped + stagingOffset, data, sizeInBytes);
+    beginBatch();
+
+    VkBufferCopy bufferCopy{};
+    bufferCopy.srcOffset = stagingOffset;
+    bufferCopy.dstOffset = dstOffset;
+    bufferCopy.size = sizeInBytes;
+    vkCmdCopyBuffer(openBatch.commandBuffer, stagingBuffer->getVkBuffer(), buffer->getVkBuffer(), 1, &bufferCopy);
+
+    openBatch.buffers.push_back(buffer);
+    openBatch.numBytes += sizeInBytes;
+    statistics.numBufferCopies++;
+    statistics.numBytesUploaded += sizeInBytes;
+    UploadToken token = openBatch.token;
+    afterCopyRecorded();
+    return token;
+}
+
+UploadToken UploadManager::uploadImage(
+        const ImagePtr& image, const void* data, VkDeviceSize sizeInBytes, bool generateMipmaps) {
+    if (sizeInBytes == 0) {
+        return 0;
+    }
+    const ImageSettings& imageSettings = image->getImageSettings();
+    if (imageSettings.mipLevels <= 1) {
+        generateMipmaps = false;
+    }
+    if (generateMipmaps && (imageSettings.usage & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) == 0) {
+        Logfile::get()->throwError(
+                "Error in UploadManager::uploadImage: Generating mipmaps is requested, but "
+                "VK_IMAGE_USAGE_TRANSFER_SRC_BIT is not set.");
+    }
+
+    VkImageAspectFlags aspectMask;
+    if (isDepthStencilFormat(imageSettings.format)) {
+        aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        if (hasStencilComponent(imageSettings.format)) {
+            aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        }
+    } else {
+        aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+
+    // The buffer offset needs to be a multiple of the texel size and of four.
+    auto texelSize = VkDeviceSize(getImageFormatEntryByteSize(imageSettings.format));
+    VkDeviceSize alignment = texelSize % 4 == 0 ? texelSize : (texelSize % 2 == 0 ? texelSize * 2 : texelSize * 4);
+    alignment = std::max(alignment, device->getLimits().optimalBufferCopyOffsetAlignment);
+
+    VkDeviceSize stagingOffset = allocateStagingMemory(sizeInBytes, alignment);
+    memcpy(stagingBufferMapped + stagingOffset, data, sizeInBytes);
+    beginBatch();
+    VkCommandBuffer commandBuffer = openBatch.commandBuffer;
+
+    image->transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, commandBuffer);
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = stagingOffset;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = aspectMask;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = imageSettings.arrayLayers;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = { imageSettings.width, imageSettings.height, imageSettings.depth };
+    vkCmdCopyBufferToImage(
+            commandBuffer, stagingBuffer->getVkBuffer(), image->getVkImage(),
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    if (generateMipmaps) {
+        image->generateMipmaps(commandBuffer);
+    } else if ((imageSettings.usage & VK_IMAGE_USAGE_SAMPLED_BIT) != 0) {
+        image->transitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, commandBuffer);
+    }
+
+    openBatch.images.push_back(image);
+    openBatch.numBytes += sizeInBytes;
+    statistics.numImageCopies++;
+    statistics.numBytesUploaded += sizeInBytes;
+    UploadToken token = openBatch.token;
+    afterCopyRecorded();
+    return token;
+}
+
+void UploadManager::flushInternal() {
+    if (!hasOpenBatch) {
+        return;
+    }
+    hasOpenBatch = false;
+
+    // Makes the copies visible to all later commands submitted to the same queue.
+    VkMemoryBarrier memoryBarrier{};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(
+            openBatch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    vkEndCommandBuffer(openBatch.commandBuffer);
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &openBatch.commandBuffer;
+    if (vkQueueSubmit(queue, 1, &submitInfo, openBatch.fence) != VK_SUCCESS) {
+        Logfile::get()->throwError("Error in UploadManager::flushInternal: vkQueueSubmit failed.");
+    }
+
+    openBatch.ringEnd = ringHead;
+    pendingBatches.push_back(std::move(openBatch));
+    openBatch = Batch();
+    statistics.numSubmissions++;
+}
+
+void UploadManager::recycleBatch(Batch& batch) {
+    vkResetFences(device->getVkDevice(), 1, &batch.fence);
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+    freeFences.push_back(batch.fence);
+    freeCommandBuffers.push_back(batch.commandBuffer);
+    lastFinishedToken = batch.token;
+    ringTail = batch.ringEnd;
+}
+
+void UploadManager::retireFinishedBatches() {
+    // Batches are submitted to the same queue in order, so they also finish in order.
+    while (!pendingBatches.empty()) {
+        Batch& batch = pendingBatches.front();
+        if (vkGetFenceStatus(device->getVkDevice(), batch.fence) != VK_SUCCESS) {
+            break;
+        }
+        recycleBatch(batch);
+        pendingBatches.pop_front();
+    }
+    if (pendingBatches.empty() && !hasOpenBatch) {
+        ringTail = ringHead;
+    }
+}
+
+void UploadManager::waitForOldestBatch() {
+    Batch& batch = pendingBatches.front();
+    vkWaitForFences(device->getVkDevice(), 1, &batch.fence, VK_TRUE, UINT64_MAX);
+    recycleBatch(batch);
+    pendingBatches.pop_front();
+}
+
+UploadToken UploadManager::flush() {
+    if (!hasOpenBatch) {
+        return pendingBatches.empty() ? lastFinishedToken : pendingBatches.back().token;
+    }
+    UploadToken token = openBatch.token;
+    flushInternal();
+    return token;
+}
+
+bool UploadManager::getIsFinished(UploadToken token) {
+    if (token <= lastFinishedToken) {
+        return true;
+    }
+    retireFinishedBatches();
+    return token <= lastFinishedToken;
+}
+
+void UploadManager::wait(UploadToken token) {
+    if (hasOpenBatch && token >= openBatch.token) {
+        flushInternal();
+    }
+    while (token > lastFinishedToken && !pendingBatches.empty()) {
+        waitForOldestBatch();
+    }
+}
+
+void UploadManager::waitAll() {
+    flushInternal();
+    while (!pendingBatches.empty()) {
+        waitForOldestBatch();
+    }
+    ringTail = ringHead;
+}
+
+UploadManagerStatistics UploadManager::getStatistics() {
+    return statistics;
+}
+
+}}
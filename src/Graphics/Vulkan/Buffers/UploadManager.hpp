@@ -0,0 +1,172 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_UPLOADMANAGER_HPP
+#define SGL_UPLOADMANAGER_HPP
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <cstdint>
+
+#include <Defs.hpp>
+#include "../libs/volk/volk.h"
+
+namespace sgl { namespace vk {
+
+class Device;
+class Buffer;
+typedef std::shared_ptr<Buffer> BufferPtr;
+class Image;
+typedef std::shared_ptr<Image> ImagePtr;
+
+/**
+ * Token identifying a submitted batch of uploads. Tokens increase monotonically, i.e., if a token has completed, all
+ * smaller tokens have also completed. The token 0 is always complete.
+ */
+typedef uint64_t UploadToken;
+
+struct DLL_OBJECT UploadManagerSettings {
+    /// Initial size of the staging ring buffer. It grows to the next power of two if an upload does not fit.
+    VkDeviceSize stagingBufferSize = 16ull * 1024ull * 1024ull;
+    /// The open batch is submitted automatically once it holds this many bytes (0 = only on @see flush).
+    VkDeviceSize autoFlushThreshold = 4ull * 1024ull * 1024ull;
+    /**
+     * Whether to submit on the worker thread graphics queue instead of the main graphics queue. This must be set if
+     * the manager is used by a worker thread, as the main queue may only be accessed by the main thread. If the device
+     * provides a separate worker thread queue, uploads can then also overlap with rendering on the main queue. As
+     * there is no semaphore signaled for the main queue in this case, the caller needs to @see wait for the token
+     * before using the uploaded resources.
+     */
+    bool useWorkerThreadQueue = false;
+};
+
+struct DLL_OBJECT UploadManagerStatistics {
+    uint64_t numSubmissions = 0;
+    uint64_t numBufferCopies = 0;
+    uint64_t numImageCopies = 0;
+    uint64_t numBytesUploaded = 0;
+    /// How often an upload had to wait for an earlier batch to free space in the staging ring.
+    uint64_t numStalls = 0;
+    VkDeviceSize stagingBufferSize = 0;
+};
+
+/**
+ * Batches uploads of buffer and image data to device-local memory. In contrast to @see Buffer::uploadData and
+ * @see Image::uploadData, which create a staging buffer per call and wait for the queue to become idle, the data is
+ * written to a persistently mapped staging ring buffer, and all copies recorded until @see flush is called (or the
+ * auto-flush threshold is reached) are submitted together with one fence. Ring memory is reclaimed as soon as the
+ * fence of a batch is signaled, so the CPU only stalls when the ring is full.
+ *
+ * The queue is chosen once at construction (@see UploadManagerSettings::useWorkerThreadQueue). When submitting on the
+ * main graphics queue, a memory barrier is recorded at the end of each batch, so later submissions to the same queue
+ * see the uploaded data without waiting for the token.
+ * The manager is not thread-safe and must only be used by the thread owning its queue (i.e., the main thread, or one
+ * worker thread if useWorkerThreadQueue is set). The resources passed to the upload functions are kept alive until the
+ * batch completes.
+ */
+class DLL_OBJECT UploadManager {
+public:
+    explicit UploadManager(Device* device, const UploadManagerSettings& settings = {});
+    /// Waits for all pending uploads.
+    ~UploadManager();
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+
+    /**
+     * Copies the data to the staging ring and records a copy to the buffer. The data can be freed after the call.
+     * @return The token of the batch the copy was recorded in (completes after the batch was flushed).
+     */
+    UploadToken uploadBuffer(
+            const BufferPtr& buffer, const void* data, VkDeviceSize sizeInBytes, VkDeviceSize dstOffset = 0);
+    /**
+     * Copies the data of all array layers of mip level 0 to the staging ring and records a copy to the image.
+     * Afterwards, the mipmaps are generated, or the image is transitioned to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+     * if it is sampled (same as @see Image::uploadData).
+     */
+    UploadToken uploadImage(
+            const ImagePtr& image, const void* data, VkDeviceSize sizeInBytes, bool generateMipmaps = true);
+
+    /// Submits all recorded copies. Returns the token of the submitted batch (0 if nothing was recorded).
+    UploadToken flush();
+    /// Returns whether the batch with the token has finished executing on the device.
+    bool getIsFinished(UploadToken token);
+    /// Waits for the batch with the token (it is flushed first if it is still open).
+    void wait(UploadToken token);
+    /// Flushes and waits for all uploads.
+    void waitAll();
+
+    [[nodiscard]] UploadManagerStatistics getStatistics();
+
+private:
+    struct Batch {
+        UploadToken token = 0;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        VkDeviceSize ringEnd = 0; ///< Monotonically increasing (not wrapped) ring offset after the batch data.
+        VkDeviceSize numBytes = 0;
+        std::vector<BufferPtr> buffers;
+        std::vector<ImagePtr> images;
+    };
+
+    VkDeviceSize allocateStagingMemory(VkDeviceSize sizeInBytes, VkDeviceSize alignment);
+    void growStagingBuffer(VkDeviceSize minSize);
+    void beginBatch();
+    void afterCopyRecorded();
+    void flushInternal();
+    void retireFinishedBatches();
+    void waitForOldestBatch();
+    void recycleBatch(Batch& batch);
+
+    Device* device;
+    UploadManagerSettings settings;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queueFamilyIndex = 0;
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    UploadManagerStatistics statistics;
+
+    // Staging ring.
+    BufferPtr stagingBuffer;
+    uint8_t* stagingBufferMapped = nullptr;
+    VkDeviceSize stagingBufferSize = 0;
+    VkDeviceSize ringHead = 0; ///< Next free offset.
+    VkDeviceSize ringTail = 0; ///< Start of the oldest offset still in use by the device.
+
+    // Batches.
+    UploadToken nextToken = 1;
+    UploadToken lastFinishedToken = 0;
+    bool hasOpenBatch = false;
+    Batch openBatch;
+    std::deque<Batch> pendingBatches;
+    std::vector<VkCommandBuffer> freeCommandBuffers;
+    std::vector<VkFence> freeFences;
+};
+
+}}
+
+#endif //SGL_UPLOADMANAGER_HPP
@@ -0,0 +1,147 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Texture/TextureContainer.hpp>
+#include "../Utils/Device.hpp"
+#include "../Buffers/Buffer.hpp"
+#include "TextureLoader.hpp"
+
+namespace sgl { namespace vk {
+
+bool uploadTextureContainerData(
+        TextureContainer& container, const ImagePtr& image, VkCommandBuffer commandBuffer, BufferPtr* stagingBuffer) {
+    bool transientCommandBuffer = commandBuffer == VK_NULL_HANDLE;
+    if (!transientCommandBuffer && !stagingBuffer) {
+        Logfile::get()->throwError(
+                "Error in uploadTextureContainerData: The staging buffer needs to be returned when a command buffer "
+                "is passed.");
+    }
+
+    Device* device = image->getDevice();
+    BufferPtr buffer(new Buffer(
+            device, container.getDataSize(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY));
+    void* bufferData = buffer->mapMemory();
+    bool isDataRead = container.readData(bufferData);
+    buffer->unmapMemory();
+    if (!isDataRead) {
+        return false;
+    }
+
+    // One copy region per level; the array layers and cube map faces of a level are stored consecutively.
+    const std::vector<TextureContainerLevel>& levels = container.getLevels();
+    std::vector<VkBufferImageCopy> regions(levels.size());
+    for (size_t level = 0; level < levels.size(); level++) {
+        const TextureContainerLevel& levelInfo = levels.at(level);
+        VkBufferImageCopy& region = regions.at(level);
+        region.bufferOffset = levelInfo.offset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = uint32_t(level);
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = container.getNumArrayLayers() * container.getNumFaces();
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { levelInfo.width, levelInfo.height, levelInfo.depth };
+    }
+
+    if (transientCommandBuffer) {
+        commandBuffer = device->beginSingleTimeCommands();
+    }
+
+    image->transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, commandBuffer);
+    vkCmdCopyBufferToImage(
+            commandBuffer, buffer->getVkBuffer(), image->getVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            uint32_t(regions.size()), regions.data());
+    if ((image->getImageSettings().usage & VK_IMAGE_USAGE_SAMPLED_BIT) != 0) {
+        image->transitionImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, commandBuffer);
+    }
+
+    if (transientCommandBuffer) {
+        device->endSingleTimeCommands(commandBuffer);
+    } else {
+        *stagingBuffer = buffer;
+    }
+    return true;
+}
+
+TexturePtr loadTextureFromContainerFile(
+        Device* device, const std::string& filename, const ImageSamplerSettings& samplerSettings,
+        VkImageUsageFlags imageUsage) {
+    TextureContainer container;
+    if (!container.open(filename)) {
+        return {};
+    }
+
+    auto format = VkFormat(container.getFormat());
+    if (container.getIsCompressed() && !device->getPhysicalDeviceFeatures().textureCompressionBC) {
+        Logfile::get()->writeError(
+                "Error in loadTextureFromContainerFile: The device does not support BC texture compression (file: \""
+                + filename + "\").");
+        return {};
+    }
+    if (!device->getSupportsFormat(format)) {
+        Logfile::get()->writeError(
+                "Error in loadTextureFromContainerFile: The device does not support the format "
+                + convertVkFormatToString(format) + " (file: \"" + filename + "\").");
+        return {};
+    }
+
+    ImageSettings imageSettings;
+    imageSettings.width = container.getWidth();
+    imageSettings.height = container.getHeight();
+    imageSettings.depth = container.getDepth();
+    imageSettings.mipLevels = container.getNumMipLevels();
+    imageSettings.arrayLayers = container.getNumArrayLayers() * container.getNumFaces();
+    imageSettings.format = format;
+    imageSettings.usage = imageUsage | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+    VkImageViewType imageViewType;
+    if (container.getIsCubeMap()) {
+        imageSettings.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+        imageViewType = container.getIsArray() ? VK_IMAGE_VIEW_TYPE_CUBE_ARRAY : VK_IMAGE_VIEW_TYPE_CUBE;
+    } else if (container.getNumDimensions() == 3) {
+        imageSettings.imageType = VK_IMAGE_TYPE_3D;
+        imageViewType = VK_IMAGE_VIEW_TYPE_3D;
+    } else if (container.getNumDimensions() == 1) {
+        imageSettings.imageType = VK_IMAGE_TYPE_1D;
+        imageViewType = container.getIsArray() ? VK_IMAGE_VIEW_TYPE_1D_ARRAY : VK_IMAGE_VIEW_TYPE_1D;
+    } else {
+        imageViewType = container.getIsArray() ? VK_IMAGE_VIEW_TYPE_2D_ARRAY : VK_IMAGE_VIEW_TYPE_2D;
+    }
+
+    auto texture = std::make_shared<Texture>(device, imageSettings, imageViewType, samplerSettings);
+    if (!uploadTextureContainerData(container, texture->getImage())) {
+        return {};
+    }
+    return texture;
+}
+
+}}
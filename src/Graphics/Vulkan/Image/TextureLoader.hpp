@@ -0,0 +1,74 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_TEXTURELOADER_HPP
+#define SGL_TEXTURELOADER_HPP
+
+#include <string>
+
+#include "Image.hpp"
+
+namespace sgl {
+class TextureContainer;
+}
+
+namespace sgl { namespace vk {
+
+/**
+ * Loads a texture from a KTX2 or DDS container file (@see TextureContainer). The texel data is read directly into a
+ * staging buffer and all levels stored in the file are copied to the image with one copy command, so neither decoding
+ * nor mipmap generation on the GPU is necessary. Block compressed formats (BC1-BC7) need the device feature
+ * textureCompressionBC. 2D arrays, cube maps and 3D textures are supported.
+ * @param device The device to create the texture on.
+ * @param filename The file name of the .ktx2 or .dds file.
+ * @param samplerSettings The settings of the sampler.
+ * @param imageUsage The usage flags of the image (VK_IMAGE_USAGE_TRANSFER_DST_BIT is always added).
+ * @return The loaded texture, or a null pointer if the file could not be loaded.
+ */
+DLL_OBJECT TexturePtr loadTextureFromContainerFile(
+        Device* device, const std::string& filename,
+        const ImageSamplerSettings& samplerSettings = ImageSamplerSettings(),
+        VkImageUsageFlags imageUsage = VK_IMAGE_USAGE_SAMPLED_BIT);
+
+/**
+ * Uploads the data of an opened texture container to an image with matching settings (@see TextureContainer::open).
+ * @param container The texture container.
+ * @param image The image created with the format, extent, mip levels and array layers of the container.
+ * @param commandBuffer The command buffer. If VK_NULL_HANDLE is specified, a transient command buffer is used and
+ * the function will wait with vkQueueWaitIdle for the command to finish on the GPU. Otherwise, the staging buffer is
+ * returned via 'stagingBuffer' and needs to be kept alive until the command buffer has finished execution.
+ * @param stagingBuffer Where the staging buffer is stored (only necessary if a command buffer is passed).
+ * @return Whether reading the data was successful.
+ */
+DLL_OBJECT bool uploadTextureContainerData(
+        TextureContainer& container, const ImagePtr& image,
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE, BufferPtr* stagingBuffer = nullptr);
+
+}}
+
+#endif //SGL_TEXTURELOADER_HPP
@@ -71,11 +71,12 @@ ComputePipeline::ComputePipeline(Device* device, const ComputePipelineInfo& pipe
     setPipelineCreateInfoPNextInternal(pipelineCreateInfo.pNext, pipelineInfo.useShader64BitIndexing);
 
     if (vkCreateComputePipelines(
-            device->getVkDevice(), VK_NULL_HANDLE, 1, &pipelineCreateInfo,
+            device->getVkDevice(), device->getVkPipelineCache(), 1, &pipelineCreateInfo,
             nullptr, &pipeline) != VK_SUCCESS) {
         Logfile::get()->throwError(
                 "Error in ComputePipeline::ComputePipeline: Could not create a Compute pipeline.");
     }
+    onPipelineCreatedInternal();
 }
 
 ComputePipeline::~ComputePipeline() = default;
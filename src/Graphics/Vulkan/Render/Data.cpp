@@ -26,6 +26,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstring>
+
 #include <Utils/AppSettings.hpp>
 #include <Utils/File/Logfile.hpp>
 #include <Utils/Events/EventManager.hpp>
@@ -33,6 +35,7 @@
 #include "../Utils/Swapchain.hpp"
 #include "Helpers.hpp"
 #include "Renderer.hpp"
+#include "DescriptorSetCache.hpp"
 #include "AccelerationStructure.hpp"
 #include "ComputePipeline.hpp"
 #include "GraphicsPipeline.hpp"
@@ -42,7 +45,8 @@
 namespace sgl { namespace vk {
 
 RenderData::RenderData(Renderer* renderer, ShaderStagesPtr& shaderStages)
-        : renderer(renderer), device(renderer->getDevice()), shaderStages(shaderStages) {
+        : renderer(renderer), device(renderer->getDevice()), shaderStages(shaderStages),
+          descriptorSetCache(renderer->getDescriptorSetCache()) {
     swapchainRecreatedEventListenerToken = EventManager::get()->addListener(
             RESOLUTION_CHANGED_EVENT, [this](const EventPtr&){ this->onSwapchainRecreated(); });
     onSwapchainRecreated();
@@ -52,11 +56,35 @@ RenderData::~RenderData() {
     EventManager::get()->removeListener(RESOLUTION_CHANGED_EVENT, swapchainRecreatedEventListenerToken);
 
     for (FrameData& frameData : frameDataList) {
+        _freeDescriptorSet(frameData);
+    }
+    frameDataList.clear();
+}
+
+void RenderData::_freeDescriptorSet(FrameData& frameData) {
+    if (frameData.descriptorSet == VK_NULL_HANDLE) {
+        return;
+    }
+    if (frameData.isDescriptorSetShared) {
+        descriptorSetCache->release(frameData.descriptorSet);
+    } else {
         vkFreeDescriptorSets(
                 device->getVkDevice(), renderer->getVkDescriptorPool(),
                 1, &frameData.descriptorSet);
     }
-    frameDataList.clear();
+    frameData.descriptorSet = VK_NULL_HANDLE;
+    frameData.isDescriptorSetShared = false;
+}
+
+void RenderData::setUseDescriptorSetCache(bool _useDescriptorSetCache) {
+    if (useDescriptorSetCache == _useDescriptorSetCache) {
+        return;
+    }
+    useDescriptorSetCache = _useDescriptorSetCache;
+    for (FrameData& frameData : frameDataList) {
+        _freeDescriptorSet(frameData);
+    }
+    isDirty = true;
 }
 
 //RenderDataPtr RenderData::copy(ShaderStagesPtr& shaderStages) {
@@ -365,12 +393,22 @@ void RenderData::_updateDescriptorSets() {
     //            "set (1).");
     //}
 
+    VkDescriptorUpdateTemplate descriptorUpdateTemplate =
+            shaderStages->getVkDescriptorUpdateTemplate(0, sizeof(DescriptorUpdateData));
+    if (descriptorUpdateTemplate != VK_NULL_HANDLE) {
+        _updateDescriptorSetsWithTemplate(descriptorUpdateTemplate);
+        return;
+    }
+
     const VkDescriptorSetLayout& descriptorSetLayout = descriptorSetLayouts.at(0);
     const std::vector<DescriptorInfo>& descriptorSetInfo = shaderStages->getDescriptorSetsInfo().find(0)->second;
 
     uint32_t variableDescriptorCount = 0;
     VkDescriptorSetVariableDescriptorCountAllocateInfo variableDescriptorCountAllocInfo{};
     for (FrameData& frameData : frameDataList) {
+        if (frameData.isDescriptorSetShared) {
+            _freeDescriptorSet(frameData);
+        }
         if (frameData.descriptorSet == VK_NULL_HANDLE) {
             VkDescriptorSetAllocateInfo allocInfo{};
             allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
@@ -600,16 +638,133 @@ void RenderData::_updateDescriptorSets() {
     }
 }
 
+void RenderData::_updateDescriptorSetsWithTemplate(VkDescriptorUpdateTemplate descriptorUpdateTemplate) {
+    const VkDescriptorSetLayout& descriptorSetLayout = shaderStages->getVkDescriptorSetLayouts().at(0);
+    const std::vector<DescriptorInfo>& descriptorSetInfo = shaderStages->getDescriptorSetsInfo().find(0)->second;
+
+    // Descriptor i is stored at index i of the update data (@see ShaderStages::getVkDescriptorUpdateTemplate).
+    std::vector<DescriptorUpdateData>& updateData = descriptorUpdateData;
+    std::vector<std::shared_ptr<void>>& resources = descriptorResources;
+    updateData.resize(descriptorSetInfo.size());
+    for (FrameData& frameData : frameDataList) {
+        // The cache hashes the data bytewise, so the padding of the unions needs to be zeroed.
+        memset(updateData.data(), 0, updateData.size() * sizeof(DescriptorUpdateData));
+        resources.clear();
+
+        for (size_t i = 0; i < descriptorSetInfo.size(); i++) {
+            DescriptorUpdateData& descriptorData = updateData.at(i);
+            const DescriptorInfo& descriptorInfo = descriptorSetInfo.at(i);
+
+            if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_SAMPLER
+                        || descriptorInfo.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER
+                        || descriptorInfo.type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE
+                        || descriptorInfo.type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE) {
+                if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_SAMPLER
+                            || descriptorInfo.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER) {
+                    auto it = frameData.imageSamplers.find(descriptorInfo.binding);
+                    if (it == frameData.imageSamplers.end()) {
+                        Logfile::get()->throwError(
+                                "Error in RenderData::_updateDescriptorSets: Couldn't find sampler with binding "
+                                + std::to_string(descriptorInfo.binding) + ".");
+                    }
+                    descriptorData.imageInfo.sampler = it->second->getVkSampler();
+                    resources.push_back(it->second);
+                }
+                if (descriptorInfo.type != VK_DESCRIPTOR_TYPE_SAMPLER) {
+                    auto it = frameData.imageViews.find(descriptorInfo.binding);
+                    if (it == frameData.imageViews.end()) {
+                        Logfile::get()->throwError(
+                                "Error in RenderData::_updateDescriptorSets: Couldn't find image view with binding "
+                                + std::to_string(descriptorInfo.binding) + ".");
+                    }
+                    descriptorData.imageInfo.imageView = it->second->getVkImageView();
+                    if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE) {
+                        descriptorData.imageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+                    } else {
+                        descriptorData.imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                    }
+                    resources.push_back(it->second);
+                }
+            } else if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
+                       || descriptorInfo.type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER) {
+                auto it = frameData.bufferViews.find(descriptorInfo.binding);
+                if (it == frameData.bufferViews.end()) {
+                    Logfile::get()->throwError(
+                            "Error in RenderData::_updateDescriptorSets: Couldn't find buffer view with binding "
+                            + std::to_string(descriptorInfo.binding) + ".");
+                }
+                descriptorData.bufferView = it->second->getVkBufferView();
+                resources.push_back(it->second);
+            } else if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+                       || descriptorInfo.type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+                       || descriptorInfo.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+                       || descriptorInfo.type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
+                auto it = frameData.buffers.find(descriptorInfo.binding);
+                if (it == frameData.buffers.end()) {
+                    Logfile::get()->throwError(
+                            "Error in RenderData::_updateDescriptorSets: Couldn't find buffer with binding "
+                            + std::to_string(descriptorInfo.binding) + ".");
+                }
+                descriptorData.bufferInfo.buffer = it->second->getVkBuffer();
+                descriptorData.bufferInfo.offset = 0;
+                if (descriptorInfo.size > 0) {
+                    descriptorData.bufferInfo.range = std::min(
+                            it->second->getSizeInBytes(), size_t(descriptorInfo.size));
+                } else {
+                    descriptorData.bufferInfo.range = it->second->getSizeInBytes();
+                }
+                resources.push_back(it->second);
+            } else if (descriptorInfo.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+                auto it = frameData.accelerationStructures.find(descriptorInfo.binding);
+                if (it == frameData.accelerationStructures.end()) {
+                    Logfile::get()->throwError(
+                            "Error in RenderData::_updateDescriptorSets: Couldn't find acceleration structure with "
+                            "binding " + std::to_string(descriptorInfo.binding) + ".");
+                }
+                descriptorData.accelerationStructure = it->second->getAccelerationStructure();
+                resources.push_back(it->second);
+            }
+        }
+
+        if (useDescriptorSetCache) {
+            // Acquire before releasing, so an unchanged set is not evicted in between.
+            VkDescriptorSet descriptorSet = descriptorSetCache->acquire(
+                    descriptorSetLayout, descriptorUpdateTemplate, updateData, resources);
+            _freeDescriptorSet(frameData);
+            frameData.descriptorSet = descriptorSet;
+            frameData.isDescriptorSetShared = true;
+            continue;
+        }
+
+        if (frameData.isDescriptorSetShared) {
+            _freeDescriptorSet(frameData);
+        }
+        if (frameData.descriptorSet == VK_NULL_HANDLE) {
+            VkDescriptorSetAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.descriptorPool = renderer->getVkDescriptorPool();
+            allocInfo.descriptorSetCount = 1;
+            allocInfo.pSetLayouts = &descriptorSetLayout;
+            if (vkAllocateDescriptorSets(
+                    device->getVkDevice(), &allocInfo, &frameData.descriptorSet) != VK_SUCCESS) {
+                Logfile::get()->throwError(
+                        "Error in RenderData::_updateDescriptorSets: Failed to allocate descriptor sets!");
+            }
+        }
+        vkUpdateDescriptorSetWithTemplate(
+                device->getVkDevice(), frameData.descriptorSet, descriptorUpdateTemplate, updateData.data());
+    }
+    // Don't keep the resources alive longer than necessary; the capacity is kept for the next update.
+    resources.clear();
+}
+
 void RenderData::onSwapchainRecreated() {
     Swapchain* swapchain = AppSettings::get()->getSwapchain();
     size_t numImages = swapchain ? swapchain->getNumImages() : 1;
     if (frameDataList.size() > numImages) {
         // Free the now unused frame data.
         for (size_t i = numImages; i < frameDataList.size(); i++) {
-            FrameData& frameData = frameDataList.at(i);
-            vkFreeDescriptorSets(
-                    device->getVkDevice(), renderer->getVkDescriptorPool(),
-                    1, &frameData.descriptorSet);
+            _freeDescriptorSet(frameDataList.at(i));
         }
         frameDataList.resize(numImages);
     } else if (frameDataList.size() < numImages) {
@@ -37,6 +37,7 @@
 #include "../Buffers/Buffer.hpp"
 
 #include "ShaderGroupSettings.hpp"
+#include "DescriptorSetCache.hpp"
 
 namespace sgl {
 typedef uint32_t ListenerToken;
@@ -170,6 +171,15 @@ public:
     inline VkDescriptorSet getVkDescriptorSet(uint32_t frameIdx) { return frameDataList.at(frameIdx).descriptorSet; }
     VkDescriptorSet getVkDescriptorSet();
 
+    /**
+     * Whether to get the descriptor sets from the descriptor set cache of the renderer (@see DescriptorSetCache).
+     * Render data objects using the same resources then share their descriptor sets. This is only used for descriptor
+     * sets that can be written using a descriptor update template (i.e., sets without descriptor arrays).
+     * NOTE: Dynamic data should not be used together with the cache, as the per-frame copies are never shared.
+     */
+    void setUseDescriptorSetCache(bool _useDescriptorSetCache);
+    [[nodiscard]] inline bool getUseDescriptorSetCache() const { return useDescriptorSetCache; }
+
     struct FrameData {
         std::map<uint32_t, BufferPtr> buffers;
         std::map<uint32_t, BufferViewPtr> bufferViews;
@@ -182,6 +192,7 @@ public:
         std::map<uint32_t, std::vector<ImageViewPtr>> imageViewArrays;
 
         VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        bool isDescriptorSetShared = false; ///< Whether the set is owned by the descriptor set cache.
     };
     inline FrameData& getFrameData(uint32_t frameIdx) { return frameDataList.at(frameIdx); }
 
@@ -189,12 +200,21 @@ protected:
     void _updateDescriptorSets();
 
 private:
+    void _updateDescriptorSetsWithTemplate(VkDescriptorUpdateTemplate descriptorUpdateTemplate);
+    void _freeDescriptorSet(FrameData& frameData);
+
     ListenerToken swapchainRecreatedEventListenerToken;
     bool isDirty = false;
+    bool useDescriptorSetCache = false;
 
     Renderer* renderer;
     Device* device;
     ShaderStagesPtr shaderStages;
+    std::shared_ptr<DescriptorSetCache> descriptorSetCache; ///< Shared, as render data may outlive the renderer.
+
+    // Reused by @see _updateDescriptorSetsWithTemplate to avoid allocations on every update.
+    std::vector<DescriptorUpdateData> descriptorUpdateData;
+    std::vector<std::shared_ptr<void>> descriptorResources;
 
     std::map<uint32_t, bool> buffersStatic;
     std::map<uint32_t, bool> bufferViewsStatic;
@@ -0,0 +1,177 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <Utils/HashCombine.hpp>
+#include <Utils/File/Logfile.hpp>
+#include "../Utils/Device.hpp"
+#include "DescriptorSetCache.hpp"
+
+namespace sgl { namespace vk {
+
+DescriptorSetCache::DescriptorSetCache(Device* device, VkDescriptorPool descriptorPool)
+        : device(device), descriptorPool(descriptorPool) {
+}
+
+DescriptorSetCache::~DescriptorSetCache() {
+    destroy();
+}
+
+void DescriptorSetCache::destroy() {
+    if (isDestroyed) {
+        return;
+    }
+    isDestroyed = true;
+    for (auto& it : entryMap) {
+        vkFreeDescriptorSets(device->getVkDevice(), descriptorPool, 1, &it.second.descriptorSet);
+    }
+    entryMap.clear();
+    hashMap.clear();
+}
+
+size_t DescriptorSetCache::computeHash(
+        VkDescriptorSetLayout descriptorSetLayout, const std::vector<DescriptorUpdateData>& updateData) {
+    size_t hash = std::hash<std::string_view>{}(std::string_view(
+            reinterpret_cast<const char*>(updateData.data()), updateData.size() * sizeof(DescriptorUpdateData)));
+    hash_combine(hash, reinterpret_cast<uintptr_t>(descriptorSetLayout));
+    return hash;
+}
+
+VkDescriptorSet DescriptorSetCache::acquire(
+        VkDescriptorSetLayout descriptorSetLayout, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+        const std::vector<DescriptorUpdateData>& updateData, std::vector<std::shared_ptr<void>>& resources) {
+    if (isDestroyed) {
+        Logfile::get()->throwError(
+                "Error in DescriptorSetCache::acquire: The cache was already destroyed together with its renderer.");
+    }
+    size_t hash = computeHash(descriptorSetLayout, updateData);
+    auto range = hashMap.equal_range(hash);
+    for (auto it = range.first; it != range.second; it++) {
+        Entry& entry = entryMap.find(it->second)->second;
+        if (entry.descriptorSetLayout == descriptorSetLayout && entry.updateData.size() == updateData.size()
+                && memcmp(
+                        entry.updateData.data(), updateData.data(),
+                        updateData.size() * sizeof(DescriptorUpdateData)) == 0) {
+            if (entry.refCount == 0) {
+                numUnusedSets--;
+            }
+            entry.refCount++;
+            numHits++;
+            return entry.descriptorSet;
+        }
+    }
+
+    numMisses++;
+    if (numUnusedSets > maxNumUnusedSets) {
+        freeUnusedSets();
+    }
+
+    Entry entry;
+    entry.descriptorSetLayout = descriptorSetLayout;
+    entry.updateData = updateData;
+    entry.resources = std::move(resources);
+    entry.hash = hash;
+    entry.refCount = 1;
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = descriptorPool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &descriptorSetLayout;
+    if (vkAllocateDescriptorSets(device->getVkDevice(), &allocInfo, &entry.descriptorSet) != VK_SUCCESS) {
+        Logfile::get()->throwError(
+                "Error in DescriptorSetCache::acquire: Failed to allocate descriptor sets!");
+    }
+    vkUpdateDescriptorSetWithTemplate(
+            device->getVkDevice(), entry.descriptorSet, descriptorUpdateTemplate, entry.updateData.data());
+
+    VkDescriptorSet descriptorSet = entry.descriptorSet;
+    hashMap.insert(std::make_pair(hash, descriptorSet));
+    entryMap.insert(std::make_pair(descriptorSet, std::move(entry)));
+    return descriptorSet;
+}
+
+void DescriptorSetCache::release(VkDescriptorSet descriptorSet) {
+    if (isDestroyed) {
+        // The set was already freed together with the descriptor pool of the renderer.
+        return;
+    }
+    auto it = entryMap.find(descriptorSet);
+    if (it == entryMap.end() || it->second.refCount == 0) {
+        Logfile::get()->writeError(
+                "Error in DescriptorSetCache::release: The descriptor set is not referenced by the cache.");
+        return;
+    }
+    Entry& entry = it->second;
+    entry.refCount--;
+    if (entry.refCount == 0) {
+        entry.releaseFrameIdx = frameIdx;
+        numUnusedSets++;
+    }
+}
+
+void DescriptorSetCache::beginFrame(uint32_t _numFramesInFlight) {
+    frameIdx++;
+    numFramesInFlight = _numFramesInFlight;
+}
+
+void DescriptorSetCache::freeUnusedSets() {
+    // Frees the sets that were released the longest time ago first, until only half of the maximum is left.
+    std::vector<std::pair<uint64_t, VkDescriptorSet>> unusedSets;
+    for (auto& it : entryMap) {
+        const Entry& entry = it.second;
+        if (entry.refCount == 0 && entry.releaseFrameIdx + numFramesInFlight < frameIdx) {
+            unusedSets.emplace_back(entry.releaseFrameIdx, entry.descriptorSet);
+        }
+    }
+    std::sort(unusedSets.begin(), unusedSets.end());
+
+    size_t targetNumUnusedSets = maxNumUnusedSets / 2;
+    for (const auto& unusedSet : unusedSets) {
+        if (numUnusedSets <= targetNumUnusedSets) {
+            break;
+        }
+        VkDescriptorSet descriptorSet = unusedSet.second;
+        auto itEntry = entryMap.find(descriptorSet);
+        auto range = hashMap.equal_range(itEntry->second.hash);
+        for (auto it = range.first; it != range.second; it++) {
+            if (it->second == descriptorSet) {
+                hashMap.erase(it);
+                break;
+            }
+        }
+        entryMap.erase(itEntry);
+        vkFreeDescriptorSets(device->getVkDevice(), descriptorPool, 1, &descriptorSet);
+        numUnusedSets--;
+    }
+}
+
+}}
@@ -0,0 +1,126 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_DESCRIPTORSETCACHE_HPP
+#define SGL_DESCRIPTORSETCACHE_HPP
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+#include "../libs/volk/volk.h"
+
+namespace sgl { namespace vk {
+
+class Device;
+
+/**
+ * Flat storage for one descriptor in a descriptor update template (@see ShaderStages::getVkDescriptorUpdateTemplate).
+ * Descriptor i of a descriptor set is stored at index i, regardless of its type.
+ */
+union DescriptorUpdateData {
+    VkDescriptorImageInfo imageInfo;
+    VkDescriptorBufferInfo bufferInfo;
+    VkBufferView bufferView;
+    VkAccelerationStructureKHR accelerationStructure;
+};
+
+/**
+ * Cache of descriptor sets owned by @see Renderer that is keyed by the content of the descriptor sets. Render data
+ * objects using the same resources with the same descriptor set layout share one descriptor set, and switching back to
+ * a combination of resources that was used before (e.g., when cycling through the time steps of a time series) does
+ * not need any descriptor set update.
+ *
+ * A cached set keeps a reference to its resources, so a resource cannot be destroyed while a set referencing it is in
+ * the cache (which could otherwise lead to a stale set being reused if a new object gets the same handle). Sets that
+ * are not referenced anymore are only freed once no frame in flight can use them anymore and the number of
+ * unreferenced sets exceeds @see setMaxNumUnusedSets.
+ *
+ * The cache is shared by the renderer and the render data objects using it, as render data may be destroyed after the
+ * renderer. The renderer calls @see destroy before destroying its descriptor pool; releasing sets is a no-op after that.
+ */
+class DLL_OBJECT DescriptorSetCache {
+public:
+    DescriptorSetCache(Device* device, VkDescriptorPool descriptorPool);
+    ~DescriptorSetCache();
+    DescriptorSetCache(const DescriptorSetCache&) = delete;
+    DescriptorSetCache& operator=(const DescriptorSetCache&) = delete;
+
+    /**
+     * Returns a descriptor set with the passed content and increments its reference count.
+     * @param descriptorSetLayout The layout of the descriptor set.
+     * @param descriptorUpdateTemplate The template used for writing the descriptors if a new set is allocated.
+     * @param updateData The descriptor data. Padding needs to be zeroed, as the data is hashed bytewise.
+     * @param resources The resources referenced by the descriptors, which are kept alive while the set is cached.
+     */
+    VkDescriptorSet acquire(
+            VkDescriptorSetLayout descriptorSetLayout, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+            const std::vector<DescriptorUpdateData>& updateData, std::vector<std::shared_ptr<void>>& resources);
+    /// Decrements the reference count of a descriptor set returned by @see acquire.
+    void release(VkDescriptorSet descriptorSet);
+
+    /// Called by @see Renderer when a new frame starts.
+    void beginFrame(uint32_t numFramesInFlight);
+    /// Frees all descriptor sets. Called by @see Renderer before the descriptor pool is destroyed.
+    void destroy();
+
+    inline void setMaxNumUnusedSets(size_t _maxNumUnusedSets) { maxNumUnusedSets = _maxNumUnusedSets; }
+    [[nodiscard]] inline size_t getNumSets() const { return entryMap.size(); }
+    [[nodiscard]] inline uint64_t getNumHits() const { return numHits; }
+    [[nodiscard]] inline uint64_t getNumMisses() const { return numMisses; }
+
+private:
+    struct Entry {
+        VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
+        std::vector<DescriptorUpdateData> updateData;
+        std::vector<std::shared_ptr<void>> resources;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        size_t hash = 0;
+        uint32_t refCount = 0;
+        uint64_t releaseFrameIdx = 0;
+    };
+    static size_t computeHash(
+            VkDescriptorSetLayout descriptorSetLayout, const std::vector<DescriptorUpdateData>& updateData);
+    void freeUnusedSets();
+
+    Device* device;
+    VkDescriptorPool descriptorPool;
+    std::unordered_multimap<size_t, VkDescriptorSet> hashMap;
+    std::unordered_map<VkDescriptorSet, Entry> entryMap;
+    size_t numUnusedSets = 0;
+    size_t maxNumUnusedSets = 256;
+    uint64_t frameIdx = 0;
+    uint32_t numFramesInFlight = 3;
+    uint64_t numHits = 0, numMisses = 0;
+    bool isDestroyed = false;
+};
+
+}}
+
+#endif //SGL_DESCRIPTORSETCACHE_HPP
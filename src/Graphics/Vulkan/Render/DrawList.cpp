@@ -0,0 +1,133 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#include "../Buffers/Framebuffer.hpp"
+#include "GraphicsPipeline.hpp"
+#include "Data.hpp"
+#include "DrawList.hpp"
+
+namespace sgl { namespace vk {
+
+void DrawList::add(const RasterDataPtr& rasterData) {
+    add(rasterData, rasterData->getGraphicsPipeline()->getFramebuffer());
+}
+
+void DrawList::add(const RasterDataPtr& rasterData, const FramebufferPtr& framebuffer) {
+    DrawListEntry entry;
+    entry.rasterData = rasterData;
+    entry.framebuffer = framebuffer;
+    entry.subpassIndex = rasterData->getGraphicsPipeline()->getSubpassIndex();
+    entry.order = uint32_t(entries.size());
+    entries.push_back(std::move(entry));
+    isSorted = false;
+}
+
+void DrawList::clear() {
+    entries.clear();
+    framebufferGroups.clear();
+    isSorted = true;
+}
+
+const std::vector<DrawListEntry>& DrawList::getSortedEntries() {
+    if (isSorted) {
+        return entries;
+    }
+
+    // The entries may have been sorted by a previous call, so they are first restored to the order of the adds.
+    auto orderLess = [](const DrawListEntry& a, const DrawListEntry& b) { return a.order < b.order; };
+    if (!std::is_sorted(entries.begin(), entries.end(), orderLess)) {
+        std::sort(entries.begin(), entries.end(), orderLess);
+    }
+
+    framebufferGroups.clear();
+    if (sortMode == DrawListSortMode::STATE) {
+        // The number of distinct framebuffers is usually very small, so a linear search is sufficient.
+        for (DrawListEntry& entry : entries) {
+            auto it = std::find(framebufferGroups.begin(), framebufferGroups.end(), entry.framebuffer.get());
+            entry.framebufferGroup = uint32_t(it - framebufferGroups.begin());
+            if (it == framebufferGroups.end()) {
+                framebufferGroups.push_back(entry.framebuffer.get());
+            }
+            entry.descriptorSet = entry.rasterData->getVkDescriptorSet();
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const DrawListEntry& a, const DrawListEntry& b) {
+            if (a.framebufferGroup != b.framebufferGroup) {
+                return a.framebufferGroup < b.framebufferGroup;
+            }
+            if (a.subpassIndex != b.subpassIndex) {
+                return a.subpassIndex < b.subpassIndex;
+            }
+            GraphicsPipeline* pipelineA = a.rasterData->getGraphicsPipeline().get();
+            GraphicsPipeline* pipelineB = b.rasterData->getGraphicsPipeline().get();
+            if (pipelineA != pipelineB) {
+                return pipelineA < pipelineB;
+            }
+            if (a.descriptorSet != b.descriptorSet) {
+                return a.descriptorSet < b.descriptorSet;
+            }
+            VkBuffer indexBufferA = a.rasterData->getHasIndexBuffer() ? a.rasterData->getVkIndexBuffer() : nullptr;
+            VkBuffer indexBufferB = b.rasterData->getHasIndexBuffer() ? b.rasterData->getVkIndexBuffer() : nullptr;
+            if (indexBufferA != indexBufferB) {
+                return indexBufferA < indexBufferB;
+            }
+            const std::vector<VkBuffer>& vertexBuffersA = a.rasterData->getVkVertexBuffers();
+            const std::vector<VkBuffer>& vertexBuffersB = b.rasterData->getVkVertexBuffers();
+            if (vertexBuffersA != vertexBuffersB) {
+                return vertexBuffersA < vertexBuffersB;
+            }
+            return a.order < b.order;
+        });
+    } else {
+        // Only consecutive draws with the same framebuffer are grouped, as reordering draws with different
+        // framebuffers could change the results.
+        uint32_t framebufferGroup = 0;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (i > 0 && entries.at(i).framebuffer != entries.at(i - 1).framebuffer) {
+                framebufferGroup++;
+            }
+            entries.at(i).framebufferGroup = framebufferGroup;
+        }
+        std::sort(entries.begin(), entries.end(), [](const DrawListEntry& a, const DrawListEntry& b) {
+            if (a.framebufferGroup != b.framebufferGroup) {
+                return a.framebufferGroup < b.framebufferGroup;
+            }
+            if (a.subpassIndex != b.subpassIndex) {
+                return a.subpassIndex < b.subpassIndex;
+            }
+            return a.order < b.order;
+        });
+    }
+
+    isSorted = true;
+    return entries;
+}
+
+}}
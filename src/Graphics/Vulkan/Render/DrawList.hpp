@@ -0,0 +1,100 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_DRAWLIST_HPP
+#define SGL_DRAWLIST_HPP
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "../libs/volk/volk.h"
+
+namespace sgl { namespace vk {
+
+class Framebuffer;
+typedef std::shared_ptr<Framebuffer> FramebufferPtr;
+class RasterData;
+typedef std::shared_ptr<RasterData> RasterDataPtr;
+
+enum class DrawListSortMode {
+    /// Draws are recorded in the order they were added, e.g., for blending. A new render pass is started whenever the
+    /// framebuffer changes.
+    NONE,
+    /// Draws are sorted by pipeline, descriptor set, index buffer and vertex buffers to minimize the number of binds.
+    /// All draws with the same framebuffer are merged into one render pass.
+    STATE
+};
+
+struct DLL_OBJECT DrawListEntry {
+    RasterDataPtr rasterData;
+    FramebufferPtr framebuffer;
+    uint32_t framebufferGroup = 0; ///< Index of the render pass the draw is recorded in (set when sorting).
+    uint32_t subpassIndex = 0;
+    uint32_t order = 0; ///< Index in the order of @see DrawList::add calls.
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE; ///< Descriptor set of the current frame when sorting.
+};
+
+/**
+ * List of draws that is recorded with @see Renderer::render(DrawList&). Consecutive draws with the same framebuffer
+ * are recorded in one render pass instead of one render pass per draw, i.e., the attachments are only loaded and
+ * stored once per render pass. With DrawListSortMode::STATE, all draws with the same framebuffer are recorded in one
+ * render pass, and framebuffers are processed in the order of their first appearance in the list. In this case, draws
+ * in one list must not depend on the results of another framebuffer of the same list.
+ *
+ * The list can be reused over multiple frames. @see clear keeps the allocated memory, so recording does not need any
+ * heap allocations per draw once the list has reached its maximum size.
+ */
+class DLL_OBJECT DrawList {
+public:
+    /// Adds a draw using the framebuffer of the graphics pipeline of the raster data.
+    void add(const RasterDataPtr& rasterData);
+    void add(const RasterDataPtr& rasterData, const FramebufferPtr& framebuffer);
+    /// Removes all draws, but keeps the allocated memory.
+    void clear();
+
+    inline void setSortMode(DrawListSortMode _sortMode) { sortMode = _sortMode; isSorted = false; }
+    [[nodiscard]] inline DrawListSortMode getSortMode() const { return sortMode; }
+    [[nodiscard]] inline bool empty() const { return entries.empty(); }
+    [[nodiscard]] inline size_t size() const { return entries.size(); }
+
+    /// Returns the draws in an unspecified order.
+    [[nodiscard]] inline const std::vector<DrawListEntry>& getEntries() const { return entries; }
+    /// Returns the draws in recording order (grouped by framebuffer and subpass, and optionally sorted by state).
+    const std::vector<DrawListEntry>& getSortedEntries();
+
+private:
+    std::vector<DrawListEntry> entries;
+    std::vector<Framebuffer*> framebufferGroups;
+    DrawListSortMode sortMode = DrawListSortMode::STATE;
+    bool isSorted = true;
+};
+
+}}
+
+#endif //SGL_DRAWLIST_HPP
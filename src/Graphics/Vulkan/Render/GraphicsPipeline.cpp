@@ -496,11 +496,12 @@ GraphicsPipeline::GraphicsPipeline(Device* device, const GraphicsPipelineInfo& p
     setPipelineCreateInfoPNextInternal(pipelineCreateInfo.pNext, pipelineInfo.useShader64BitIndexing);
 
     if (vkCreateGraphicsPipelines(
-            device->getVkDevice(), VK_NULL_HANDLE, 1, &pipelineCreateInfo,
+            device->getVkDevice(), device->getVkPipelineCache(), 1, &pipelineCreateInfo,
             nullptr, &pipeline) != VK_SUCCESS) {
         Logfile::get()->throwError(
                 "Error in GraphicsPipeline::GraphicsPipeline: Could not create a graphics pipeline.");
     }
+    onPipelineCreatedInternal();
 }
 
 }}
@@ -29,6 +29,7 @@
 #include <Utils/File/Logfile.hpp>
 #include "../Utils/Device.hpp"
 #include "../Shader/Shader.hpp"
+#include "PipelineCache.hpp"
 #include "Pipeline.hpp"
 
 namespace sgl { namespace vk {
@@ -66,6 +67,18 @@ void Pipeline::setPipelineCreateInfoPNextInternal(const void*& pNext, bool useSh
         pNext = &pipelineCreateFlags2CreateInfo;
     }
 #endif
+    PipelineCache* pipelineCache = device->getPipelineCache();
+    if (pipelineCache) {
+        pipelineCache->addCreationFeedback(pNext, creationFeedbackCreateInfo, creationFeedback);
+    }
+    creationStartTime = std::chrono::steady_clock::now();
+}
+
+void Pipeline::onPipelineCreatedInternal() {
+    PipelineCache* pipelineCache = device->getPipelineCache();
+    if (pipelineCache) {
+        pipelineCache->recordPipelineCreation(creationFeedback, creationStartTime);
+    }
 }
 
 Pipeline::~Pipeline() {
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <utility>
+#include <chrono>
 #include "../libs/volk/volk.h"
 
 #ifndef VK_VERSION_1_4
@@ -57,7 +58,10 @@ public:
 
 protected:
     void createPipelineLayout();
+    /// Also starts the statistics of the pipeline cache for the following pipeline creation call.
     void setPipelineCreateInfoPNextInternal(const void*& pNext, bool useShader64BitIndexing);
+    /// Updates the statistics of the pipeline cache after the pipeline was created.
+    void onPipelineCreatedInternal();
 
     Device* device;
     ShaderStagesPtr shaderStages;
@@ -66,6 +70,9 @@ protected:
 #else
     VkPipelineCreateFlags2CreateInfo_Compat pipelineCreateFlags2CreateInfo{};
 #endif
+    VkPipelineCreationFeedbackCreateInfoEXT creationFeedbackCreateInfo{};
+    VkPipelineCreationFeedbackEXT creationFeedback{};
+    std::chrono::time_point<std::chrono::steady_clock> creationStartTime;
 
     VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
     VkPipeline pipeline = VK_NULL_HANDLE;
@@ -0,0 +1,314 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <fstream>
+#include <cstring>
+#include <random>
+#include <filesystem>
+
+#include <Utils/StringUtils.hpp>
+#include <Utils/File/Logfile.hpp>
+#include <Utils/File/FileUtils.hpp>
+#include "../Utils/Device.hpp"
+#include "PipelineCache.hpp"
+
+namespace sgl { namespace vk {
+
+namespace {
+
+const char PIPELINE_CACHE_FILE_MAGIC[8] = { 'S', 'G', 'L', 'P', 'C', 'A', 'C', 'H' };
+const uint32_t PIPELINE_CACHE_FILE_VERSION = 1u;
+
+struct PipelineCacheFileHeader {
+    char magic[8];
+    uint32_t fileVersion;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+    uint64_t dataSize;
+    uint64_t dataHash;
+};
+
+/// FNV-1a hash for detecting corrupted cache files.
+uint64_t computeDataHash(const uint8_t* data, size_t dataSize) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < dataSize; i++) {
+        hash ^= uint64_t(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void fillFileHeader(Device* device, PipelineCacheFileHeader& header) {
+    const VkPhysicalDeviceProperties& properties = device->getPhysicalDeviceProperties();
+    memcpy(header.magic, PIPELINE_CACHE_FILE_MAGIC, sizeof(PIPELINE_CACHE_FILE_MAGIC));
+    header.fileVersion = PIPELINE_CACHE_FILE_VERSION;
+    header.vendorID = properties.vendorID;
+    header.deviceID = properties.deviceID;
+    header.driverVersion = properties.driverVersion;
+    memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+/**
+ * Returns a temporary file name next to the passed file. A random suffix is used, so that multiple processes saving
+ * the cache at the same time do not write to the same temporary file.
+ */
+std::string createTemporaryFilename(const std::string& filename) {
+    std::random_device randomDevice;
+    uint64_t suffix = (uint64_t(randomDevice()) << 32u) | uint64_t(randomDevice());
+    return filename + "." + sgl::toHexString(suffix) + ".tmp";
+}
+
+}
+
+PipelineCache::PipelineCache(Device* device) : device(device) {
+    useCreationFeedback = device->isDeviceExtensionSupported(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+    createPipelineCache(nullptr, 0);
+}
+
+PipelineCache::~PipelineCache() {
+    if (pipelineCache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(device->getVkDevice(), pipelineCache, nullptr);
+        pipelineCache = VK_NULL_HANDLE;
+    }
+}
+
+void PipelineCache::createPipelineCache(const void* initialData, size_t initialDataSize) {
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo{};
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.initialDataSize = initialDataSize;
+    pipelineCacheCreateInfo.pInitialData = initialData;
+    VkPipelineCache newPipelineCache = VK_NULL_HANDLE;
+    VkResult result = vkCreatePipelineCache(
+            device->getVkDevice(), &pipelineCacheCreateInfo, nullptr, &newPipelineCache);
+    if (result != VK_SUCCESS && initialDataSize != 0) {
+        // Drivers may still reject data that passed the header check; fall back to an empty cache.
+        sgl::Logfile::get()->writeWarning(
+                "Warning in PipelineCache::createPipelineCache: The driver rejected the cache data.", false);
+        initialDataSize = 0;
+        pipelineCacheCreateInfo.initialDataSize = 0;
+        pipelineCacheCreateInfo.pInitialData = nullptr;
+        result = vkCreatePipelineCache(device->getVkDevice(), &pipelineCacheCreateInfo, nullptr, &newPipelineCache);
+    }
+    if (result != VK_SUCCESS) {
+        sgl::Logfile::get()->throwError(
+                "Error in PipelineCache::createPipelineCache: vkCreatePipelineCache failed.");
+    }
+
+    if (pipelineCache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(device->getVkDevice(), pipelineCache, nullptr);
+    }
+    pipelineCache = newPipelineCache;
+    loadedDataSize = initialDataSize;
+}
+
+bool PipelineCache::checkCacheDataHeader(const uint8_t* data, size_t dataSize) {
+    // Header of version VK_PIPELINE_CACHE_HEADER_VERSION_ONE (see the Vulkan specification).
+    const size_t vulkanHeaderSize = 16 + VK_UUID_SIZE;
+    if (dataSize < vulkanHeaderSize) {
+        return false;
+    }
+    uint32_t headerSize, headerVersion, vendorID, deviceID;
+    memcpy(&headerSize, data, sizeof(uint32_t));
+    memcpy(&headerVersion, data + 4, sizeof(uint32_t));
+    memcpy(&vendorID, data + 8, sizeof(uint32_t));
+    memcpy(&deviceID, data + 12, sizeof(uint32_t));
+    const VkPhysicalDeviceProperties& properties = device->getPhysicalDeviceProperties();
+    return headerSize >= vulkanHeaderSize && headerSize <= dataSize
+            && headerVersion == uint32_t(VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+            && vendorID == properties.vendorID && deviceID == properties.deviceID
+            && memcmp(data + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool PipelineCache::loadFromFile(const std::string& _filename) {
+    filename = _filename;
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    PipelineCacheFileHeader header{};
+    PipelineCacheFileHeader expectedHeader{};
+    fillFileHeader(device, expectedHeader);
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(PipelineCacheFileHeader))
+            || memcmp(header.magic, expectedHeader.magic, sizeof(header.magic)) != 0
+            || header.fileVersion != expectedHeader.fileVersion) {
+        sgl::Logfile::get()->writeWarning(
+                "Warning in PipelineCache::loadFromFile: Invalid pipeline cache file \"" + filename + "\".", false);
+        return false;
+    }
+    if (header.vendorID != expectedHeader.vendorID || header.deviceID != expectedHeader.deviceID
+            || header.driverVersion != expectedHeader.driverVersion
+            || memcmp(header.pipelineCacheUUID, expectedHeader.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        // Expected after driver updates.
+        sgl::Logfile::get()->writeInfo(
+                "PipelineCache::loadFromFile: Ignoring \"" + filename + "\", as it was created with a different "
+                "device or driver.");
+        return false;
+    }
+
+    // Check the size before allocating, as a corrupted header could otherwise request an arbitrary amount of memory.
+    std::streamoff dataOffset = file.tellg();
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(dataOffset, std::ios::beg);
+    if (dataOffset < 0 || fileSize < dataOffset || header.dataSize != uint64_t(fileSize - dataOffset)) {
+        sgl::Logfile::get()->writeWarning(
+                "Warning in PipelineCache::loadFromFile: Corrupted pipeline cache file \"" + filename + "\".", false);
+        return false;
+    }
+
+    std::vector<uint8_t> data(size_t(header.dataSize));
+    if (!file.read(reinterpret_cast<char*>(data.data()), std::streamsize(header.dataSize))
+            || computeDataHash(data.data(), data.size()) != header.dataHash
+            || !checkCacheDataHeader(data.data(), data.size())) {
+        sgl::Logfile::get()->writeWarning(
+                "Warning in PipelineCache::loadFromFile: Corrupted pipeline cache file \"" + filename + "\".", false);
+        return false;
+    }
+
+    createPipelineCache(data.data(), data.size());
+    return loadedDataSize != 0;
+}
+
+bool PipelineCache::saveToFile(const std::string& _filename) {
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(device->getVkDevice(), pipelineCache, &dataSize, nullptr) != VK_SUCCESS) {
+        return false;
+    }
+    std::vector<uint8_t> data(dataSize);
+    if (vkGetPipelineCacheData(device->getVkDevice(), pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+        return false;
+    }
+    data.resize(dataSize);
+
+    PipelineCacheFileHeader header{};
+    fillFileHeader(device, header);
+    header.dataSize = uint64_t(dataSize);
+    header.dataHash = computeDataHash(data.data(), dataSize);
+
+    std::filesystem::path filePath(_filename);
+    if (filePath.has_parent_path()) {
+        std::error_code errorCode;
+        std::filesystem::create_directories(filePath.parent_path(), errorCode);
+    }
+
+    // Write to a temporary file first and rename it afterwards, so that the cache file is replaced atomically.
+    std::string tmpFilename = createTemporaryFilename(_filename);
+    {
+        std::ofstream file(tmpFilename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            sgl::Logfile::get()->writeError(
+                    "Error in PipelineCache::saveToFile: Couldn't open \"" + tmpFilename + "\" for writing.", false);
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(PipelineCacheFileHeader));
+        file.write(reinterpret_cast<const char*>(data.data()), std::streamsize(dataSize));
+        if (!file.good()) {
+            file.close();
+            std::error_code errorCode;
+            std::filesystem::remove(tmpFilename, errorCode);
+            return false;
+        }
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(tmpFilename, _filename, errorCode);
+    if (errorCode) {
+        sgl::Logfile::get()->writeError(
+                "Error in PipelineCache::saveToFile: Couldn't rename \"" + tmpFilename + "\": "
+                + errorCode.message(), false);
+        std::filesystem::remove(tmpFilename, errorCode);
+        return false;
+    }
+    return true;
+}
+
+bool PipelineCache::save() {
+    if (filename.empty()) {
+        return false;
+    }
+    return saveToFile(filename);
+}
+
+std::string PipelineCache::getDefaultFilename(Device* device) {
+    std::string configDirectory = sgl::FileUtils::get()->getConfigDirectory();
+    if (configDirectory.empty()) {
+        return "";
+    }
+    const VkPhysicalDeviceProperties& properties = device->getPhysicalDeviceProperties();
+    return configDirectory + "PipelineCache/" + sgl::toHexString(properties.vendorID) + "_"
+            + sgl::toHexString(properties.deviceID) + ".bin";
+}
+
+void PipelineCache::addCreationFeedback(
+        const void*& pNext, VkPipelineCreationFeedbackCreateInfoEXT& feedbackCreateInfo,
+        VkPipelineCreationFeedbackEXT& feedback) {
+    feedback = {};
+    if (!useCreationFeedback) {
+        return;
+    }
+    feedbackCreateInfo = {};
+    feedbackCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+    feedbackCreateInfo.pNext = pNext;
+    feedbackCreateInfo.pPipelineCreationFeedback = &feedback;
+    pNext = &feedbackCreateInfo;
+}
+
+void PipelineCache::recordPipelineCreation(
+        const VkPipelineCreationFeedbackEXT& feedback,
+        std::chrono::time_point<std::chrono::steady_clock> creationStartTime) {
+    auto creationTime = std::chrono::steady_clock::now() - creationStartTime;
+    totalCreationTimeNs += uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(creationTime).count());
+    numPipelinesCreated++;
+    if ((feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT) == 0) {
+        numUnknown++;
+    } else if ((feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) != 0) {
+        numCacheHits++;
+    }
+}
+
+PipelineCacheStatistics PipelineCache::getStatistics() const {
+    PipelineCacheStatistics statistics;
+    statistics.numPipelinesCreated = numPipelinesCreated;
+    statistics.numCacheHits = numCacheHits;
+    statistics.numUnknown = numUnknown;
+    statistics.totalCreationTimeMs = double(totalCreationTimeNs.load()) * 1e-6;
+    statistics.loadedDataSize = loadedDataSize;
+    return statistics;
+}
+
+void PipelineCache::resetStatistics() {
+    numPipelinesCreated = 0;
+    numCacheHits = 0;
+    numUnknown = 0;
+    totalCreationTimeNs = 0;
+}
+
+}}
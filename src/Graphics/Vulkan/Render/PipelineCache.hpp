@@ -0,0 +1,121 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_PIPELINECACHE_HPP
+#define SGL_PIPELINECACHE_HPP
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "../libs/volk/volk.h"
+
+namespace sgl { namespace vk {
+
+class Device;
+
+struct DLL_OBJECT PipelineCacheStatistics {
+    uint64_t numPipelinesCreated = 0;
+    /// Number of pipelines that were found in the cache (only known with VK_EXT_pipeline_creation_feedback).
+    uint64_t numCacheHits = 0;
+    /// Number of pipelines created without valid creation feedback (i.e., the hit state is unknown).
+    uint64_t numUnknown = 0;
+    double totalCreationTimeMs = 0.0;
+    /// Size of the cache data loaded from disk (0 if no valid cache file was found).
+    size_t loadedDataSize = 0;
+};
+
+/**
+ * Wrapper around a VkPipelineCache owned by @see Device and used by all graphics, compute and ray tracing pipelines.
+ * The cache can be persisted to disk, so driver-side shader compilation is not redone on every launch.
+ *
+ * The file consists of a header with the vendor ID, device ID, driver version and pipeline cache UUID of the device it
+ * was created with, the size of the cache data and a checksum, followed by the cache data. If any of these do not match,
+ * the file is ignored and an empty cache is created. Files are first written to a temporary file that is then renamed,
+ * so a crash during saving can never leave a truncated cache file behind.
+ *
+ * If VK_EXT_pipeline_creation_feedback is enabled, cache hits are counted (@see getStatistics).
+ */
+class DLL_OBJECT PipelineCache {
+public:
+    explicit PipelineCache(Device* device);
+    ~PipelineCache();
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    [[nodiscard]] inline VkPipelineCache getVkPipelineCache() const { return pipelineCache; }
+
+    /**
+     * Recreates the cache with the data from the file if it is valid for the device. The file is also used as the
+     * target of @see save.
+     * @return Whether valid cache data was loaded.
+     */
+    bool loadFromFile(const std::string& filename);
+    /// Writes the current cache data to the file atomically.
+    bool saveToFile(const std::string& filename);
+    /// Saves the cache to the file passed to @see loadFromFile or @see setFilename (if any).
+    bool save();
+    inline void setFilename(const std::string& _filename) { filename = _filename; }
+    [[nodiscard]] inline const std::string& getFilename() const { return filename; }
+    /// Returns the default file name for the device in the config directory of the application.
+    static std::string getDefaultFilename(Device* device);
+
+    /**
+     * Prepends VkPipelineCreationFeedbackCreateInfoEXT to the pNext chain of a pipeline create info if
+     * VK_EXT_pipeline_creation_feedback is enabled. The structs must remain in scope until the pipeline is created.
+     */
+    void addCreationFeedback(
+            const void*& pNext, VkPipelineCreationFeedbackCreateInfoEXT& feedbackCreateInfo,
+            VkPipelineCreationFeedbackEXT& feedback);
+    /// Updates the statistics after a pipeline was created with @see addCreationFeedback.
+    void recordPipelineCreation(
+            const VkPipelineCreationFeedbackEXT& feedback,
+            std::chrono::time_point<std::chrono::steady_clock> creationStartTime);
+
+    [[nodiscard]] PipelineCacheStatistics getStatistics() const;
+    void resetStatistics();
+
+private:
+    void createPipelineCache(const void* initialData, size_t initialDataSize);
+    bool checkCacheDataHeader(const uint8_t* data, size_t dataSize);
+
+    Device* device;
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+    std::string filename;
+    bool useCreationFeedback = false;
+
+    std::atomic<uint64_t> numPipelinesCreated{0};
+    std::atomic<uint64_t> numCacheHits{0};
+    std::atomic<uint64_t> numUnknown{0};
+    std::atomic<uint64_t> totalCreationTimeNs{0};
+    size_t loadedDataSize = 0;
+};
+
+}}
+
+#endif //SGL_PIPELINECACHE_HPP
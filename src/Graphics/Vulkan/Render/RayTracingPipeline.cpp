@@ -496,11 +496,12 @@ RayTracingPipeline::RayTracingPipeline(Device* device, const RayTracingPipelineI
     setPipelineCreateInfoPNextInternal(pipelineCreateInfo.pNext, pipelineInfo.useShader64BitIndexing);
 
     if (vkCreateRayTracingPipelinesKHR(
-            device->getVkDevice(), VK_NULL_HANDLE, VK_NULL_HANDLE,
+            device->getVkDevice(), VK_NULL_HANDLE, device->getVkPipelineCache(),
             1, &pipelineCreateInfo, nullptr, &pipeline) != VK_SUCCESS) {
         Logfile::get()->throwError(
                 "Error in RayTracingPipeline::RayTracingPipeline: Could not create a RayTracing pipeline.");
     }
+    onPipelineCreatedInternal();
 
     sbt.buildShaderBindingTable(pipeline);
 #endif
@@ -26,6 +26,14 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <thread>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 #include <Utils/AppSettings.hpp>
 #include <Utils/File/Logfile.hpp>
 #include "../Utils/Device.hpp"
@@ -37,6 +45,8 @@
 #include "../Buffers/Buffer.hpp"
 #include "CommandBuffer.hpp"
 #include "Data.hpp"
+#include "DrawList.hpp"
+#include "DescriptorSetCache.hpp"
 #include "Renderer.hpp"
 
 namespace sgl { namespace vk {
@@ -73,6 +83,7 @@ Renderer::Renderer(Device* device, uint32_t numDescriptors) : device(device) {
             device->getVkDevice(), &globalPoolInfo, nullptr, &globalDescriptorPool) != VK_SUCCESS) {
         Logfile::get()->throwError("Error in Renderer::Renderer: Failed to create global descriptor pool!");
     }
+    descriptorSetCache = std::make_shared<DescriptorSetCache>(device, globalDescriptorPool);
 
 
     VkDescriptorSetLayoutBinding uboLayoutBinding{};
@@ -140,6 +151,9 @@ Renderer::~Renderer() {
 
     vkDestroyDescriptorSetLayout(device->getVkDevice(), matrixBufferDesciptorSetLayout, nullptr);
     vkDestroyDescriptorPool(device->getVkDevice(), matrixBufferDescriptorPool, nullptr);
+    // Render data objects may still hold a reference to the cache, so only its sets are freed here.
+    descriptorSetCache->destroy();
+    descriptorSetCache = {};
     vkDestroyDescriptorPool(device->getVkDevice(), globalDescriptorPool, nullptr);
     matrixBufferDesciptorSetLayout = {};
     matrixBufferDescriptorPool = {};
@@ -186,6 +200,7 @@ void Renderer::beginCommandBuffer() {
                     frameCaches.at(frameIndex).allCameraMatrixBuffers;
             frameCaches.at(frameIndex).freeMatrixBlockDescriptorSets =
                     frameCaches.at(frameIndex).allMatrixBlockDescriptorSets;
+            frameCaches.at(frameIndex).numUsedSecondaryCommandBuffers = 0;
 
             auto commandBufferPtr = commandBuffers.at(frameIndex);
             frameCommandBuffers.push_back(commandBufferPtr);
@@ -210,6 +225,7 @@ void Renderer::beginCommandBuffer() {
         Logfile::get()->throwError(
                 "Error in Renderer::beginCommandBuffer: Could not begin recording a command buffer.");
     }
+    descriptorSetCache->beginFrame(uint32_t(std::max(frameCaches.size(), size_t(1))) + 1);
 
     recordingCommandBufferStarted = true;
     isCommandBufferInRecordingState = true;
@@ -299,6 +315,11 @@ void Renderer::syncWithCpu() {
         }
     }
 
+    if (frameIndex < frameCaches.size()) {
+        // The device finished all work, so the secondary command buffers can be reused.
+        frameCaches.at(frameIndex).numUsedSecondaryCommandBuffers = 0;
+    }
+
     if (swapchain || frameIndex < commandBuffers.size()) {
         commandBufferPtr = commandBuffers.at(frameIndex);
     }
@@ -355,20 +376,7 @@ void Renderer::render(const RasterDataPtr& rasterData, const FramebufferPtr& fra
     }
 
     if (isFirstSubpass) {
-        VkRenderPassBeginInfo renderPassBeginInfo = {};
-        renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassBeginInfo.renderPass = framebuffer->getVkRenderPass();
-        renderPassBeginInfo.framebuffer = framebuffer->getVkFramebuffer();
-        renderPassBeginInfo.renderArea.offset = {0, 0};
-        renderPassBeginInfo.renderArea.extent = framebuffer->getExtent2D();
-        if (framebuffer->getUseClear()) {
-            const std::vector<VkClearValue>& clearValues = framebuffer->getVkClearValues();
-            renderPassBeginInfo.clearValueCount = uint32_t(clearValues.size());
-            renderPassBeginInfo.pClearValues = clearValues.data();
-        }
-
-        // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
-        vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        _beginRenderPass(framebuffer, VK_SUBPASS_CONTENTS_INLINE);
     }
 
     if (!isFirstSubpass && numSubpasses > 1) {
@@ -388,12 +396,371 @@ void Renderer::render(const RasterDataPtr& rasterData, const FramebufferPtr& fra
 
     const std::vector<VkBuffer>& vertexBuffers = rasterData->getVkVertexBuffers();
     if (!vertexBuffers.empty()) {
-        std::vector<VkDeviceSize> offsets;
-        offsets.resize(vertexBuffers.size(), 0);
-        vkCmdBindVertexBuffers(commandBuffer, 0, uint32_t(vertexBuffers.size()), vertexBuffers.data(), offsets.data());
+        _bindVertexBuffers(commandBuffer, vertexBuffers);
     }
 
     rasterData->_updateDescriptorSets();
+    _bindRasterDataDescriptorSets(commandBuffer, rasterData);
+    const char* errorMessage = _recordDrawCommand(commandBuffer, rasterData);
+    if (errorMessage) {
+        Logfile::get()->throwError(errorMessage);
+    }
+
+    // Transition the image layouts.
+    framebuffer->transitionAttachmentImageLayouts(subpassIndex);
+
+    if (isLastSubpass) {
+        vkCmdEndRenderPass(commandBuffer);
+    }
+    lastFramebuffer = framebuffer;
+}
+
+void Renderer::render(DrawList& drawList) {
+    if (drawList.empty()) {
+        return;
+    }
+
+    // The descriptor sets are updated before sorting, as they are used as a sort key.
+    for (const DrawListEntry& entry : drawList.getEntries()) {
+        entry.rasterData->_updateDescriptorSets();
+    }
+
+    const std::vector<DrawListEntry>& entries = drawList.getSortedEntries();
+    Framebuffer* currentFramebuffer = nullptr;
+    uint32_t numSubpasses = 0;
+    uint32_t currentSubpassIndex = 0;
+    VkBuffer boundIndexBuffer = VK_NULL_HANDLE;
+    VkIndexType boundIndexType = VK_INDEX_TYPE_UINT32;
+    VkDescriptorSet boundDescriptorSet = VK_NULL_HANDLE;
+    bool hasBoundDescriptorSets = false;
+    boundVertexBuffers.clear();
+
+    auto endRenderPass = [&]() {
+        while (currentSubpassIndex + 1 < numSubpasses) {
+            vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+            currentSubpassIndex++;
+        }
+        currentFramebuffer->transitionAttachmentImageLayouts(currentSubpassIndex);
+        vkCmdEndRenderPass(commandBuffer);
+    };
+
+    for (const DrawListEntry& entry : entries) {
+        const RasterDataPtr& rasterData = entry.rasterData;
+        const FramebufferPtr& framebuffer = entry.framebuffer;
+
+        if (framebuffer.get() != currentFramebuffer) {
+            if (currentFramebuffer) {
+                endRenderPass();
+            }
+            currentFramebuffer = framebuffer.get();
+            numSubpasses = framebuffer->getNumSubpasses();
+            currentSubpassIndex = 0;
+            _beginRenderPass(framebuffer, VK_SUBPASS_CONTENTS_INLINE);
+        }
+
+        if (entry.subpassIndex >= numSubpasses) {
+            Logfile::get()->throwError(
+                    "Error in Renderer::render: subpassIndex >= numSubpasses!");
+        }
+        while (currentSubpassIndex < entry.subpassIndex) {
+            vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+            currentSubpassIndex++;
+        }
+
+        bool isNewPipeline = false;
+        const GraphicsPipelinePtr& newGraphicsPipeline = rasterData->getGraphicsPipeline();
+        if (graphicsPipeline != newGraphicsPipeline) {
+            graphicsPipeline = newGraphicsPipeline;
+            isNewPipeline = true;
+            vkCmdBindPipeline(
+                    commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    graphicsPipeline->getVkPipeline());
+        }
+
+        if (useMatrixBlock && (updateMatrixBlock() || recordingCommandBufferStarted || isNewPipeline)) {
+            vkCmdBindDescriptorSets(
+                    commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getVkPipelineLayout(),
+                    1, 1, &matrixBlockDescriptorSet, 0, nullptr);
+            recordingCommandBufferStarted = false;
+        }
+
+        if (rasterData->getHasIndexBuffer()) {
+            VkBuffer indexBuffer = rasterData->getVkIndexBuffer();
+            if (indexBuffer != boundIndexBuffer || rasterData->getIndexType() != boundIndexType) {
+                vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, rasterData->getIndexType());
+                boundIndexBuffer = indexBuffer;
+                boundIndexType = rasterData->getIndexType();
+            }
+        }
+
+        const std::vector<VkBuffer>& vertexBuffers = rasterData->getVkVertexBuffers();
+        if (!vertexBuffers.empty() && vertexBuffers != boundVertexBuffers) {
+            _bindVertexBuffers(commandBuffer, vertexBuffers);
+            boundVertexBuffers = vertexBuffers;
+        }
+
+        // Draws sharing their descriptor sets (e.g., via the descriptor set cache) are sorted next to each other.
+        VkDescriptorSet descriptorSet = rasterData->getVkDescriptorSet();
+        if (!hasBoundDescriptorSets || isNewPipeline || descriptorSet != boundDescriptorSet) {
+            _bindRasterDataDescriptorSets(commandBuffer, rasterData);
+            boundDescriptorSet = descriptorSet;
+            hasBoundDescriptorSets = true;
+        }
+        const char* errorMessage = _recordDrawCommand(commandBuffer, rasterData);
+        if (errorMessage) {
+            Logfile::get()->throwError(errorMessage);
+        }
+    }
+
+    endRenderPass();
+    lastFramebuffer = entries.back().framebuffer;
+}
+
+void Renderer::renderParallel(DrawList& drawList) {
+    if (drawList.empty()) {
+        return;
+    }
+
+    // Everything touching shared state is done on the calling thread before recording in parallel. The descriptor
+    // sets are updated before sorting, as they are used as a sort key.
+    if (useMatrixBlock) {
+        updateMatrixBlock();
+    }
+    size_t maxNumVertexBuffers = 0;
+    for (const DrawListEntry& entry : drawList.getEntries()) {
+        entry.rasterData->_updateDescriptorSets();
+        maxNumVertexBuffers = std::max(maxNumVertexBuffers, entry.rasterData->getVkVertexBuffers().size());
+    }
+    const std::vector<DrawListEntry>& entries = drawList.getSortedEntries();
+    if (zeroVertexBufferOffsets.size() < maxNumVertexBuffers) {
+        zeroVertexBufferOffsets.resize(maxNumVertexBuffers, 0);
+    }
+
+    // Split each run of draws with the same framebuffer and subpass into partitions.
+    size_t maxNumPartitions = numParallelRecordingPartitions;
+    if (maxNumPartitions == 0) {
+        maxNumPartitions = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    }
+    size_t minNumDraws = std::max(minNumDrawsPerRecordingPartition, size_t(1));
+    parallelRecordingPartitions.clear();
+    size_t segmentBegin = 0;
+    while (segmentBegin < entries.size()) {
+        size_t segmentEnd = segmentBegin + 1;
+        while (segmentEnd < entries.size()
+                && entries.at(segmentEnd).framebuffer == entries.at(segmentBegin).framebuffer
+                && entries.at(segmentEnd).subpassIndex == entries.at(segmentBegin).subpassIndex) {
+            segmentEnd++;
+        }
+        size_t numDraws = segmentEnd - segmentBegin;
+        size_t numPartitions = std::clamp(numDraws / minNumDraws, size_t(1), maxNumPartitions);
+        for (size_t partitionIdx = 0; partitionIdx < numPartitions; partitionIdx++) {
+            ParallelRecordingPartition partition;
+            partition.entriesBegin = segmentBegin + numDraws * partitionIdx / numPartitions;
+            partition.entriesEnd = segmentBegin + numDraws * (partitionIdx + 1) / numPartitions;
+            parallelRecordingPartitions.push_back(partition);
+        }
+        segmentBegin = segmentEnd;
+    }
+
+    /*
+     * Command buffers that are recorded at the same time need to come from different command pools. Slot i of all
+     * frame caches uses the command pool i + 1, and the slots are only reset when the frame cache is reused.
+     */
+    FrameCache& frameCache = frameCaches.at(frameIndex);
+    for (ParallelRecordingPartition& partition : parallelRecordingPartitions) {
+        size_t slotIdx = frameCache.numUsedSecondaryCommandBuffers++;
+        if (slotIdx >= frameCache.secondaryCommandBuffers.size()) {
+            vk::CommandPoolType commandPoolType;
+            if (!useGraphicsQueue) {
+                commandPoolType.queueFamilyIndex = device->getComputeQueueIndex();
+            }
+            commandPoolType.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            commandPoolType.threadIndex = uint32_t(slotIdx + 1);
+            VkCommandPool pool;
+            frameCache.secondaryCommandBuffers.push_back(device->allocateCommandBuffer(
+                    commandPoolType, &pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+        }
+        partition.commandBuffer = frameCache.secondaryCommandBuffers.at(slotIdx);
+    }
+
+    size_t numPartitions = parallelRecordingPartitions.size();
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPartitions), [&](auto const& r) {
+        for (auto partitionIdx = r.begin(); partitionIdx != r.end(); partitionIdx++) {
+            _recordParallelRecordingPartition(parallelRecordingPartitions.at(partitionIdx), entries);
+        }
+    });
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numPartitions, entries) schedule(dynamic)
+#endif
+    for (size_t partitionIdx = 0; partitionIdx < numPartitions; partitionIdx++) {
+        _recordParallelRecordingPartition(parallelRecordingPartitions.at(partitionIdx), entries);
+    }
+#endif
+    for (const ParallelRecordingPartition& partition : parallelRecordingPartitions) {
+        if (partition.errorMessage) {
+            Logfile::get()->throwError(partition.errorMessage);
+        }
+    }
+
+    // Execute the secondary command buffers in one render pass per framebuffer.
+    Framebuffer* currentFramebuffer = nullptr;
+    uint32_t numSubpasses = 0;
+    uint32_t currentSubpassIndex = 0;
+    auto endRenderPass = [&]() {
+        while (currentSubpassIndex + 1 < numSubpasses) {
+            vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            currentSubpassIndex++;
+        }
+        currentFramebuffer->transitionAttachmentImageLayouts(currentSubpassIndex);
+        vkCmdEndRenderPass(commandBuffer);
+    };
+    parallelRecordingCommandBuffers.clear();
+    for (size_t partitionIdx = 0; partitionIdx < numPartitions; partitionIdx++) {
+        const ParallelRecordingPartition& partition = parallelRecordingPartitions.at(partitionIdx);
+        const DrawListEntry& firstEntry = entries.at(partition.entriesBegin);
+        const FramebufferPtr& framebuffer = firstEntry.framebuffer;
+        if (framebuffer.get() != currentFramebuffer) {
+            if (currentFramebuffer) {
+                endRenderPass();
+            }
+            currentFramebuffer = framebuffer.get();
+            numSubpasses = framebuffer->getNumSubpasses();
+            currentSubpassIndex = 0;
+            _beginRenderPass(framebuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+        }
+        if (firstEntry.subpassIndex >= numSubpasses) {
+            Logfile::get()->throwError(
+                    "Error in Renderer::renderParallel: subpassIndex >= numSubpasses!");
+        }
+        while (currentSubpassIndex < firstEntry.subpassIndex) {
+            vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            currentSubpassIndex++;
+        }
+
+        parallelRecordingCommandBuffers.push_back(partition.commandBuffer);
+        bool isLastInSubpass = partitionIdx + 1 == numPartitions;
+        if (!isLastInSubpass) {
+            const DrawListEntry& nextEntry = entries.at(parallelRecordingPartitions.at(partitionIdx + 1).entriesBegin);
+            isLastInSubpass =
+                    nextEntry.framebuffer.get() != currentFramebuffer || nextEntry.subpassIndex != currentSubpassIndex;
+        }
+        if (isLastInSubpass) {
+            vkCmdExecuteCommands(
+                    commandBuffer, uint32_t(parallelRecordingCommandBuffers.size()),
+                    parallelRecordingCommandBuffers.data());
+            parallelRecordingCommandBuffers.clear();
+        }
+    }
+    endRenderPass();
+
+    // The state of the primary command buffer is undefined after executing secondary command buffers.
+    graphicsPipeline = GraphicsPipelinePtr();
+    recordingCommandBufferStarted = true;
+    lastFramebuffer = entries.back().framebuffer;
+}
+
+void Renderer::_recordParallelRecordingPartition(
+        ParallelRecordingPartition& partition, const std::vector<DrawListEntry>& entries) {
+    const DrawListEntry& firstEntry = entries.at(partition.entriesBegin);
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = firstEntry.framebuffer->getVkRenderPass();
+    inheritanceInfo.subpass = firstEntry.subpassIndex;
+    inheritanceInfo.framebuffer = firstEntry.framebuffer->getVkFramebuffer();
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags =
+            VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+    VkCommandBuffer secondaryCommandBuffer = partition.commandBuffer;
+    if (vkBeginCommandBuffer(secondaryCommandBuffer, &beginInfo) != VK_SUCCESS) {
+        partition.errorMessage =
+                "Error in Renderer::renderParallel: Could not begin recording a secondary command buffer.";
+        return;
+    }
+
+    // Secondary command buffers do not inherit any bound state.
+    GraphicsPipeline* boundPipeline = nullptr;
+    VkBuffer boundIndexBuffer = VK_NULL_HANDLE;
+    VkIndexType boundIndexType = VK_INDEX_TYPE_UINT32;
+    const std::vector<VkBuffer>* boundVertexBuffersPtr = nullptr;
+    VkDescriptorSet boundDescriptorSet = VK_NULL_HANDLE;
+    for (size_t entryIdx = partition.entriesBegin; entryIdx < partition.entriesEnd; entryIdx++) {
+        const RasterDataPtr& rasterData = entries.at(entryIdx).rasterData;
+        const GraphicsPipelinePtr& pipeline = rasterData->getGraphicsPipeline();
+        bool isNewPipeline = pipeline.get() != boundPipeline;
+        if (isNewPipeline) {
+            boundPipeline = pipeline.get();
+            vkCmdBindPipeline(secondaryCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->getVkPipeline());
+            if (useMatrixBlock) {
+                vkCmdBindDescriptorSets(
+                        secondaryCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->getVkPipelineLayout(),
+                        1, 1, &matrixBlockDescriptorSet, 0, nullptr);
+            }
+        }
+
+        if (rasterData->getHasIndexBuffer()) {
+            VkBuffer indexBuffer = rasterData->getVkIndexBuffer();
+            if (indexBuffer != boundIndexBuffer || rasterData->getIndexType() != boundIndexType) {
+                vkCmdBindIndexBuffer(secondaryCommandBuffer, indexBuffer, 0, rasterData->getIndexType());
+                boundIndexBuffer = indexBuffer;
+                boundIndexType = rasterData->getIndexType();
+            }
+        }
+
+        const std::vector<VkBuffer>& vertexBuffers = rasterData->getVkVertexBuffers();
+        if (!vertexBuffers.empty() && (!boundVertexBuffersPtr || vertexBuffers != *boundVertexBuffersPtr)) {
+            _bindVertexBuffers(secondaryCommandBuffer, vertexBuffers);
+            boundVertexBuffersPtr = &vertexBuffers;
+        }
+
+        VkDescriptorSet descriptorSet = rasterData->getVkDescriptorSet();
+        if (isNewPipeline || descriptorSet != boundDescriptorSet) {
+            _bindRasterDataDescriptorSets(secondaryCommandBuffer, rasterData);
+            boundDescriptorSet = descriptorSet;
+        }
+        const char* errorMessage = _recordDrawCommand(secondaryCommandBuffer, rasterData);
+        if (errorMessage) {
+            partition.errorMessage = errorMessage;
+            break;
+        }
+    }
+
+    if (vkEndCommandBuffer(secondaryCommandBuffer) != VK_SUCCESS && !partition.errorMessage) {
+        partition.errorMessage = "Error in Renderer::renderParallel: Could not record a secondary command buffer.";
+    }
+}
+
+void Renderer::_beginRenderPass(const FramebufferPtr& framebuffer, VkSubpassContents subpassContents) {
+    VkRenderPassBeginInfo renderPassBeginInfo = {};
+    renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassBeginInfo.renderPass = framebuffer->getVkRenderPass();
+    renderPassBeginInfo.framebuffer = framebuffer->getVkFramebuffer();
+    renderPassBeginInfo.renderArea.offset = {0, 0};
+    renderPassBeginInfo.renderArea.extent = framebuffer->getExtent2D();
+    if (framebuffer->getUseClear()) {
+        const std::vector<VkClearValue>& clearValues = framebuffer->getVkClearValues();
+        renderPassBeginInfo.clearValueCount = uint32_t(clearValues.size());
+        renderPassBeginInfo.pClearValues = clearValues.data();
+    }
+    vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, subpassContents);
+}
+
+void Renderer::_bindVertexBuffers(VkCommandBuffer commandBuffer, const std::vector<VkBuffer>& vertexBuffers) {
+    // The offsets are always zero, so the array is shared by all draws to avoid a heap allocation per draw.
+    // renderParallel resizes it up front, so worker threads only read it.
+    if (zeroVertexBufferOffsets.size() < vertexBuffers.size()) {
+        zeroVertexBufferOffsets.resize(vertexBuffers.size(), 0);
+    }
+    vkCmdBindVertexBuffers(
+            commandBuffer, 0, uint32_t(vertexBuffers.size()), vertexBuffers.data(), zeroVertexBufferOffsets.data());
+}
+
+void Renderer::_bindRasterDataDescriptorSets(VkCommandBuffer commandBuffer, const RasterDataPtr& rasterData) {
+    const GraphicsPipelinePtr& graphicsPipeline = rasterData->getGraphicsPipeline();
     VkDescriptorSet descriptorSet = rasterData->getVkDescriptorSet();
     if (descriptorSet != VK_NULL_HANDLE) {
         if (graphicsPipeline->getShaderStages()->getVkDescriptorSetLayouts().size() == 1) {
@@ -415,7 +782,10 @@ void Renderer::render(const RasterDataPtr& rasterData, const FramebufferPtr& fra
                 commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline->getVkPipelineLayout(),
                 1, 1, &matrixBlockDescriptorSet, 0, nullptr);
     }
+}
 
+const char* Renderer::_recordDrawCommand(VkCommandBuffer commandBuffer, const RasterDataPtr& rasterData) {
+    const GraphicsPipelinePtr& graphicsPipeline = rasterData->getGraphicsPipeline();
     if (graphicsPipeline->getShaderStages()->getHasVertexShader()) {
         if (rasterData->getUseIndirectDraw()) {
             if (rasterData->getUseIndirectDrawCount()) {
@@ -521,17 +891,10 @@ void Renderer::render(const RasterDataPtr& rasterData, const FramebufferPtr& fra
         }
 #endif
         else {
-            sgl::Logfile::get()->throwError("Error in Renderer::render: Task count > 0, but no mesh shader set.");
+            return "Error in Renderer::render: Task count > 0, but no mesh shader set.";
         }
     }
-
-    // Transition the image layouts.
-    framebuffer->transitionAttachmentImageLayouts(subpassIndex);
-
-    if (isLastSubpass) {
-        vkCmdEndRenderPass(commandBuffer);
-    }
-    lastFramebuffer = framebuffer;
+    return nullptr;
 }
 
 void Renderer::setModelMatrix(const glm::mat4 &matrix) {
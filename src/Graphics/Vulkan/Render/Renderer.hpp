@@ -63,6 +63,9 @@ class ComputeData;
 typedef std::shared_ptr<ComputeData> ComputeDataPtr;
 class RasterData;
 typedef std::shared_ptr<RasterData> RasterDataPtr;
+class DrawList;
+struct DrawListEntry;
+class DescriptorSetCache;
 class RayTracingData;
 typedef std::shared_ptr<RayTracingData> RayTracingDataPtr;
 class Pipeline;
@@ -99,6 +102,28 @@ public:
     // Graphics pipeline.
     void render(const RasterDataPtr& rasterData);
     void render(const RasterDataPtr& rasterData, const FramebufferPtr& framebuffer);
+    /**
+     * Records all draws of the draw list. In contrast to calling @see render for each raster data object, only one
+     * render pass is recorded per framebuffer, and pipelines, index buffers and vertex buffers are only bound when they
+     * change between consecutive draws. The render passes of the framebuffers must not have been started yet.
+     */
+    void render(DrawList& drawList);
+    /**
+     * Same as @see render(DrawList&), but the draws are split into partitions that are recorded into secondary
+     * command buffers in parallel (using TBB or OpenMP). Each partition uses its own command pool. The secondary
+     * command buffers are then executed with one render pass per framebuffer. Descriptor set updates and the matrix
+     * block update are done on the calling thread before recording.
+     * This is only worth it if the CPU time for recording the draws is the bottleneck (e.g., thousands of objects).
+     */
+    void renderParallel(DrawList& drawList);
+    /// Maximum number of partitions per framebuffer for @see renderParallel (0 = number of hardware threads).
+    inline void setNumParallelRecordingPartitions(uint32_t _numPartitions) {
+        numParallelRecordingPartitions = _numPartitions;
+    }
+    /// Minimum number of draws per partition for @see renderParallel.
+    inline void setMinNumDrawsPerRecordingPartition(size_t _minNumDraws) {
+        minNumDrawsPerRecordingPartition = _minNumDraws;
+    }
     void setModelMatrix(const glm::mat4 &matrix);
     void setViewMatrix(const glm::mat4 &matrix);
     void setProjectionMatrix(const glm::mat4 &matrix);
@@ -235,6 +260,8 @@ public:
     // Access to internal state.
     inline Device* getDevice() { return device; }
     inline VkDescriptorPool getVkDescriptorPool() { return globalDescriptorPool; }
+    /// Cache of descriptor sets allocated from the global descriptor pool (@see RenderData::setUseDescriptorSetCache).
+    inline const std::shared_ptr<DescriptorSetCache>& getDescriptorSetCache() { return descriptorSetCache; }
     inline void clearGraphicsPipeline() {
         graphicsPipeline = GraphicsPipelinePtr();
         lastFramebuffer = FramebufferPtr();
@@ -257,10 +284,32 @@ private:
 
     // Global descriptor pool that can be used by ComputeData, RasterData and RayTracingData.
     VkDescriptorPool globalDescriptorPool;
+    std::shared_ptr<DescriptorSetCache> descriptorSetCache;
 
     // Rasterizer state.
+    void _beginRenderPass(const FramebufferPtr& framebuffer, VkSubpassContents subpassContents);
+    void _bindVertexBuffers(VkCommandBuffer commandBuffer, const std::vector<VkBuffer>& vertexBuffers);
+    void _bindRasterDataDescriptorSets(VkCommandBuffer commandBuffer, const RasterDataPtr& rasterData);
+    /// Returns an error message instead of throwing, as it is also called inside of the parallel region.
+    const char* _recordDrawCommand(VkCommandBuffer commandBuffer, const RasterDataPtr& rasterData);
     GraphicsPipelinePtr graphicsPipeline;
     FramebufferPtr lastFramebuffer;
+    std::vector<VkDeviceSize> zeroVertexBufferOffsets;
+    std::vector<VkBuffer> boundVertexBuffers;
+
+    // Parallel recording state (@see renderParallel).
+    struct ParallelRecordingPartition {
+        size_t entriesBegin = 0, entriesEnd = 0;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        /// Set if recording failed, as errors cannot be thrown inside of the parallel region.
+        const char* errorMessage = nullptr;
+    };
+    void _recordParallelRecordingPartition(
+            ParallelRecordingPartition& partition, const std::vector<DrawListEntry>& entries);
+    uint32_t numParallelRecordingPartitions = 0;
+    size_t minNumDrawsPerRecordingPartition = 64;
+    std::vector<ParallelRecordingPartition> parallelRecordingPartitions;
+    std::vector<VkCommandBuffer> parallelRecordingCommandBuffers;
 
     // Compute state.
     ComputePipelinePtr computePipeline;
@@ -296,6 +345,8 @@ private:
         CircularQueue<BufferPtr> allCameraMatrixBuffers;
         CircularQueue<VkDescriptorSet> allMatrixBlockDescriptorSets;
         std::vector<sgl::vk::CommandBufferPtr> frameCommandBuffers;
+        std::vector<VkCommandBuffer> secondaryCommandBuffers; ///< Slot i is allocated from command pool i + 1.
+        size_t numUsedSecondaryCommandBuffers = 0;
     };
     const uint32_t maxFrameCacheSize = 1000;
     std::vector<FrameCache> frameCaches;
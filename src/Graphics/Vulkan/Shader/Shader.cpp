@@ -323,6 +323,12 @@ ShaderStages::ShaderStages(
 }
 
 ShaderStages::~ShaderStages() {
+    for (auto& it : descriptorUpdateTemplates) {
+        if (it.second.descriptorUpdateTemplate != VK_NULL_HANDLE) {
+            vkDestroyDescriptorUpdateTemplate(device->getVkDevice(), it.second.descriptorUpdateTemplate, nullptr);
+        }
+    }
+    descriptorUpdateTemplates.clear();
     for (VkDescriptorSetLayout& descriptorSetLayout : descriptorSetLayouts) {
         vkDestroyDescriptorSetLayout(device->getVkDevice(), descriptorSetLayout, nullptr);
     }
@@ -464,6 +470,69 @@ void ShaderStages::createDescriptorSetLayouts() {
     }
 }
 
+VkDescriptorUpdateTemplate ShaderStages::getVkDescriptorUpdateTemplate(uint32_t setIdx, size_t stride) {
+    auto itTemplate = descriptorUpdateTemplates.find(setIdx);
+    if (itTemplate != descriptorUpdateTemplates.end() && itTemplate->second.stride == stride) {
+        return itTemplate->second.descriptorUpdateTemplate;
+    }
+    if (itTemplate != descriptorUpdateTemplates.end()) {
+        if (itTemplate->second.descriptorUpdateTemplate != VK_NULL_HANDLE) {
+            vkDestroyDescriptorUpdateTemplate(
+                    device->getVkDevice(), itTemplate->second.descriptorUpdateTemplate, nullptr);
+        }
+        descriptorUpdateTemplates.erase(itTemplate);
+    }
+
+    DescriptorUpdateTemplateEntry templateEntry;
+    templateEntry.stride = stride;
+
+    // Descriptor update templates are core since Vulkan 1.1. Descriptor arrays may have a different size per set.
+    auto itInfo = descriptorSetsInfo.find(setIdx);
+    bool isSupported =
+            vkCreateDescriptorUpdateTemplate != nullptr && vkUpdateDescriptorSetWithTemplate != nullptr
+            && setIdx < uint32_t(descriptorSetLayouts.size()) && itInfo != descriptorSetsInfo.end();
+    if (isSupported) {
+        for (const DescriptorInfo& descriptorInfo : itInfo->second) {
+            if (descriptorInfo.count != 1) {
+                isSupported = false;
+                break;
+            }
+        }
+    }
+
+    if (isSupported) {
+        std::vector<VkDescriptorUpdateTemplateEntry> entries(itInfo->second.size());
+        for (size_t i = 0; i < itInfo->second.size(); i++) {
+            const DescriptorInfo& descriptorInfo = itInfo->second.at(i);
+            VkDescriptorUpdateTemplateEntry& entry = entries.at(i);
+            entry.dstBinding = descriptorInfo.binding;
+            entry.dstArrayElement = 0;
+            entry.descriptorCount = 1;
+            entry.descriptorType = descriptorInfo.type;
+            entry.offset = i * stride;
+            entry.stride = stride;
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo templateInfo{};
+        templateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateInfo.descriptorUpdateEntryCount = uint32_t(entries.size());
+        templateInfo.pDescriptorUpdateEntries = entries.data();
+        templateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateInfo.descriptorSetLayout = descriptorSetLayouts.at(setIdx);
+        if (vkCreateDescriptorUpdateTemplate(
+                device->getVkDevice(), &templateInfo, nullptr,
+                &templateEntry.descriptorUpdateTemplate) != VK_SUCCESS) {
+            Logfile::get()->writeError(
+                    "Error in ShaderStages::getVkDescriptorUpdateTemplate: Failed to create descriptor update "
+                    "template!", false);
+            templateEntry.descriptorUpdateTemplate = VK_NULL_HANDLE;
+        }
+    }
+
+    descriptorUpdateTemplates.insert(std::make_pair(setIdx, templateEntry));
+    return templateEntry.descriptorUpdateTemplate;
+}
+
 const std::vector<InterfaceVariableDescriptor>& ShaderStages::getInputVariableDescriptors() const {
     if (!vertexShaderModule) {
         sgl::Logfile::get()->writeError(
@@ -205,6 +205,12 @@ public:
     [[nodiscard]] inline const std::vector<VkPushConstantRange>& getVkPushConstantRanges() const {
         return pushConstantRanges;
     }
+    /**
+     * Returns a descriptor update template for the descriptor set (created on first use), or VK_NULL_HANDLE if
+     * descriptor update templates are not supported by the device or the set contains descriptor arrays.
+     * Descriptor i of @see getDescriptorSetsInfo is read from the offset i * stride.
+     */
+    VkDescriptorUpdateTemplate getVkDescriptorUpdateTemplate(uint32_t setIdx, size_t stride);
     [[nodiscard]] inline bool getUse64BitIndexing() const { return use64BitIndexing; }
 
 private:
@@ -224,6 +230,11 @@ private:
     std::vector<VkDescriptorSetLayout> descriptorSetLayouts; ///< created from descriptorSetsInfo for use in Vulkan
     std::vector<VkPushConstantRange> pushConstantRanges;
     uint32_t numDescriptorSets = 0;
+    struct DescriptorUpdateTemplateEntry {
+        VkDescriptorUpdateTemplate descriptorUpdateTemplate = VK_NULL_HANDLE;
+        size_t stride = 0;
+    };
+    std::map<uint32_t, DescriptorUpdateTemplateEntry> descriptorUpdateTemplates; ///< set index -> template
     std::vector<VkPipelineShaderStageCreateInfo> vkShaderStages;
     std::vector<ShaderStageSettings> shaderStagesSettings;
     bool use64BitIndexing = false;
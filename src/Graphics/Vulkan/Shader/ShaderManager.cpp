@@ -341,20 +341,7 @@ ShaderStagesPtr ShaderManagerVk::compileComputeShaderFromStringCached(
         return it->second;
     }
 
-    ShaderModulePtr shaderModule;
-    ShaderModuleInfo shaderInfo{};
-    shaderInfo.shaderModuleType = ShaderModuleType::COMPUTE;
-    shaderInfo.filename = shaderId;
-#ifdef SUPPORT_SHADERC_BACKEND
-    if (shaderCompilerBackend == ShaderCompilerBackend::SHADERC) {
-        shaderModule = loadAssetShaderc(shaderInfo, shaderId, shaderString);
-    }
-#endif
-#ifdef SUPPORT_GLSLANG_BACKEND
-    if (shaderCompilerBackend == ShaderCompilerBackend::GLSLANG) {
-        shaderModule = loadAssetGlslang(shaderInfo, shaderId, shaderString);
-    }
-#endif
+    ShaderModulePtr shaderModule = compileShaderModuleFromString(shaderId, ShaderModuleType::COMPUTE, shaderString);
     if (!shaderModule) {
         return ShaderStagesPtr();
     }
@@ -375,6 +362,57 @@ ShaderStagesPtr ShaderManagerVk::compileComputeShaderFromStringCached(
     return shaderStages;
 }
 
+ShaderModuleType getShaderModuleTypeFromString(const std::string& shaderId);
+
+ShaderStagesPtr ShaderManagerVk::compileShaderStagesFromStringsCached(
+        const std::vector<std::string>& shaderIds, const std::vector<std::string>& shaderStrings) {
+    if (shaderIds.size() != shaderStrings.size()) {
+        Logfile::get()->throwError(
+                "Error in ShaderManagerVk::compileShaderStagesFromStringsCached: The number of shader IDs does not "
+                "match the number of shader strings.");
+    }
+    std::string shaderStagesId;
+    for (const std::string& shaderId : shaderIds) {
+        shaderStagesId += shaderId + ";";
+    }
+    auto it = cachedShadersLoadedFromDirectString.find(shaderStagesId);
+    if (it != cachedShadersLoadedFromDirectString.end()) {
+        return it->second;
+    }
+
+    std::vector<ShaderModulePtr> shaderModules;
+    for (size_t i = 0; i < shaderIds.size(); i++) {
+        ShaderModulePtr shaderModule = compileShaderModuleFromString(
+                shaderIds.at(i), getShaderModuleTypeFromString(shaderIds.at(i)), shaderStrings.at(i));
+        if (!shaderModule) {
+            return ShaderStagesPtr();
+        }
+        shaderModules.push_back(shaderModule);
+    }
+    ShaderStagesPtr shaderProgram(new ShaderStages(device, shaderModules));
+    cachedShadersLoadedFromDirectString.insert(std::make_pair(shaderStagesId, shaderProgram));
+    return shaderProgram;
+}
+
+ShaderModulePtr ShaderManagerVk::compileShaderModuleFromString(
+        const std::string& shaderId, ShaderModuleType shaderModuleType, const std::string& shaderString) {
+    ShaderModulePtr shaderModule;
+    ShaderModuleInfo shaderInfo{};
+    shaderInfo.shaderModuleType = shaderModuleType;
+    shaderInfo.filename = shaderId;
+#ifdef SUPPORT_SHADERC_BACKEND
+    if (shaderCompilerBackend == ShaderCompilerBackend::SHADERC) {
+        shaderModule = loadAssetShaderc(shaderInfo, shaderId, shaderString);
+    }
+#endif
+#ifdef SUPPORT_GLSLANG_BACKEND
+    if (shaderCompilerBackend == ShaderCompilerBackend::GLSLANG) {
+        shaderModule = loadAssetGlslang(shaderInfo, shaderId, shaderString);
+    }
+#endif
+    return shaderModule;
+}
+
 
 ShaderModuleType getShaderModuleTypeFromString(const std::string& shaderId) {
     std::string shaderIdLower = sgl::toLowerCopy(shaderId);
@@ -100,6 +100,10 @@ public:
     ShaderStagesPtr compileComputeShaderFromStringCached(
             const std::string& shaderId, const std::string& shaderString,
             const std::map<std::string, std::string>& customPreprocessorDefines);
+    /// Cached compilation of shader stages from source strings (e.g., "Test.Vertex" and "Test.Fragment"). The shader
+    /// module types are deduced from the shader IDs.
+    ShaderStagesPtr compileShaderStagesFromStringsCached(
+            const std::vector<std::string>& shaderIds, const std::vector<std::string>& shaderStrings);
 
     //virtual ShaderAttributesPtr createShaderAttributes(ShaderStagesPtr& shader)=0;
 
@@ -157,6 +161,8 @@ protected:
     ShaderModulePtr loadAssetGlslang(
             ShaderModuleInfo& shaderInfo, const std::string& id, const std::string& shaderString);
 #endif
+    ShaderModulePtr compileShaderModuleFromString(
+            const std::string& shaderId, ShaderModuleType shaderModuleType, const std::string& shaderString);
     ShaderStagesPtr createShaderStages(const std::vector<std::string>& shaderIds, bool dumpTextDebug);
     ShaderStagesPtr createShaderStages(
             const std::vector<std::string>& shaderIds, const std::vector<ShaderStageSettings>& shaderStageSettings,
@@ -195,7 +201,7 @@ protected:
     shaderc::Compiler* shaderCompiler = nullptr;
 #endif
 
-    /// @see compileComputeShaderFromStringCached
+    /// @see compileComputeShaderFromStringCached and @see compileShaderStagesFromStringsCached
     std::unordered_map<std::string, ShaderStagesPtr> cachedShadersLoadedFromDirectString;
 };
 
@@ -54,6 +54,7 @@
 #ifndef DISABLE_DEVICE_SELECTION_SUPPORT
 #include "DeviceSelectionVulkan.hpp"
 #endif
+#include <Graphics/Vulkan/Render/PipelineCache.hpp>
 #include "Device.hpp"
 
 #ifdef SUPPORT_OPENGL
@@ -2770,6 +2771,8 @@ void Device::createDeviceSwapchain(
     // For device thread info.
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME);
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME);
+    // For pipeline cache statistics.
+    optionalDeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
 
     VkSurfaceKHR surface = window->getVkSurface();
     DeviceFeatures requestedDeviceFeatures = requestedDeviceFeaturesIn;
@@ -2792,6 +2795,7 @@ void Device::createDeviceSwapchain(
     writeDeviceInfoToLog(enabledDeviceExtensionNames);
 
     createVulkanMemoryAllocator();
+    createPipelineCache();
 }
 #endif
 
@@ -2809,6 +2813,8 @@ void Device::createDeviceHeadless(
     // For device thread info.
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME);
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME);
+    // For pipeline cache statistics.
+    optionalDeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
 
     DeviceFeatures requestedDeviceFeatures = requestedDeviceFeaturesIn;
     enabledDeviceExtensionNames = {};
@@ -2830,6 +2836,7 @@ void Device::createDeviceHeadless(
     writeDeviceInfoToLog(enabledDeviceExtensionNames);
 
     createVulkanMemoryAllocator();
+    createPipelineCache();
 }
 
 void Device::createDeviceHeadlessFromPhysicalDevice(
@@ -2846,6 +2853,8 @@ void Device::createDeviceHeadlessFromPhysicalDevice(
     // For device thread info.
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_EXTENSION_NAME);
     optionalDeviceExtensions.push_back(VK_AMD_SHADER_CORE_PROPERTIES_2_EXTENSION_NAME);
+    // For pipeline cache statistics.
+    optionalDeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
 
     DeviceFeatures requestedDeviceFeatures = requestedDeviceFeaturesIn;
     enabledDeviceExtensionNames = {};
@@ -2877,9 +2886,41 @@ void Device::createDeviceHeadlessFromPhysicalDevice(
     writeDeviceInfoToLog(enabledDeviceExtensionNames);
 
     createVulkanMemoryAllocator();
+    createPipelineCache();
+}
+
+void Device::createPipelineCache() {
+    pipelineCache = new PipelineCache(this);
+    std::string pipelineCacheFilename = PipelineCache::getDefaultFilename(this);
+    if (!pipelineCacheFilename.empty()) {
+        pipelineCache->loadFromFile(pipelineCacheFilename);
+    }
+}
+
+VkPipelineCache Device::getVkPipelineCache() {
+    return pipelineCache ? pipelineCache->getVkPipelineCache() : VK_NULL_HANDLE;
+}
+
+void Device::savePipelineCache() {
+    if (pipelineCache) {
+        pipelineCache->save();
+    }
 }
 
 Device::~Device() {
+    if (pipelineCache) {
+        PipelineCacheStatistics statistics = pipelineCache->getStatistics();
+        if (statistics.numPipelinesCreated > 0) {
+            sgl::Logfile::get()->writeInfo(
+                    "Pipeline cache: " + std::to_string(statistics.numPipelinesCreated) + " pipelines created in "
+                    + sgl::toString(statistics.totalCreationTimeMs, 2) + "ms, "
+                    + std::to_string(statistics.numCacheHits) + " cache hits.");
+        }
+        pipelineCache->save();
+        delete pipelineCache;
+        pipelineCache = nullptr;
+    }
+
     for (auto& it : commandPools) {
         vkDestroyCommandPool(device, it.second, nullptr);
     }
@@ -112,6 +112,7 @@ namespace sgl { namespace vk {
 class Instance;
 struct BufferSettings;
 class Buffer;
+class PipelineCache;
 typedef std::shared_ptr<Buffer> BufferPtr;
 
 struct DLL_OBJECT DeviceFeatures {
@@ -443,6 +444,11 @@ public:
     [[nodiscard]] VkPhysicalDevice getVkPhysicalDevice() { return physicalDevice; }
     [[nodiscard]] VkDevice getVkDevice() { return device; }
     [[nodiscard]] VmaAllocator getAllocator() { return allocator; }
+    /// The pipeline cache used by all pipelines. It is persisted in the config directory of the application.
+    [[nodiscard]] PipelineCache* getPipelineCache() { return pipelineCache; }
+    [[nodiscard]] VkPipelineCache getVkPipelineCache();
+    /// Saves the pipeline cache to disk (also done automatically when the device is destroyed).
+    void savePipelineCache();
     [[nodiscard]] VkQueue getGraphicsQueue() { return graphicsQueue; }
     [[nodiscard]] VkQueue getComputeQueue() { return computeQueue; }
     [[nodiscard]] VkQueue getWorkerThreadGraphicsQueue() { return workerThreadGraphicsQueue; } ///< For use in another thread.
@@ -800,6 +806,7 @@ private:
     void writeDeviceInfoToLog(const std::vector<const char*>& deviceExtensions);
 
     void createVulkanMemoryAllocator();
+    void createPipelineCache();
     VmaPool createExternalMemoryHandlePool(uint32_t memoryTypeIndex);
 
     void createLogicalDeviceAndQueues(
@@ -854,6 +861,7 @@ private:
     VkDevice device = VK_NULL_HANDLE;
     VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
     VmaAllocator allocator = VK_NULL_HANDLE;
+    PipelineCache* pipelineCache = nullptr;
     std::unordered_map<MemoryPoolType, VmaPool> externalMemoryHandlePools;
     VkExportMemoryAllocateInfo exportMemoryAllocateInfo{}; ///< Must remain in scope for use in VMA.
     std::unordered_map<VkDeviceMemory, VkDeviceSize> deviceMemoryToSizeMap;
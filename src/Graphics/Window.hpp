@@ -143,6 +143,15 @@ public:
     virtual void update()=0;
     /// Returns false if the game should quit.
     virtual bool processEvents()=0;
+    /**
+     * Blocks until an event is available or the timeout has passed. @see processEvents still needs to be called
+     * afterwards. SDL leaves the events in the queue for it, while GLFW already dispatches them to the window
+     * callbacks during the wait. Returns false if the timeout has passed without an event. With GLFW, a wake-up by
+     * @see wakeUp also returns false, as it does not count as an input or window event.
+     */
+    virtual bool waitEvents(int timeoutMs) { return true; }
+    /// Wakes up a thread blocked in @see waitEvents. Can be called from any thread.
+    virtual void wakeUp() {}
     virtual void clear(const Color &color = Color(0, 0, 0))=0;
     virtual void flip()=0;
 
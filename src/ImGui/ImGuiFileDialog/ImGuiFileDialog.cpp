@@ -43,6 +43,9 @@ SOFTWARE.
 #include <sys/stat.h>
 #include <cstdio>
 #include <cerrno>
+#include <atomic>
+
+#include <Utils/File/PathWatchService.hpp>
 
 // this option need c++17
 #ifdef USE_STD_FILESYSTEM
@@ -1800,6 +1803,213 @@ bool IGFD::FileInfos::FinalizeFileTypeParsing(const size_t& vMaxDotToExtract) {
     return false;
 }
 
+///////////////////////////////
+// DIRECTORY SCANNING
+///////////////////////////////
+
+namespace IGFD {
+
+struct CachedFileStat {
+    size_t fileSize = 0U;
+    std::string formatedFileSize;
+    std::string fileModifDate;
+};
+typedef std::unordered_map<std::string, CachedFileStat> CachedFileStatMap;
+
+// the state of a directory scan, shared between the ui thread and the worker thread
+struct DirectoryScanState {
+    std::string path;
+    std::atomic<bool> isCancelled{false};
+    std::atomic<bool> isThreadExited{false};  // set by the worker thread right before it returns
+
+    // ui thread only
+    bool isRefresh             = false;  // the current file list is kept until the scan is finished
+    bool isResultStored        = false;
+    uint64_t cacheGeneration   = 0U;
+    time_t cachedModifTime     = 0;
+    std::shared_ptr<const CachedFileStatMap> cachedFileStats;
+
+    // guarded by mutex
+    std::mutex mutex;
+    std::vector<std::shared_ptr<FileInfos> > scannedFiles;  // not yet added to the file list by the ui thread
+    bool isFinished        = false;
+    bool hasModifTime      = false;
+    time_t modifTime       = 0;
+    std::shared_ptr<const CachedFileStatMap> fileStats;
+};
+
+// Caches the stat infos of the files in recently visited directories, so that going back to a directory doesn't need to
+// stat every file again. The cache is only used when directories can be watched via sgl::PathWatchService (inotify):
+// entries of files reported as changed (including writes to them) are removed, and a directory is only reused if its
+// mtime is unchanged.
+// Only accessed by the ui thread.
+class DirectoryStatCache {
+public:
+    static DirectoryStatCache& Instance() {
+        static DirectoryStatCache _instance;
+        return _instance;
+    }
+
+    // watch the directory if not done yet, and return the cached infos (if any)
+    void Lookup(DirectoryScanState& vScanState) {
+        if (!sgl::PathWatchService::get()->getIsSupported()) {
+            return;
+        }
+        auto it = m_Directories.find(vScanState.path);
+        if (it == m_Directories.end()) {
+            m_EvictIfNeeded();
+            const std::string path = vScanState.path;
+            Entry entry;
+            entry.watchToken = sgl::PathWatchService::get()->addWatch(
+                path, true, false, [this, path](const std::vector<std::string>& vChangedPaths) { m_OnPathChanged(path, vChangedPaths); },
+                true);  // files rewritten in place don't change the mtime of the directory, so writes need to be reported
+            if (entry.watchToken == 0) {
+                return;
+            }
+            it = m_Directories.insert(std::make_pair(path, entry)).first;
+        }
+        it->second.lastUseIdx       = ++m_UseCounter;
+        vScanState.cacheGeneration  = it->second.generation;
+        vScanState.cachedModifTime  = it->second.modifTime;
+        vScanState.cachedFileStats  = it->second.fileStats;
+    }
+
+    // store the infos of a finished scan, if nothing has changed in the meantime
+    void Store(const DirectoryScanState& vScanState, time_t vModifTime, const std::shared_ptr<const CachedFileStatMap>& vFileStats) {
+        auto it = m_Directories.find(vScanState.path);
+        if (it != m_Directories.end() && it->second.generation == vScanState.cacheGeneration) {
+            it->second.modifTime = vModifTime;
+            it->second.fileStats = vFileStats;
+        }
+    }
+
+    // the generation is incremented each time a change in the directory is reported
+    uint64_t GetGeneration(const std::string& vPath) const {
+        auto it = m_Directories.find(vPath);
+        return it != m_Directories.end() ? it->second.generation : 0U;
+    }
+
+private:
+    struct Entry {
+        sgl::PathWatchToken watchToken = 0;
+        uint64_t generation            = 0U;
+        uint64_t lastUseIdx            = 0U;
+        time_t modifTime               = 0;
+        std::shared_ptr<const CachedFileStatMap> fileStats;
+    };
+
+    void m_OnPathChanged(const std::string& vPath, const std::vector<std::string>& vChangedPaths) {
+        auto it = m_Directories.find(vPath);
+        if (it == m_Directories.end()) {
+            return;
+        }
+        Entry& entry = it->second;
+        entry.generation++;
+        if (!entry.fileStats) {
+            return;
+        }
+        auto fileStats = std::make_shared<CachedFileStatMap>(*entry.fileStats);
+        for (const auto& changedPath : vChangedPaths) {
+            if (changedPath.size() <= vPath.size()) {  // the directory itself has changed
+                entry.fileStats = nullptr;
+                return;
+            }
+            fileStats->erase(changedPath.substr(changedPath.find_last_of("/\\") + 1));
+        }
+        entry.fileStats = fileStats;
+    }
+
+    void m_EvictIfNeeded() {
+        if (m_Directories.size() < s_MaxCachedDirectories) {
+            return;
+        }
+        auto itOldest = m_Directories.begin();
+        for (auto it = m_Directories.begin(); it != m_Directories.end(); ++it) {
+            if (it->second.lastUseIdx < itOldest->second.lastUseIdx) {
+                itOldest = it;
+            }
+        }
+        sgl::PathWatchService::get()->removeWatch(itOldest->second.watchToken);
+        m_Directories.erase(itOldest);
+    }
+
+    static const size_t s_MaxCachedDirectories = 32U;
+    std::unordered_map<std::string, Entry> m_Directories;
+    uint64_t m_UseCounter = 0U;
+};
+
+}  // namespace IGFD
+
+// Enumerates the directory and stats its entries, publishing them in batches so that the ui thread can show the first
+// entries immediately. The filtering (which depends on the current dialog state) is done by the ui thread.
+void IGFD::FileManager::m_ScanDirectoryThreadFunc(std::shared_ptr<IFileSystem> vFileSystemPtr, std::shared_ptr<DirectoryScanState> vScanState) {
+    struct ThreadExitMarker {
+        DirectoryScanState& scanState;
+        ~ThreadExitMarker() {
+            scanState.isThreadExited = true;
+        }
+    } threadExitMarker{*vScanState};
+
+    const size_t batchSize = 256U;
+    const std::string& path = vScanState->path;
+
+    struct stat dirStatInfos = {};
+    const bool hasModifTime = stat(path.c_str(), &dirStatInfos) == 0;
+    std::shared_ptr<const CachedFileStatMap> cachedFileStats;
+    if (hasModifTime && vScanState->cachedModifTime == dirStatInfos.st_mtime) {
+        cachedFileStats = vScanState->cachedFileStats;
+    }
+
+    const auto files = vFileSystemPtr->ScanDirectory(path);
+    auto fileStats = std::make_shared<CachedFileStatMap>();
+    std::vector<std::shared_ptr<FileInfos> > batch;
+    for (const auto& file : files) {
+        if (vScanState->isCancelled) {
+            return;
+        }
+        auto infos_ptr                   = FileInfos::create();
+        infos_ptr->filePath              = path;
+        infos_ptr->fileNameExt           = file.fileNameExt;
+        infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
+        infos_ptr->fileType              = file.fileType;
+
+        const CachedFileStat* cachedStat = nullptr;
+        if (cachedFileStats) {
+            auto it = cachedFileStats->find(file.fileNameExt);
+            if (it != cachedFileStats->end()) {
+                cachedStat = &it->second;
+            }
+        }
+        if (cachedStat) {
+            infos_ptr->fileSize         = cachedStat->fileSize;
+            infos_ptr->formatedFileSize = cachedStat->formatedFileSize;
+            infos_ptr->fileModifDate    = cachedStat->fileModifDate;
+        } else {
+            m_CompleteFileInfos(infos_ptr);
+        }
+        if (hasModifTime) {
+            CachedFileStat& fileStat  = (*fileStats)[file.fileNameExt];
+            fileStat.fileSize         = infos_ptr->fileSize;
+            fileStat.formatedFileSize = infos_ptr->formatedFileSize;
+            fileStat.fileModifDate    = infos_ptr->fileModifDate;
+        }
+
+        batch.push_back(infos_ptr);
+        if (batch.size() >= batchSize) {
+            std::lock_guard<std::mutex> lock(vScanState->mutex);
+            vScanState->scannedFiles.insert(vScanState->scannedFiles.end(), batch.begin(), batch.end());
+            batch.clear();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(vScanState->mutex);
+    vScanState->scannedFiles.insert(vScanState->scannedFiles.end(), batch.begin(), batch.end());
+    vScanState->hasModifTime = hasModifTime;
+    vScanState->modifTime    = dirStatInfos.st_mtime;
+    vScanState->fileStats    = fileStats;
+    vScanState->isFinished   = true;
+}
+
 IGFD::FileManager::FileManager() {
     fsRoot = IGFD::Utils::GetPathSeparator();
 #define STR(x) #x
@@ -1812,6 +2022,11 @@ IGFD::FileManager::FileManager() {
     // m_FileSystemPtr = std::make_unique<FILE_SYSTEM_OVERRIDE>();
 }
 
+IGFD::FileManager::~FileManager() {
+    m_CancelDirectoryScan();
+    m_JoinCancelledDirectoryScans(true);
+}
+
 void IGFD::FileManager::OpenCurrentPath(const FileDialogInternal& vFileDialogInternal) {
     showDevices = false;
     ClearComposer();
@@ -1982,6 +2197,7 @@ bool IGFD::FileManager::m_CompleteFileInfosWithUserFileAttirbutes(const FileDial
 }
 
 void IGFD::FileManager::ClearFileLists() {
+    m_CancelDirectoryScan();
     m_FilteredFileList.clear();
     m_FileList.clear();
 }
@@ -1991,13 +2207,8 @@ void IGFD::FileManager::ClearPathLists() {
     m_PathList.clear();
 }
 
-void IGFD::FileManager::m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName, const FileType& vFileType) {
-    auto infos_ptr = FileInfos::create();
-
-    infos_ptr->filePath              = vPath;
-    infos_ptr->fileNameExt           = vFileName;
-    infos_ptr->fileNameExt_optimized = Utils::LowerCaseString(infos_ptr->fileNameExt);
-    infos_ptr->fileType              = vFileType;
+void IGFD::FileManager::m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos) {
+    const auto& infos_ptr = vInfos;
 
     if (infos_ptr->fileNameExt.empty() || (infos_ptr->fileNameExt == "." && !vFileDialogInternal.filterManager.dLGFilters.empty())) {  // filename empty or filename is the current dir '.' //-V807
         return;
@@ -2018,7 +2229,7 @@ void IGFD::FileManager::m_AddFile(const FileDialogInternal& vFileDialogInternal,
 
     vFileDialogInternal.filterManager.FillFileStyle(infos_ptr);
 
-    m_CompleteFileInfos(infos_ptr);
+    // the stat infos were already completed by the scanning thread
 
     if (m_CompleteFileInfosWithUserFileAttirbutes(vFileDialogInternal, infos_ptr)) {
         m_FileList.push_back(infos_ptr);
@@ -2069,16 +2280,116 @@ void IGFD::FileManager::ScanDir(const FileDialogInternal& vFileDialogInternal, c
 #endif  // _IGFD_WIN_
 
         ClearFileLists();
+        m_StartDirectoryScan(path, false);
+        ProcessDirectoryScan(vFileDialogInternal);
+    }
+}
 
-        const auto& files = m_FileSystemPtr->ScanDirectory(path);
-        for (const auto& file : files) {
-            m_AddFile(vFileDialogInternal, path, file.fileNameExt, file.fileType);
+void IGFD::FileManager::m_StartDirectoryScan(const std::string& vPath, bool vIsRefresh) {
+    m_CancelDirectoryScan();
+    m_DirectoryScanState            = std::make_shared<DirectoryScanState>();
+    m_DirectoryScanState->path      = vPath;
+    m_DirectoryScanState->isRefresh = vIsRefresh;
+    DirectoryStatCache::Instance().Lookup(*m_DirectoryScanState);
+    m_NeedToSortFileList = false;
+#ifdef __EMSCRIPTEN__
+    m_ScanDirectoryThreadFunc(m_FileSystemPtr, m_DirectoryScanState);
+#else
+    m_DirectoryScanThread = std::thread(&IGFD::FileManager::m_ScanDirectoryThreadFunc, m_FileSystemPtr, m_DirectoryScanState);
+#endif
+}
+
+// the worker thread checks the cancel flag after every entry, but the directory listing or the stat of one entry can
+// take long on slow (e.g. network) file systems. So the ui thread doesn't wait for it, and the thread is joined later
+// once it has exited. The worker thread only accesses the shared scan state and file system.
+void IGFD::FileManager::m_CancelDirectoryScan() {
+    if (m_DirectoryScanState) {
+        m_DirectoryScanState->isCancelled = true;
+    }
+    if (m_DirectoryScanThread.joinable()) {
+        m_CancelledDirectoryScans.emplace_back(m_DirectoryScanState, std::move(m_DirectoryScanThread));
+    }
+    m_DirectoryScanState = nullptr;
+    m_JoinCancelledDirectoryScans(false);
+}
+
+void IGFD::FileManager::m_JoinCancelledDirectoryScans(bool vWaitForAll) {
+    auto it = m_CancelledDirectoryScans.begin();
+    while (it != m_CancelledDirectoryScans.end()) {
+        if (vWaitForAll || it->first->isThreadExited) {
+            it->second.join();
+            it = m_CancelledDirectoryScans.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void IGFD::FileManager::ProcessDirectoryScan(const FileDialogInternal& vFileDialogInternal) {
+    if (!m_CancelledDirectoryScans.empty()) {
+        m_JoinCancelledDirectoryScans(false);
+    }
+    if (!m_DirectoryScanState) {
+        return;
+    }
+    auto scanState = m_DirectoryScanState;
+
+    std::vector<std::shared_ptr<FileInfos> > scannedFiles;
+    bool isFinished = false;
+    {
+        std::lock_guard<std::mutex> lock(scanState->mutex);
+        isFinished = scanState->isFinished;
+        if (isFinished || !scanState->isRefresh) {  // on refresh, the old list is kept until the new one is complete
+            scannedFiles.swap(scanState->scannedFiles);
+        }
+        if (isFinished && !scanState->isResultStored) {
+            if (scanState->hasModifTime) {
+                DirectoryStatCache::Instance().Store(*scanState, scanState->modifTime, scanState->fileStats);
+            }
+            scanState->isResultStored = true;
+            scanState->fileStats      = nullptr;
+        }
+    }
+
+    if (scanState->isRefresh && isFinished) {
+        m_FilteredFileList.clear();
+        m_FileList.clear();
+        scanState->isRefresh = false;
+        m_NeedToSortFileList = true;
+    }
+    for (const auto& infos_ptr : scannedFiles) {
+        m_AddFile(vFileDialogInternal, infos_ptr);
+        m_NeedToSortFileList = true;
+    }
+
+    // sorting/filtering is deferred and throttled while entries are still coming in
+    if (m_NeedToSortFileList) {
+        const double currentTime = ImGui::GetTime();
+        if (isFinished || currentTime - m_LastFileListSortTime >= 0.25) {
+            m_SortFields(vFileDialogInternal, m_FileList, m_FilteredFileList);
+            m_NeedToSortFileList   = false;
+            m_LastFileListSortTime = currentTime;
         }
+    }
 
-        m_SortFields(vFileDialogInternal, m_FileList, m_FilteredFileList);
+    // the directory has changed during or after the scan
+    if (isFinished && DirectoryStatCache::Instance().GetGeneration(scanState->path) != scanState->cacheGeneration) {
+        m_StartDirectoryScan(scanState->path, true);
     }
 }
 
+bool IGFD::FileManager::HasDirectoryScan() const {
+    return m_DirectoryScanState != nullptr;
+}
+
+bool IGFD::FileManager::IsScanningDirectory() const {
+    if (!m_DirectoryScanState) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_DirectoryScanState->mutex);
+    return !m_DirectoryScanState->isFinished;
+}
+
 void IGFD::FileManager::m_ScanDirForPathSelection(const FileDialogInternal& vFileDialogInternal, const std::string& vPath) {
     std::string path = vPath;
 
@@ -2257,9 +2568,12 @@ void IGFD::FileManager::m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vI
             struct tm _tm;
             errno_t err = localtime_s(&_tm, &statInfos.st_mtime);
             if (!err) len = strftime(timebuf, 99, DateTimeFormat, &_tm);
-#else   // _MSC_VER
-            struct tm* _tm = localtime(&statInfos.st_mtime);
+#elif defined(_WIN32)  // _MSC_VER
+            struct tm* _tm = localtime(&statInfos.st_mtime);  // thread-local storage in the msvcrt
             if (_tm) len = strftime(timebuf, 99, DateTimeFormat, _tm);
+#else   // _MSC_VER
+            struct tm _tm;  // called by the scanning thread, so the reentrant version is needed
+            if (localtime_r(&statInfos.st_mtime, &_tm)) len = strftime(timebuf, 99, DateTimeFormat, &_tm);
 #endif  // _MSC_VER
             if (len) {
                 vInfos->fileModifDate = std::string(timebuf, len);
@@ -3824,7 +4138,7 @@ bool IGFD::FileDialog::Display(const std::string& vKey, ImGuiWindowFlags vFlags,
                 fdFilter.SetDefaultFilterIfNotDefined();
 
                 // init list of files
-                if (fdFile.IsFileListEmpty() && !fdFile.showDevices) {
+                if (fdFile.IsFileListEmpty() && !fdFile.showDevices && !fdFile.HasDirectoryScan()) {
                     if (fdFile.dLGpath != ".")                                                      // Removes extension seperator in filename if we don't check
                         IGFD::Utils::ReplaceString(fdFile.dLGDefaultFileName, fdFile.dLGpath, "");  // local path
 
@@ -3835,6 +4149,7 @@ bool IGFD::FileDialog::Display(const std::string& vKey, ImGuiWindowFlags vFlags,
                         fdFile.SetDefaultFileName(".");
                     fdFile.ScanDir(m_FileDialogInternal, fdFile.dLGpath);
                 }
+                fdFile.ProcessDirectoryScan(m_FileDialogInternal);  // progressive population of the file list
 
                 // draw dialog parts
                 m_DrawHeader();        // place, directory, path
@@ -530,6 +530,8 @@ public:
     virtual std::vector<IGFD::PathDisplayedName> GetDevicesList() = 0;
 };
 
+struct DirectoryScanState;
+
 class IGFD_API FileManager {
 public:                            // types
     enum class SortingFieldEnum {  // sorting for filetering of the file lsit
@@ -557,7 +559,12 @@ private:
     std::set<std::string> m_SelectedFileNames;                    // the user selection of FilePathNames
     bool m_CreateDirectoryMode = false;                           // for create directory widget
     std::string m_FileSystemName;
-    std::unique_ptr<IFileSystem> m_FileSystemPtr = nullptr;
+    std::shared_ptr<IFileSystem> m_FileSystemPtr = nullptr;               // shared with the directory scanning thread
+    std::shared_ptr<DirectoryScanState> m_DirectoryScanState = nullptr;  // scan of the current directory running on a worker thread
+    std::thread m_DirectoryScanThread;                                   // worker thread of m_DirectoryScanState
+    std::vector<std::pair<std::shared_ptr<DirectoryScanState>, std::thread> > m_CancelledDirectoryScans;  // joined once they have exited
+    bool m_NeedToSortFileList      = false;                              // entries were added since the last sorting/filtering
+    double m_LastFileListSortTime  = 0.0;                                // ImGui time of the last sorting/filtering
 
 public:
     bool inputPathActivated                               = false;  // show input for path edition
@@ -597,8 +604,7 @@ private:
     static void m_CompleteFileInfos(const std::shared_ptr<FileInfos>& vInfos);                    // set time and date infos of a file (detail view mode)
     void m_RemoveFileNameInSelection(const std::string& vFileName);                               // selection : remove a file name
     void m_AddFileNameInSelection(const std::string& vFileName, bool vSetLastSelectionFileName);  // selection : add a file name
-    void m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName,
-                   const FileType& vFileType);  // add file called by scandir
+    void m_AddFile(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos);  // add file scanned by the worker thread of scandir
     void m_AddPath(const FileDialogInternal& vFileDialogInternal, const std::string& vPath, const std::string& vFileName,
                    const FileType& vFileType);  // add file called by scandir
     void m_ScanDirForPathSelection(const FileDialogInternal& vFileDialogInternal,
@@ -613,9 +619,15 @@ private:
     void m_SortFields(const FileDialogInternal& vFileDialogInternal, std::vector<std::shared_ptr<FileInfos> >& vFileInfosList,
                       std::vector<std::shared_ptr<FileInfos> >& vFileInfosFilteredList);  // will sort a column
     bool m_CompleteFileInfosWithUserFileAttirbutes(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos);
+    void m_StartDirectoryScan(const std::string& vPath, bool vIsRefresh);  // launch the worker thread scanning the directory
+    void m_CancelDirectoryScan();
+    void m_JoinCancelledDirectoryScans(bool vWaitForAll);  // join the exited worker threads of cancelled scans
+    static void m_ScanDirectoryThreadFunc(std::shared_ptr<IFileSystem> vFileSystemPtr,  //
+                                          std::shared_ptr<DirectoryScanState> vScanState);
 
 public:
     FileManager();
+    ~FileManager();
     bool IsComposerEmpty() const;
     size_t GetComposerSize() const;
     bool IsFileListEmpty() const;
@@ -651,7 +663,10 @@ public:
     void SelectOrDeselectFileName(const FileDialogInternal& vFileDialogInternal, const std::shared_ptr<FileInfos>& vInfos);  // add/remove a filename in selection
     void SetCurrentDir(const std::string& vPath);                                                                            // define current directory for scan
     void ScanDir(const FileDialogInternal& vFileDialogInternal,
-                 const std::string& vPath);  // scan the directory for retrieve the file list
+                 const std::string& vPath);                                // scan the directory for retrieve the file list (asynchronously)
+    void ProcessDirectoryScan(const FileDialogInternal& vFileDialogInternal);  // add the entries scanned since the last frame to the file list
+    bool HasDirectoryScan() const;                                             // a scan of the current directory was started (it may be finished already)
+    bool IsScanningDirectory() const;                                          // the scan of the current directory is still running
     std::string GetResultingPath();
     std::string GetResultingFileName(FileDialogInternal& vFileDialogInternal, IGFD_ResultMode vFlag);
     std::string GetResultingFilePathName(FileDialogInternal& vFileDialogInternal, IGFD_ResultMode vFlag);
@@ -28,6 +28,7 @@
 
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 #ifdef __linux__
 #include <sys/inotify.h>
@@ -41,6 +42,7 @@
 #endif
 
 #include <Utils/AppSettings.hpp>
+#include <Utils/AppLogic.hpp>
 #include <Utils/File/Logfile.hpp>
 #include <Utils/File/FileUtils.hpp>
 #include <Utils/Parallel/Reduction.hpp>
@@ -324,6 +326,8 @@ void GuiVarData::setAttributeValues(const std::vector<float>& _attributes) {
 }
 
 void GuiVarData::setAttributeValues(const std::vector<float>& _attributes, float minAttribute, float maxAttribute) {
+    window->cancelHistogramJobs(varIdx);
+    this->histogramSummary = {};
     this->attributes = _attributes;
     this->dataRange = glm::vec2(minAttribute, maxAttribute);
     this->selectedRange = glm::vec2(minAttribute, maxAttribute);
@@ -337,6 +341,8 @@ void GuiVarData::computeHistogram() {
             selectedRange.x, selectedRange.y, dataRange.x, dataRange.y,
             recomputeMinMax, isSelectedRangeFixed)) {
         recomputeMinMax = false;
+        histogramJobId = 0;
+        isHistogramPreview = false;
         return;
     }
     if (recomputeMinMax && window->requestAttributeValuesCallback) {
@@ -358,28 +364,14 @@ void GuiVarData::computeHistogram() {
         float minVal, maxVal;
         window->requestAttributeValuesCallback(
                 varIdx, &attributesPtr, &fmt, numAttributes, minVal, maxVal);
-        if (fmt == ScalarDataFormat::FLOAT) {
-            sgl::computeHistogram(
-                    histogram, histogramResolution, static_cast<const float*>(attributesPtr), numAttributes,
-                    selectedRange.x, selectedRange.y);
-        } else if (fmt == ScalarDataFormat::BYTE) {
-            sgl::computeHistogramUnormByte(
-                    histogram, histogramResolution, static_cast<const uint8_t*>(attributesPtr), numAttributes,
-                    selectedRange.x, selectedRange.y);
-        } else if (fmt == ScalarDataFormat::SHORT) {
-            sgl::computeHistogramUnormShort(
-                    histogram, histogramResolution, static_cast<const uint16_t*>(attributesPtr), numAttributes,
-                    selectedRange.x, selectedRange.y);
-        } else if (fmt == ScalarDataFormat::FLOAT16) {
-            sgl::Logfile::get()->throwError("Error in GuiVarData::computeHistogram: FLOAT16 is not yet supported.");
-        } else {
+        if (fmt != ScalarDataFormat::FLOAT && fmt != ScalarDataFormat::BYTE && fmt != ScalarDataFormat::SHORT
+                && fmt != ScalarDataFormat::FLOAT16) {
             sgl::Logfile::get()->throwError(
                     "Error in GuiVarData::computeHistogram: Invalid number of bytes per component.");
         }
+        window->computeHistogramAsync(*this, fmt, attributesPtr, numAttributes);
     } else {
-        sgl::computeHistogram(
-                histogram, histogramResolution, attributes.data(), attributes.size(),
-                selectedRange.x, selectedRange.y);
+        window->computeHistogramAsync(*this, ScalarDataFormat::FLOAT, attributes.data(), attributes.size());
     }
 
     /*float histogramsMax = 0;
@@ -1014,7 +1006,19 @@ MultiVarTransferFunctionWindow::MultiVarTransferFunctionWindow(
 MultiVarTransferFunctionWindow::MultiVarTransferFunctionWindow(const std::vector<std::string>& tfPresetFiles)
         : MultiVarTransferFunctionWindow("", tfPresetFiles) {}
 
-MultiVarTransferFunctionWindow::~MultiVarTransferFunctionWindow() = default;
+MultiVarTransferFunctionWindow::~MultiVarTransferFunctionWindow() {
+    if (histogramWorkerThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(histogramJobMutex);
+            quitHistogramWorker = true;
+            pendingHistogramJobs.clear();
+            cancelRunningHistogramJob = true;
+            abortRunningHistogramSummary = true;
+        }
+        histogramJobQueueCv.notify_all();
+        histogramWorkerThread.join();
+    }
+}
 
 void MultiVarTransferFunctionWindow::setAttributesValues(
         const std::vector<std::string>& names,
@@ -1064,6 +1068,7 @@ void MultiVarTransferFunctionWindow::setAttributeNames(const std::vector<std::st
     selectedVarIndex = defaultVarIndex;
 
     if (guiVarData.size() != names.size()) {
+        cancelHistogramJobs();
         guiVarData.clear();
         guiVarData.reserve(names.size());
         dirtyIndices.resize(names.size());
@@ -1101,8 +1106,10 @@ void MultiVarTransferFunctionWindow::setAttributeNames(const std::vector<std::st
 }
 
 void MultiVarTransferFunctionWindow::setAttributeDataDirty(int varIdx) {
+    cancelHistogramJobs(varIdx);
     GuiVarData& varData = guiVarData.at(varIdx);
     varData.isEmpty = true;
+    varData.histogramSummary = {};
     if (int(selectedVarIndex) == varIdx) {
         loadAttributeDataIfEmpty(varIdx);
     }
@@ -1126,6 +1133,8 @@ void MultiVarTransferFunctionWindow::updateAttributeName(int varIdx, const std::
 }
 
 void MultiVarTransferFunctionWindow::removeAttribute(int varIdxRemove) {
+    // The variable indices of the jobs change, so all jobs are restarted below.
+    cancelHistogramJobs();
     size_t numVarsNew = varNames.size() - 1;
     varNames.erase(varNames.begin() + varIdxRemove);
     guiVarData.erase(guiVarData.begin() + varIdxRemove);
@@ -1153,6 +1162,7 @@ void MultiVarTransferFunctionWindow::removeAttribute(int varIdxRemove) {
         selectedVarIndex--;
     }
     currVarData = &guiVarData.at(selectedVarIndex);
+    recomputePreviewHistograms();
 
     recreateTfMapTexture();
     rebuildTransferFunctionMapComplete();
@@ -1168,6 +1178,8 @@ void MultiVarTransferFunctionWindow::addAttributeName(const std::string& name) {
     transferFunctionMap_sRGB.resize(TRANSFER_FUNCTION_TEXTURE_SIZE * numVarsNew);
     transferFunctionMap_linearRGB.resize(TRANSFER_FUNCTION_TEXTURE_SIZE * numVarsNew);
 
+    // Growing 'guiVarData' may relocate the attribute arrays used by running jobs.
+    cancelHistogramJobs();
     guiVarData.emplace_back(
             this, tfPresetFiles.empty() ? "" : tfPresetFiles.at(varIdxNew % tfPresetFiles.size()),
             &transferFunctionMap_sRGB.at(TRANSFER_FUNCTION_TEXTURE_SIZE * varIdxNew),
@@ -1181,6 +1193,7 @@ void MultiVarTransferFunctionWindow::addAttributeName(const std::string& name) {
     }
     currVarData = &guiVarData.at(selectedVarIndex);
     dirtyIndices.emplace_back(true);
+    recomputePreviewHistograms();
 
     recreateTfMapTexture();
     rebuildTransferFunctionMapComplete();
@@ -1369,11 +1382,189 @@ void MultiVarTransferFunctionWindow::setTransferFunction(
 
 void MultiVarTransferFunctionWindow::update(float dt) {
     directoryContentWatch.update([this] { this->updateAvailableFiles(); });
+    applyFinishedHistogramJobs();
     if (currVarData) {
         currVarData->dragPoint();
     }
 }
 
+void MultiVarTransferFunctionWindow::computeHistogramAsync(
+        GuiVarData& varData, ScalarDataFormat format, const void* values, size_t numValues) {
+    // Any job still computing the histogram of this variable is stale now.
+    {
+        std::lock_guard<std::mutex> lock(histogramJobMutex);
+        pendingHistogramJobs.erase(varData.varIdx);
+        if (runningHistogramJobVarIdx == varData.varIdx) {
+            cancelRunningHistogramJob = true;
+        }
+    }
+    varData.histogramJobId = ++histogramJobCounter;
+
+    // The summary of small data sets is built on the UI thread, the one of large data sets by the worker thread.
+    const bool isLargeData = numValues > maxNumHistogramPreviewValues;
+    if (!varData.histogramSummary && !isLargeData) {
+        auto summary = std::make_shared<HistogramSummary>();
+        summary->build(format, values, numValues, varData.dataRange.x, varData.dataRange.y);
+        varData.histogramSummary = summary;
+    }
+
+    if (varData.histogramSummary) {
+        float maxErrorBound = varData.histogramSummary->computeHistogram(
+                varData.histogram, varData.histogramResolution, varData.selectedRange.x, varData.selectedRange.y);
+        varData.isHistogramPreview = maxErrorBound > HistogramSummary::DEFAULT_MAX_ERROR_BOUND;
+        if (varData.isHistogramPreview && !isLargeData) {
+            sgl::computeHistogramStrided(
+                    varData.histogram, varData.histogramResolution, format, values, numValues, 1,
+                    varData.selectedRange.x, varData.selectedRange.y);
+            varData.isHistogramPreview = false;
+        }
+    } else {
+        size_t stride = (numValues + maxNumHistogramPreviewValues - 1) / maxNumHistogramPreviewValues;
+        sgl::computeHistogramStrided(
+                varData.histogram, varData.histogramResolution, format, values, numValues, stride,
+                varData.selectedRange.x, varData.selectedRange.y);
+        varData.isHistogramPreview = true;
+    }
+    if (!varData.isHistogramPreview) {
+        return;
+    }
+
+    HistogramJob job;
+    job.varIdx = varData.varIdx;
+    job.jobId = varData.histogramJobId;
+    job.histogramResolution = varData.histogramResolution;
+    job.format = format;
+    job.values = values;
+    job.numValues = numValues;
+    job.minVal = varData.selectedRange.x;
+    job.maxVal = varData.selectedRange.y;
+    job.dataMin = varData.dataRange.x;
+    job.dataMax = varData.dataRange.y;
+    job.summary = varData.histogramSummary;
+    {
+        std::lock_guard<std::mutex> lock(histogramJobMutex);
+        pendingHistogramJobs[job.varIdx] = job;
+        if (!histogramWorkerThread.joinable()) {
+            histogramWorkerThread = std::thread(&MultiVarTransferFunctionWindow::histogramWorkerThreadFunction, this);
+        }
+    }
+    histogramJobQueueCv.notify_one();
+}
+
+void MultiVarTransferFunctionWindow::cancelHistogramJobs(int varIdx) {
+    std::unique_lock<std::mutex> lock(histogramJobMutex);
+    if (varIdx < 0) {
+        pendingHistogramJobs.clear();
+        finishedHistogramJobs.clear();
+    } else {
+        pendingHistogramJobs.erase(varIdx);
+        finishedHistogramJobs.erase(
+                std::remove_if(
+                        finishedHistogramJobs.begin(), finishedHistogramJobs.end(),
+                        [varIdx](const HistogramJobResult& result) { return result.varIdx == varIdx; }),
+                finishedHistogramJobs.end());
+    }
+    if (runningHistogramJobVarIdx >= 0 && (varIdx < 0 || runningHistogramJobVarIdx == varIdx)) {
+        cancelRunningHistogramJob = true;
+        abortRunningHistogramSummary = true;
+        histogramJobFinishedCv.wait(lock, [&] {
+            return runningHistogramJobVarIdx < 0 || (varIdx >= 0 && runningHistogramJobVarIdx != varIdx);
+        });
+    }
+}
+
+void MultiVarTransferFunctionWindow::recomputePreviewHistograms() {
+    for (GuiVarData& varData : guiVarData) {
+        if (varData.isHistogramPreview && !varData.isEmpty) {
+            varData.computeHistogram();
+        }
+    }
+}
+
+void MultiVarTransferFunctionWindow::applyFinishedHistogramJobs() {
+    std::vector<HistogramJobResult> results;
+    {
+        std::lock_guard<std::mutex> lock(histogramJobMutex);
+        if (finishedHistogramJobs.empty()) {
+            return;
+        }
+        results.swap(finishedHistogramJobs);
+    }
+    for (HistogramJobResult& result : results) {
+        if (size_t(result.varIdx) >= guiVarData.size()) {
+            continue;
+        }
+        GuiVarData& varData = guiVarData.at(result.varIdx);
+        if (result.summary && !varData.histogramSummary) {
+            varData.histogramSummary = result.summary;
+        }
+        if (varData.histogramJobId == result.jobId && !result.histogram.empty()) {
+            varData.histogram = std::move(result.histogram);
+            varData.isHistogramPreview = false;
+        }
+    }
+}
+
+void MultiVarTransferFunctionWindow::histogramWorkerThreadFunction() {
+    std::unique_lock<std::mutex> lock(histogramJobMutex);
+    while (true) {
+        histogramJobQueueCv.wait(lock, [this] { return quitHistogramWorker || !pendingHistogramJobs.empty(); });
+        if (quitHistogramWorker) {
+            break;
+        }
+
+        auto it = pendingHistogramJobs.begin();
+        HistogramJob job = it->second;
+        pendingHistogramJobs.erase(it);
+        runningHistogramJobVarIdx = job.varIdx;
+        cancelRunningHistogramJob = false;
+        abortRunningHistogramSummary = false;
+        lock.unlock();
+
+        HistogramJobResult result;
+        result.varIdx = job.varIdx;
+        result.jobId = job.jobId;
+        bool isFinished = true;
+        if (!job.summary) {
+            auto summary = std::make_shared<HistogramSummary>();
+            isFinished = summary->build(
+                    job.format, job.values, job.numValues, job.dataMin, job.dataMax,
+                    HistogramSummary::DEFAULT_NUM_FINE_BINS, &abortRunningHistogramSummary);
+            if (isFinished) {
+                result.summary = summary;
+                job.summary = summary;
+                // Jobs for other ranges that were queued in the meantime can reuse the summary.
+                lock.lock();
+                auto itPending = pendingHistogramJobs.find(job.varIdx);
+                if (itPending != pendingHistogramJobs.end() && !itPending->second.summary) {
+                    itPending->second.summary = summary;
+                }
+                lock.unlock();
+            }
+        }
+        if (isFinished && !cancelRunningHistogramJob) {
+            float maxErrorBound = job.summary->computeHistogram(
+                    result.histogram, job.histogramResolution, job.minVal, job.maxVal);
+            if (maxErrorBound > HistogramSummary::DEFAULT_MAX_ERROR_BOUND) {
+                isFinished = sgl::computeHistogramStrided(
+                        result.histogram, job.histogramResolution, job.format, job.values, job.numValues, 1,
+                        job.minVal, job.maxVal, &cancelRunningHistogramJob);
+            }
+        }
+
+        lock.lock();
+        runningHistogramJobVarIdx = -1;
+        if (!isFinished || cancelRunningHistogramJob) {
+            result.histogram.clear();
+        }
+        if (!result.histogram.empty() || result.summary) {
+            finishedHistogramJobs.push_back(std::move(result));
+            AppLogic::requestRedraw();
+        }
+        histogramJobFinishedCv.notify_all();
+    }
+}
+
 void MultiVarTransferFunctionWindow::setUseLinearRGB(bool _useLinearRGB) {
     this->useLinearRGB = _useLinearRGB;
     rebuildTransferFunctionMapComplete();
@@ -1463,6 +1654,7 @@ void MultiVarTransferFunctionWindow::rebuildTransferFunctionMap() {
 }
 
 bool MultiVarTransferFunctionWindow::renderGui() {
+    applyFinishedHistogramJobs();
 #ifndef DISABLE_IMGUI
     sgl::ImGuiWrapper::get()->setNextWindowStandardPosSize(2, 1278, 634, 818);
     if (showWindow && !varNames.empty()) {
@@ -30,9 +30,16 @@
 #define SGL_MULTIVARTRANSFERFUNCTIONWINDOW_HPP
 
 #include <utility>
+#include <memory>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 
 #include <Utils/File/PathWatch.hpp>
 #include <Utils/SciVis/ScalarDataFormat.hpp>
+#include <Utils/Parallel/HistogramSummary.hpp>
 #include <ImGui/Widgets/TransferFunctionWindow.hpp>
 #ifdef SUPPORT_OPENGL
 #include <Graphics/Buffers/GeometryBuffer.hpp>
@@ -119,6 +126,10 @@ private:
     int varIdx = 0;
     int histogramResolution = 64;
     std::vector<float> histogram;
+    uint64_t histogramJobId = 0; ///< ID of the last asynchronous histogram job (results of older jobs are stale).
+    bool isHistogramPreview = false; ///< Whether 'histogram' is a preview and the exact result is pending.
+    /// Summary of the attribute values, from which histograms can be derived without rescanning the data.
+    std::shared_ptr<const HistogramSummary> histogramSummary;
     glm::vec2 dataRange = glm::vec2(0.0f);
     glm::vec2 selectedRange = glm::vec2(0.0f);
     std::vector<float> attributes;
@@ -188,6 +199,8 @@ public:
     /*
      * Secondary interface, where attribute data is not supplied through @see setAttributesValues, but when used
      * through a callback. 'fmt' is the format of the entries. 'attributes' and 'fmt' may be a null pointer.
+     * As histograms of large data sets are computed asynchronously, the memory returned via 'attributes' needs to stay
+     * valid until @see setAttributeDataDirty or @see removeAttribute is called for the variable.
      */
     using RequestAttributeValuesCallback = std::function<void(
             int varIdx, const void** attributes, ScalarDataFormat* fmt, size_t& numAttributes, float& minVal, float& maxVal)>;
@@ -301,6 +314,49 @@ private:
     RequestAttributeValuesCallback requestAttributeValuesCallback{};
     RequestHistogramCallback requestHistogramCallback{};
 
+    /*
+     * Asynchronous histogram computation. Histograms are derived from a @see HistogramSummary of each variable if its
+     * error bound is small enough. For data sets with more than 'maxNumHistogramPreviewValues' values, the summary and,
+     * if necessary, the exact histogram are computed by a worker thread, while a preview is shown. Jobs that become
+     * stale (e.g., when the selected range changes again) are cancelled. Building the summary is only aborted if the
+     * data changes, as it is reused for all later ranges.
+     */
+    struct HistogramJob {
+        int varIdx = 0;
+        uint64_t jobId = 0;
+        int histogramResolution = 0;
+        ScalarDataFormat format = ScalarDataFormat::FLOAT;
+        const void* values = nullptr;
+        size_t numValues = 0;
+        float minVal = 0.0f, maxVal = 0.0f;
+        float dataMin = 0.0f, dataMax = 0.0f;
+        std::shared_ptr<const HistogramSummary> summary; ///< Built by the job if null.
+    };
+    struct HistogramJobResult {
+        int varIdx = 0;
+        uint64_t jobId = 0;
+        std::vector<float> histogram; ///< Empty if the job was cancelled after building the summary.
+        std::shared_ptr<const HistogramSummary> summary;
+    };
+    void computeHistogramAsync(GuiVarData& varData, ScalarDataFormat format, const void* values, size_t numValues);
+    /// Cancels the jobs of the passed variable (or of all variables if -1) and waits until the data is unused.
+    void cancelHistogramJobs(int varIdx = -1);
+    void recomputePreviewHistograms();
+    void applyFinishedHistogramJobs();
+    void histogramWorkerThreadFunction();
+    size_t maxNumHistogramPreviewValues = size_t(1) << 20;
+    uint64_t histogramJobCounter = 0;
+    std::thread histogramWorkerThread;
+    std::mutex histogramJobMutex;
+    std::condition_variable histogramJobQueueCv;
+    std::condition_variable histogramJobFinishedCv;
+    std::map<int, HistogramJob> pendingHistogramJobs; ///< At most one pending job per variable.
+    std::vector<HistogramJobResult> finishedHistogramJobs;
+    int runningHistogramJobVarIdx = -1;
+    std::atomic<bool> cancelRunningHistogramJob = false;
+    std::atomic<bool> abortRunningHistogramSummary = false;
+    bool quitHistogramWorker = false;
+
     // Data range shader storage buffer object.
 #ifdef SUPPORT_OPENGL
     sgl::GeometryBufferPtr minMaxSsbo;
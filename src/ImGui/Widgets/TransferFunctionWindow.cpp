@@ -314,6 +314,7 @@ void TransferFunctionWindow::computeHistogram(const std::vector<float>& attribut
     auto [minAttr, maxAttr] = sgl::reduceFloatArrayMinMax(attributes);
     this->dataRange = glm::vec2(minAttr, maxAttr);
     this->selectedRange = glm::vec2(minAttr, maxAttr);
+    histogramSummary.build(ScalarDataFormat::FLOAT, attributes.data(), attributes.size(), minAttr, maxAttr);
     recomputeHistogram();
     rebuildRangeUbo();
 }
@@ -322,12 +323,19 @@ void TransferFunctionWindow::computeHistogram(const std::vector<float>& attribut
     this->attributes = attributes;
     this->dataRange = glm::vec2(minAttr, maxAttr);
     this->selectedRange = glm::vec2(minAttr, maxAttr);
+    histogramSummary.build(ScalarDataFormat::FLOAT, attributes.data(), attributes.size(), minAttr, maxAttr);
     recomputeHistogram();
     rebuildRangeUbo();
 }
 
 
 void TransferFunctionWindow::recomputeHistogram() {
+    // Only fall back to rescanning the data if the edges of the histogram bins straddle populated fine bins too much.
+    float maxErrorBound = histogramSummary.computeHistogram(
+            histogram, histogramResolution, selectedRange.x, selectedRange.y);
+    if (maxErrorBound <= HistogramSummary::DEFAULT_MAX_ERROR_BOUND) {
+        return;
+    }
     sgl::computeHistogram(
             histogram, histogramResolution, attributes.data(), attributes.size(), selectedRange.x, selectedRange.y);
 
@@ -40,6 +40,7 @@
 
 #include <Math/Geometry/AABB2.hpp>
 #include <Utils/File/PathWatch.hpp>
+#include <Utils/Parallel/HistogramSummary.hpp>
 #include <Graphics/Color.hpp>
 #ifdef SUPPORT_OPENGL
 #include <Graphics/Texture/Texture.hpp>
@@ -201,6 +202,7 @@ private:
     glm::vec2 dataRange = glm::vec2(0.0f);
     glm::vec2 selectedRange = glm::vec2(0.0f);
     std::vector<float> attributes;
+    HistogramSummary histogramSummary; ///< Histograms are derived from the summary if it is accurate enough.
 
     // Drag-and-drop data
     SelectedPointType selectedPointType = SELECTED_POINT_TYPE_NONE;
@@ -0,0 +1,289 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_FRUSTUM_CULLING_USE_SSE2
+#endif
+
+#include "FrustumCulling.hpp"
+
+namespace sgl {
+
+// Bounds are processed in chunks; inputs with fewer bounds than one chunk are processed on the calling thread.
+static const size_t CULLING_CHUNK_SIZE = 4096;
+
+void AABB3Array::clear() {
+    minX.clear(); minY.clear(); minZ.clear();
+    maxX.clear(); maxY.clear(); maxZ.clear();
+}
+
+void AABB3Array::resize(size_t size) {
+    minX.resize(size); minY.resize(size); minZ.resize(size);
+    maxX.resize(size); maxY.resize(size); maxZ.resize(size);
+}
+
+void AABB3Array::reserve(size_t size) {
+    minX.reserve(size); minY.reserve(size); minZ.reserve(size);
+    maxX.reserve(size); maxY.reserve(size); maxZ.reserve(size);
+}
+
+void AABB3Array::set(size_t idx, const AABB3& aabb) {
+    minX[idx] = aabb.min.x; minY[idx] = aabb.min.y; minZ[idx] = aabb.min.z;
+    maxX[idx] = aabb.max.x; maxY[idx] = aabb.max.y; maxZ[idx] = aabb.max.z;
+}
+
+void AABB3Array::push_back(const AABB3& aabb) {
+    minX.push_back(aabb.min.x); minY.push_back(aabb.min.y); minZ.push_back(aabb.min.z);
+    maxX.push_back(aabb.max.x); maxY.push_back(aabb.max.y); maxZ.push_back(aabb.max.z);
+}
+
+void SphereArray::clear() {
+    centerX.clear(); centerY.clear(); centerZ.clear(); radius.clear();
+}
+
+void SphereArray::resize(size_t size) {
+    centerX.resize(size); centerY.resize(size); centerZ.resize(size); radius.resize(size);
+}
+
+void SphereArray::reserve(size_t size) {
+    centerX.reserve(size); centerY.reserve(size); centerZ.reserve(size); radius.reserve(size);
+}
+
+void SphereArray::set(size_t idx, const Sphere& sphere) {
+    centerX[idx] = sphere.center.x; centerY[idx] = sphere.center.y; centerZ[idx] = sphere.center.z;
+    radius[idx] = sphere.radius;
+}
+
+void SphereArray::push_back(const Sphere& sphere) {
+    centerX.push_back(sphere.center.x); centerY.push_back(sphere.center.y); centerZ.push_back(sphere.center.z);
+    radius.push_back(sphere.radius);
+}
+
+/*
+ * For every plane, the box corner farthest along the plane normal (p-vertex) and the opposite corner (n-vertex) are
+ * selected by the signs of the normal components. The box is outside if the p-vertex is outside of one plane, and
+ * inside if the n-vertices are inside of all planes.
+ */
+static void classifyAabbsRange(
+        const Plane* planes, int numPlanes, const AABB3Array& aabbs, FrustumTestResult* results,
+        size_t begin, size_t end) {
+    size_t i = begin;
+#ifdef SGL_FRUSTUM_CULLING_USE_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= end; i += 4) {
+        __m128 minX = _mm_loadu_ps(aabbs.minX.data() + i);
+        __m128 minY = _mm_loadu_ps(aabbs.minY.data() + i);
+        __m128 minZ = _mm_loadu_ps(aabbs.minZ.data() + i);
+        __m128 maxX = _mm_loadu_ps(aabbs.maxX.data() + i);
+        __m128 maxY = _mm_loadu_ps(aabbs.maxY.data() + i);
+        __m128 maxZ = _mm_loadu_ps(aabbs.maxZ.data() + i);
+        __m128 outsideMask = _mm_setzero_ps();
+        __m128 intersectingMask = _mm_setzero_ps();
+        for (int planeIdx = 0; planeIdx < numPlanes; planeIdx++) {
+            const Plane& plane = planes[planeIdx];
+            __m128 a = _mm_set1_ps(plane.a), b = _mm_set1_ps(plane.b), c = _mm_set1_ps(plane.c);
+            __m128 d = _mm_set1_ps(plane.d);
+            __m128 pDist = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(a, plane.a >= 0.0f ? maxX : minX),
+                    _mm_mul_ps(b, plane.b >= 0.0f ? maxY : minY)), _mm_add_ps(
+                    _mm_mul_ps(c, plane.c >= 0.0f ? maxZ : minZ), d));
+            __m128 nDist = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(a, plane.a >= 0.0f ? minX : maxX),
+                    _mm_mul_ps(b, plane.b >= 0.0f ? minY : maxY)), _mm_add_ps(
+                    _mm_mul_ps(c, plane.c >= 0.0f ? minZ : maxZ), d));
+            outsideMask = _mm_or_ps(outsideMask, _mm_cmplt_ps(pDist, zero));
+            intersectingMask = _mm_or_ps(intersectingMask, _mm_cmplt_ps(nDist, zero));
+        }
+        int outsideBits = _mm_movemask_ps(outsideMask);
+        int intersectingBits = _mm_movemask_ps(intersectingMask);
+        for (int j = 0; j < 4; j++) {
+            results[i + j] =
+                    (outsideBits >> j) & 1 ? FrustumTestResult::OUTSIDE
+                    : ((intersectingBits >> j) & 1 ? FrustumTestResult::INTERSECTING : FrustumTestResult::INSIDE);
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        FrustumTestResult result = FrustumTestResult::INSIDE;
+        for (int planeIdx = 0; planeIdx < numPlanes; planeIdx++) {
+            const Plane& plane = planes[planeIdx];
+            float pDist =
+                    plane.a * (plane.a >= 0.0f ? aabbs.maxX[i] : aabbs.minX[i])
+                    + plane.b * (plane.b >= 0.0f ? aabbs.maxY[i] : aabbs.minY[i])
+                    + plane.c * (plane.c >= 0.0f ? aabbs.maxZ[i] : aabbs.minZ[i]) + plane.d;
+            if (pDist < 0.0f) {
+                result = FrustumTestResult::OUTSIDE;
+                break;
+            }
+            float nDist =
+                    plane.a * (plane.a >= 0.0f ? aabbs.minX[i] : aabbs.maxX[i])
+                    + plane.b * (plane.b >= 0.0f ? aabbs.minY[i] : aabbs.maxY[i])
+                    + plane.c * (plane.c >= 0.0f ? aabbs.minZ[i] : aabbs.maxZ[i]) + plane.d;
+            if (nDist < 0.0f) {
+                result = FrustumTestResult::INTERSECTING;
+            }
+        }
+        results[i] = result;
+    }
+}
+
+static void classifySpheresRange(
+        const Plane* planes, int numPlanes, const SphereArray& spheres, FrustumTestResult* results,
+        size_t begin, size_t end) {
+    size_t i = begin;
+#ifdef SGL_FRUSTUM_CULLING_USE_SSE2
+    for (; i + 4 <= end; i += 4) {
+        __m128 centerX = _mm_loadu_ps(spheres.centerX.data() + i);
+        __m128 centerY = _mm_loadu_ps(spheres.centerY.data() + i);
+        __m128 centerZ = _mm_loadu_ps(spheres.centerZ.data() + i);
+        __m128 radius = _mm_loadu_ps(spheres.radius.data() + i);
+        __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+        __m128 outsideMask = _mm_setzero_ps();
+        __m128 intersectingMask = _mm_setzero_ps();
+        for (int planeIdx = 0; planeIdx < numPlanes; planeIdx++) {
+            const Plane& plane = planes[planeIdx];
+            __m128 dist = _mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(_mm_set1_ps(plane.a), centerX),
+                    _mm_mul_ps(_mm_set1_ps(plane.b), centerY)), _mm_add_ps(
+                    _mm_mul_ps(_mm_set1_ps(plane.c), centerZ), _mm_set1_ps(plane.d)));
+            outsideMask = _mm_or_ps(outsideMask, _mm_cmplt_ps(dist, negRadius));
+            intersectingMask = _mm_or_ps(intersectingMask, _mm_cmplt_ps(dist, radius));
+        }
+        int outsideBits = _mm_movemask_ps(outsideMask);
+        int intersectingBits = _mm_movemask_ps(intersectingMask);
+        for (int j = 0; j < 4; j++) {
+            results[i + j] =
+                    (outsideBits >> j) & 1 ? FrustumTestResult::OUTSIDE
+                    : ((intersectingBits >> j) & 1 ? FrustumTestResult::INTERSECTING : FrustumTestResult::INSIDE);
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        FrustumTestResult result = FrustumTestResult::INSIDE;
+        for (int planeIdx = 0; planeIdx < numPlanes; planeIdx++) {
+            const Plane& plane = planes[planeIdx];
+            float dist =
+                    plane.a * spheres.centerX[i] + plane.b * spheres.centerY[i] + plane.c * spheres.centerZ[i]
+                    + plane.d;
+            if (dist < -spheres.radius[i]) {
+                result = FrustumTestResult::OUTSIDE;
+                break;
+            }
+            if (dist < spheres.radius[i]) {
+                result = FrustumTestResult::INTERSECTING;
+            }
+        }
+        results[i] = result;
+    }
+}
+
+template<class F>
+static void forEachCullingChunk(size_t numBounds, F&& processRange) {
+    const size_t numChunks = (numBounds + CULLING_CHUNK_SIZE - 1) / CULLING_CHUNK_SIZE;
+    if (numChunks == 0) {
+        return;
+    }
+    if (numChunks == 1) {
+        processRange(size_t(0), numBounds);
+        return;
+    }
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](auto const& r) {
+        for (auto chunkIdx = r.begin(); chunkIdx != r.end(); chunkIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numChunks, numBounds, processRange) default(none)
+#endif
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+#endif
+        size_t begin = chunkIdx * CULLING_CHUNK_SIZE;
+        processRange(begin, std::min(begin + CULLING_CHUNK_SIZE, numBounds));
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+void classifyFrustumVisibility(
+        const Plane* planes, int numPlanes, const AABB3Array& aabbs, std::vector<FrustumTestResult>& results) {
+    results.resize(aabbs.size());
+    FrustumTestResult* resultsPtr = results.data();
+    forEachCullingChunk(aabbs.size(), [&](size_t begin, size_t end) {
+        classifyAabbsRange(planes, numPlanes, aabbs, resultsPtr, begin, end);
+    });
+}
+
+void classifyFrustumVisibility(
+        const Plane* planes, int numPlanes, const SphereArray& spheres, std::vector<FrustumTestResult>& results) {
+    results.resize(spheres.size());
+    FrustumTestResult* resultsPtr = results.data();
+    forEachCullingChunk(spheres.size(), [&](size_t begin, size_t end) {
+        classifySpheresRange(planes, numPlanes, spheres, resultsPtr, begin, end);
+    });
+}
+
+void compactVisibleIndices(const std::vector<FrustumTestResult>& results, std::vector<uint32_t>& visibleIndices) {
+    const size_t numResults = results.size();
+    if (numResults == 0) {
+        visibleIndices.clear();
+        return;
+    }
+    const size_t numChunks = (numResults + CULLING_CHUNK_SIZE - 1) / CULLING_CHUNK_SIZE;
+
+    // Count the visible bounds per chunk, compute the output offsets and then write the indices in parallel.
+    std::vector<size_t> chunkOffsets(numChunks + 1, 0);
+    forEachCullingChunk(numResults, [&](size_t begin, size_t end) {
+        size_t numVisible = 0;
+        for (size_t i = begin; i < end; i++) {
+            numVisible += results[i] != FrustumTestResult::OUTSIDE ? 1 : 0;
+        }
+        chunkOffsets[begin / CULLING_CHUNK_SIZE + 1] = numVisible;
+    });
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+        chunkOffsets[chunkIdx + 1] += chunkOffsets[chunkIdx];
+    }
+    visibleIndices.resize(chunkOffsets.back());
+    forEachCullingChunk(numResults, [&](size_t begin, size_t end) {
+        uint32_t* dst = visibleIndices.data() + chunkOffsets[begin / CULLING_CHUNK_SIZE];
+        for (size_t i = begin; i < end; i++) {
+            if (results[i] != FrustumTestResult::OUTSIDE) {
+                *dst++ = uint32_t(i);
+            }
+        }
+    });
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_FRUSTUMCULLING_HPP
+#define SGL_FRUSTUMCULLING_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include "AABB3.hpp"
+#include "Sphere.hpp"
+#include "Plane.hpp"
+
+namespace sgl {
+
+enum class FrustumTestResult : uint8_t {
+    OUTSIDE = 0, INTERSECTING = 1, INSIDE = 2
+};
+
+/// Axis-aligned bounding boxes stored as structure of arrays for batched culling.
+struct DLL_OBJECT AABB3Array {
+    std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+
+    [[nodiscard]] inline size_t size() const { return minX.size(); }
+    void clear();
+    void resize(size_t size);
+    void reserve(size_t size);
+    void set(size_t idx, const AABB3& aabb);
+    void push_back(const AABB3& aabb);
+};
+
+/// Bounding spheres stored as structure of arrays for batched culling.
+struct DLL_OBJECT SphereArray {
+    std::vector<float> centerX, centerY, centerZ, radius;
+
+    [[nodiscard]] inline size_t size() const { return centerX.size(); }
+    void clear();
+    void resize(size_t size);
+    void reserve(size_t size);
+    void set(size_t idx, const Sphere& sphere);
+    void push_back(const Sphere& sphere);
+};
+
+/**
+ * Classifies all bounds w.r.t. the volume enclosed by the passed planes (with normals pointing inwards). Four bounds
+ * are tested at once with SSE2 if available, and large inputs are processed in parallel.
+ * The test is conservative, i.e., bounds outside of the frustum near its edges may be classified as intersecting.
+ */
+DLL_OBJECT void classifyFrustumVisibility(
+        const Plane* planes, int numPlanes, const AABB3Array& aabbs, std::vector<FrustumTestResult>& results);
+DLL_OBJECT void classifyFrustumVisibility(
+        const Plane* planes, int numPlanes, const SphereArray& spheres, std::vector<FrustumTestResult>& results);
+
+/// Writes the indices of all results not equal to FrustumTestResult::OUTSIDE in ascending order.
+DLL_OBJECT void compactVisibleIndices(
+        const std::vector<FrustumTestResult>& results, std::vector<uint32_t>& visibleIndices);
+
+}
+
+#endif //SGL_FRUSTUMCULLING_HPP
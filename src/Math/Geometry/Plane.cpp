@@ -44,7 +44,7 @@ bool Plane::isOutside(const glm::vec3 &pt) const {
 bool Plane::isOutside(const AABB3 &aabb) const {
     glm::vec3 extent = aabb.getExtent();
     float centerDist = getDistance(aabb.getCenter());
-    float maxAbsDist = std::abs(a*extent.x + b*extent.y + c*extent.z);
+    float maxAbsDist = std::abs(a)*extent.x + std::abs(b)*extent.y + std::abs(c)*extent.z;
     return -centerDist > maxAbsDist;
 }
 
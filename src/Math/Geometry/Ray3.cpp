@@ -27,7 +27,10 @@
  */
 
 #include <cmath>
+#include <limits>
+#include <utility>
 
+#include "AABB3.hpp"
 #include "Plane.hpp"
 #include "Ray3.hpp"
 
@@ -47,4 +50,22 @@ RaycastResult Ray3::intersects(const Plane &plane) const {
     }
 }
 
+RaycastResult Ray3::intersects(const AABB3 &aabb) const {
+    float tNear = std::numeric_limits<float>::lowest();
+    float tFar = std::numeric_limits<float>::max();
+    for (int i = 0; i < 3; i++) {
+        float invDir = 1.0f / this->direction[i];
+        float t0 = (aabb.min[i] - this->origin[i]) * invDir;
+        float t1 = (aabb.max[i] - this->origin[i]) * invDir;
+        if (invDir < 0.0f) {
+            std::swap(t0, t1);
+        }
+        // NaN (origin on a slab plane parallel to the ray) leaves the interval unchanged.
+        tNear = t0 > tNear ? t0 : tNear;
+        tFar = t1 < tFar ? t1 : tFar;
+    }
+    bool hit = tNear <= tFar && tFar >= 0.0f;
+    return RaycastResult(hit, tNear);
+}
+
 }
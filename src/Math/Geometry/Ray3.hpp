@@ -53,6 +53,10 @@ public:
     Ray3(const glm::vec3 &origin, const glm::vec3 &direction) : origin(origin), direction(direction) {}
 
     [[nodiscard]] RaycastResult intersects(const Plane &plane) const;
+    /// Slab test. If the origin lies within the AABB, 'hit' is true and 't' is the (negative) entry distance.
+    [[nodiscard]] RaycastResult intersects(const AABB3 &aabb) const;
+    [[nodiscard]] inline const glm::vec3& getOrigin() const { return origin; }
+    [[nodiscard]] inline const glm::vec3& getDirection() const { return direction; }
     [[nodiscard]] inline glm::vec3 getPoint(float t) const { return origin + direction * t; }
     [[nodiscard]] inline glm::vec2 getPoint2D(float t) const { glm::vec3 pt3d = getPoint(t); return glm::vec2(pt3d.x, pt3d.y); }
 
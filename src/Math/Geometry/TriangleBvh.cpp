@@ -0,0 +1,515 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <Utils/File/Logfile.hpp>
+#include "TriangleBvh.hpp"
+
+namespace sgl {
+
+static const int NUM_SAH_BINS = 16;
+static const uint32_t STACK_BUFFER_SIZE = 64;
+
+static inline float getSurfaceArea(const AABB3& aabb) {
+    glm::vec3 dim = aabb.max - aabb.min;
+    if (dim.x < 0.0f || dim.y < 0.0f || dim.z < 0.0f) {
+        return 0.0f;
+    }
+    return 2.0f * (dim.x * dim.y + dim.y * dim.z + dim.z * dim.x);
+}
+
+static inline bool intersectRayAabb(
+        const AABB3& aabb, const glm::vec3& origin, const glm::vec3& invDir, float tMin, float tMax, float& tEntry) {
+    float tNear = tMin, tFar = tMax;
+    for (int i = 0; i < 3; i++) {
+        float t0 = (aabb.min[i] - origin[i]) * invDir[i];
+        float t1 = (aabb.max[i] - origin[i]) * invDir[i];
+        if (invDir[i] < 0.0f) {
+            std::swap(t0, t1);
+        }
+        tNear = t0 > tNear ? t0 : tNear;
+        tFar = t1 < tFar ? t1 : tFar;
+    }
+    tEntry = tNear;
+    return tNear <= tFar;
+}
+
+// Möller-Trumbore ray-triangle intersection test.
+static inline bool intersectRayTriangle(
+        const glm::vec3& origin, const glm::vec3& direction,
+        const glm::vec3& v0, const glm::vec3& e1, const glm::vec3& e2, float& t, float& u, float& v) {
+    glm::vec3 pvec = glm::cross(direction, e2);
+    float det = glm::dot(e1, pvec);
+    if (det == 0.0f) {
+        return false;
+    }
+    float invDet = 1.0f / det;
+    glm::vec3 tvec = origin - v0;
+    u = glm::dot(tvec, pvec) * invDet;
+    if (u < 0.0f || u > 1.0f) {
+        return false;
+    }
+    glm::vec3 qvec = glm::cross(tvec, e1);
+    v = glm::dot(direction, qvec) * invDet;
+    if (v < 0.0f || u + v > 1.0f) {
+        return false;
+    }
+    t = glm::dot(e2, qvec) * invDet;
+    return true;
+}
+
+void TriangleBvh::build(const std::vector<uint32_t>& triangleIndices, const std::vector<glm::vec3>& vertexPositions) {
+    build(
+            triangleIndices.data(), triangleIndices.size(),
+            reinterpret_cast<const float*>(vertexPositions.data()), vertexPositions.size(), sizeof(glm::vec3));
+}
+
+void TriangleBvh::build(
+        const uint32_t* triangleIndices, size_t numIndices,
+        const float* vertexPositions, size_t numVertices, size_t vertexStride) {
+    nodes.clear();
+    triangleData.clear();
+    triangleIds.clear();
+    maxDepth = 0;
+    if (vertexStride == 0) {
+        vertexStride = 3 * sizeof(float);
+    }
+    if (numIndices % 3 != 0) {
+        Logfile::get()->writeError("Error in TriangleBvh::build: The number of indices is not a multiple of three.");
+        return;
+    }
+    for (size_t i = 0; i < numIndices; i++) {
+        if (triangleIndices[i] >= numVertices) {
+            Logfile::get()->writeError("Error in TriangleBvh::build: Invalid vertex index.");
+            return;
+        }
+    }
+    const auto numTriangles = uint32_t(numIndices / 3);
+    if (numTriangles == 0) {
+        return;
+    }
+    auto getVertex = [&](uint32_t vertexIdx) {
+        const auto* position = reinterpret_cast<const float*>(
+                reinterpret_cast<const uint8_t*>(vertexPositions) + vertexIdx * vertexStride);
+        return glm::vec3(position[0], position[1], position[2]);
+    };
+
+    std::vector<AABB3> triangleAabbs(numTriangles);
+    std::vector<glm::vec3> centroids(numTriangles);
+    triangleIds.resize(numTriangles);
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numTriangles), [&](auto const& r) {
+        for (auto triangleIdx = r.begin(); triangleIdx != r.end(); triangleIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numTriangles, triangleIndices, triangleAabbs, centroids, getVertex) default(none)
+#endif
+    for (uint32_t triangleIdx = 0; triangleIdx < numTriangles; triangleIdx++) {
+#endif
+        AABB3 aabb;
+        for (int i = 0; i < 3; i++) {
+            aabb.combine(getVertex(triangleIndices[triangleIdx * 3 + i]));
+        }
+        triangleAabbs[triangleIdx] = aabb;
+        centroids[triangleIdx] = aabb.getCenter();
+        triangleIds[triangleIdx] = triangleIdx;
+    }
+#ifdef USE_TBB
+    });
+#endif
+
+    // The tree is built level by level, as all nodes of one level can be split independently in parallel.
+    nodes.reserve(2 * size_t(numTriangles));
+    nodes.emplace_back();
+    for (const AABB3& aabb : triangleAabbs) {
+        nodes.front().aabb.combine(aabb);
+    }
+    std::vector<BuildTask> levelTasks = { BuildTask{ 0, 0, numTriangles } };
+    std::vector<BuildTask> nextLevelTasks;
+    std::vector<uint32_t> splitIndices;
+    std::vector<AABB3> childAabbs;
+    while (!levelTasks.empty()) {
+        auto numTasks = uint32_t(levelTasks.size());
+        splitIndices.clear();
+        splitIndices.resize(numTasks);
+        childAabbs.clear();
+        childAabbs.resize(numTasks * 2);
+#ifdef USE_TBB
+        tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numTasks, 1), [&](auto const& r) {
+            for (auto taskIdx = r.begin(); taskIdx != r.end(); taskIdx++) {
+#else
+#if _OPENMP >= 201107
+        #pragma omp parallel for shared(numTasks, levelTasks, splitIndices, childAabbs, triangleAabbs, centroids) \
+                schedule(dynamic) default(none)
+#endif
+        for (uint32_t taskIdx = 0; taskIdx < numTasks; taskIdx++) {
+#endif
+            const BuildTask& task = levelTasks[taskIdx];
+            if (!splitNode(
+                    nodes[task.nodeIdx].aabb, task.begin, task.end, triangleAabbs, centroids,
+                    splitIndices[taskIdx], childAabbs[taskIdx * 2], childAabbs[taskIdx * 2 + 1])) {
+                splitIndices[taskIdx] = task.end;
+            }
+        }
+#ifdef USE_TBB
+        });
+#endif
+
+        nextLevelTasks.clear();
+        for (uint32_t taskIdx = 0; taskIdx < numTasks; taskIdx++) {
+            const BuildTask& task = levelTasks[taskIdx];
+            uint32_t mid = splitIndices[taskIdx];
+            if (mid == task.end) {
+                nodes[task.nodeIdx].firstIdx = task.begin;
+                nodes[task.nodeIdx].numTriangles = task.end - task.begin;
+                continue;
+            }
+            auto leftIdx = uint32_t(nodes.size());
+            nodes[task.nodeIdx].firstIdx = leftIdx;
+            nodes[task.nodeIdx].numTriangles = 0;
+            nodes.emplace_back();
+            nodes.back().aabb = childAabbs[taskIdx * 2];
+            nodes.emplace_back();
+            nodes.back().aabb = childAabbs[taskIdx * 2 + 1];
+            nextLevelTasks.push_back(BuildTask{ leftIdx, task.begin, mid });
+            nextLevelTasks.push_back(BuildTask{ leftIdx + 1, mid, task.end });
+        }
+        std::swap(levelTasks, nextLevelTasks);
+        maxDepth++;
+    }
+
+    // Store the triangles in BVH order for coherent memory accesses during traversal.
+    triangleData.resize(3 * size_t(numTriangles));
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<uint32_t>(0, numTriangles), [&](auto const& r) {
+        for (auto i = r.begin(); i != r.end(); i++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numTriangles, triangleIndices, getVertex) default(none)
+#endif
+    for (uint32_t i = 0; i < numTriangles; i++) {
+#endif
+        uint32_t triangleIdx = triangleIds[i];
+        glm::vec3 v0 = getVertex(triangleIndices[triangleIdx * 3]);
+        glm::vec3 v1 = getVertex(triangleIndices[triangleIdx * 3 + 1]);
+        glm::vec3 v2 = getVertex(triangleIndices[triangleIdx * 3 + 2]);
+        triangleData[i * 3] = v0;
+        triangleData[i * 3 + 1] = v1 - v0;
+        triangleData[i * 3 + 2] = v2 - v0;
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+bool TriangleBvh::splitNode(
+        const AABB3& nodeAabb, uint32_t begin, uint32_t end,
+        const std::vector<AABB3>& triangleAabbs, const std::vector<glm::vec3>& centroids,
+        uint32_t& mid, AABB3& leftAabb, AABB3& rightAabb) {
+    const uint32_t numTriangles = end - begin;
+    if (numTriangles <= 1) {
+        return false;
+    }
+
+    AABB3 centroidAabb;
+    for (uint32_t i = begin; i < end; i++) {
+        centroidAabb.combine(centroids[triangleIds[i]]);
+    }
+
+    // Evaluate the SAH cost of the split planes between the bins along all three axes.
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    AABB3 bestLeftAabb, bestRightAabb;
+    for (int axis = 0; axis < 3; axis++) {
+        float extent = centroidAabb.max[axis] - centroidAabb.min[axis];
+        if (extent <= 0.0f) {
+            continue;
+        }
+        float binScale = float(NUM_SAH_BINS) / extent;
+        AABB3 binAabbs[NUM_SAH_BINS];
+        uint32_t binCounts[NUM_SAH_BINS] = {};
+        for (uint32_t i = begin; i < end; i++) {
+            uint32_t triangleIdx = triangleIds[i];
+            int binIdx = std::min(
+                    int((centroids[triangleIdx][axis] - centroidAabb.min[axis]) * binScale), NUM_SAH_BINS - 1);
+            binCounts[binIdx]++;
+            binAabbs[binIdx].combine(triangleAabbs[triangleIdx]);
+        }
+
+        AABB3 rightAabbs[NUM_SAH_BINS];
+        uint32_t rightCounts[NUM_SAH_BINS];
+        AABB3 accumulatedAabb;
+        uint32_t accumulatedCount = 0;
+        for (int binIdx = NUM_SAH_BINS - 1; binIdx > 0; binIdx--) {
+            accumulatedAabb.combine(binAabbs[binIdx]);
+            accumulatedCount += binCounts[binIdx];
+            rightAabbs[binIdx] = accumulatedAabb;
+            rightCounts[binIdx] = accumulatedCount;
+        }
+        accumulatedAabb = AABB3();
+        accumulatedCount = 0;
+        for (int binIdx = 1; binIdx < NUM_SAH_BINS; binIdx++) {
+            accumulatedAabb.combine(binAabbs[binIdx - 1]);
+            accumulatedCount += binCounts[binIdx - 1];
+            if (accumulatedCount == 0 || rightCounts[binIdx] == 0) {
+                continue;
+            }
+            float cost =
+                    getSurfaceArea(accumulatedAabb) * float(accumulatedCount)
+                    + getSurfaceArea(rightAabbs[binIdx]) * float(rightCounts[binIdx]);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = binIdx;
+                bestLeftAabb = accumulatedAabb;
+                bestRightAabb = rightAabbs[binIdx];
+            }
+        }
+    }
+
+    auto* idsBegin = triangleIds.data() + begin;
+    auto* idsEnd = triangleIds.data() + end;
+    if (bestAxis >= 0) {
+        // Relative costs: Traversing a node costs as much as intersecting one triangle.
+        float nodeArea = getSurfaceArea(nodeAabb);
+        float splitCost = nodeArea + bestCost;
+        float leafCost = nodeArea * float(numTriangles);
+        if (numTriangles <= maxLeafSize && splitCost >= leafCost) {
+            return false;
+        }
+        float binScale = float(NUM_SAH_BINS) / (centroidAabb.max[bestAxis] - centroidAabb.min[bestAxis]);
+        float axisMin = centroidAabb.min[bestAxis];
+        auto* idsMid = std::partition(idsBegin, idsEnd, [&](uint32_t triangleIdx) {
+            int binIdx = std::min(int((centroids[triangleIdx][bestAxis] - axisMin) * binScale), NUM_SAH_BINS - 1);
+            return binIdx < bestSplit;
+        });
+        mid = begin + uint32_t(idsMid - idsBegin);
+        leftAabb = bestLeftAabb;
+        rightAabb = bestRightAabb;
+        return true;
+    }
+
+    // All centroids coincide, so no spatial split is possible.
+    if (numTriangles <= maxLeafSize) {
+        return false;
+    }
+    mid = begin + numTriangles / 2;
+    leftAabb = AABB3();
+    rightAabb = AABB3();
+    for (uint32_t i = begin; i < mid; i++) {
+        leftAabb.combine(triangleAabbs[triangleIds[i]]);
+    }
+    for (uint32_t i = mid; i < end; i++) {
+        rightAabb.combine(triangleAabbs[triangleIds[i]]);
+    }
+    return true;
+}
+
+bool TriangleBvh::intersectClosest(const Ray3& ray, TriangleRayHit& hit, float tMin, float tMax) const {
+    hit = TriangleRayHit();
+    if (nodes.empty()) {
+        return false;
+    }
+    const glm::vec3& origin = ray.getOrigin();
+    const glm::vec3& direction = ray.getDirection();
+    const glm::vec3 invDir = 1.0f / direction;
+
+    uint32_t stackBuffer[STACK_BUFFER_SIZE];
+    std::vector<uint32_t> stackVector;
+    uint32_t* stack = stackBuffer;
+    if (maxDepth + 1 >= STACK_BUFFER_SIZE) {
+        stackVector.resize(maxDepth + 2);
+        stack = stackVector.data();
+    }
+    uint32_t stackSize = 0;
+    float tEntry;
+    if (!intersectRayAabb(nodes.front().aabb, origin, invDir, tMin, tMax, tEntry)) {
+        return false;
+    }
+    stack[stackSize++] = 0;
+
+    float tClosest = tMax;
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        if (node.numTriangles > 0) {
+            for (uint32_t i = node.firstIdx; i < node.firstIdx + node.numTriangles; i++) {
+                float t, u, v;
+                if (intersectRayTriangle(
+                        origin, direction, triangleData[i * 3], triangleData[i * 3 + 1], triangleData[i * 3 + 2],
+                        t, u, v) && t >= tMin && t <= tClosest) {
+                    tClosest = t;
+                    hit.t = t;
+                    hit.u = u;
+                    hit.v = v;
+                    hit.triangleIdx = triangleIds[i];
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first, so that more nodes can be culled by the closest hit distance.
+        float tEntryLeft, tEntryRight;
+        bool hitLeft = intersectRayAabb(nodes[node.firstIdx].aabb, origin, invDir, tMin, tClosest, tEntryLeft);
+        bool hitRight = intersectRayAabb(nodes[node.firstIdx + 1].aabb, origin, invDir, tMin, tClosest, tEntryRight);
+        if (hitLeft && hitRight) {
+            if (tEntryLeft <= tEntryRight) {
+                stack[stackSize++] = node.firstIdx + 1;
+                stack[stackSize++] = node.firstIdx;
+            } else {
+                stack[stackSize++] = node.firstIdx;
+                stack[stackSize++] = node.firstIdx + 1;
+            }
+        } else if (hitLeft) {
+            stack[stackSize++] = node.firstIdx;
+        } else if (hitRight) {
+            stack[stackSize++] = node.firstIdx + 1;
+        }
+    }
+    return hit.getHasHit();
+}
+
+bool TriangleBvh::intersectAny(const Ray3& ray, float tMin, float tMax) const {
+    if (nodes.empty()) {
+        return false;
+    }
+    const glm::vec3& origin = ray.getOrigin();
+    const glm::vec3& direction = ray.getDirection();
+    const glm::vec3 invDir = 1.0f / direction;
+
+    uint32_t stackBuffer[STACK_BUFFER_SIZE];
+    std::vector<uint32_t> stackVector;
+    uint32_t* stack = stackBuffer;
+    if (maxDepth + 1 >= STACK_BUFFER_SIZE) {
+        stackVector.resize(maxDepth + 2);
+        stack = stackVector.data();
+    }
+    uint32_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        float tEntry;
+        if (!intersectRayAabb(node.aabb, origin, invDir, tMin, tMax, tEntry)) {
+            continue;
+        }
+        if (node.numTriangles > 0) {
+            for (uint32_t i = node.firstIdx; i < node.firstIdx + node.numTriangles; i++) {
+                float t, u, v;
+                if (intersectRayTriangle(
+                        origin, direction, triangleData[i * 3], triangleData[i * 3 + 1], triangleData[i * 3 + 2],
+                        t, u, v) && t >= tMin && t <= tMax) {
+                    return true;
+                }
+            }
+        } else {
+            stack[stackSize++] = node.firstIdx + 1;
+            stack[stackSize++] = node.firstIdx;
+        }
+    }
+    return false;
+}
+
+void TriangleBvh::intersectClosest(
+        const std::vector<Ray3>& rays, std::vector<TriangleRayHit>& hits, float tMin, float tMax) const {
+    const size_t numRays = rays.size();
+    hits.resize(numRays);
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numRays), [&](auto const& r) {
+        for (auto rayIdx = r.begin(); rayIdx != r.end(); rayIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numRays, rays, hits, tMin, tMax) schedule(dynamic, 256) default(none)
+#endif
+    for (size_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+#endif
+        intersectClosest(rays[rayIdx], hits[rayIdx], tMin, tMax);
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+void TriangleBvh::intersectAny(
+        const std::vector<Ray3>& rays, std::vector<uint8_t>& occluded, float tMin, float tMax) const {
+    const size_t numRays = rays.size();
+    occluded.resize(numRays);
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numRays), [&](auto const& r) {
+        for (auto rayIdx = r.begin(); rayIdx != r.end(); rayIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(numRays, rays, occluded, tMin, tMax) schedule(dynamic, 256) default(none)
+#endif
+    for (size_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+#endif
+        occluded[rayIdx] = intersectAny(rays[rayIdx], tMin, tMax) ? 1 : 0;
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+void TriangleBvh::queryOverlap(const AABB3& aabb, std::vector<uint32_t>& triangleIndicesOut) const {
+    if (nodes.empty()) {
+        return;
+    }
+    std::vector<uint32_t> stack;
+    stack.reserve(maxDepth + 2);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = nodes[stack.back()];
+        stack.pop_back();
+        if (!node.aabb.intersects(aabb)) {
+            continue;
+        }
+        if (node.numTriangles > 0) {
+            for (uint32_t i = node.firstIdx; i < node.firstIdx + node.numTriangles; i++) {
+                AABB3 triangleAabb;
+                triangleAabb.combine(triangleData[i * 3]);
+                triangleAabb.combine(triangleData[i * 3] + triangleData[i * 3 + 1]);
+                triangleAabb.combine(triangleData[i * 3] + triangleData[i * 3 + 2]);
+                if (triangleAabb.intersects(aabb)) {
+                    triangleIndicesOut.push_back(triangleIds[i]);
+                }
+            }
+        } else {
+            stack.push_back(node.firstIdx + 1);
+            stack.push_back(node.firstIdx);
+        }
+    }
+}
+
+}
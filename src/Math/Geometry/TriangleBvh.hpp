@@ -0,0 +1,134 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_TRIANGLEBVH_HPP
+#define SGL_TRIANGLEBVH_HPP
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+#ifdef USE_GLM
+#include <glm/glm.hpp>
+#else
+#include <Math/Geometry/fallback/vec3.hpp>
+#endif
+
+#include "AABB3.hpp"
+#include "Ray3.hpp"
+
+namespace sgl {
+
+struct DLL_OBJECT TriangleRayHit {
+    static constexpr uint32_t INVALID_TRIANGLE = std::numeric_limits<uint32_t>::max();
+    float t = std::numeric_limits<float>::max();
+    uint32_t triangleIdx = INVALID_TRIANGLE; ///< Index of the triangle in the index buffer passed to the build function.
+    float u = 0.0f, v = 0.0f; ///< Barycentric coordinates of the hit point w.r.t. the second and third vertex.
+    [[nodiscard]] inline bool getHasHit() const { return triangleIdx != INVALID_TRIANGLE; }
+};
+
+/**
+ * CPU bounding volume hierarchy over a triangle soup for ray casting without a GPU (e.g., for picking, baking ambient
+ * occlusion or headless tests). The input is the same as for the triangle input of the Vulkan ray tracing acceleration
+ * structures, i.e., a 32-bit index buffer and a vertex position buffer with an arbitrary stride.
+ *
+ * The hierarchy is built top-down using the surface area heuristic (SAH) with binned split candidates. All nodes of a
+ * tree level are split in parallel. The batched query functions process the rays in parallel.
+ */
+class DLL_OBJECT TriangleBvh {
+public:
+    /**
+     * Builds the BVH. Any previously built data is discarded.
+     * @param triangleIndices The index buffer (three indices per triangle).
+     * @param numIndices The number of indices (i.e., three times the number of triangles).
+     * @param vertexPositions Pointer to the position (three floats) of the first vertex.
+     * @param numVertices The number of vertices.
+     * @param vertexStride The distance between two vertex positions in bytes (0 means tightly packed).
+     */
+    void build(
+            const uint32_t* triangleIndices, size_t numIndices,
+            const float* vertexPositions, size_t numVertices, size_t vertexStride = 0);
+    void build(const std::vector<uint32_t>& triangleIndices, const std::vector<glm::vec3>& vertexPositions);
+
+    /// Sets the maximum number of triangles stored in a leaf (default: 8).
+    inline void setMaxLeafSize(uint32_t size) { maxLeafSize = size; }
+
+    /**
+     * Finds the closest intersection with t in [tMin, tMax].
+     * @return Whether a triangle was hit.
+     */
+    bool intersectClosest(
+            const Ray3& ray, TriangleRayHit& hit,
+            float tMin = 0.0f, float tMax = std::numeric_limits<float>::max()) const;
+    /// Returns whether any triangle is hit with t in [tMin, tMax] (e.g., for shadow or occlusion rays).
+    [[nodiscard]] bool intersectAny(
+            const Ray3& ray, float tMin = 0.0f, float tMax = std::numeric_limits<float>::max()) const;
+
+    // Batched queries. The rays are processed in parallel.
+    void intersectClosest(
+            const std::vector<Ray3>& rays, std::vector<TriangleRayHit>& hits,
+            float tMin = 0.0f, float tMax = std::numeric_limits<float>::max()) const;
+    void intersectAny(
+            const std::vector<Ray3>& rays, std::vector<uint8_t>& occluded,
+            float tMin = 0.0f, float tMax = std::numeric_limits<float>::max()) const;
+
+    /// Appends the indices of all triangles whose bounding box overlaps the passed AABB.
+    void queryOverlap(const AABB3& aabb, std::vector<uint32_t>& triangleIndicesOut) const;
+
+    [[nodiscard]] inline bool getIsEmpty() const { return nodes.empty(); }
+    [[nodiscard]] inline size_t getNumTriangles() const { return triangleIds.size(); }
+    [[nodiscard]] inline size_t getNumNodes() const { return nodes.size(); }
+    [[nodiscard]] inline const AABB3& getAabb() const { return nodes.front().aabb; }
+
+private:
+    struct Node {
+        AABB3 aabb;
+        uint32_t firstIdx = 0; ///< Left child index for inner nodes (the right child follows), else first triangle.
+        uint32_t numTriangles = 0; ///< 0 for inner nodes.
+    };
+    struct BuildTask {
+        uint32_t nodeIdx;
+        uint32_t begin, end;
+    };
+    /// Partitions the triangles of a node at the split with the lowest SAH cost. Returns false for leaf nodes.
+    bool splitNode(
+            const AABB3& nodeAabb, uint32_t begin, uint32_t end,
+            const std::vector<AABB3>& triangleAabbs, const std::vector<glm::vec3>& centroids,
+            uint32_t& mid, AABB3& leftAabb, AABB3& rightAabb);
+
+    uint32_t maxLeafSize = 8;
+    uint32_t maxDepth = 0;
+    std::vector<Node> nodes;
+    /// The triangles in BVH order; for triangle i, v0 is stored at 3*i, followed by the edges v1-v0 and v2-v0.
+    std::vector<glm::vec3> triangleData;
+    std::vector<uint32_t> triangleIds; ///< Maps BVH order to the triangle index of the input.
+};
+
+}
+
+#endif //SGL_TRIANGLEBVH_HPP
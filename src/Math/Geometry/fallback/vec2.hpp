@@ -179,10 +179,10 @@ template<class T> tvec2<bool> lessThanEqual(tvec2<T> const& v0, tvec2<T> const&
     return tvec2<bool>(v0.x <= v1.x, v0.y <= v1.y);
 }
 template<class T> tvec2<bool> greaterThan(tvec2<T> const& v0, tvec2<T> const& v1) {
-    return tvec2<bool>(v0.x < v1.x, v0.y < v1.y);
+    return tvec2<bool>(v0.x > v1.x, v0.y > v1.y);
 }
 template<class T> tvec2<bool> greaterThanEqual(tvec2<T> const& v0, tvec2<T> const& v1) {
-    return tvec2<bool>(v0.x <= v1.x, v0.y <= v1.y);
+    return tvec2<bool>(v0.x >= v1.x, v0.y >= v1.y);
 }
 typedef tvec2<float> vec2;
 typedef tvec2<double> dvec2;
@@ -116,7 +116,7 @@ template<class T> tvec3<T> operator-(tvec3<T> const& lhs, T scalar) {
     return tvec3<T>(lhs.x - scalar, lhs.y - scalar, lhs.z - scalar);
 }
 template<class T> tvec3<T> operator+(tvec3<T> const& lhs, tvec3<T> const& rhs) {
-    return tvec3<T>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z + rhs.z);
+    return tvec3<T>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z);
 }
 template<class T> tvec3<T> operator-(tvec3<T> const& lhs, tvec3<T> const& rhs) {
     return tvec3<T>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
@@ -197,10 +197,10 @@ template<class T> tvec3<bool> lessThanEqual(tvec3<T> const& v0, tvec3<T> const&
     return tvec3<bool>(v0.x <= v1.x, v0.y <= v1.y, v0.z <= v1.z);
 }
 template<class T> tvec3<bool> greaterThan(tvec3<T> const& v0, tvec3<T> const& v1) {
-    return tvec3<bool>(v0.x < v1.x, v0.y < v1.y, v0.z < v1.z);
+    return tvec3<bool>(v0.x > v1.x, v0.y > v1.y, v0.z > v1.z);
 }
 template<class T> tvec3<bool> greaterThanEqual(tvec3<T> const& v0, tvec3<T> const& v1) {
-    return tvec3<bool>(v0.x <= v1.x, v0.y <= v1.y, v0.z <= v1.z);
+    return tvec3<bool>(v0.x >= v1.x, v0.y >= v1.y, v0.z >= v1.z);
 }
 typedef tvec3<float> vec3;
 typedef tvec3<double> dvec3;
@@ -127,7 +127,7 @@ template<class T> tvec4<T> operator-(tvec4<T> const& lhs, T scalar) {
     return tvec4<T>(lhs.x - scalar, lhs.y - scalar, lhs.z - scalar, lhs.w - scalar);
 }
 template<class T> tvec4<T> operator+(tvec4<T> const& lhs, tvec4<T> const& rhs) {
-    return tvec4<T>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
+    return tvec4<T>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
 }
 template<class T> tvec4<T> operator-(tvec4<T> const& lhs, tvec4<T> const& rhs) {
     return tvec4<T>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
@@ -193,10 +193,10 @@ template<class T> tvec4<bool> lessThanEqual(tvec4<T> const& v0, tvec4<T> const&
     return tvec4<bool>(v0.x <= v1.x, v0.y <= v1.y, v0.z <= v1.z, v0.w <= v1.w);
 }
 template<class T> tvec4<bool> greaterThan(tvec4<T> const& v0, tvec4<T> const& v1) {
-    return tvec4<bool>(v0.x < v1.x, v0.y < v1.y, v0.z < v1.z, v0.w < v1.w);
+    return tvec4<bool>(v0.x > v1.x, v0.y > v1.y, v0.z > v1.z, v0.w > v1.w);
 }
 template<class T> tvec4<bool> greaterThanEqual(tvec4<T> const& v0, tvec4<T> const& v1) {
-    return tvec4<bool>(v0.x <= v1.x, v0.y <= v1.y, v0.z <= v1.z, v0.w <= v1.w);
+    return tvec4<bool>(v0.x >= v1.x, v0.y >= v1.y, v0.z >= v1.z, v0.w >= v1.w);
 }
 typedef tvec4<float> vec4;
 typedef tvec4<double> dvec4;
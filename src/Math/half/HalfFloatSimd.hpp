@@ -0,0 +1,72 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_HALFFLOATSIMD_HPP
+#define SGL_HALFFLOATSIMD_HPP
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_HALF_FLOAT_USE_SSE2
+#endif
+
+namespace sgl {
+
+#ifdef SGL_HALF_FLOAT_USE_SSE2
+/**
+ * Converts four half floats stored in the lower 16 bits of the 32-bit lanes of 'halfBits' to float. The results are
+ * the same as the ones of HalfFloat::operator float (except for the payload of NaNs), as long as denormal floats are
+ * not flushed to zero (FTZ/DAZ), as denormal halves are converted by scaling with 2^112.
+ * Based on "half_to_float_fast5" by Fabian Giesen: https://gist.github.com/rygorous/2144712
+ */
+inline __m128 convertHalfBitsToFloatSse2(__m128i halfBits) {
+    const __m128i maskNoSign = _mm_set1_epi32(0x7FFF);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i wasInfNan = _mm_set1_epi32(0x7BFF);
+    const __m128 expInfNan = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+    __m128i expMant = _mm_and_si128(maskNoSign, halfBits);
+    __m128i justSign = _mm_xor_si128(halfBits, expMant);
+    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), magic);
+    __m128 infNanExp = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(expMant, wasInfNan)), expInfNan);
+    __m128 signInfNan = _mm_or_ps(_mm_castsi128_ps(_mm_slli_epi32(justSign, 16)), infNanExp);
+    return _mm_or_ps(scaled, signInfNan);
+}
+
+/// Loads eight half floats from unaligned memory and converts them to two vectors of four floats.
+inline void loadHalfFloat8Sse2(const void* ptr, __m128& valuesLo, __m128& valuesHi) {
+    __m128i halfBits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    __m128i zero = _mm_setzero_si128();
+    valuesLo = convertHalfBitsToFloatSse2(_mm_unpacklo_epi16(halfBits, zero));
+    valuesHi = convertHalfBitsToFloatSse2(_mm_unpackhi_epi16(halfBits, zero));
+}
+#endif
+
+}
+
+#endif //SGL_HALFFLOATSIMD_HPP
@@ -745,6 +745,22 @@ bool SDLWindow::processEvents() {
     return running;
 }
 
+bool SDLWindow::waitEvents(int timeoutMs) {
+    // Passing no event structure leaves the event in the queue for processEvents.
+#ifdef SUPPORT_SDL3
+    return SDL_WaitEventTimeout(nullptr, Sint32(timeoutMs));
+#else
+    return SDL_WaitEventTimeout(nullptr, timeoutMs) == 1;
+#endif
+}
+
+void SDLWindow::wakeUp() {
+    // SDL_PushEvent is thread-safe. The user event is ignored by processEvents.
+    SDL_Event event{};
+    event.type = SDL_USEREVENT;
+    SDL_PushEvent(&event);
+}
+
 void SDLWindow::clear(const Color &color) {
 #ifdef SUPPORT_OPENGL
     glClearColor(color.getFloatR(), color.getFloatG(), color.getFloatB(), 1.0);
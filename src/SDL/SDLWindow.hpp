@@ -80,6 +80,8 @@ public:
     void setEventHandler(std::function<void(const SDL_Event&)> eventHandler);
     /// Returns false if the game should quit
     bool processEvents() override;
+    bool waitEvents(int timeoutMs) override;
+    void wakeUp() override;
     void clear(const Color &color = Color(0, 0, 0)) override;
     void flip() override;
 
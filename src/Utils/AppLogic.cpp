@@ -27,6 +27,8 @@
  */
 
 #include <string>
+#include <atomic>
+#include <algorithm>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
@@ -43,6 +45,7 @@
 #include <Input/Gamepad.hpp>
 #include <Utils/File/Logfile.hpp>
 #include <Utils/File/FileUtils.hpp>
+#include <Utils/Profiler/Profiler.hpp>
 #include <Graphics/Renderer.hpp>
 #include <tracy/Tracy.hpp>
 
@@ -64,6 +67,8 @@
 
 namespace sgl {
 
+static std::atomic<bool> isRedrawRequested{ true };
+
 AppLogic::AppLogic() : framerateSmoother(16) {
     Timer->setFixedPhysicsFPS(true, 30);
     Timer->setFPSLimit(true, 60);
@@ -75,7 +80,7 @@ AppLogic::AppLogic() : framerateSmoother(16) {
 
     window = AppSettings::get()->getMainWindow();
 #ifdef SUPPORT_SDL
-    if (getIsSdlWindowBackend(window->getBackend())) {
+    if (window && getIsSdlWindowBackend(window->getBackend())) {
         static_cast<SDLWindow*>(window)->setEventHandler([this](const SDL_Event &event) {
             this->processSDLEvent(event);
         });
@@ -96,6 +101,8 @@ AppLogic::AppLogic() : framerateSmoother(16) {
 }
 
 AppLogic::~AppLogic() {
+    stopPipelinedUpdateThread();
+
 #ifdef SUPPORT_VULKAN
     if (sgl::AppSettings::get()->getPrimaryDevice()) {
         delete rendererVk;
@@ -154,13 +161,56 @@ void AppLogic::run() {
         runStep();
     }
 #endif
+    // Derived classes are still alive here, in contrast to the destructor of this class.
+    stopPipelinedUpdateThread();
 
     Logfile::get()->write("INFO: End of main loop.", BLUE);
 }
 
+void AppLogic::setFrameSchedulingMode(FrameSchedulingMode mode) {
+    frameSchedulingMode = mode;
+    requestRedraw();
+}
+
+void AppLogic::requestRedraw() {
+    isRedrawRequested = true;
+    Window* mainWindow = AppSettings::get()->getMainWindow();
+    if (mainWindow) {
+        mainWindow->wakeUp();
+    }
+}
+
+bool AppLogic::waitForRedraw() {
+    if (numRemainingEventFrames > 0) {
+        numRemainingEventFrames--;
+        return false;
+    }
+    if (isRedrawRequested.exchange(false)) {
+        return false;
+    }
+
+    // A redraw requested after the check above also wakes up the window, so it cannot get lost.
+    uint64_t startTime = Timer->getTicksMicroseconds();
+    bool hasEvent = window->waitEvents(std::max(int(maxIdleLatency * 1000.0f), 1));
+    idleTimeMicroseconds += Timer->getTicksMicroseconds() - startTime;
+    isRedrawRequested = false;
+    if (hasEvent) {
+        numRemainingEventFrames = std::max(numFramesAfterEvent - 1, 0);
+    }
+    return true;
+}
+
 void AppLogic::runStep() {
+    bool hasIdled = false;
+#ifndef __EMSCRIPTEN__
+    if (frameSchedulingMode == FrameSchedulingMode::ON_DEMAND) {
+        hasIdled = waitForRedraw();
+    }
+#endif
+
     Timer->update();
-    accumulatedTimeFixed += Timer->getElapsedMicroseconds();
+    // The time spent idle should neither trigger a burst of fixed updates nor distort the frame rate.
+    accumulatedTimeFixed += hasIdled ? uint64_t(fixedFPSInMicroSeconds) : Timer->getElapsedMicroseconds();
 
     do {
         updateFixed(float(Timer->getFixedPhysicsFPS()));
@@ -171,7 +221,9 @@ void AppLogic::runStep() {
     running = running && windowRunning;
 
     //float dt = Timer->getElapsedSeconds();
-    framerateSmoother.addSample(1.0f/Timer->getElapsedSeconds());
+    if (!hasIdled) {
+        framerateSmoother.addSample(1.0f/Timer->getElapsedSeconds());
+    }
     float dt = 1.0f / framerateSmoother.computeAverage();
     Mouse->update(dt);
     Keyboard->update(dt);
@@ -179,6 +231,13 @@ void AppLogic::runStep() {
     updateBase(dt);
     update(dt);
     Keyboard->clearKeyBuffer(); //< getKeyBuffer can be used in child class update.
+    if (usePipelinedUpdate) {
+        runPipelinedUpdate(dt);
+    } else {
+        // The hook is also called in synchronous mode, as derived classes copy their input state into the slot there.
+        onPipelinedUpdateStart(renderFrameStateIndex);
+        updatePipelined(dt, renderFrameStateIndex);
+    }
 
     // Decided to quit during update?
     if (!running) {
@@ -197,7 +256,7 @@ void AppLogic::runStep() {
             swapchain->beginFrame();
         }
     }
-    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::VULKAN) {
+    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::VULKAN && rendererVk) {
         rendererVk->beginCommandBuffer();
     }
 #endif
@@ -219,7 +278,7 @@ void AppLogic::runStep() {
             swapchainValid = swapchain->beginFrame();
         }
     }
-    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::WEBGPU && swapchainValid) {
+    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::WEBGPU && swapchainValid && rendererWgpu) {
         rendererWgpu->beginCommandBuffer();
     }
 #endif
@@ -229,7 +288,7 @@ void AppLogic::runStep() {
     }
 
 #ifdef SUPPORT_VULKAN
-    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::VULKAN) {
+    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::VULKAN && rendererVk) {
         rendererVk->endCommandBuffer();
         auto* swapchain = sgl::AppSettings::get()->getSwapchain();
         if (swapchain) {
@@ -239,7 +298,7 @@ void AppLogic::runStep() {
 #endif
 
 #ifdef SUPPORT_WEBGPU
-    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::WEBGPU && swapchainValid) {
+    if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::WEBGPU && swapchainValid && rendererWgpu) {
         rendererWgpu->endCommandBuffer();
         auto* swapchain = sgl::AppSettings::get()->getWebGPUSwapchain();
         if (swapchain) {
@@ -275,12 +334,102 @@ void AppLogic::runStep() {
     }
 
     endFrameMarker();
+    Profiler::get()->markFrame();
+    numRenderedFrames++;
 
 #ifdef TRACY_ENABLE
     FrameMark;
 #endif
 }
 
+void AppLogic::setUsePipelinedUpdate(bool usePipelined) {
+    if (usePipelinedUpdate == usePipelined) {
+        return;
+    }
+    usePipelinedUpdate = usePipelined;
+    if (!usePipelinedUpdate) {
+        stopPipelinedUpdateThread();
+    }
+    hasPipelinedFrameState = false;
+}
+
+void AppLogic::runPipelinedUpdate(float dt) {
+    if (!pipelinedUpdateThread.joinable()) {
+        shallStopPipelinedUpdateThread = false;
+        pipelinedUpdateThread = std::thread(&AppLogic::pipelinedUpdateThreadFunction, this);
+    }
+
+    if (!hasPipelinedFrameState) {
+        // There is no previous update to overlap with in the first frame, so the state is filled synchronously.
+        updateFrameStateIndex = 0;
+        onPipelinedUpdateStart(updateFrameStateIndex);
+        updatePipelined(dt, updateFrameStateIndex);
+        hasPipelinedFrameState = true;
+    } else {
+        waitForPipelinedUpdate();
+    }
+
+    // The slot written by the worker is handed over to rendering, and the worker continues with the other slot.
+    renderFrameStateIndex = updateFrameStateIndex;
+    updateFrameStateIndex = (renderFrameStateIndex + 1) % NUM_FRAME_STATES;
+    onPipelinedUpdateStart(updateFrameStateIndex);
+
+    std::unique_lock<std::mutex> lock(pipelinedUpdateMutex);
+    pipelinedUpdateDt = dt;
+    isPipelinedUpdatePending = true;
+    lock.unlock();
+    pipelinedUpdateCondition.notify_all();
+}
+
+void AppLogic::waitForPipelinedUpdate() {
+    std::unique_lock<std::mutex> lock(pipelinedUpdateMutex);
+    pipelinedUpdateCondition.wait(lock, [this] { return !isPipelinedUpdatePending; });
+    if (pipelinedUpdateException) {
+        std::exception_ptr exception = pipelinedUpdateException;
+        pipelinedUpdateException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void AppLogic::stopPipelinedUpdateThread() {
+    if (!pipelinedUpdateThread.joinable()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(pipelinedUpdateMutex);
+    shallStopPipelinedUpdateThread = true;
+    lock.unlock();
+    pipelinedUpdateCondition.notify_all();
+    pipelinedUpdateThread.join();
+    pipelinedUpdateException = nullptr;
+    hasPipelinedFrameState = false;
+}
+
+void AppLogic::pipelinedUpdateThreadFunction() {
+    std::unique_lock<std::mutex> lock(pipelinedUpdateMutex);
+    while (true) {
+        pipelinedUpdateCondition.wait(lock, [this] {
+            return isPipelinedUpdatePending || shallStopPipelinedUpdateThread;
+        });
+        // A pending update is finished before stopping, as its frame state may still be rendered.
+        if (!isPipelinedUpdatePending) {
+            break;
+        }
+        float dt = pipelinedUpdateDt;
+        uint32_t frameStateIndex = updateFrameStateIndex;
+        lock.unlock();
+        try {
+            updatePipelined(dt, frameStateIndex);
+        } catch (...) {
+            lock.lock();
+            pipelinedUpdateException = std::current_exception();
+            lock.unlock();
+        }
+        lock.lock();
+        isPipelinedUpdatePending = false;
+        pipelinedUpdateCondition.notify_all();
+    }
+}
+
 void AppLogic::updateBase(float dt) {
     EventManager::get()->update();
     if (Keyboard->keyPressed(ImGuiKey_PrintScreen)
@@ -31,6 +31,10 @@
 
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #ifdef SUPPORT_SDL
 union SDL_Event;
@@ -57,6 +61,16 @@ class Event;
 typedef std::shared_ptr<Event> EventPtr;
 class Window;
 
+enum class FrameSchedulingMode {
+    /// A new frame is rendered in every iteration of the main loop.
+    CONTINUOUS,
+    /**
+     * A new frame is only rendered after window/input events, after calls to @see AppLogic::requestRedraw, or when the
+     * maximum idle latency has passed. In between, the main loop blocks without using the CPU or GPU.
+     */
+    ON_DEMAND
+};
+
 class DLL_OBJECT AppLogic {
 public:
     AppLogic();
@@ -73,13 +87,55 @@ public:
     virtual void resolutionChanged(EventPtr event) {}
     virtual void render() {}
 
+    /**
+     * Pipelined mode: @see updatePipelined for frame N+1 runs on a worker thread while the main thread records and
+     * submits frame N. The frame state is double-buffered. updatePipelined writes to the slot passed to it, and after
+     * it has finished, the slot is handed over to the main thread, where it can be read in @see render using
+     * @see getRenderFrameStateIndex. Data read by updatePipelined (e.g., camera matrices or user input) should be
+     * copied into the slot in @see onPipelinedUpdateStart, which is called on the main thread before the worker starts.
+     * NOTE: updatePipelined must not access the window, the input devices, ImGui or the renderer, and the rendered
+     * frame lags one frame behind the input in pipelined mode.
+     */
+    void setUsePipelinedUpdate(bool usePipelined);
+    [[nodiscard]] inline bool getUsePipelinedUpdate() const { return usePipelinedUpdate; }
+    /// Called after update(dt) with the index of the frame state slot to write. Runs on a worker thread if pipelined.
+    virtual void updatePipelined(float dt, uint32_t frameStateIndex) {}
+    /// Called on the main thread before updatePipelined is started for the passed frame state slot.
+    virtual void onPipelinedUpdateStart(uint32_t frameStateIndex) {}
+    [[nodiscard]] inline uint32_t getRenderFrameStateIndex() const { return renderFrameStateIndex; }
+    static constexpr uint32_t NUM_FRAME_STATES = 2;
+
     virtual void setPrintFPS(bool enabled);
     [[nodiscard]] inline float getFPS() const { return fps; }
     inline void quit() { running = false; }
 
+    /// Frame scheduling (@see FrameSchedulingMode).
+    void setFrameSchedulingMode(FrameSchedulingMode mode);
+    [[nodiscard]] inline FrameSchedulingMode getFrameSchedulingMode() const { return frameSchedulingMode; }
+    /// Maximum time the main loop blocks in on-demand mode before a frame is rendered anyway (e.g., for polling).
+    inline void setMaxIdleLatency(float seconds) { maxIdleLatency = seconds; }
+    [[nodiscard]] inline float getMaxIdleLatency() const { return maxIdleLatency; }
+    /// Number of frames rendered after an event in on-demand mode (ImGui needs more than one frame to settle).
+    inline void setNumFramesAfterEvent(int numFrames) { numFramesAfterEvent = numFrames; }
+    /**
+     * Marks the scene as dirty, i.e., a new frame is rendered in on-demand mode. This function can be called from any
+     * thread, e.g., by asynchronous loaders after new data has arrived.
+     */
+    static void requestRedraw();
+    /// Statistics for measuring the effect of on-demand rendering.
+    [[nodiscard]] inline uint64_t getNumRenderedFrames() const { return numRenderedFrames; }
+    [[nodiscard]] inline uint64_t getIdleTimeMicroseconds() const { return idleTimeMicroseconds; }
+
 protected:
     // Main loop logic.
     virtual void runStep();
+    /// Blocks in on-demand mode until a new frame needs to be rendered. Returns whether the loop was idle.
+    bool waitForRedraw();
+    /// Hands over the frame state and starts updatePipelined for the next frame.
+    void runPipelinedUpdate(float dt);
+    void waitForPipelinedUpdate();
+    void stopPipelinedUpdateThread();
+    void pipelinedUpdateThreadFunction();
     uint64_t accumulatedTimeFixed = 0;
     uint64_t fpsTimer = 0;
     int64_t fixedFPSInMicroSeconds = 0;
@@ -104,6 +160,26 @@ protected:
     virtual void endFrameMarker() {}
 
 private:
+    FrameSchedulingMode frameSchedulingMode = FrameSchedulingMode::CONTINUOUS;
+    float maxIdleLatency = 0.5f;
+    int numFramesAfterEvent = 3;
+    int numRemainingEventFrames = 0;
+    uint64_t numRenderedFrames = 0;
+    uint64_t idleTimeMicroseconds = 0;
+
+    // Pipelined update.
+    bool usePipelinedUpdate = false;
+    bool hasPipelinedFrameState = false;
+    uint32_t renderFrameStateIndex = 0;
+    uint32_t updateFrameStateIndex = 0;
+    float pipelinedUpdateDt = 0.0f;
+    bool isPipelinedUpdatePending = false;
+    bool shallStopPipelinedUpdateThread = false;
+    std::exception_ptr pipelinedUpdateException;
+    std::mutex pipelinedUpdateMutex;
+    std::condition_variable pipelinedUpdateCondition;
+    std::thread pipelinedUpdateThread;
+
     bool running;
     uint64_t fpsCounterUpdateFrequency;
     bool printFPS;
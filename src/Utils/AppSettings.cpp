@@ -1062,6 +1062,7 @@ Window* AppSettings::getMainWindow() {
 }
 
 Window* AppSettings::setMainWindow(Window* window) {
+    mainWindow = window;
     return mainWindow;
 }
 
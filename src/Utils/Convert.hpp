@@ -30,10 +30,16 @@
 #define SRC_UTILS_CONVERT_HPP_
 
 #include <string>
+#include <string_view>
 #include <locale>
 #include <vector>
 #include <sstream>
 #include <iomanip>
+#include <charconv>
+#include <type_traits>
+#include <limits>
+#include <cmath>
+#include <cstdio>
 #include <cstdint>
 
 #ifdef USE_GLM
@@ -44,17 +50,121 @@
 #include <Math/Geometry/fallback/vec.hpp>
 #endif
 
+// Floating-point std::to_chars/std::from_chars are not available in all standard libraries (e.g., older libc++).
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SGL_CONVERT_FLOAT_CHARCONV
+#endif
+
 namespace sgl {
 
+/// Size of a char buffer large enough for any number written by @see writeNumber.
+const size_t NUMBER_STRING_BUFFER_SIZE = 32;
+
+namespace detail {
+/// Integer types that streams format as numbers (i.e., not bool and not character types).
+template<class T>
+constexpr bool isConvertibleInteger =
+        std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) > 1 && !std::is_same_v<T, wchar_t>
+        && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+template<class T>
+constexpr bool isConvertibleFloat = std::is_same_v<T, float> || std::is_same_v<T, double>;
+template<class T>
+constexpr bool isConvertibleNumber = isConvertibleInteger<T> || isConvertibleFloat<T>;
+
+/// Streams use the global locale, so the std::to_chars fast paths may only replace them for the classic locale.
+inline bool getIsGlobalLocaleClassic() {
+    return std::locale() == std::locale::classic();
+}
+
+inline bool isStreamWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+/**
+ * Parses a number like 'stream >> value' does for the classic locale if the result is guaranteed to be identical.
+ * Returns false for all other cases (e.g., parse errors, hexadecimal, out-of-range or non-finite values), which are
+ * left to the stream.
+ */
+template<class T>
+bool tryParseNumberLikeStream(const std::string& str, T& value) {
+    const char* first = str.data();
+    const char* last = str.data() + str.size();
+    while (first != last && isStreamWhitespace(*first)) {
+        first++;
+    }
+    if (first != last && *first == '+') {
+        first++;
+        if (first != last && *first == '-') {
+            return false;
+        }
+    }
+    T valueParsed{};
+    std::from_chars_result result;
+    if constexpr (isConvertibleInteger<T>) {
+        result = std::from_chars(first, last, valueParsed);
+    } else {
+#ifdef SGL_CONVERT_FLOAT_CHARCONV
+        result = std::from_chars(first, last, valueParsed);
+        if (result.ec == std::errc() && !std::isfinite(valueParsed)) {
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+    if (result.ec != std::errc() || (result.ptr != last && !isStreamWhitespace(*result.ptr))) {
+        return false;
+    }
+    value = valueParsed;
+    return true;
+}
+
+template<class T>
+bool tryWriteNumberLikeStream(T value, int precision, std::chars_format format, std::string& str) {
+    char buffer[128];
+    std::to_chars_result result;
+    if constexpr (isConvertibleInteger<T>) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    } else {
+#ifdef SGL_CONVERT_FLOAT_CHARCONV
+        // Streams use a precision of 6 if it is negative.
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value, format, precision < 0 ? 6 : precision);
+#else
+        (void)precision;
+        (void)format;
+        return false;
+#endif
+    }
+    if (result.ec != std::errc()) {
+        return false;
+    }
+    str.assign(buffer, result.ptr);
+    return true;
+}
+}
+
 /// Conversion to and from string
 template <class T>
 std::string toString(T obj) {
+    if constexpr (detail::isConvertibleNumber<T>) {
+        std::string str;
+        if (detail::getIsGlobalLocaleClassic()
+                && detail::tryWriteNumberLikeStream(obj, 6, std::chars_format::general, str)) {
+            return str;
+        }
+    }
     std::ostringstream ostr;
     ostr << obj;
     return ostr.str();
 }
 template <class T>
 T fromString(const std::string &stringObject) {
+    if constexpr (detail::isConvertibleNumber<T>) {
+        T value;
+        if (detail::getIsGlobalLocaleClassic() && detail::tryParseNumberLikeStream(stringObject, value)) {
+            return value;
+        }
+    }
     std::stringstream strstr;
     strstr << stringObject;
     T type;
@@ -69,6 +179,16 @@ inline std::string fromString(const std::string &stringObject) {
 template <class T>
 std::string toString(
         T obj, int precision, bool fixed = true, bool noshowpoint = false, bool scientific = false) {
+    // Both 'fixed' and 'scientific' result in hexadecimal floats, which are left to the stream.
+    if constexpr (detail::isConvertibleNumber<T>) {
+        std::string str;
+        if (!(fixed && scientific) && detail::getIsGlobalLocaleClassic() && detail::tryWriteNumberLikeStream(
+                obj, precision,
+                fixed ? std::chars_format::fixed : (scientific ? std::chars_format::scientific
+                        : std::chars_format::general), str)) {
+            return str;
+        }
+    }
     std::ostringstream ostr;
     ostr.precision(precision);
     if (fixed) {
@@ -107,12 +227,213 @@ void appendVector(std::vector<T> &vector1, std::vector<T> &vector2) {
 /// Uses the C locale. Should be used, e.g., to avoid system-dependent decimal separator dot "." / comma ",".
 template <class T>
 std::string toStringLocaleC(T obj) {
+    if constexpr (detail::isConvertibleNumber<T>) {
+        std::string str;
+        if (detail::tryWriteNumberLikeStream(obj, 6, std::chars_format::general, str)) {
+            return str;
+        }
+    }
     std::ostringstream ostr;
     ostr.imbue(std::locale("C"));
     ostr << obj;
     return ostr.str();
 }
 
+/*
+ * Allocation-free conversion of numbers independent of the locale (always using "." as the decimal separator).
+ * Floating-point numbers are written in the shortest representation that parses back to the identical value
+ * (e.g., 0.1f is written as "0.1", 1.0f / 3.0f as "0.33333334"). In contrast to @see toString and @see fromString,
+ * no streams or temporary strings are used, which matters when reading or writing large ASCII point sets or CSV files.
+ */
+
+/**
+ * Writes a number to [first, last) without a terminating null character.
+ * @return A pointer past the last written character, or nullptr if the buffer is too small. Buffers of size
+ * @see NUMBER_STRING_BUFFER_SIZE are always large enough.
+ */
+template<class T>
+char* writeNumber(char* first, char* last, T value) {
+    static_assert(detail::isConvertibleNumber<T>, "Unsupported type passed to sgl::writeNumber.");
+    if constexpr (detail::isConvertibleInteger<T>) {
+        std::to_chars_result result = std::to_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    } else {
+#ifdef SGL_CONVERT_FLOAT_CHARCONV
+        std::to_chars_result result = std::to_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+        // Fallback: Enough digits for a round trip (but not necessarily the shortest representation).
+        char buffer[NUMBER_STRING_BUFFER_SIZE];
+        int length = std::snprintf(
+                buffer, sizeof(buffer), "%.*g", std::numeric_limits<T>::max_digits10, double(value));
+        if (length < 0 || size_t(length) > size_t(last - first)) {
+            return nullptr;
+        }
+        for (int i = 0; i < length; i++) {
+            // The C library may use another decimal separator depending on LC_NUMERIC.
+            char c = buffer[i];
+            first[i] = c == ',' ? '.' : c;
+        }
+        return first + length;
+#endif
+    }
+}
+
+/// Appends a number to the passed string (see @see writeNumber).
+template<class T>
+void appendNumber(std::string& str, T value) {
+    char buffer[NUMBER_STRING_BUFFER_SIZE];
+    char* end = writeNumber(buffer, buffer + NUMBER_STRING_BUFFER_SIZE, value);
+    str.append(buffer, end);
+}
+
+/// Appends the numbers to the passed string, separated by 'separator'.
+template<class T>
+void appendNumberArray(std::string& str, const T* values, size_t count, char separator = ' ') {
+    char buffer[NUMBER_STRING_BUFFER_SIZE * 16];
+    char* bufferEnd = buffer + sizeof(buffer);
+    char* ptr = buffer;
+    for (size_t i = 0; i < count; i++) {
+        if (size_t(bufferEnd - ptr) < NUMBER_STRING_BUFFER_SIZE + 1) {
+            str.append(buffer, ptr);
+            ptr = buffer;
+        }
+        if (i != 0) {
+            *ptr = separator;
+            ptr++;
+        }
+        ptr = writeNumber(ptr, bufferEnd, values[i]);
+    }
+    str.append(buffer, ptr);
+}
+template<class T>
+void appendNumberArray(std::string& str, const std::vector<T>& values, char separator = ' ') {
+    appendNumberArray(str, values.data(), values.size(), separator);
+}
+
+/**
+ * Parses a number at the start of [first, last). Leading whitespace is not skipped, but a leading '+' is accepted.
+ * @return A pointer past the parsed characters, or nullptr if no number could be parsed or it is out of range.
+ */
+template<class T>
+const char* parseNumber(const char* first, const char* last, T& value) {
+    static_assert(detail::isConvertibleNumber<T>, "Unsupported type passed to sgl::parseNumber.");
+    if (first != last && *first == '+' && last - first > 1 && first[1] != '-' && first[1] != '+') {
+        first++;
+    }
+    if constexpr (detail::isConvertibleInteger<T>) {
+        std::from_chars_result result = std::from_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    } else {
+#ifdef SGL_CONVERT_FLOAT_CHARCONV
+        std::from_chars_result result = std::from_chars(first, last, value);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+        // Fallback: Parse the longest prefix that looks like a decimal number with a stream using the classic locale.
+        const char* ptr = first;
+        if (ptr != last && *ptr == '-') {
+            ptr++;
+        }
+        bool hasDigits = false;
+        while (ptr != last && ((*ptr >= '0' && *ptr <= '9') || *ptr == '.')) {
+            hasDigits = hasDigits || *ptr != '.';
+            ptr++;
+        }
+        if (!hasDigits) {
+            return nullptr;
+        }
+        if (ptr != last && (*ptr == 'e' || *ptr == 'E')) {
+            const char* ptrExponent = ptr + 1;
+            if (ptrExponent != last && (*ptrExponent == '-' || *ptrExponent == '+')) {
+                ptrExponent++;
+            }
+            if (ptrExponent != last && *ptrExponent >= '0' && *ptrExponent <= '9') {
+                ptr = ptrExponent;
+                while (ptr != last && *ptr >= '0' && *ptr <= '9') {
+                    ptr++;
+                }
+            }
+        }
+        std::istringstream istr(std::string(first, ptr));
+        istr.imbue(std::locale::classic());
+        T valueParsed;
+        istr >> valueParsed;
+        if (istr.fail()) {
+            return nullptr;
+        }
+        value = valueParsed;
+        return ptr;
+#endif
+    }
+}
+
+/// Parses a string consisting of one number, optionally surrounded by whitespace. Returns false on failure.
+template<class T>
+bool parseNumber(std::string_view str, T& value) {
+    const char* first = str.data();
+    const char* last = str.data() + str.size();
+    while (first != last && detail::isStreamWhitespace(*first)) {
+        first++;
+    }
+    const char* ptr = parseNumber(first, last, value);
+    if (!ptr) {
+        return false;
+    }
+    while (ptr != last && detail::isStreamWhitespace(*ptr)) {
+        ptr++;
+    }
+    return ptr == last;
+}
+
+/**
+ * Parses up to maxCount numbers separated by whitespace, ',' or ';' (e.g., a line of an ASCII point set or CSV file).
+ * Parsing stops at the first token that is not a number.
+ * @return The number of parsed values.
+ */
+template<class T>
+size_t parseNumberArray(std::string_view str, T* values, size_t maxCount) {
+    const char* ptr = str.data();
+    const char* last = str.data() + str.size();
+    size_t numValues = 0;
+    while (numValues < maxCount) {
+        while (ptr != last && (detail::isStreamWhitespace(*ptr) || *ptr == ',' || *ptr == ';')) {
+            ptr++;
+        }
+        if (ptr == last) {
+            break;
+        }
+        ptr = parseNumber(ptr, last, values[numValues]);
+        if (!ptr) {
+            break;
+        }
+        numValues++;
+    }
+    return numValues;
+}
+/// Appends all numbers in the passed string to 'values' (see @see parseNumberArray). Returns the number of values.
+template<class T>
+size_t parseNumberArray(std::string_view str, std::vector<T>& values) {
+    const char* ptr = str.data();
+    const char* last = str.data() + str.size();
+    size_t numValues = 0;
+    T value;
+    for (;;) {
+        while (ptr != last && (detail::isStreamWhitespace(*ptr) || *ptr == ',' || *ptr == ';')) {
+            ptr++;
+        }
+        if (ptr == last) {
+            break;
+        }
+        ptr = parseNumber(ptr, last, value);
+        if (!ptr) {
+            break;
+        }
+        values.push_back(value);
+        numValues++;
+    }
+    return numValues;
+}
+
 /// Special string conversion functions
 DLL_OBJECT std::string floatToString(float f, int decimalPrecision = -1);
 DLL_OBJECT uint32_t hexadecimalStringToUint32(const std::string &stringObject);
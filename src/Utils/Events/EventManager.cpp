@@ -35,6 +35,10 @@ EventManager::EventManager() {
 }
 
 void EventManager::update() {
+    {
+        std::lock_guard<std::mutex> lock(threadSafeEventQueueMutex);
+        eventQueue.splice(eventQueue.end(), threadSafeEventQueue);
+    }
     while (!eventQueue.empty()) {
         EventPtr event = eventQueue.front();
         eventQueue.pop_front();
@@ -78,4 +82,9 @@ void EventManager::queueEvent(const EventPtr& event) {
     eventQueue.push_back(event);
 }
 
+void EventManager::threadSafeQueueEvent(const EventPtr& event) {
+    std::lock_guard<std::mutex> lock(threadSafeEventQueueMutex);
+    threadSafeEventQueue.push_back(event);
+}
+
 }
@@ -34,6 +34,7 @@
 #include <list>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include "Stream/Stream.hpp"
 #include <Utils/Singleton.hpp>
 
@@ -70,14 +71,16 @@ public:
     void triggerEvent(const EventPtr& event);
     /// Adds an event to the event queue, which is updated by calling the function "update"
     void queueEvent(const EventPtr& event);
-    //bool threadSafeQueueEvent(const EventDataPtr &event);
+    /// Like queueEvent, but can be called from any thread. The listeners are still called by "update".
+    void threadSafeQueueEvent(const EventPtr& event);
 
 
 private:
     std::map<uint32_t, EventFuncList> listeners;
     std::list<EventPtr> eventQueue;
     uint32_t listenerCounter;
-    //MultithreadedQueue<EventPtr> threadSafeEventQueue
+    std::mutex threadSafeEventQueueMutex;
+    std::list<EventPtr> threadSafeEventQueue;
 };
 
 }
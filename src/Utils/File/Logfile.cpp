@@ -29,6 +29,14 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <csignal>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 #ifdef USE_TBB
 #if __has_include(<tbb/version.h>)
@@ -49,9 +57,52 @@
 #include "../StringUtils.hpp"
 #include "Logfile.hpp"
 
+// windows.h may define "ERROR" (@see Logfile.hpp).
+#pragma push_macro("ERROR")
+#undef ERROR
+
 namespace sgl {
 
-Logfile::Logfile () : closedLogfile(false) {
+/**
+ * Message buffer of one thread. The owning thread appends to it and the writer thread drains it, so the lock is
+ * practically uncontended. A spin lock is used, as the crash signal handler can only try to acquire it.
+ */
+struct LogThreadBuffer {
+    inline void lock() {
+        while (isLocked.exchange(true, std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    inline bool tryLock() { return !isLocked.exchange(true, std::memory_order_acquire); }
+    inline void unlock() { isLocked.store(false, std::memory_order_release); }
+
+    std::string text;
+    std::string stdoutText, stderrText; ///< Console echo of the messages, written together with the file content.
+    std::atomic<bool> isLocked{false};
+    std::atomic<bool> isInUse{false}; ///< Whether a running thread owns the buffer.
+    LogThreadBuffer* next = nullptr;
+};
+
+namespace {
+/// Keeps the buffer alive until the thread exits, even if the log file is destroyed before.
+struct LogThreadBufferHandle {
+    ~LogThreadBufferHandle() {
+        if (buffer) {
+            buffer->isInUse.store(false, std::memory_order_release);
+        }
+    }
+    uint64_t logfileInstanceId = 0;
+    std::shared_ptr<LogThreadBuffer> buffer;
+};
+thread_local LogThreadBufferHandle threadBufferHandle;
+std::atomic<uint64_t> logfileInstanceCounter{0};
+std::atomic<Logfile*> crashSignalLogfile{nullptr};
+}
+
+Logfile::Logfile () : closedLogfile(false), instanceId(++logfileInstanceCounter) {
+#ifdef __EMSCRIPTEN__
+    useAsyncWriter = false;
+#endif
 }
 
 Logfile::~Logfile () {
@@ -64,13 +115,70 @@ void Logfile::closeLogfile() {
         return;
     }
     write("<br><br>End of file.</font></body></html>");
+    stopWriterThread();
+    writePending();
+    Logfile* logfilePtr = this;
+    crashSignalLogfile.compare_exchange_strong(logfilePtr, nullptr);
+    std::lock_guard<std::mutex> lockFile(fileMutex);
+    if (crashFileDescriptor >= 0) {
+#ifdef _WIN32
+        _close(crashFileDescriptor);
+#else
+        close(crashFileDescriptor);
+#endif
+        crashFileDescriptor = -1;
+    }
     logfile.close();
     closedLogfile = true;
 }
 
+void Logfile::setUseAsyncWriter(bool useAsync) {
+#ifndef __EMSCRIPTEN__
+    if (writerThread.joinable()) {
+        std::cerr << "Error in Logfile::setUseAsyncWriter: Must be called before createLogfile." << std::endl;
+        return;
+    }
+    useAsyncWriter = useAsync;
+#endif
+}
+
+void Logfile::setFlushPolicy(LogFlushPolicy policy) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    flushPolicy.store(policy, std::memory_order_relaxed);
+    bufferCondition.notify_one();
+}
+
+void Logfile::setFlushIntervalMs(uint32_t intervalMs) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    flushIntervalMs = std::max(intervalMs, 1u);
+    bufferCondition.notify_one();
+}
+
+void Logfile::setLogLevel(LogLevel level) {
+    logLevel.store(level, std::memory_order_relaxed);
+}
+
+void Logfile::flush() {
+    writePending();
+}
+
 void Logfile::createLogfile(const std::string& filename, const std::string& appName) {
     // Open the file and write the header.
-    logfile.open(filename);
+    {
+        std::lock_guard<std::mutex> lockFile(fileMutex);
+        logfile.open(filename);
+    }
+    if (useAsyncWriter && !writerThread.joinable()) {
+        // Pending messages are appended to the file using this descriptor if the program crashes.
+#ifdef _WIN32
+        crashFileDescriptor = _open(filename.c_str(), _O_WRONLY | _O_APPEND | _O_BINARY);
+#else
+        crashFileDescriptor = open(filename.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+#endif
+        stopWriter = false;
+        writerThread = std::thread(&Logfile::writerThreadFunction, this);
+        installCrashSignalHandlers();
+    }
     write(std::string() + "<html><head><title>Logfile (" + appName + ")</title></head>");
     write("<body><font face='courier new'>");
     writeTopic(std::string() + "Logfile (" + appName + ")", 2);
@@ -126,47 +234,254 @@ void Logfile::createLogfile(const std::string& filename, const std::string& appN
     write("<br><a href='https://github.com/chrismile/" + appName + "/issues'>Inform the developers about issues</a><br><br>");
 }
 
-// Writes the header.
-void Logfile::writeTopic (const std::string &text, int size) {
-    write("<table width='100%%' ");
-    write("bgcolor='#E0E0E5'><tr><td><font face='arial' ");
-    write(std::string() + "size='+" + toString(size) + "'>");
-    write(text);
-    write("</font></td></tr></table>\n<br>");
+void Logfile::appendMessage(const std::string &text, bool isError) {
+    if (!useAsyncWriter || !writerThread.joinable()) {
+        std::lock_guard<std::mutex> lockFile(fileMutex);
+        logfile.write(text.c_str(), std::streamsize(text.size()));
+        logfile.flush();
+        return;
+    }
+
+    LogThreadBuffer* buffer = getThreadBuffer();
+    buffer->lock();
+    buffer->text.append(text);
+    bool isThresholdExceeded = buffer->text.size() >= PENDING_BUFFER_THRESHOLD;
+    buffer->unlock();
+
+    if (isError && flushPolicy.load(std::memory_order_relaxed) != LogFlushPolicy::SHUTDOWN) {
+        // Errors may be followed by a crash, so they are written synchronously.
+        writePending();
+    } else if (isThresholdExceeded) {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        isBufferThresholdExceeded = true;
+        bufferCondition.notify_one();
+    }
 }
 
-// Writes black text to the file.
-void Logfile::write(const std::string &text) {
-    logfile.write(text.c_str(), text.size());
+void Logfile::appendConsoleMessage(const std::string &text, bool useStderr) {
+    // Like the file content, the console output is not flushed per message (as std::endl would).
+    std::ostream& stream = useStderr ? std::cerr : std::cout;
+    if (!useAsyncWriter || !writerThread.joinable()) {
+        std::lock_guard<std::mutex> lockFile(fileMutex);
+        stream.write(text.c_str(), std::streamsize(text.size()));
+        stream.put('\n');
+        stream.flush();
+        return;
+    }
+
+    LogThreadBuffer* buffer = getThreadBuffer();
+    buffer->lock();
+    std::string& consoleText = useStderr ? buffer->stderrText : buffer->stdoutText;
+    consoleText.append(text);
+    consoleText.push_back('\n');
+    buffer->unlock();
+}
+
+LogThreadBuffer* Logfile::getThreadBuffer() {
+    LogThreadBufferHandle& handle = threadBufferHandle;
+    if (handle.buffer && handle.logfileInstanceId == instanceId) {
+        return handle.buffer.get();
+    }
+
+    std::lock_guard<std::mutex> lock(threadBuffersMutex);
+    if (handle.buffer) {
+        // The buffer belongs to a different log file.
+        handle.buffer->isInUse.store(false, std::memory_order_release);
+        handle.buffer = {};
+    }
+    for (const std::shared_ptr<LogThreadBuffer>& buffer : threadBuffers) {
+        bool isInUse = false;
+        if (buffer->isInUse.compare_exchange_strong(isInUse, true, std::memory_order_acquire)) {
+            handle.buffer = buffer;
+            break;
+        }
+    }
+    if (!handle.buffer) {
+        handle.buffer = std::make_shared<LogThreadBuffer>();
+        handle.buffer->isInUse.store(true, std::memory_order_relaxed);
+        handle.buffer->next = threadBuffersHead.load(std::memory_order_relaxed);
+        threadBuffers.push_back(handle.buffer);
+        threadBuffersHead.store(handle.buffer.get(), std::memory_order_release);
+    }
+    handle.logfileInstanceId = instanceId;
+    return handle.buffer.get();
+}
+
+void Logfile::writePending() {
+    std::lock_guard<std::mutex> lockFile(fileMutex);
+    // Messages are only ordered within one thread, as each thread has its own buffer.
+    for (LogThreadBuffer* buffer = threadBuffersHead.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+        buffer->lock();
+        drainBuffer.append(buffer->text);
+        buffer->text.clear();
+        drainStdoutBuffer.append(buffer->stdoutText);
+        buffer->stdoutText.clear();
+        drainStderrBuffer.append(buffer->stderrText);
+        buffer->stderrText.clear();
+        buffer->unlock();
+    }
+    if (!drainBuffer.empty()) {
+        logfile.write(drainBuffer.c_str(), std::streamsize(drainBuffer.size()));
+        drainBuffer.clear();
+    }
+    // Always flush, so that the stream holds no data when a crash signal handler appends to the file.
     logfile.flush();
+    if (!drainStdoutBuffer.empty()) {
+        std::cout.write(drainStdoutBuffer.c_str(), std::streamsize(drainStdoutBuffer.size()));
+        std::cout.flush();
+        drainStdoutBuffer.clear();
+    }
+    if (!drainStderrBuffer.empty()) {
+        std::cerr.write(drainStderrBuffer.c_str(), std::streamsize(drainStderrBuffer.size()));
+        std::cerr.flush();
+        drainStderrBuffer.clear();
+    }
 }
 
-// Writes colored text to the logfile.
-void Logfile::write(const std::string &text, int color) {
+void Logfile::writerThreadFunction() {
+    std::unique_lock<std::mutex> lock(bufferMutex);
+    while (!stopWriter) {
+        auto predicate = [this] {
+            return stopWriter || isBufferThresholdExceeded;
+        };
+        if (flushPolicy.load(std::memory_order_relaxed) == LogFlushPolicy::INTERVAL) {
+            bufferCondition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs), predicate);
+        } else {
+            bufferCondition.wait(lock, predicate);
+        }
+        isBufferThresholdExceeded = false;
+        lock.unlock();
+        writePending();
+        lock.lock();
+    }
+}
+
+void Logfile::stopWriterThread() {
+    if (!writerThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        stopWriter = true;
+        bufferCondition.notify_one();
+    }
+    writerThread.join();
+}
+
+static void (*previousSignalHandlers[4])(int) = { SIG_DFL, SIG_DFL, SIG_DFL, SIG_DFL };
+static const int crashSignals[4] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+void Logfile::installCrashSignalHandlers() {
+    crashSignalLogfile.store(this);
+    if (crashHandlersInstalled) {
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        auto previousHandler = std::signal(crashSignals[i], &Logfile::crashSignalHandler);
+        previousSignalHandlers[i] = previousHandler == SIG_ERR ? SIG_DFL : previousHandler;
+    }
+    crashHandlersInstalled = true;
+}
+
+static void writeFromSignalHandler(int fileDescriptor, const char* data, size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int numBytesWritten = _write(fileDescriptor, data, unsigned(std::min(size, size_t(1) << 30)));
+#else
+        ssize_t numBytesWritten = ::write(fileDescriptor, data, size);
+#endif
+        if (numBytesWritten <= 0) {
+            return;
+        }
+        data += numBytesWritten;
+        size -= size_t(numBytesWritten);
+    }
+}
+
+void Logfile::flushFromSignalHandler() {
+    // Only async-signal-safe operations may be used here: No blocking locks, no allocations and no stream output.
+    // Buffers that are locked by another thread (or by the crashing thread itself) are skipped.
+    if (crashFileDescriptor < 0) {
+        return;
+    }
+    for (LogThreadBuffer* buffer = threadBuffersHead.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+        if (!buffer->tryLock()) {
+            continue;
+        }
+        writeFromSignalHandler(crashFileDescriptor, buffer->text.data(), buffer->text.size());
+        buffer->text.clear();
+        writeFromSignalHandler(1, buffer->stdoutText.data(), buffer->stdoutText.size());
+        buffer->stdoutText.clear();
+        writeFromSignalHandler(2, buffer->stderrText.data(), buffer->stderrText.size());
+        buffer->stderrText.clear();
+        buffer->unlock();
+    }
+    static const char crashMessage[] = "<br><font color=red>The program received a crash signal.</font><br>\n";
+    writeFromSignalHandler(crashFileDescriptor, crashMessage, sizeof(crashMessage) - 1);
+}
+
+void Logfile::crashSignalHandler(int signal) {
+    Logfile* logfile = crashSignalLogfile.exchange(nullptr);
+    if (logfile) {
+        logfile->flushFromSignalHandler();
+    }
+    for (int i = 0; i < 4; i++) {
+        if (crashSignals[i] == signal) {
+            std::signal(signal, previousSignalHandlers[i]);
+            break;
+        }
+    }
+    std::raise(signal);
+}
+
+std::string Logfile::getColorTagOpen(int color) {
     switch (color) {
     case BLACK:
-        write("<font color=black>");  break;
+        return "<font color=black>";
     case WHITE:
-        write("<font color=white>");  break;
+        return "<font color=white>";
     case RED:
-        write("<font color=red>");    break;
+        return "<font color=red>";
     case GREEN:
-        write("<font color=green>");  break;
+        return "<font color=green>";
     case BLUE:
-        write("<font color=blue>");   break;
+        return "<font color=blue>";
     case PURPLE:
-        write("<font color=purple>"); break;
+        return "<font color=purple>";
     case ORANGE:
-        write("<font color=FF9200>"); break;
+        return "<font color=FF9200>";
+    default:
+        return "";
     };
+}
+
+// Writes the header.
+void Logfile::writeTopic (const std::string &text, int size) {
+    appendMessage(
+            "<table width='100%%' bgcolor='#E0E0E5'><tr><td><font face='arial' size='+" + toString(size) + "'>"
+            + text + "</font></td></tr></table>\n<br>");
+}
 
-    write(text);
-    write("</font>");
-    write("<br>");
+// Writes black text to the file.
+void Logfile::write(const std::string &text) {
+    appendMessage(text);
+}
+
+// Writes colored text to the logfile.
+void Logfile::write(const std::string &text, int color) {
+    // Assemble the whole message first so that it is written at once and can't interleave with other threads.
+    std::string message = getColorTagOpen(color);
+    message.reserve(message.size() + text.size() + 11);
+    message += text;
+    message += "</font><br>";
+    appendMessage(message, color == RED || color == ORANGE);
 }
 
 void Logfile::writeWarning(const std::string &text, bool openMessageBox) {
-    std::cerr << text << std::endl;
+    if (!getIsLogLevelEnabled(LogLevel::WARNING)) {
+        return;
+    }
+    appendConsoleMessage(text, true);
     write(text, ORANGE);
     if (openMessageBox) {
         dialog::openMessageBox("Warning", text, dialog::Icon::WARNING);
@@ -174,7 +489,10 @@ void Logfile::writeWarning(const std::string &text, bool openMessageBox) {
 }
 
 void Logfile::writeWarningMultiline(const std::string &text, bool openMessageBox) {
-    std::cerr << text << std::endl;
+    if (!getIsLogLevelEnabled(LogLevel::WARNING)) {
+        return;
+    }
+    appendConsoleMessage(text, true);
     std::string textHtml = sgl::stringReplaceAllCopy(text, "\n", "<br>\n");
     write(textHtml, ORANGE);
     if (openMessageBox) {
@@ -183,7 +501,10 @@ void Logfile::writeWarningMultiline(const std::string &text, bool openMessageBox
 }
 
 void Logfile::writeError(const std::string &text, bool openMessageBox) {
-    std::cerr << text << std::endl;
+    if (!getIsLogLevelEnabled(LogLevel::ERROR)) {
+        return;
+    }
+    appendConsoleMessage(text, true);
     write(text, RED);
     if (openMessageBox) {
         dialog::openMessageBoxBlocking("Error occurred", text, dialog::Icon::ERROR);
@@ -191,7 +512,10 @@ void Logfile::writeError(const std::string &text, bool openMessageBox) {
 }
 
 void Logfile::writeErrorMultiline(const std::string &text, bool openMessageBox) {
-    std::cerr << text << std::endl;
+    if (!getIsLogLevelEnabled(LogLevel::ERROR)) {
+        return;
+    }
+    appendConsoleMessage(text, true);
     std::string textHtml = sgl::stringReplaceAllCopy(text, "\n", "<br>\n");
     write(textHtml, RED);
     if (openMessageBox) {
@@ -201,6 +525,8 @@ void Logfile::writeErrorMultiline(const std::string &text, bool openMessageBox)
 
 void Logfile::throwError(const std::string &text, bool openMessageBox) {
     write(text, RED);
+    // The exception may terminate the program, so make sure the message reaches the disk.
+    writePending();
     if (openMessageBox) {
         dialog::openMessageBoxBlocking("Fatal error occurred", text, dialog::Icon::ERROR);
     }
@@ -208,8 +534,21 @@ void Logfile::throwError(const std::string &text, bool openMessageBox) {
 }
 
 void Logfile::writeInfo(const std::string &text) {
-    std::cout << text << std::endl;
+    if (!getIsLogLevelEnabled(LogLevel::INFO)) {
+        return;
+    }
+    appendConsoleMessage(text, false);
     write(text, BLUE);
 }
 
+void Logfile::writeDebug(const std::string &text) {
+    if (!getIsLogLevelEnabled(LogLevel::DEBUG)) {
+        return;
+    }
+    appendConsoleMessage(text, false);
+    write(text, GREEN);
 }
+
+}
+
+#pragma pop_macro("ERROR")
@@ -30,16 +30,46 @@
 #define SRC_UTILS_FILE_LOGFILE_HPP_
 
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <memory>
 #include <Utils/Singleton.hpp>
 #include <Utils/Convert.hpp>
 
+// windows.h may define "ERROR", which is used by LogLevel. The macro is restored at the end of the file.
+#pragma push_macro("ERROR")
+#undef ERROR
+
 namespace sgl {
 
+struct LogThreadBuffer;
+
 /// Colors for the output text.
 enum FontColors {
     BLACK, WHITE, RED, GREEN, BLUE, PURPLE, ORANGE
 };
 
+/// Messages below the set log level are discarded before they are formatted.
+enum class LogLevel {
+    DEBUG, INFO, WARNING, ERROR, NONE
+};
+
+/**
+ * When buffered text is flushed to the log file. Independent of the policy, the buffer is also flushed when
+ * it exceeds its size threshold, when the log file is closed, before @see Logfile::throwError throws and when
+ * a crash signal is received.
+ * - ON_ERROR: Additionally flush whenever a warning or error is written.
+ * - INTERVAL: Like ON_ERROR, but also flush periodically (@see Logfile::setFlushIntervalMs).
+ * - SHUTDOWN: Only flush on the conditions listed above.
+ * The echo of messages on stdout and stderr (e.g., by @see Logfile::writeInfo) is flushed together with the file.
+ */
+enum class LogFlushPolicy {
+    ON_ERROR, INTERVAL, SHUTDOWN
+};
+
 class DLL_OBJECT Logfile : public Singleton<Logfile> {
 public:
     Logfile();
@@ -47,6 +77,27 @@ public:
     void createLogfile(const std::string& filename, const std::string& appName);
     void closeLogfile();
 
+    /**
+     * Whether a background thread writes the log file (default: true). Otherwise, messages are written and flushed
+     * synchronously by the calling thread. Must be called before @see createLogfile.
+     */
+    void setUseAsyncWriter(bool useAsync);
+    void setFlushPolicy(LogFlushPolicy policy);
+    void setFlushIntervalMs(uint32_t intervalMs);
+    void setLogLevel(LogLevel level);
+    [[nodiscard]] inline LogLevel getLogLevel() const { return logLevel.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline bool getIsLogLevelEnabled(LogLevel level) const {
+        return int(level) >= int(logLevel.load(std::memory_order_relaxed));
+    }
+    /// Writes all buffered text to the log file and flushes it.
+    void flush();
+    /**
+     * Installs handlers for SIGSEGV, SIGABRT, SIGFPE and SIGILL that append the buffered messages to the log file
+     * before the previously installed handler is invoked. The handlers only use async-signal-safe functions.
+     * Called by @see createLogfile when the asynchronous writer is used.
+     */
+    void installCrashSignalHandlers();
+
     /// Write to log file.
     void writeTopic(const std::string &text, int size);
     void write(const std::string &text);
@@ -63,23 +114,46 @@ public:
     void throwError(const std::string &text, bool openMessageBox = true);
     /// Outputs text on stdout, too.
     void writeInfo(const std::string &text);
+    /// Outputs text on stdout, too. Discarded by default (@see setLogLevel).
+    void writeDebug(const std::string &text);
 
     // Versions of the functions above with variadic templates and fold expressions.
+    // The arguments are only converted to strings if the log level of the message is enabled.
+    template<typename... T>
+    void writeDebugVar(T... args) {
+        if (getIsLogLevelEnabled(LogLevel::DEBUG)) {
+            writeDebug((std::string() + ... + toString(args)));
+        }
+    }
+    template<typename... T>
+    void writeInfoVar(T... args) {
+        if (getIsLogLevelEnabled(LogLevel::INFO)) {
+            writeInfo((std::string() + ... + toString(args)));
+        }
+    }
     template<typename... T>
     void writeWarningVar(T... args) {
-        writeWarning((std::string() + ... + toString(args)));
+        if (getIsLogLevelEnabled(LogLevel::WARNING)) {
+            writeWarning((std::string() + ... + toString(args)));
+        }
     }
     template<typename... T>
     void writeWarningVarMsgBox(T... args) {
-        writeWarning((std::string() + ... + toString(args)), true);
+        if (getIsLogLevelEnabled(LogLevel::WARNING)) {
+            writeWarning((std::string() + ... + toString(args)), true);
+        }
     }
     template<typename... T>
     void writeErrorVar(T... args) {
-        writeError((std::string() + ... + toString(args)));
+        if (getIsLogLevelEnabled(LogLevel::ERROR)) {
+            writeError((std::string() + ... + toString(args)));
+        }
     }
     template<typename... T>
     void writeErrorVarNoMsgBox(T... args) {
-        writeError((std::string() + ... + toString(args)), false);
+        if (getIsLogLevelEnabled(LogLevel::ERROR)) {
+            writeError((std::string() + ... + toString(args)), false);
+        }
     }
     template<typename... T>
     void throwErrorVar(T... args) {
@@ -87,11 +161,53 @@ public:
     }
 
 private:
+    /// Appends a complete message to the buffer of the calling thread (or writes it directly in synchronous mode).
+    void appendMessage(const std::string &text, bool isError = false);
+    /// Echoes a message on stdout or stderr. It is buffered like the file content and written by @see writePending.
+    void appendConsoleMessage(const std::string &text, bool useStderr);
+    static std::string getColorTagOpen(int color);
+    /// Returns the buffer of the calling thread, which is registered on the first call of the thread.
+    LogThreadBuffer* getThreadBuffer();
+    /// Drains the buffers of all threads, writes their content to the file and flushes it.
+    void writePending();
+    void writerThreadFunction();
+    void stopWriterThread();
+    void flushFromSignalHandler();
+    static void crashSignalHandler(int signal);
+
     bool closedLogfile;
     std::ofstream logfile;
+    std::atomic<LogLevel> logLevel{LogLevel::INFO};
+
+    // Asynchronous writer. Lock order: fileMutex before bufferMutex.
+    bool useAsyncWriter = true;
+    std::atomic<LogFlushPolicy> flushPolicy{LogFlushPolicy::INTERVAL};
+    uint32_t flushIntervalMs = 200;
+    std::mutex fileMutex;
+    std::mutex bufferMutex;
+    std::condition_variable bufferCondition;
+    bool isBufferThresholdExceeded = false;
+    bool stopWriter = false;
+    std::thread writerThread;
+    static constexpr size_t PENDING_BUFFER_THRESHOLD = 64 * 1024;
+
+    // Per-thread message buffers. The list is only ever prepended to, so it can be traversed without locks (and thus
+    // also by the crash signal handler). Buffers of exited threads are reused by new threads.
+    uint64_t instanceId;
+    std::mutex threadBuffersMutex;
+    std::vector<std::shared_ptr<LogThreadBuffer>> threadBuffers;
+    std::atomic<LogThreadBuffer*> threadBuffersHead{nullptr};
+    std::string drainBuffer; ///< Protected by fileMutex.
+    std::string drainStdoutBuffer, drainStderrBuffer; ///< Protected by fileMutex.
+
+    // Crash handling. The log file is opened a second time, as only write(2) is async-signal-safe.
+    bool crashHandlersInstalled = false;
+    int crashFileDescriptor = -1;
 };
 
 }
 
+#pragma pop_macro("ERROR")
+
 /*! SRC_UTILS_FILE_LOGFILE_HPP_ */
 #endif
@@ -36,102 +36,40 @@
 
 #if defined(__linux__)
 
-#include <sys/inotify.h>
-#include <poll.h>
-#include <unistd.h>
+#include "PathWatchService.hpp"
 
 namespace sgl {
 
+/*
+ * On Linux, all path watches share the inotify file descriptor of the path watch service, which also debounces the
+ * events. The callback of the service is dispatched on the main thread by EventManager::update.
+ */
 struct PathWatchImplData {
-    int inotifyFileDesc = -1;
-    int parentWatchDesc = -1;
-    int pathWatchDesc = -1;
-    struct inotify_event* inotifyEvents = nullptr;
-    const size_t inotifyEventBufferSize = (sizeof(struct inotify_event) + PATH_MAX + 1) * 4;
+    PathWatchToken token = 0;
+    bool hasChanged = false;
 };
 
 void PathWatch::initialize() {
     if (!data) {
         data = new PathWatchImplData;
     }
-
-    data->inotifyFileDesc = inotify_init();
-    if (data->inotifyFileDesc == -1) {
-        sgl::Logfile::get()->writeError(
-                "Error in PathWatch::initialize: inotify_init returned errno "
-                + std::to_string(errno) + ": " + strerror(errno));
-    }
-    /*
-     * - IN_DELETE_SELF: Remove watch.
-     * - IN_CREATE: File/dir created in this directory.
-     * - IN_DELETE: File/dir deleted in this directory.
-     */
-    data->parentWatchDesc = inotify_add_watch(
-            data->inotifyFileDesc, parentDirectoryPath.c_str(),
-            IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVED_TO | IN_MOVED_FROM);
-    if (data->parentWatchDesc == -1) {
-        sgl::Logfile::get()->writeError(
-                "Error in PathWatch::initialize: inotify_add_watch (parent) for '" + parentDirectoryPath
-                + "' returned errno " + std::to_string(errno) + ": " + strerror(errno));
-    }
-    uint32_t flags = IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVED_TO | IN_MOVED_FROM;
-    if (!isFolder) {
-        flags |= IN_MODIFY;
-    }
-    data->pathWatchDesc = inotify_add_watch(data->inotifyFileDesc, path.c_str(), flags);
-    if (data->pathWatchDesc == -1 && (isFolder || errno != ENOENT)) {
-        sgl::Logfile::get()->writeError(
-                "Error in PathWatch::initialize: inotify_add_watch (path) for '" + path
-                + "' returned errno " + std::to_string(errno) + ": " + strerror(errno));
-    }
-
-    if (!data->inotifyEvents) {
-        data->inotifyEvents = (inotify_event*)malloc(data->inotifyEventBufferSize);
+    if (data->token != 0) {
+        PathWatchService::get()->removeWatch(data->token);
     }
+    PathWatchImplData* implData = data;
+    data->token = PathWatchService::get()->addWatch(
+            path, isFolder, false, [implData](const std::vector<std::string>& changedPaths) {
+                implData->hasChanged = true;
+            });
 }
 
 void PathWatch::_freeInternal() {
-    if (data->inotifyEvents) {
-        free(data->inotifyEvents);
-        data->inotifyEvents = nullptr;
-    }
-
-    if (data->parentWatchDesc >= 0) {
-        int retVal = inotify_rm_watch(data->inotifyFileDesc, data->parentWatchDesc);
-        data->parentWatchDesc = -1;
-        if (retVal == -1) {
-            sgl::Logfile::get()->writeError(
-                    "Error in PathWatch::~PathWatch: inotify_rm_watch (parent) returned errno "
-                    + std::to_string(errno) + ": " + strerror(errno), false);
-            return;
-        }
-    }
-    if (data->pathWatchDesc >= 0) {
-        int retVal = inotify_rm_watch(data->inotifyFileDesc, data->pathWatchDesc);
-        data->pathWatchDesc = -1;
-        if (retVal == -1) {
-            sgl::Logfile::get()->writeError(
-                    "Error in PathWatch::~PathWatch: inotify_rm_watch (path) returned errno "
-                    + std::to_string(errno) + ": " + strerror(errno), false);
-            return;
-        }
-    }
-
-    if (data->inotifyFileDesc != -1) {
-        int retValClose = close(data->inotifyFileDesc);
-        data->inotifyFileDesc = -1;
-        if (retValClose == -1) {
-            sgl::Logfile::get()->writeError(
-                    "Error in PathWatch::~PathWatch: close returned errno " + std::to_string(errno) + ": "
-                    + strerror(errno));
-            return;
-        }
-    }
-
-    if (data) {
-        delete data;
-        data = nullptr;
+    if (data->token != 0) {
+        PathWatchService::get()->removeWatch(data->token);
+        data->token = 0;
     }
+    delete data;
+    data = nullptr;
 }
 
 PathWatch::~PathWatch() {
@@ -141,86 +79,8 @@ PathWatch::~PathWatch() {
 }
 
 void PathWatch::update(std::function<void()> pathChangedCallback) {
-    bool shallUseCallback = false;
-
-    while (true) {
-        struct pollfd pfd = { data->inotifyFileDesc, POLLIN, 0 };
-        int retVal = poll(&pfd, 1, 0);
-        if (pfd.revents == POLLERR) {
-            sgl::Logfile::get()->writeError("Error in PathWatch::update: poll returned POLLERR.");
-            return;
-        } else if (pfd.revents == POLLHUP) {
-            sgl::Logfile::get()->writeError("Error in PathWatch::update: poll returned POLLHUP.");
-            return;
-        } else if (pfd.revents == POLLNVAL) {
-            // TODO: Why can this error occur when recreating a path watch?
-            //sgl::Logfile::get()->writeError("Error in PathWatch::update: poll returned POLLNVAL.");
-            sgl::Logfile::get()->write("Warning in PathWatch::update: poll returned POLLNVAL.", sgl::ORANGE);
-            initialize();
-            return;
-        }
-        if (retVal < 0) {
-            sgl::Logfile::get()->writeError("Error in PathWatch::update: Failed poll.");
-        } else if (retVal > 0) {
-            int size = read(data->inotifyFileDesc, data->inotifyEvents, data->inotifyEventBufferSize);
-            if (size == -1) {
-                sgl::Logfile::get()->writeError(
-                        "Error in PathWatch::update: read returned errno " + std::to_string(errno) + ": "
-                        + strerror(errno));
-                return;
-            }
-            uint8_t* inotifyBuffer = reinterpret_cast<uint8_t*>(data->inotifyEvents);
-            const uint8_t* inotifyBufferEnd = inotifyBuffer + size;
-            while (inotifyBuffer < inotifyBufferEnd) {
-                inotify_event* inotifyEvent = reinterpret_cast<inotify_event*>(inotifyBuffer);
-
-                if (inotifyEvent->wd == data->parentWatchDesc) {
-                    if (inotifyEvent->mask & IN_CREATE || inotifyEvent->mask & IN_DELETE
-                            || inotifyEvent->mask & IN_MOVED_FROM || inotifyEvent->mask & IN_MOVED_TO) {
-                        if (strcmp(inotifyEvent->name, watchedNodeName.c_str()) == 0) {
-                            if (data->pathWatchDesc >= 0) {
-                                int retValRm = inotify_rm_watch(data->inotifyFileDesc, data->pathWatchDesc);
-                                if (retValRm == -1) {
-                                    sgl::Logfile::get()->writeError(
-                                            "Error in PathWatch::update: inotify_rm_watch (path) returned errno "
-                                            + std::to_string(errno) + ": " + strerror(errno));
-                                    return;
-                                }
-                            }
-                            uint32_t flags = IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVED_TO | IN_MOVED_FROM;
-                            if (!isFolder) {
-                                flags |= IN_MODIFY;
-                            }
-                            data->pathWatchDesc = inotify_add_watch(data->inotifyFileDesc, path.c_str(), flags);
-                            if (data->pathWatchDesc == -1 && (isFolder || errno != ENOENT)) {
-                                sgl::Logfile::get()->writeError(
-                                        "Error in PathWatch::update: inotify_add_watch returned errno "
-                                        + std::to_string(errno) + ": " + strerror(errno));
-                                return;
-                            }
-                        }
-                    }
-
-                    if (strcmp(inotifyEvent->name, watchedNodeName.c_str()) == 0) {
-                        shallUseCallback = true;
-                    }
-                }
-                if (inotifyEvent->wd == data->pathWatchDesc) {
-                    shallUseCallback = true;
-                }
-
-                inotifyBuffer += sizeof(inotify_event) + inotifyEvent->len;
-            }
-            if (size == 0) {
-                sgl::Logfile::get()->writeError("Error in PathWatch::update: Failed read.");
-                return;
-            }
-        } else {
-            break;
-        }
-    }
-
-    if (shallUseCallback) {
+    if (data && data->hasChanged) {
+        data->hasChanged = false;
         pathChangedCallback();
     }
 }
@@ -0,0 +1,539 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <Utils/AppSettings.hpp>
+#include <Graphics/Window.hpp>
+
+#include "Logfile.hpp"
+#include "PathWatchService.hpp"
+
+#if defined(__linux__)
+
+#include <cstring>
+#include <climits>
+#include <set>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <unordered_map>
+
+#include <sys/inotify.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+
+namespace sgl {
+
+typedef std::chrono::steady_clock PathWatchClock;
+
+struct PathWatchEntry {
+    std::string path; ///< Without trailing slash.
+    std::string parentDirectoryPath;
+    std::string watchedNodeName;
+    bool isFolder = false;
+    bool isRecursive = false;
+    bool reportFileWrites = false;
+    int parentWatchDesc = -1;
+    std::set<int> pathWatchDescs;
+
+    // Debouncing.
+    bool isPending = false;
+    PathWatchClock::time_point firstEventTime, lastEventTime;
+    std::set<std::string> changedPaths;
+};
+
+struct PathWatchDescUser {
+    PathWatchToken token;
+    bool isParent;
+};
+
+/// The kernel returns the same watch descriptor for the same directory, so it may be shared by multiple watches.
+struct PathWatchDescEntry {
+    std::string path;
+    std::vector<PathWatchDescUser> users;
+};
+
+struct PathWatchServiceImplData {
+    int inotifyFileDesc = -1;
+    int epollFileDesc = -1;
+    int wakeUpFileDesc = -1;
+    std::thread watcherThread;
+    std::atomic<bool> shallStop{ false };
+
+    std::mutex mutex;
+    PathWatchToken tokenCounter = 1;
+    std::map<PathWatchToken, PathWatchEntry> watches;
+    std::unordered_map<int, PathWatchDescEntry> watchDescs;
+    uint32_t debounceTimeMs = 100;
+};
+
+/// All watch descriptors use the same mask, as adding a watch for an already watched directory replaces its mask.
+static const uint32_t PATH_WATCH_MASK =
+        IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF | IN_MOVED_TO | IN_MOVED_FROM
+        | IN_MODIFY | IN_CLOSE_WRITE;
+
+static int addWatchDesc(
+        PathWatchServiceImplData* data, const std::string& path, PathWatchToken token, bool isParent) {
+    int watchDesc = inotify_add_watch(data->inotifyFileDesc, path.c_str(), PATH_WATCH_MASK);
+    if (watchDesc == -1) {
+        return -1;
+    }
+    PathWatchDescEntry& entry = data->watchDescs[watchDesc];
+    entry.path = path;
+    for (const PathWatchDescUser& user : entry.users) {
+        if (user.token == token && user.isParent == isParent) {
+            return watchDesc;
+        }
+    }
+    entry.users.push_back(PathWatchDescUser{ token, isParent });
+    return watchDesc;
+}
+
+static void removeWatchDescUser(
+        PathWatchServiceImplData* data, int watchDesc, PathWatchToken token, bool isParent) {
+    auto it = data->watchDescs.find(watchDesc);
+    if (it == data->watchDescs.end()) {
+        return;
+    }
+    auto& users = it->second.users;
+    users.erase(std::remove_if(users.begin(), users.end(), [&](const PathWatchDescUser& user) {
+        return user.token == token && user.isParent == isParent;
+    }), users.end());
+    if (users.empty()) {
+        // Fails with EINVAL if the kernel has already removed the watch, which can be ignored.
+        inotify_rm_watch(data->inotifyFileDesc, watchDesc);
+        data->watchDescs.erase(it);
+    }
+}
+
+static void addDirectoryWatchesRecursive(
+        PathWatchServiceImplData* data, PathWatchEntry& watch, PathWatchToken token, const std::string& path) {
+    int watchDesc = addWatchDesc(data, path, token, false);
+    if (watchDesc == -1) {
+        return;
+    }
+    watch.pathWatchDescs.insert(watchDesc);
+
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        return;
+    }
+    struct dirent* dirEntry;
+    while ((dirEntry = readdir(dir)) != nullptr) {
+        if (strcmp(dirEntry->d_name, ".") == 0 || strcmp(dirEntry->d_name, "..") == 0) {
+            continue;
+        }
+        std::string childPath = path + "/" + dirEntry->d_name;
+        bool isDirectory = dirEntry->d_type == DT_DIR;
+        if (dirEntry->d_type == DT_UNKNOWN) {
+            struct stat statBuffer{};
+            isDirectory = lstat(childPath.c_str(), &statBuffer) == 0 && S_ISDIR(statBuffer.st_mode);
+        }
+        if (isDirectory) {
+            addDirectoryWatchesRecursive(data, watch, token, childPath);
+        }
+    }
+    closedir(dir);
+}
+
+static void addPathWatches(PathWatchServiceImplData* data, PathWatchEntry& watch, PathWatchToken token) {
+    if (watch.isFolder && watch.isRecursive) {
+        addDirectoryWatchesRecursive(data, watch, token, watch.path);
+        return;
+    }
+    int watchDesc = addWatchDesc(data, watch.path, token, false);
+    if (watchDesc >= 0) {
+        watch.pathWatchDescs.insert(watchDesc);
+    } else if (watch.isFolder || errno != ENOENT) {
+        sgl::Logfile::get()->writeError(
+                "Error in PathWatchService: inotify_add_watch (path) for '" + watch.path
+                + "' returned errno " + std::to_string(errno) + ": " + strerror(errno), false);
+    }
+}
+
+static void removePathWatches(PathWatchServiceImplData* data, PathWatchEntry& watch, PathWatchToken token) {
+    for (int watchDesc : watch.pathWatchDescs) {
+        removeWatchDescUser(data, watchDesc, token, false);
+    }
+    watch.pathWatchDescs.clear();
+}
+
+static void markPathChanged(PathWatchEntry& watch, const std::string& changedPath) {
+    auto now = PathWatchClock::now();
+    if (!watch.isPending) {
+        watch.isPending = true;
+        watch.firstEventTime = now;
+    }
+    watch.lastEventTime = now;
+    watch.changedPaths.insert(changedPath);
+}
+
+/// A continuous stream of events must not delay the dispatch indefinitely, so it is limited to multiple windows.
+static PathWatchClock::time_point getDispatchTime(const PathWatchEntry& watch, uint32_t debounceTimeMs) {
+    auto debounceTime = std::chrono::milliseconds(debounceTimeMs);
+    return std::min(watch.lastEventTime + debounceTime, watch.firstEventTime + 4 * debounceTime);
+}
+
+static void processInotifyEvent(PathWatchServiceImplData* data, const inotify_event* inotifyEvent) {
+    if (inotifyEvent->mask & IN_Q_OVERFLOW) {
+        // Events were lost, so all watches need to assume that their paths have changed.
+        for (auto& watchPair : data->watches) {
+            markPathChanged(watchPair.second, watchPair.second.path);
+        }
+        return;
+    }
+
+    auto itDesc = data->watchDescs.find(inotifyEvent->wd);
+    if (itDesc == data->watchDescs.end()) {
+        return;
+    }
+    // Copied, as the watch descriptor map may change while processing the event.
+    std::string directoryPath = itDesc->second.path;
+    std::vector<PathWatchDescUser> users = itDesc->second.users;
+    std::string name = inotifyEvent->len > 0 ? std::string(inotifyEvent->name) : std::string();
+    uint32_t mask = inotifyEvent->mask;
+
+    for (const PathWatchDescUser& user : users) {
+        auto itWatch = data->watches.find(user.token);
+        if (itWatch == data->watches.end()) {
+            continue;
+        }
+        PathWatchEntry& watch = itWatch->second;
+
+        if (mask & IN_IGNORED) {
+            // The kernel has removed the watch (e.g., because the directory was deleted).
+            if (user.isParent) {
+                watch.parentWatchDesc = -1;
+            } else {
+                watch.pathWatchDescs.erase(inotifyEvent->wd);
+            }
+            continue;
+        }
+
+        if (user.isParent) {
+            if (name != watch.watchedNodeName) {
+                continue;
+            }
+            if (mask & (IN_CREATE | IN_MOVED_TO)) {
+                removePathWatches(data, watch, user.token);
+                addPathWatches(data, watch, user.token);
+            } else if (mask & (IN_DELETE | IN_MOVED_FROM)) {
+                removePathWatches(data, watch, user.token);
+            }
+            markPathChanged(watch, watch.path);
+        } else {
+            // Usually, only the content of directories is relevant, not every single write to the files contained in them.
+            if (watch.isFolder && !watch.reportFileWrites && (mask & (IN_MODIFY | IN_CLOSE_WRITE))) {
+                continue;
+            }
+            std::string changedPath = name.empty() ? directoryPath : directoryPath + "/" + name;
+            if (watch.isFolder && watch.isRecursive && (mask & IN_ISDIR) && (mask & (IN_CREATE | IN_MOVED_TO))) {
+                addDirectoryWatchesRecursive(data, watch, user.token, changedPath);
+            }
+            markPathChanged(watch, changedPath);
+        }
+    }
+
+    if (mask & IN_IGNORED) {
+        data->watchDescs.erase(inotifyEvent->wd);
+    }
+}
+
+static void wakeUpMainThread() {
+    Window* window = AppSettings::get()->getMainWindow();
+    if (window) {
+        window->wakeUp();
+    }
+}
+
+static void watcherThreadFunction(PathWatchServiceImplData* data) {
+    constexpr size_t inotifyEventBufferSize = (sizeof(struct inotify_event) + NAME_MAX + 1) * 64;
+    alignas(inotify_event) uint8_t inotifyEventBuffer[inotifyEventBufferSize];
+    epoll_event epollEvents[2];
+
+    while (!data->shallStop) {
+        int timeoutMs = -1;
+        {
+            std::lock_guard<std::mutex> lock(data->mutex);
+            auto now = PathWatchClock::now();
+            for (const auto& watchPair : data->watches) {
+                if (!watchPair.second.isPending) {
+                    continue;
+                }
+                auto dispatchTime = getDispatchTime(watchPair.second, data->debounceTimeMs);
+                auto remainingTimeMs = std::max(int(std::chrono::duration_cast<std::chrono::milliseconds>(
+                        dispatchTime - now).count()) + 1, 0);
+                timeoutMs = timeoutMs < 0 ? remainingTimeMs : std::min(timeoutMs, remainingTimeMs);
+            }
+        }
+
+        int numEvents = epoll_wait(data->epollFileDesc, epollEvents, 2, timeoutMs);
+        if (numEvents < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            sgl::Logfile::get()->writeError(
+                    "Error in PathWatchService: epoll_wait returned errno " + std::to_string(errno) + ": "
+                    + strerror(errno), false);
+            return;
+        }
+
+        for (int eventIdx = 0; eventIdx < numEvents; eventIdx++) {
+            if (epollEvents[eventIdx].data.fd == data->wakeUpFileDesc) {
+                uint64_t counter = 0;
+                ssize_t size = read(data->wakeUpFileDesc, &counter, sizeof(uint64_t));
+                (void)size;
+                continue;
+            }
+            while (true) {
+                ssize_t size = read(data->inotifyFileDesc, inotifyEventBuffer, inotifyEventBufferSize);
+                if (size <= 0) {
+                    // EAGAIN: All events have been read from the non-blocking file descriptor.
+                    break;
+                }
+                std::lock_guard<std::mutex> lock(data->mutex);
+                const uint8_t* inotifyBuffer = inotifyEventBuffer;
+                const uint8_t* inotifyBufferEnd = inotifyBuffer + size;
+                while (inotifyBuffer < inotifyBufferEnd) {
+                    const auto* inotifyEvent = reinterpret_cast<const inotify_event*>(inotifyBuffer);
+                    processInotifyEvent(data, inotifyEvent);
+                    inotifyBuffer += sizeof(inotify_event) + inotifyEvent->len;
+                }
+            }
+        }
+
+        std::vector<EventPtr> events;
+        {
+            std::lock_guard<std::mutex> lock(data->mutex);
+            auto now = PathWatchClock::now();
+            for (auto& watchPair : data->watches) {
+                PathWatchEntry& watch = watchPair.second;
+                if (!watch.isPending || getDispatchTime(watch, data->debounceTimeMs) > now) {
+                    continue;
+                }
+                std::vector<std::string> changedPaths(watch.changedPaths.begin(), watch.changedPaths.end());
+                events.push_back(std::make_shared<PathChangedEvent>(watchPair.first, std::move(changedPaths)));
+                watch.changedPaths.clear();
+                watch.isPending = false;
+            }
+        }
+        for (const EventPtr& event : events) {
+            EventManager::get()->threadSafeQueueEvent(event);
+        }
+        if (!events.empty()) {
+            wakeUpMainThread();
+        }
+    }
+}
+
+static bool startWatcherThread(PathWatchServiceImplData* data) {
+    data->inotifyFileDesc = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (data->inotifyFileDesc == -1) {
+        sgl::Logfile::get()->writeError(
+                "Error in PathWatchService: inotify_init1 returned errno " + std::to_string(errno) + ": "
+                + strerror(errno), false);
+        return false;
+    }
+    data->wakeUpFileDesc = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    data->epollFileDesc = epoll_create1(EPOLL_CLOEXEC);
+    if (data->wakeUpFileDesc == -1 || data->epollFileDesc == -1) {
+        sgl::Logfile::get()->writeError(
+                "Error in PathWatchService: eventfd or epoll_create1 returned errno " + std::to_string(errno) + ": "
+                + strerror(errno), false);
+        return false;
+    }
+    for (int fileDesc : { data->inotifyFileDesc, data->wakeUpFileDesc }) {
+        epoll_event epollEvent{};
+        epollEvent.events = EPOLLIN;
+        epollEvent.data.fd = fileDesc;
+        if (epoll_ctl(data->epollFileDesc, EPOLL_CTL_ADD, fileDesc, &epollEvent) == -1) {
+            sgl::Logfile::get()->writeError(
+                    "Error in PathWatchService: epoll_ctl returned errno " + std::to_string(errno) + ": "
+                    + strerror(errno), false);
+            return false;
+        }
+    }
+    data->watcherThread = std::thread(watcherThreadFunction, data);
+    return true;
+}
+
+static void wakeUpWatcherThread(PathWatchServiceImplData* data) {
+    uint64_t counter = 1;
+    ssize_t size = write(data->wakeUpFileDesc, &counter, sizeof(uint64_t));
+    (void)size;
+}
+
+PathWatchService::PathWatchService() {
+    data = new PathWatchServiceImplData;
+}
+
+PathWatchService::~PathWatchService() {
+    if (data->watcherThread.joinable()) {
+        data->shallStop = true;
+        wakeUpWatcherThread(data);
+        data->watcherThread.join();
+    }
+    for (int fileDesc : { data->epollFileDesc, data->wakeUpFileDesc, data->inotifyFileDesc }) {
+        if (fileDesc != -1) {
+            close(fileDesc);
+        }
+    }
+    delete data;
+    data = nullptr;
+}
+
+bool PathWatchService::getIsSupported() const {
+    return true;
+}
+
+PathWatchToken PathWatchService::addWatch(
+        const std::string& path, bool isFolder, bool isRecursive, const PathChangedCallback& callback,
+        bool reportFileWrites) {
+    if (!isListenerRegistered) {
+        EventManager::get()->addListener(PATH_CHANGED_EVENT, [this](const EventPtr& event) {
+            this->onPathChangedEvent(event);
+        });
+        isListenerRegistered = true;
+    }
+    if (data->inotifyFileDesc == -1 && !startWatcherThread(data)) {
+        return 0;
+    }
+
+    PathWatchEntry watch;
+    watch.path = path;
+    while (watch.path.size() > 1 && (watch.path.back() == '/' || watch.path.back() == '\\')) {
+        watch.path.pop_back();
+    }
+    watch.isFolder = isFolder;
+    watch.isRecursive = isRecursive;
+    watch.reportFileWrites = reportFileWrites;
+    size_t separatorPos = watch.path.find_last_of("/\\");
+    if (separatorPos == std::string::npos) {
+        watch.parentDirectoryPath = ".";
+        watch.watchedNodeName = watch.path;
+    } else {
+        watch.parentDirectoryPath = separatorPos == 0 ? "/" : watch.path.substr(0, separatorPos);
+        watch.watchedNodeName = watch.path.substr(separatorPos + 1);
+    }
+
+    PathWatchToken token;
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        std::lock_guard<std::mutex> lockData(data->mutex);
+        token = data->tokenCounter++;
+        watch.parentWatchDesc = addWatchDesc(data, watch.parentDirectoryPath, token, true);
+        if (watch.parentWatchDesc == -1) {
+            sgl::Logfile::get()->writeError(
+                    "Error in PathWatchService::addWatch: inotify_add_watch (parent) for '"
+                    + watch.parentDirectoryPath + "' returned errno " + std::to_string(errno) + ": "
+                    + strerror(errno), false);
+        }
+        PathWatchEntry& watchInserted = data->watches.insert(std::make_pair(token, std::move(watch))).first->second;
+        addPathWatches(data, watchInserted, token);
+        callbacks.insert(std::make_pair(token, callback));
+    }
+    return token;
+}
+
+void PathWatchService::removeWatch(PathWatchToken token) {
+    std::lock_guard<std::mutex> lock(callbackMutex);
+    callbacks.erase(token);
+
+    std::lock_guard<std::mutex> lockData(data->mutex);
+    auto it = data->watches.find(token);
+    if (it == data->watches.end()) {
+        return;
+    }
+    PathWatchEntry& watch = it->second;
+    removePathWatches(data, watch, token);
+    if (watch.parentWatchDesc >= 0) {
+        removeWatchDescUser(data, watch.parentWatchDesc, token, true);
+    }
+    data->watches.erase(it);
+}
+
+void PathWatchService::setDebounceTimeMs(uint32_t timeMs) {
+    std::lock_guard<std::mutex> lock(data->mutex);
+    data->debounceTimeMs = timeMs;
+}
+
+}
+
+#else
+
+namespace sgl {
+
+struct PathWatchServiceImplData {};
+
+PathWatchService::PathWatchService() = default;
+PathWatchService::~PathWatchService() = default;
+
+bool PathWatchService::getIsSupported() const {
+    return false;
+}
+
+PathWatchToken PathWatchService::addWatch(
+        const std::string& path, bool isFolder, bool isRecursive, const PathChangedCallback& callback,
+        bool reportFileWrites) {
+    sgl::Logfile::get()->writeWarning(
+            "Warning in PathWatchService::addWatch: The path watch service is not supported on this platform.",
+            false);
+    return 0;
+}
+
+void PathWatchService::removeWatch(PathWatchToken token) {
+}
+
+void PathWatchService::setDebounceTimeMs(uint32_t timeMs) {
+}
+
+}
+
+#endif
+
+namespace sgl {
+
+void PathWatchService::onPathChangedEvent(const EventPtr& event) {
+    auto* pathChangedEvent = static_cast<PathChangedEvent*>(event.get());
+    PathChangedCallback callback;
+    {
+        // The watch may have been removed after the event was queued.
+        std::lock_guard<std::mutex> lock(callbackMutex);
+        auto it = callbacks.find(pathChangedEvent->getToken());
+        if (it == callbacks.end()) {
+            return;
+        }
+        callback = it->second;
+    }
+    callback(pathChangedEvent->getChangedPaths());
+}
+
+}
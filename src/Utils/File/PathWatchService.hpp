@@ -0,0 +1,108 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_PATHWATCHSERVICE_HPP
+#define SGL_PATHWATCHSERVICE_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+
+#include <Utils/Singleton.hpp>
+#include <Utils/Events/EventManager.hpp>
+
+namespace sgl {
+
+typedef uint32_t PathWatchToken;
+typedef std::function<void(const std::vector<std::string>& changedPaths)> PathChangedCallback;
+
+const uint32_t PATH_CHANGED_EVENT = 3106544929U;
+
+/// Queued by @see PathWatchService when a watched path has changed.
+class DLL_OBJECT PathChangedEvent : public Event {
+public:
+    PathChangedEvent(PathWatchToken token, std::vector<std::string> changedPaths)
+            : Event(PATH_CHANGED_EVENT), token(token), changedPaths(std::move(changedPaths)) {}
+    [[nodiscard]] inline PathWatchToken getToken() const { return token; }
+    [[nodiscard]] inline const std::vector<std::string>& getChangedPaths() const { return changedPaths; }
+
+private:
+    PathWatchToken token;
+    std::vector<std::string> changedPaths;
+};
+
+struct PathWatchServiceImplData;
+
+/**
+ * Background service watching files and directories for changes. On Linux, all watches are multiplexed over one
+ * inotify file descriptor, which is waited on by one epoll-driven thread, so no system calls are necessary per frame.
+ * Bursts of events (e.g., editors writing a file in several steps) are coalesced within a debounce window, and the
+ * callbacks are dispatched on the main thread via @see PATH_CHANGED_EVENT by @see EventManager::update.
+ *
+ * Like @see PathWatch, the parent directory of a watched path is also watched, so a path that is deleted and then
+ * recreated is noticed. Directories can optionally be watched recursively, including newly created subdirectories.
+ */
+class DLL_OBJECT PathWatchService : public Singleton<PathWatchService> {
+public:
+    PathWatchService();
+    ~PathWatchService() override;
+
+    /**
+     * Adds a watch.
+     * @param path The path of the file or directory to watch.
+     * @param isFolder Is 'path' pointing to a folder or file?
+     * @param isRecursive Whether to also watch all subdirectories of a folder.
+     * @param callback Called on the main thread with the paths that have changed within the debounce window.
+     * @param reportFileWrites Whether writes to the files in a watched folder are also reported. By default, only
+     * changes of the folder content (i.e., created, deleted or renamed entries) are reported for folders.
+     * @return A token for removing the watch, or 0 if watching is not supported on this platform.
+     */
+    PathWatchToken addWatch(
+            const std::string& path, bool isFolder, bool isRecursive, const PathChangedCallback& callback,
+            bool reportFileWrites = false);
+    void removeWatch(PathWatchToken token);
+
+    /// Sets the time without new events after which the accumulated changes of a watch are dispatched.
+    void setDebounceTimeMs(uint32_t timeMs);
+    [[nodiscard]] bool getIsSupported() const;
+
+private:
+    void onPathChangedEvent(const EventPtr& event);
+
+    PathWatchServiceImplData* data = nullptr;
+    std::mutex callbackMutex;
+    std::map<PathWatchToken, PathChangedCallback> callbacks;
+    bool isListenerRegistered = false;
+};
+
+}
+
+#endif //SGL_PATHWATCHSERVICE_HPP
@@ -27,6 +27,7 @@
  */
 
 #include <atomic>
+#include <mutex>
 #include <algorithm>
 #include <cmath>
 
@@ -37,6 +38,7 @@
 #endif
 
 #include <Utils/File/Logfile.hpp>
+#include <Math/half/half.hpp>
 #include "Reduction.hpp"
 #include "Histogram.hpp"
 
@@ -274,6 +276,148 @@ void computeHistogramUnormShort(
 
 
 
+void computeHistogramHalfFloat(
+        std::vector<float>& histogram, int histogramResolution,
+        const HalfFloat* values, size_t numValues, float minVal, float maxVal) {
+    computeHistogramStrided(
+            histogram, histogramResolution, ScalarDataFormat::FLOAT16, values, numValues, 1, minVal, maxVal);
+}
+
+void computeHistogramHalfFloat(
+        std::vector<float>& histogram, int histogramResolution,
+        const HalfFloat* values, size_t numValues) {
+    auto [minVal, maxVal] = sgl::reduceHalfFloatArrayMinMax(values, numValues);
+    computeHistogramHalfFloat(histogram, histogramResolution, values, numValues, minVal, maxVal);
+}
+
+
+template<class T>
+inline float loadHistogramValue(const T* values, size_t valIdx) {
+    if constexpr (std::is_same<T, uint8_t>()) {
+        return float(values[valIdx]) / 255.0f;
+    } else if constexpr (std::is_same<T, uint16_t>()) {
+        return float(values[valIdx]) / 65535.0f;
+    } else {
+        return float(values[valIdx]);
+    }
+}
+
+template<class T>
+bool computeHistogramCountsTemplated(
+        std::vector<uint64_t>& histogramCounts, int histogramResolution,
+        const T* values, size_t numValues, size_t stride, float minVal, float maxVal,
+        const std::atomic<bool>* cancelFlag) {
+    // The samples are processed in blocks, so that the cancel flag only needs to be checked once per block.
+    const size_t blockSize = 1 << 16;
+    const size_t numSamples = (numValues + stride - 1) / stride;
+    const size_t numBlocks = (numSamples + blockSize - 1) / blockSize;
+    const float binScale = maxVal > minVal ? float(histogramResolution) / (maxVal - minVal) : 0.0f;
+    const float maxBin = float(histogramResolution - 1);
+
+    // Each thread counts into a local histogram, which is merged into the global one at the end.
+    histogramCounts.clear();
+    histogramCounts.resize(histogramResolution, 0);
+    std::mutex mergeMutex;
+    auto countBlock = [&](size_t blockIdx, std::vector<uint64_t>& localCounts) {
+        if (cancelFlag && cancelFlag->load(std::memory_order_relaxed)) {
+            return;
+        }
+        const size_t sampleIdxEnd = std::min((blockIdx + 1) * blockSize, numSamples);
+        for (size_t sampleIdx = blockIdx * blockSize; sampleIdx < sampleIdxEnd; sampleIdx++) {
+            float value = loadHistogramValue(values, sampleIdx * stride);
+            if (std::isnan(value)) {
+                continue;
+            }
+            // Clamping in floating point avoids undefined behavior for values far outside of the range.
+            float bin = std::clamp((value - minVal) * binScale, 0.0f, maxBin);
+            localCounts[int(bin)]++;
+        }
+    };
+    auto mergeCounts = [&](const std::vector<uint64_t>& localCounts) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+            histogramCounts[histIdx] += localCounts[histIdx];
+        }
+    };
+
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), [&](auto const& r) {
+        std::vector<uint64_t> localCounts(histogramResolution, 0);
+        for (auto blockIdx = r.begin(); blockIdx != r.end(); blockIdx++) {
+            countBlock(blockIdx, localCounts);
+        }
+        mergeCounts(localCounts);
+    });
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel shared(numBlocks, histogramResolution, countBlock, mergeCounts) default(none)
+#endif
+    {
+        std::vector<uint64_t> localCounts(histogramResolution, 0);
+#if _OPENMP >= 201107
+        #pragma omp for
+#endif
+        for (size_t blockIdx = 0; blockIdx < numBlocks; blockIdx++) {
+            countBlock(blockIdx, localCounts);
+        }
+        mergeCounts(localCounts);
+    }
+#endif
+
+    return !cancelFlag || !cancelFlag->load();
+}
+
+bool computeHistogramCounts(
+        std::vector<uint64_t>& histogramCounts, int histogramResolution, ScalarDataFormat format,
+        const void* values, size_t numValues, size_t stride, float minVal, float maxVal,
+        const std::atomic<bool>* cancelFlag) {
+    stride = std::max(stride, size_t(1));
+    if (format == ScalarDataFormat::FLOAT) {
+        return computeHistogramCountsTemplated(
+                histogramCounts, histogramResolution, static_cast<const float*>(values), numValues, stride,
+                minVal, maxVal, cancelFlag);
+    } else if (format == ScalarDataFormat::BYTE) {
+        return computeHistogramCountsTemplated(
+                histogramCounts, histogramResolution, static_cast<const uint8_t*>(values), numValues, stride,
+                minVal, maxVal, cancelFlag);
+    } else if (format == ScalarDataFormat::SHORT) {
+        return computeHistogramCountsTemplated(
+                histogramCounts, histogramResolution, static_cast<const uint16_t*>(values), numValues, stride,
+                minVal, maxVal, cancelFlag);
+    } else if (format == ScalarDataFormat::FLOAT16) {
+        return computeHistogramCountsTemplated(
+                histogramCounts, histogramResolution, static_cast<const HalfFloat*>(values), numValues, stride,
+                minVal, maxVal, cancelFlag);
+    } else {
+        Logfile::get()->throwError("Error in computeHistogramCounts: Unsupported scalar data format.");
+        return false;
+    }
+}
+
+bool computeHistogramStrided(
+        std::vector<float>& histogram, int histogramResolution, ScalarDataFormat format,
+        const void* values, size_t numValues, size_t stride, float minVal, float maxVal,
+        const std::atomic<bool>* cancelFlag) {
+    std::vector<uint64_t> histogramCounts;
+    if (!computeHistogramCounts(
+            histogramCounts, histogramResolution, format, values, numValues, stride, minVal, maxVal, cancelFlag)) {
+        return false;
+    }
+
+    // Normalize values of histogram.
+    uint64_t histogramMax = 0;
+    for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+        histogramMax = std::max(histogramMax, histogramCounts[histIdx]);
+    }
+    histogram.resize(histogramResolution);
+    for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+        histogram[histIdx] = histogramMax > 0 ? float(double(histogramCounts[histIdx]) / double(histogramMax)) : 0.0f;
+    }
+    return true;
+}
+
+
+
 template<class Tx, class Ty>
 void computeHistogram2dTemplated(
         std::vector<float>& histogram, int histogramResolution,
@@ -30,8 +30,12 @@
 #define SGL_HISTOGRAM_HPP
 
 #include <vector>
+#include <atomic>
+#include <cstdint>
 #include <Utils/SciVis/ScalarDataFormat.hpp>
 
+class HalfFloat;
+
 namespace sgl {
 
 DLL_OBJECT void computeHistogram(
@@ -52,6 +56,33 @@ DLL_OBJECT void computeHistogramUnormShort(
 DLL_OBJECT void computeHistogramUnormShort(
         std::vector<float>& histogram, int histogramResolution, const uint16_t* values, size_t numValues);
 
+// For half float / float16 data.
+DLL_OBJECT void computeHistogramHalfFloat(
+        std::vector<float>& histogram, int histogramResolution,
+        const HalfFloat* values, size_t numValues, float minVal, float maxVal);
+DLL_OBJECT void computeHistogramHalfFloat(
+        std::vector<float>& histogram, int histogramResolution, const HalfFloat* values, size_t numValues);
+
+/**
+ * Computes the histogram of data of an arbitrary scalar format while only considering every stride-th value.
+ * A stride larger than one can be used for quickly computing a preview of the histogram of very large data sets.
+ * In contrast to the functions above, the bin counts are 64-bit, so more than 2^31 values may fall into one bin.
+ * @param cancelFlag Optional flag that can be set by another thread to abort the computation.
+ * @return False if the computation was cancelled. In this case, 'histogram' is left unchanged.
+ */
+DLL_OBJECT bool computeHistogramStrided(
+        std::vector<float>& histogram, int histogramResolution, ScalarDataFormat format,
+        const void* values, size_t numValues, size_t stride, float minVal, float maxVal,
+        const std::atomic<bool>* cancelFlag = nullptr);
+
+/**
+ * Same as @see computeHistogramStrided, but returns the unnormalized number of values per bin.
+ */
+DLL_OBJECT bool computeHistogramCounts(
+        std::vector<uint64_t>& histogramCounts, int histogramResolution, ScalarDataFormat format,
+        const void* values, size_t numValues, size_t stride, float minVal, float maxVal,
+        const std::atomic<bool>* cancelFlag = nullptr);
+
 // For 2D histograms.
 DLL_OBJECT void computeHistogram2d(
         std::vector<float>& histogram2d, int histogramResolution,
@@ -0,0 +1,136 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Histogram.hpp"
+#include "HistogramSummary.hpp"
+
+namespace sgl {
+
+bool HistogramSummary::build(
+        ScalarDataFormat format, const void* values, size_t numValues, float minVal, float maxVal,
+        int numFineBins, const std::atomic<bool>* cancelFlag) {
+    reset();
+    std::vector<uint64_t> fineCounts;
+    if (!computeHistogramCounts(
+            fineCounts, numFineBins, format, values, numValues, 1, minVal, maxVal, cancelFlag)) {
+        return false;
+    }
+    minValue = minVal;
+    maxValue = maxVal;
+    prefixSums.resize(numFineBins + 1);
+    prefixSums[0] = 0;
+    for (int binIdx = 0; binIdx < numFineBins; binIdx++) {
+        prefixSums[binIdx + 1] = prefixSums[binIdx] + fineCounts[binIdx];
+    }
+    return true;
+}
+
+void HistogramSummary::reset() {
+    prefixSums.clear();
+    minValue = 0.0f;
+    maxValue = 0.0f;
+}
+
+double HistogramSummary::estimateNumValuesBelow(double value, double& maxError) const {
+    const int numFineBins = getNumFineBins();
+    maxError = 0.0;
+    if (!(maxValue > minValue)) {
+        // All values were counted in the first fine bin.
+        return value > double(minValue) ? double(prefixSums.back()) : 0.0;
+    }
+    double binPosition = (value - double(minValue)) / (double(maxValue) - double(minValue)) * double(numFineBins);
+    if (binPosition <= 0.0) {
+        return 0.0;
+    }
+    if (binPosition >= double(numFineBins)) {
+        return double(prefixSums.back());
+    }
+    auto binIdx = int(binPosition);
+    double fraction = binPosition - double(binIdx);
+    auto binCount = double(prefixSums[binIdx + 1] - prefixSums[binIdx]);
+    // The values of the straddled fine bin may lie anywhere within it.
+    if (fraction > 0.0) {
+        maxError = std::max(fraction, 1.0 - fraction) * binCount;
+    }
+    return double(prefixSums[binIdx]) + fraction * binCount;
+}
+
+float HistogramSummary::computeHistogram(
+        std::vector<float>& histogram, int histogramResolution, float minVal, float maxVal,
+        std::vector<float>* errorBounds) const {
+    std::vector<double> binCounts(histogramResolution, 0.0);
+    std::vector<double> binErrors(histogramResolution, 0.0);
+    if (!getIsEmpty()) {
+        if (maxVal > minVal) {
+            // The first and last bin are unbounded, like with the clamping in @see computeHistogram.
+            double lowerError = 0.0;
+            double lowerCount = 0.0;
+            for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+                double upperError = 0.0;
+                double upperCount = double(prefixSums.back());
+                if (histIdx + 1 < histogramResolution) {
+                    double upperEdge =
+                            double(minVal) + double(maxVal - minVal) * double(histIdx + 1) / double(histogramResolution);
+                    upperCount = estimateNumValuesBelow(upperEdge, upperError);
+                }
+                binCounts[histIdx] = std::max(upperCount - lowerCount, 0.0);
+                binErrors[histIdx] = lowerError + upperError;
+                lowerCount = upperCount;
+                lowerError = upperError;
+            }
+        } else {
+            binCounts[0] = double(prefixSums.back());
+        }
+    }
+
+    // Normalize values of histogram.
+    double histogramMax = 0.0;
+    for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+        histogramMax = std::max(histogramMax, binCounts[histIdx]);
+    }
+    double normalizationFactor = histogramMax > 0.0 ? 1.0 / histogramMax : 0.0;
+    float maxErrorBound = 0.0f;
+    histogram.resize(histogramResolution);
+    if (errorBounds) {
+        errorBounds->resize(histogramResolution);
+    }
+    for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+        histogram[histIdx] = float(binCounts[histIdx] * normalizationFactor);
+        auto errorBound = float(binErrors[histIdx] * normalizationFactor);
+        maxErrorBound = std::max(maxErrorBound, errorBound);
+        if (errorBounds) {
+            (*errorBounds)[histIdx] = errorBound;
+        }
+    }
+    return maxErrorBound;
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_HISTOGRAMSUMMARY_HPP
+#define SGL_HISTOGRAMSUMMARY_HPP
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <Utils/SciVis/ScalarDataFormat.hpp>
+
+namespace sgl {
+
+/**
+ * One-time summary of the value distribution of a scalar data set, from which histograms of arbitrary sub-ranges and
+ * resolutions can be derived without scanning the data again. The summary stores the prefix sums of a fine-grained
+ * histogram over the data range, so a derived histogram costs O(histogramResolution) instead of O(numValues).
+ *
+ * The values within a fine bin are assumed to be distributed uniformly. Derived bins whose edges do not coincide with
+ * fine bin edges thus have an error, which is bounded by the number of values in the straddled fine bins.
+ */
+class DLL_OBJECT HistogramSummary {
+public:
+    static constexpr int DEFAULT_NUM_FINE_BINS = 65536;
+    /// Error bound (relative to the largest bin) below which derived histograms are accurate enough for GUI plots.
+    static constexpr float DEFAULT_MAX_ERROR_BOUND = 0.01f;
+
+    /**
+     * Builds the summary. Values outside of [minVal, maxVal] are counted in the first or last fine bin.
+     * @param cancelFlag Optional flag that can be set by another thread to abort building the summary.
+     * @return False if building was cancelled. In this case, the summary is empty.
+     */
+    bool build(
+            ScalarDataFormat format, const void* values, size_t numValues, float minVal, float maxVal,
+            int numFineBins = DEFAULT_NUM_FINE_BINS, const std::atomic<bool>* cancelFlag = nullptr);
+    void reset();
+    [[nodiscard]] inline bool getIsEmpty() const { return prefixSums.empty(); }
+    [[nodiscard]] inline int getNumFineBins() const { return int(prefixSums.size()) - 1; }
+    [[nodiscard]] inline uint64_t getNumValues() const { return prefixSums.empty() ? 0 : prefixSums.back(); }
+    [[nodiscard]] inline float getMinValue() const { return minValue; }
+    [[nodiscard]] inline float getMaxValue() const { return maxValue; }
+
+    /**
+     * Derives a histogram normalized like the one of @see computeHistogram, i.e., values outside of [minVal, maxVal]
+     * are counted in the first or last bin, and the largest bin has the value one.
+     * @param errorBounds If not null, receives the maximum absolute error of each bin (in normalized units).
+     * @return The maximum error bound over all bins.
+     */
+    float computeHistogram(
+            std::vector<float>& histogram, int histogramResolution, float minVal, float maxVal,
+            std::vector<float>* errorBounds = nullptr) const;
+
+private:
+    /// Estimates the number of values smaller than 'value' and returns the maximum error of the estimate.
+    double estimateNumValuesBelow(double value, double& maxError) const;
+
+    std::vector<uint64_t> prefixSums; ///< prefixSums[i] is the number of values in the fine bins [0, i).
+    float minValue = 0.0f;
+    float maxValue = 0.0f;
+};
+
+}
+
+#endif //SGL_HISTOGRAMSUMMARY_HPP
@@ -27,15 +27,23 @@
  */
 
 #include <limits>
+#include <algorithm>
 #include <cstddef>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_REDUCTION_USE_SSE2
+#endif
+
 #ifdef USE_TBB
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 #include <tbb/blocked_range.h>
 #endif
 
+#include <Math/Math.hpp>
 #include <Math/half/half.hpp>
+#include <Math/half/HalfFloatSimd.hpp>
 #include <Math/Geometry/AABB2.hpp>
 #include <Math/Geometry/AABB3.hpp>
 #include "Reduction.hpp"
@@ -44,63 +52,102 @@ namespace sgl {
 
 std::pair<float, float> reduceFloatArrayMinMax(
         const std::vector<float>& floatValues, std::pair<float, float> init) {
-#ifdef USE_TBB
-
-    return tbb::parallel_reduce(
-            tbb::blocked_range<size_t>(0, floatValues.size()), init,
-            [&floatValues](tbb::blocked_range<size_t> const& r, std::pair<float, float> init) {
-                for (auto i = r.begin(); i != r.end(); i++) {
-                    float value = floatValues.at(i);
-                    init.first = std::min(init.first, value);
-                    init.second = std::max(init.second, value);
-                }
-                return init;
-            }, &reductionFunctionFloatMinMax);
-
-#else
+    return reduceFloatArrayMinMax(floatValues.data(), floatValues.size(), init);
+}
 
-    float minValue = std::numeric_limits<float>::max();
-    float maxValue = std::numeric_limits<float>::lowest();
-    size_t n = floatValues.size();
-#if _OPENMP >= 201107
-    #pragma omp parallel for shared(floatValues, n) reduction(min: minValue) reduction(max: maxValue) \
-    default(none)
+/*
+ * The float and half float reductions are vectorized within chunks of REDUCTION_CHUNK_SIZE values, which are
+ * distributed over the threads. NaN values are ignored like by the scalar std::min/std::max loops (_mm_min_ps and
+ * _mm_max_ps return the second operand, i.e., the accumulator, if one of the operands is NaN).
+ */
+static const size_t REDUCTION_CHUNK_SIZE = 65536;
+
+static void reduceFloatRangeMinMax(const float* values, size_t begin, size_t end, float& minValue, float& maxValue) {
+    size_t i = begin;
+#ifdef SGL_REDUCTION_USE_SSE2
+    if (end - begin >= 8) {
+        __m128 minValues0 = _mm_set1_ps(minValue), minValues1 = minValues0;
+        __m128 maxValues0 = _mm_set1_ps(maxValue), maxValues1 = maxValues0;
+        for (; i + 8 <= end; i += 8) {
+            __m128 values0 = _mm_loadu_ps(values + i);
+            __m128 values1 = _mm_loadu_ps(values + i + 4);
+            minValues0 = _mm_min_ps(values0, minValues0);
+            minValues1 = _mm_min_ps(values1, minValues1);
+            maxValues0 = _mm_max_ps(values0, maxValues0);
+            maxValues1 = _mm_max_ps(values1, maxValues1);
+        }
+        alignas(16) float minArray[4], maxArray[4];
+        _mm_store_ps(minArray, _mm_min_ps(minValues0, minValues1));
+        _mm_store_ps(maxArray, _mm_max_ps(maxValues0, maxValues1));
+        for (int j = 0; j < 4; j++) {
+            minValue = std::min(minValue, minArray[j]);
+            maxValue = std::max(maxValue, maxArray[j]);
+        }
+    }
 #endif
-    for (size_t i = 0; i < n; i++) {
-        minValue = std::min(minValue, floatValues.at(i));
-        maxValue = std::max(maxValue, floatValues.at(i));
+    for (; i < end; i++) {
+        minValue = std::min(minValue, values[i]);
+        maxValue = std::max(maxValue, values[i]);
     }
-    return std::make_pair(minValue, maxValue);
+}
 
+static void reduceHalfFloatRangeMinMax(
+        const HalfFloat* values, size_t begin, size_t end, float& minValue, float& maxValue) {
+    size_t i = begin;
+#ifdef SGL_HALF_FLOAT_USE_SSE2
+    if (end - begin >= 8) {
+        __m128 minValues0 = _mm_set1_ps(minValue), minValues1 = minValues0;
+        __m128 maxValues0 = _mm_set1_ps(maxValue), maxValues1 = maxValues0;
+        __m128 values0, values1;
+        for (; i + 8 <= end; i += 8) {
+            loadHalfFloat8Sse2(values + i, values0, values1);
+            minValues0 = _mm_min_ps(values0, minValues0);
+            minValues1 = _mm_min_ps(values1, minValues1);
+            maxValues0 = _mm_max_ps(values0, maxValues0);
+            maxValues1 = _mm_max_ps(values1, maxValues1);
+        }
+        alignas(16) float minArray[4], maxArray[4];
+        _mm_store_ps(minArray, _mm_min_ps(minValues0, minValues1));
+        _mm_store_ps(maxArray, _mm_max_ps(maxValues0, maxValues1));
+        for (int j = 0; j < 4; j++) {
+            minValue = std::min(minValue, minArray[j]);
+            maxValue = std::max(maxValue, maxArray[j]);
+        }
+    }
 #endif
+    for (; i < end; i++) {
+        auto value = float(values[i]);
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+    }
 }
 
 std::pair<float, float> reduceFloatArrayMinMax(
         const float* floatValues, size_t N, std::pair<float, float> init) {
+    const size_t numChunks = sizeceil(N, REDUCTION_CHUNK_SIZE);
 #ifdef USE_TBB
 
     return tbb::parallel_reduce(
-            tbb::blocked_range<size_t>(0, N), init,
-            [&floatValues](tbb::blocked_range<size_t> const& r, std::pair<float, float> init) {
-                for (auto i = r.begin(); i != r.end(); i++) {
-                    float value = floatValues[i];
-                    init.first = std::min(init.first, value);
-                    init.second = std::max(init.second, value);
-                }
+            tbb::blocked_range<size_t>(0, numChunks), init,
+            [&floatValues, N](tbb::blocked_range<size_t> const& r, std::pair<float, float> init) {
+                size_t begin = r.begin() * REDUCTION_CHUNK_SIZE;
+                size_t end = std::min(r.end() * REDUCTION_CHUNK_SIZE, N);
+                reduceFloatRangeMinMax(floatValues, begin, end, init.first, init.second);
                 return init;
             }, &reductionFunctionFloatMinMax);
 
 #else
 
-    float minValue = std::numeric_limits<float>::max();
-    float maxValue = std::numeric_limits<float>::lowest();
+    float minValue = init.first;
+    float maxValue = init.second;
 #if _OPENMP >= 201107
-    #pragma omp parallel for shared(floatValues, N) reduction(min: minValue) reduction(max: maxValue) \
+    #pragma omp parallel for shared(floatValues, N, numChunks) reduction(min: minValue) reduction(max: maxValue) \
     default(none)
 #endif
-    for (size_t i = 0; i < N; i++) {
-        minValue = std::min(minValue, floatValues[i]);
-        maxValue = std::max(maxValue, floatValues[i]);
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+        size_t begin = chunkIdx * size_t(REDUCTION_CHUNK_SIZE);
+        size_t end = std::min(begin + size_t(REDUCTION_CHUNK_SIZE), N);
+        reduceFloatRangeMinMax(floatValues, begin, end, minValue, maxValue);
     }
     return std::make_pair(minValue, maxValue);
 
@@ -175,31 +222,30 @@ std::pair<float, float> reduceUnormShortArrayMinMax(
 
 std::pair<float, float> reduceHalfFloatArrayMinMax(
         const HalfFloat* values, size_t N, std::pair<float, float> init) {
+    const size_t numChunks = sizeceil(N, REDUCTION_CHUNK_SIZE);
 #ifdef USE_TBB
 
     return tbb::parallel_reduce(
-            tbb::blocked_range<size_t>(0, N), init,
-            [&values](tbb::blocked_range<size_t> const& r, std::pair<float, float> init) {
-                for (auto i = r.begin(); i != r.end(); i++) {
-                    auto value = float(values[i]);
-                    init.first = std::min(init.first, value);
-                    init.second = std::max(init.second, value);
-                }
+            tbb::blocked_range<size_t>(0, numChunks), init,
+            [&values, N](tbb::blocked_range<size_t> const& r, std::pair<float, float> init) {
+                size_t begin = r.begin() * REDUCTION_CHUNK_SIZE;
+                size_t end = std::min(r.end() * REDUCTION_CHUNK_SIZE, N);
+                reduceHalfFloatRangeMinMax(values, begin, end, init.first, init.second);
                 return init;
             }, &reductionFunctionFloatMinMax);
 
 #else
 
-    float minValue = std::numeric_limits<float>::max();
-    float maxValue = std::numeric_limits<float>::lowest();
+    float minValue = init.first;
+    float maxValue = init.second;
 #if _OPENMP >= 201107
-    #pragma omp parallel for shared(values, N) reduction(min: minValue) reduction(max: maxValue) \
+    #pragma omp parallel for shared(values, N, numChunks) reduction(min: minValue) reduction(max: maxValue) \
     default(none)
 #endif
-    for (size_t i = 0; i < N; i++) {
-        auto val = float(values[i]);
-        minValue = std::min(minValue, val);
-        maxValue = std::max(maxValue, val);
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+        size_t begin = chunkIdx * size_t(REDUCTION_CHUNK_SIZE);
+        size_t end = std::min(begin + size_t(REDUCTION_CHUNK_SIZE), N);
+        reduceHalfFloatRangeMinMax(values, begin, end, minValue, maxValue);
     }
     return std::make_pair(minValue, maxValue);
 
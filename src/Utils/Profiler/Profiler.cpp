@@ -0,0 +1,429 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <unordered_map>
+#include <cmath>
+
+#include <Utils/File/Logfile.hpp>
+#include "Profiler.hpp"
+
+namespace sgl {
+
+/**
+ * Lock-free single-producer/single-consumer ring buffer. The producer is the thread owning the buffer, the consumer
+ * is the thread calling Profiler::collect (serialized by Profiler::collectMutex).
+ */
+class ProfilerThreadBuffer {
+public:
+    ProfilerThreadBuffer(size_t capacity, uint32_t threadIdx) : threadIdx(threadIdx) {
+        size_t capacityPow2 = 1;
+        while (capacityPow2 < capacity) {
+            capacityPow2 <<= 1;
+        }
+        events.resize(capacityPow2);
+        mask = capacityPow2 - 1;
+    }
+
+    inline void push(const ProfilerEvent& event) {
+        size_t headLocal = head.load(std::memory_order_relaxed);
+        if (headLocal - tail.load(std::memory_order_acquire) > mask) {
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[headLocal & mask] = event;
+        head.store(headLocal + 1, std::memory_order_release);
+    }
+
+    void drain(std::vector<ProfilerEvent>& eventsOut) {
+        size_t tailLocal = tail.load(std::memory_order_relaxed);
+        size_t headLocal = head.load(std::memory_order_acquire);
+        eventsOut.reserve(eventsOut.size() + (headLocal - tailLocal));
+        for (size_t idx = tailLocal; idx != headLocal; idx++) {
+            eventsOut.push_back(events[idx & mask]);
+        }
+        tail.store(headLocal, std::memory_order_release);
+    }
+
+    [[nodiscard]] inline uint64_t getNumDropped() const { return numDropped.load(std::memory_order_relaxed); }
+    [[nodiscard]] inline uint32_t getThreadIdx() const { return threadIdx; }
+    /// Called by the owning thread on exit. Its events pushed before are visible to the consumer afterwards.
+    inline void retire() { isRetired.store(true, std::memory_order_release); }
+    [[nodiscard]] inline bool getIsRetired() const { return isRetired.load(std::memory_order_acquire); }
+    std::string threadName; ///< Protected by Profiler::threadBufferMutex.
+
+private:
+    uint32_t threadIdx;
+    std::vector<ProfilerEvent> events;
+    size_t mask = 0;
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    alignas(64) std::atomic<uint64_t> numDropped{0};
+    std::atomic<bool> isRetired{false};
+};
+
+namespace {
+/// Keeps the buffer of the thread alive until the thread exits, even if the profiler is destroyed before.
+struct ProfilerThreadBufferHandle {
+    ~ProfilerThreadBufferHandle() {
+        if (buffer) {
+            buffer->retire();
+        }
+    }
+    uint64_t profilerInstanceId = 0;
+    std::shared_ptr<ProfilerThreadBuffer> buffer;
+};
+thread_local ProfilerThreadBufferHandle threadBufferHandle;
+std::atomic<uint64_t> profilerInstanceCounter{0};
+}
+
+Profiler::Profiler() : instanceId(++profilerInstanceCounter) {
+    epoch = std::chrono::steady_clock::now();
+    frameZoneId = registerZone("Frame");
+}
+
+Profiler::~Profiler() = default;
+
+uint32_t& Profiler::threadDepth() {
+    static thread_local uint32_t depth = 0;
+    return depth;
+}
+
+void Profiler::setThreadBufferCapacity(size_t capacity) {
+    threadBufferCapacity.store(std::max(capacity, size_t(16)), std::memory_order_relaxed);
+}
+
+ProfilerThreadBuffer* Profiler::getThreadBuffer() {
+    ProfilerThreadBufferHandle& handle = threadBufferHandle;
+    if (handle.profilerInstanceId != instanceId) {
+        if (handle.buffer) {
+            // The buffer belongs to a different profiler.
+            handle.buffer->retire();
+        }
+        std::lock_guard<std::mutex> lock(threadBufferMutex);
+        handle.buffer = std::make_shared<ProfilerThreadBuffer>(
+                threadBufferCapacity.load(std::memory_order_relaxed), nextThreadIdx++);
+        threadBuffers.push_back(handle.buffer);
+        handle.profilerInstanceId = instanceId;
+    }
+    return handle.buffer.get();
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ProfilerThreadBuffer* buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(threadBufferMutex);
+    buffer->threadName = name;
+}
+
+ProfilerZoneId Profiler::registerZone(const char* name, const char* file, int line) {
+    std::lock_guard<std::mutex> lock(zoneMutex);
+    auto zoneId = ProfilerZoneId(zones.size());
+    ProfilerZoneInfo zoneInfo;
+    zoneInfo.name = name;
+    zoneInfo.file = file;
+    zoneInfo.line = line;
+    zones.push_back(zoneInfo);
+    return zoneId;
+}
+
+ProfilerZoneInfo Profiler::getZoneInfo(ProfilerZoneId zoneId) {
+    std::lock_guard<std::mutex> lock(zoneMutex);
+    if (zoneId >= zones.size()) {
+        Logfile::get()->throwError("Error in Profiler::getZoneInfo: Invalid zone ID.");
+    }
+    return zones.at(zoneId);
+}
+
+size_t Profiler::getNumZones() {
+    std::lock_guard<std::mutex> lock(zoneMutex);
+    return zones.size();
+}
+
+void Profiler::recordEvent(ProfilerZoneId zoneId, uint64_t beginNs, uint64_t endNs, uint32_t depth) {
+    ProfilerEvent event{};
+    event.beginNs = beginNs;
+    event.endNs = endNs;
+    event.zoneId = zoneId;
+    event.depth = depth;
+    getThreadBuffer()->push(event);
+}
+
+void Profiler::markFrame() {
+    uint64_t frameEndNs = now();
+    uint64_t frameBeginNs = lastFrameNs.exchange(frameEndNs, std::memory_order_relaxed);
+    if (frameBeginNs != 0 && getIsEnabled()) {
+        recordEvent(frameZoneId, frameBeginNs, frameEndNs, 0);
+    }
+}
+
+void Profiler::collect() {
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> threadBuffersLocal;
+    std::vector<std::string> threadNames;
+    {
+        std::lock_guard<std::mutex> lock(threadBufferMutex);
+        threadBuffersLocal = threadBuffers;
+        for (auto& threadBuffer : threadBuffersLocal) {
+            threadNames.push_back(threadBuffer->threadName);
+        }
+    }
+
+    // Buffers that were retired before draining them hold no more events afterwards and can be released.
+    std::vector<ProfilerThreadBuffer*> retiredThreadBuffers;
+    {
+        std::lock_guard<std::mutex> lock(collectMutex);
+        for (size_t i = 0; i < threadBuffersLocal.size(); i++) {
+            auto& threadBuffer = threadBuffersLocal.at(i);
+            if (threadBuffer->getIsRetired()) {
+                retiredThreadBuffers.push_back(threadBuffer.get());
+            }
+            // The thread indices are increasing, so the event lists stay sorted by them.
+            uint32_t threadIdx = threadBuffer->getThreadIdx();
+            auto it = std::lower_bound(
+                    collectedEvents.begin(), collectedEvents.end(), threadIdx,
+                    [](const ProfilerThreadEvents& threadEvents, uint32_t idx) {
+                        return threadEvents.threadIdx < idx;
+                    });
+            if (it == collectedEvents.end() || it->threadIdx != threadIdx) {
+                it = collectedEvents.insert(it, ProfilerThreadEvents());
+                it->threadIdx = threadIdx;
+            }
+            it->threadName = threadNames.at(i);
+            threadBuffer->drain(it->events);
+        }
+    }
+
+    if (!retiredThreadBuffers.empty()) {
+        std::lock_guard<std::mutex> lock(threadBufferMutex);
+        for (ProfilerThreadBuffer* threadBuffer : retiredThreadBuffers) {
+            numDroppedEventsReleased += threadBuffer->getNumDropped();
+        }
+        threadBuffers.erase(std::remove_if(threadBuffers.begin(), threadBuffers.end(), [&](const auto& threadBuffer) {
+            return std::find(retiredThreadBuffers.begin(), retiredThreadBuffers.end(), threadBuffer.get())
+                    != retiredThreadBuffers.end();
+        }), threadBuffers.end());
+    }
+}
+
+void Profiler::clear() {
+    // The event lists of live threads are recreated by the next call of collect.
+    std::lock_guard<std::mutex> lock(collectMutex);
+    collectedEvents.clear();
+}
+
+uint64_t Profiler::getNumDroppedEvents() {
+    std::lock_guard<std::mutex> lock(threadBufferMutex);
+    uint64_t numDropped = numDroppedEventsReleased;
+    for (auto& threadBuffer : threadBuffers) {
+        numDropped += threadBuffer->getNumDropped();
+    }
+    return numDropped;
+}
+
+size_t Profiler::getNumThreadBuffers() {
+    std::lock_guard<std::mutex> lock(threadBufferMutex);
+    return threadBuffers.size();
+}
+
+uint64_t computePercentileSorted(const std::vector<uint64_t>& valuesSorted, double percentile) {
+    if (valuesSorted.empty()) {
+        return 0;
+    }
+    auto rank = size_t(std::ceil(percentile * double(valuesSorted.size())));
+    rank = std::clamp(rank, size_t(1), valuesSorted.size());
+    return valuesSorted.at(rank - 1);
+}
+
+static ProfilerZoneStatistics computeStatisticsFromDurations(
+        ProfilerZoneId zoneId, const std::string& name, std::vector<uint64_t>& durationsNs) {
+    ProfilerZoneStatistics stats;
+    stats.zoneId = zoneId;
+    stats.name = name;
+    stats.numSamples = durationsNs.size();
+    if (durationsNs.empty()) {
+        return stats;
+    }
+
+    std::sort(durationsNs.begin(), durationsNs.end());
+    uint64_t totalNs = 0;
+    for (uint64_t durationNs : durationsNs) {
+        totalNs += durationNs;
+        uint64_t durationUs = durationNs / 1000;
+        uint32_t bucketIdx = 0;
+        while (durationUs != 0) {
+            durationUs >>= 1;
+            bucketIdx++;
+        }
+        if (stats.histogram.size() <= bucketIdx) {
+            stats.histogram.resize(bucketIdx + 1, 0);
+        }
+        stats.histogram.at(bucketIdx)++;
+    }
+    stats.totalMs = double(totalNs) * 1e-6;
+    stats.minMs = double(durationsNs.front()) * 1e-6;
+    stats.maxMs = double(durationsNs.back()) * 1e-6;
+    stats.meanMs = stats.totalMs / double(durationsNs.size());
+    stats.medianMs = double(computePercentileSorted(durationsNs, 0.5)) * 1e-6;
+    stats.p95Ms = double(computePercentileSorted(durationsNs, 0.95)) * 1e-6;
+    stats.p99Ms = double(computePercentileSorted(durationsNs, 0.99)) * 1e-6;
+    return stats;
+}
+
+std::vector<ProfilerZoneStatistics> Profiler::computeStatistics() {
+    std::unordered_map<ProfilerZoneId, std::vector<uint64_t>> zoneDurations;
+    {
+        std::lock_guard<std::mutex> lock(collectMutex);
+        for (const auto& threadEvents : collectedEvents) {
+            for (const ProfilerEvent& event : threadEvents.events) {
+                zoneDurations[event.zoneId].push_back(event.endNs - event.beginNs);
+            }
+        }
+    }
+
+    std::vector<ProfilerZoneStatistics> statistics;
+    statistics.reserve(zoneDurations.size());
+    for (auto& entry : zoneDurations) {
+        statistics.push_back(computeStatisticsFromDurations(
+                entry.first, getZoneInfo(entry.first).name, entry.second));
+    }
+    std::sort(statistics.begin(), statistics.end(), [](const auto& a, const auto& b) {
+        return a.totalMs > b.totalMs;
+    });
+    return statistics;
+}
+
+ProfilerZoneStatistics Profiler::computeZoneStatistics(ProfilerZoneId zoneId) {
+    std::vector<uint64_t> durationsNs;
+    {
+        std::lock_guard<std::mutex> lock(collectMutex);
+        for (const auto& threadEvents : collectedEvents) {
+            for (const ProfilerEvent& event : threadEvents.events) {
+                if (event.zoneId == zoneId) {
+                    durationsNs.push_back(event.endNs - event.beginNs);
+                }
+            }
+        }
+    }
+    return computeStatisticsFromDurations(zoneId, getZoneInfo(zoneId).name, durationsNs);
+}
+
+void Profiler::printStatistics() {
+    std::vector<ProfilerZoneStatistics> statistics = computeStatistics();
+    for (const auto& stats : statistics) {
+        Logfile::get()->writeInfo(
+                "ZONE - " + stats.name + ": n=" + std::to_string(stats.numSamples)
+                + ", mean=" + std::to_string(stats.meanMs) + "ms"
+                + ", p50=" + std::to_string(stats.medianMs) + "ms"
+                + ", p95=" + std::to_string(stats.p95Ms) + "ms"
+                + ", p99=" + std::to_string(stats.p99Ms) + "ms"
+                + ", max=" + std::to_string(stats.maxMs) + "ms");
+    }
+    uint64_t numDropped = getNumDroppedEvents();
+    if (numDropped != 0) {
+        Logfile::get()->writeWarning(
+                "Warning in Profiler::printStatistics: " + std::to_string(numDropped)
+                + " events were dropped due to full thread buffers.");
+    }
+}
+
+static void writeJsonEscapedString(std::ostream& stream, const std::string& str) {
+    stream << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            const char* hexDigits = "0123456789abcdef";
+            stream << "\\u00" << hexDigits[(c >> 4) & 0xF] << hexDigits[c & 0xF];
+        } else {
+            stream << c;
+        }
+    }
+    stream << '"';
+}
+
+static void writeMicroseconds(std::ostream& stream, uint64_t timeNs) {
+    // Print with nanosecond precision without going through floating point.
+    uint64_t fraction = timeNs % 1000;
+    stream << (timeNs / 1000) << '.' << char('0' + fraction / 100) << char('0' + (fraction / 10) % 10)
+           << char('0' + fraction % 10);
+}
+
+bool Profiler::exportChromeTrace(const std::string& filename) {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        Logfile::get()->writeError(
+                "Error in Profiler::exportChromeTrace: Could not open file \"" + filename + "\".", false);
+        return false;
+    }
+
+    std::vector<std::string> zoneNames;
+    {
+        std::lock_guard<std::mutex> lock(zoneMutex);
+        for (const auto& zone : zones) {
+            zoneNames.push_back(zone.name);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(collectMutex);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool isFirst = true;
+    for (const auto& threadEvents : collectedEvents) {
+        std::string threadName = threadEvents.threadName;
+        if (threadName.empty()) {
+            threadName = "Thread " + std::to_string(threadEvents.threadIdx);
+        }
+        file << (isFirst ? "" : ",\n");
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadEvents.threadIdx
+             << ",\"args\":{\"name\":";
+        writeJsonEscapedString(file, threadName);
+        file << "}}";
+        isFirst = false;
+
+        for (const ProfilerEvent& event : threadEvents.events) {
+            file << ",\n{\"name\":";
+            writeJsonEscapedString(file, zoneNames.at(event.zoneId));
+            file << ",\"cat\":\"sgl\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadEvents.threadIdx << ",\"ts\":";
+            writeMicroseconds(file, event.beginNs);
+            file << ",\"dur\":";
+            writeMicroseconds(file, event.endNs - event.beginNs);
+            file << ",\"args\":{\"depth\":" << event.depth << "}}";
+        }
+    }
+    file << "\n]}\n";
+    file.close();
+
+    if (!file) {
+        Logfile::get()->writeError(
+                "Error in Profiler::exportChromeTrace: Writing to file \"" + filename + "\" failed.", false);
+        return false;
+    }
+    return true;
+}
+
+}
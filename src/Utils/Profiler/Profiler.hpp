@@ -0,0 +1,228 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_PROFILER_HPP
+#define SGL_PROFILER_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <Utils/Singleton.hpp>
+
+namespace sgl {
+
+/**
+ * A low-overhead hierarchical CPU profiler that is independent of Tracy (i.e., it also works when TRACY_ENABLE is
+ * not set and in headless builds).
+ *
+ * - Zones are identified by a 32-bit ID that is interned once per call site (@see SGL_PROFILE_ZONE). Recording a
+ *   zone thus neither hashes nor allocates strings.
+ * - Every thread writes its events into its own lock-free single-producer/single-consumer ring buffer. The thread
+ *   calling @see Profiler::collect is the consumer. If a ring buffer overflows, events are dropped and counted.
+ *   The buffers of exited threads are released by the first call of @see Profiler::collect after the thread exit.
+ * - Scopes may be nested arbitrarily; the nesting depth is stored with every event.
+ * - Collected events can be summarized (mean, p50/p95/p99, log2 histogram) and exported as a Chrome trace
+ *   (chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Usage:
+ * sgl::Profiler::get()->setEnabled(true);
+ * {
+ *     SGL_PROFILE_ZONE("Update");
+ *     ...
+ * }
+ * sgl::Profiler::get()->markFrame();
+ * sgl::Profiler::get()->collect();
+ * sgl::Profiler::get()->exportChromeTrace("trace.json");
+ */
+
+typedef uint32_t ProfilerZoneId;
+
+struct DLL_OBJECT ProfilerZoneInfo {
+    std::string name;
+    const char* file = nullptr;
+    int line = 0;
+};
+
+/// Event as stored in the per-thread ring buffers. Timestamps are in nanoseconds since the profiler epoch.
+struct DLL_OBJECT ProfilerEvent {
+    uint64_t beginNs;
+    uint64_t endNs;
+    ProfilerZoneId zoneId;
+    uint32_t depth;
+};
+
+/// Events collected from one thread.
+struct DLL_OBJECT ProfilerThreadEvents {
+    uint32_t threadIdx = 0;
+    std::string threadName;
+    std::vector<ProfilerEvent> events;
+};
+
+/// Summary statistics of all collected events of one zone.
+struct DLL_OBJECT ProfilerZoneStatistics {
+    ProfilerZoneId zoneId = 0;
+    std::string name;
+    size_t numSamples = 0;
+    double totalMs = 0.0;
+    double minMs = 0.0;
+    double maxMs = 0.0;
+    double meanMs = 0.0;
+    double medianMs = 0.0; ///< p50
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    /// Bucket i counts the samples with a duration in [2^(i-1), 2^i) microseconds (bucket 0: < 1us).
+    std::vector<uint32_t> histogram;
+};
+
+/// Returns the value at the passed percentile (in [0, 1]) of sorted values using the nearest-rank method.
+DLL_OBJECT uint64_t computePercentileSorted(const std::vector<uint64_t>& valuesSorted, double percentile);
+
+class ProfilerThreadBuffer;
+
+class DLL_OBJECT Profiler : public Singleton<Profiler> {
+public:
+    Profiler();
+    ~Profiler() override;
+
+    /// When disabled (the default), scopes only cost one relaxed atomic load.
+    inline void setEnabled(bool enabled) { isEnabled.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] inline bool getIsEnabled() const { return isEnabled.load(std::memory_order_relaxed); }
+    /// Sets the number of events each per-thread ring buffer can hold until @see collect is called.
+    void setThreadBufferCapacity(size_t capacity);
+    /// Optionally assigns a name to the calling thread that is shown in the exported trace.
+    void setThreadName(const std::string& name);
+
+    /// Interns a zone. Normally called only once per call site through @see SGL_PROFILE_ZONE.
+    ProfilerZoneId registerZone(const char* name, const char* file = nullptr, int line = 0);
+    [[nodiscard]] ProfilerZoneInfo getZoneInfo(ProfilerZoneId zoneId);
+    [[nodiscard]] size_t getNumZones();
+
+    /// Returns the nanoseconds that passed since the profiler epoch.
+    [[nodiscard]] inline uint64_t now() const {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - epoch).count());
+    }
+    /// Pushes a finished zone into the ring buffer of the calling thread.
+    void recordEvent(ProfilerZoneId zoneId, uint64_t beginNs, uint64_t endNs, uint32_t depth);
+    /// Marks the end of a frame (recorded as the zone "Frame" spanning the time since the last call).
+    void markFrame();
+
+    /// Drains the ring buffers of all threads into the collected event lists. Can be called while recording.
+    void collect();
+    /// Removes all collected events (and the event lists of exited threads).
+    void clear();
+    [[nodiscard]] const std::vector<ProfilerThreadEvents>& getCollectedEvents() const { return collectedEvents; }
+    /// The number of events that were dropped because a thread ring buffer was full.
+    [[nodiscard]] uint64_t getNumDroppedEvents();
+    /// The number of ring buffers, i.e., of threads that recorded events and were not released by @see collect yet.
+    [[nodiscard]] size_t getNumThreadBuffers();
+
+    /// Computes the statistics of all zones with at least one collected event.
+    std::vector<ProfilerZoneStatistics> computeStatistics();
+    /// Computes the statistics of a single zone (numSamples == 0 if no event was collected).
+    ProfilerZoneStatistics computeZoneStatistics(ProfilerZoneId zoneId);
+    /// Prints the statistics of all zones to the log file.
+    void printStatistics();
+    /// Writes the collected events as a Chrome trace event file (JSON), which can be opened in Perfetto.
+    bool exportChromeTrace(const std::string& filename);
+
+    /// Per-thread nesting depth of open scopes (used by @see ProfilerScope).
+    static uint32_t& threadDepth();
+
+private:
+    ProfilerThreadBuffer* getThreadBuffer();
+
+    std::atomic<bool> isEnabled{false};
+    std::chrono::steady_clock::time_point epoch;
+    std::atomic<size_t> threadBufferCapacity{1u << 16u};
+
+    std::mutex zoneMutex;
+    std::deque<ProfilerZoneInfo> zones;
+    ProfilerZoneId frameZoneId = 0;
+    std::atomic<uint64_t> lastFrameNs{0};
+
+    uint64_t instanceId;
+    std::mutex threadBufferMutex;
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> threadBuffers;
+    uint32_t nextThreadIdx = 0;
+    uint64_t numDroppedEventsReleased = 0; ///< Events dropped by threads whose buffers were released.
+
+    std::mutex collectMutex;
+    std::vector<ProfilerThreadEvents> collectedEvents;
+};
+
+/// RAII helper recording the time between construction and destruction.
+class ProfilerScope {
+public:
+    explicit ProfilerScope(ProfilerZoneId zoneId) {
+        profiler = Profiler::get();
+        if (profiler->getIsEnabled()) {
+            this->zoneId = zoneId;
+            depth = Profiler::threadDepth()++;
+            beginNs = profiler->now();
+        } else {
+            profiler = nullptr;
+        }
+    }
+    ~ProfilerScope() {
+        if (profiler) {
+            uint64_t endNs = profiler->now();
+            Profiler::threadDepth()--;
+            profiler->recordEvent(zoneId, beginNs, endNs, depth);
+        }
+    }
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+    Profiler* profiler;
+    ProfilerZoneId zoneId = 0;
+    uint32_t depth = 0;
+    uint64_t beginNs = 0;
+};
+
+}
+
+#define SGL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SGL_PROFILE_CONCAT(a, b) SGL_PROFILE_CONCAT_IMPL(a, b)
+
+/// Records a zone with the passed name (a string literal) until the end of the enclosing scope.
+#define SGL_PROFILE_ZONE(name) \
+    static const sgl::ProfilerZoneId SGL_PROFILE_CONCAT(sglProfilerZoneId, __LINE__) = \
+            sgl::Profiler::get()->registerZone(name, __FILE__, __LINE__); \
+    sgl::ProfilerScope SGL_PROFILE_CONCAT(sglProfilerScope, __LINE__)(SGL_PROFILE_CONCAT(sglProfilerZoneId, __LINE__))
+/// Records a zone named after the enclosing function.
+#define SGL_PROFILE_FUNCTION() SGL_PROFILE_ZONE(__func__)
+
+#endif //SGL_PROFILER_HPP
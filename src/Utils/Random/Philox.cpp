@@ -0,0 +1,202 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_PHILOX_USE_SSE2
+#endif
+
+#include "Philox.hpp"
+
+namespace sgl {
+
+static const uint32_t PHILOX_M0 = 0xD2511F53u;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static const uint32_t PHILOX_W0 = 0x9E3779B9u;
+static const uint32_t PHILOX_W1 = 0xBB67AE85u;
+static const int PHILOX_NUM_ROUNDS = 10;
+// Bulk fills with more values are split into chunks of this size, which are generated in parallel.
+static const size_t PHILOX_CHUNK_SIZE = 16384;
+
+static inline void mulhilo32(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+    uint64_t product = uint64_t(a) * uint64_t(b);
+    hi = uint32_t(product >> 32u);
+    lo = uint32_t(product);
+}
+
+void PhiloxRandomGenerator::computeBlock(uint64_t key, uint64_t streamIdx, uint64_t blockIdx, uint32_t values[4]) {
+    uint32_t c0 = uint32_t(blockIdx), c1 = uint32_t(blockIdx >> 32u);
+    uint32_t c2 = uint32_t(streamIdx), c3 = uint32_t(streamIdx >> 32u);
+    uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32u);
+    for (int round = 0; round < PHILOX_NUM_ROUNDS; round++) {
+        if (round > 0) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        uint32_t hi0, lo0, hi1, lo1;
+        mulhilo32(PHILOX_M0, c0, hi0, lo0);
+        mulhilo32(PHILOX_M1, c2, hi1, lo1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+    }
+    values[0] = c0;
+    values[1] = c1;
+    values[2] = c2;
+    values[3] = c3;
+}
+
+#ifdef SGL_PHILOX_USE_SSE2
+static inline void mulhilo32x4(__m128i a, __m128i m, __m128i& hi, __m128i& lo) {
+    __m128i productEven = _mm_mul_epu32(a, m);
+    __m128i productOdd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    lo = _mm_unpacklo_epi32(
+            _mm_shuffle_epi32(productEven, _MM_SHUFFLE(0, 0, 2, 0)),
+            _mm_shuffle_epi32(productOdd, _MM_SHUFFLE(0, 0, 2, 0)));
+    hi = _mm_unpacklo_epi32(
+            _mm_shuffle_epi32(productEven, _MM_SHUFFLE(0, 0, 3, 1)),
+            _mm_shuffle_epi32(productOdd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+/// Computes the four consecutive blocks starting at blockIdx, one block per SIMD lane.
+static void computeBlocks4(uint64_t key, uint64_t streamIdx, uint64_t blockIdx, uint32_t* values) {
+    const uint64_t b1 = blockIdx + 1, b2 = blockIdx + 2, b3 = blockIdx + 3;
+    __m128i c0 = _mm_set_epi32(int(uint32_t(b3)), int(uint32_t(b2)), int(uint32_t(b1)), int(uint32_t(blockIdx)));
+    __m128i c1 = _mm_set_epi32(
+            int(uint32_t(b3 >> 32u)), int(uint32_t(b2 >> 32u)), int(uint32_t(b1 >> 32u)), int(uint32_t(blockIdx >> 32u)));
+    __m128i c2 = _mm_set1_epi32(int(uint32_t(streamIdx)));
+    __m128i c3 = _mm_set1_epi32(int(uint32_t(streamIdx >> 32u)));
+    const __m128i m0 = _mm_set1_epi32(int(PHILOX_M0));
+    const __m128i m1 = _mm_set1_epi32(int(PHILOX_M1));
+    uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32u);
+    for (int round = 0; round < PHILOX_NUM_ROUNDS; round++) {
+        if (round > 0) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        __m128i hi0, lo0, hi1, lo1;
+        mulhilo32x4(c0, m0, hi0, lo0);
+        mulhilo32x4(c2, m1, hi1, lo1);
+        c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), _mm_set1_epi32(int(k0)));
+        c1 = lo1;
+        c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), _mm_set1_epi32(int(k1)));
+        c3 = lo0;
+    }
+
+    // Transpose, so that the four values of each block are stored contiguously.
+    __m128i t0 = _mm_unpacklo_epi32(c0, c1);
+    __m128i t1 = _mm_unpacklo_epi32(c2, c3);
+    __m128i t2 = _mm_unpackhi_epi32(c0, c1);
+    __m128i t3 = _mm_unpackhi_epi32(c2, c3);
+    auto* dst = reinterpret_cast<__m128i*>(values);
+    _mm_storeu_si128(dst, _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128(dst + 2, _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128(dst + 3, _mm_unpackhi_epi64(t2, t3));
+}
+#endif
+
+void PhiloxRandomGenerator::generateValues(uint64_t firstValueIdx, uint32_t* values, size_t numValues) const {
+    uint32_t block[4];
+    size_t i = 0;
+
+    // Values before the first block boundary.
+    if (firstValueIdx % 4 != 0) {
+        computeBlock(key, streamIdx, firstValueIdx / 4, block);
+        for (uint64_t j = firstValueIdx % 4; j < 4 && i < numValues; j++) {
+            values[i++] = block[j];
+        }
+    }
+
+    uint64_t blockIdx = (firstValueIdx + i) / 4;
+#ifdef SGL_PHILOX_USE_SSE2
+    for (; i + 16 <= numValues; i += 16, blockIdx += 4) {
+        computeBlocks4(key, streamIdx, blockIdx, values + i);
+    }
+#endif
+    for (; i + 4 <= numValues; i += 4, blockIdx++) {
+        computeBlock(key, streamIdx, blockIdx, values + i);
+    }
+    if (i < numValues) {
+        computeBlock(key, streamIdx, blockIdx, block);
+        for (int j = 0; i < numValues; j++) {
+            values[i++] = block[j];
+        }
+    }
+}
+
+uint32_t PhiloxRandomGenerator::getRandomUint32() {
+    uint64_t blockIdx = position / 4;
+    if (blockIdx != cachedBlockIdx) {
+        computeBlock(key, streamIdx, blockIdx, cachedBlock);
+        cachedBlockIdx = blockIdx;
+    }
+    return cachedBlock[position++ % 4];
+}
+
+void PhiloxRandomGenerator::fillUint32(uint32_t* values, size_t numValues) {
+    const uint64_t firstValueIdx = position;
+    position += numValues;
+    if (numValues <= PHILOX_CHUNK_SIZE) {
+        generateValues(firstValueIdx, values, numValues);
+        return;
+    }
+
+    // As every value only depends on its position, the chunks can be generated in any order.
+    const size_t numChunks = (numValues + PHILOX_CHUNK_SIZE - 1) / PHILOX_CHUNK_SIZE;
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](auto const& r) {
+        for (auto chunkIdx = r.begin(); chunkIdx != r.end(); chunkIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(values, numValues, numChunks, firstValueIdx) default(none)
+#endif
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+#endif
+        size_t chunkStart = chunkIdx * PHILOX_CHUNK_SIZE;
+        size_t chunkSize = std::min(size_t(PHILOX_CHUNK_SIZE), numValues - chunkStart);
+        generateValues(firstValueIdx + chunkStart, values + chunkStart, chunkSize);
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+PhiloxRandomGenerator PhiloxRandomGenerator::getStream(uint64_t otherStreamIdx) const {
+    return PhiloxRandomGenerator(key, otherStreamIdx);
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SYSTEM_RANDOM_PHILOX_HPP_
+#define SYSTEM_RANDOM_PHILOX_HPP_
+
+#include "Random.hpp"
+
+namespace sgl {
+
+/**
+ * Counter-based Philox4x32-10 generator (Salmon et al., "Parallel random numbers: As easy as 1, 2, 3", 2011).
+ * Every value is a pure function of the seed, the stream index and the position of the value in the stream. Thus,
+ * streams can be created independently for every work item of a parallel loop, and bulk fills give the same results
+ * regardless of how many threads are used. Four counter blocks are computed at once with SSE2 if available.
+ */
+class DLL_OBJECT PhiloxRandomGenerator : public RandomGenerator {
+public:
+    PhiloxRandomGenerator() : RandomGenerator(), key(seed) {}
+    explicit PhiloxRandomGenerator(uint64_t seed64, uint64_t streamIdx = 0)
+            : RandomGenerator(uint32_t(seed64)), key(seed64), streamIdx(streamIdx) {}
+    ~PhiloxRandomGenerator() override = default;
+    uint32_t getRandomUint32() override;
+    void fillUint32(uint32_t* values, size_t numValues) override;
+    using RandomGenerator::fillUint32;
+
+    /// Returns the generator of another stream with the same seed (e.g., one per work item of a parallel loop).
+    [[nodiscard]] PhiloxRandomGenerator getStream(uint64_t otherStreamIdx) const;
+    [[nodiscard]] inline uint64_t getStreamIdx() const { return streamIdx; }
+    /// Jumps ahead or back to an arbitrary position in the stream in constant time.
+    inline void setPosition(uint64_t valueIdx) { position = valueIdx; }
+    inline void skip(uint64_t numValues) { position += numValues; }
+    [[nodiscard]] inline uint64_t getPosition() const { return position; }
+
+    /// Computes the four values of the counter block 'blockIdx' in the passed stream.
+    static void computeBlock(uint64_t key, uint64_t streamIdx, uint64_t blockIdx, uint32_t values[4]);
+
+private:
+    void generateValues(uint64_t firstValueIdx, uint32_t* values, size_t numValues) const;
+
+    uint64_t key;
+    uint64_t streamIdx = 0;
+    uint64_t position = 0;
+    uint64_t cachedBlockIdx = std::numeric_limits<uint64_t>::max();
+    uint32_t cachedBlock[4] = {};
+};
+
+}
+
+#endif /* SYSTEM_RANDOM_PHILOX_HPP_ */
@@ -26,6 +26,15 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cmath>
+#include <cstring>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+#include <Math/Math.hpp>
 #include "Random.hpp"
 
 namespace sgl {
@@ -48,4 +57,61 @@ float RandomGenerator::getRandomFloatBetween(float min, float max) {
     return (getRandomUint32() / static_cast<float>(4294967295UL) * (max - min) + min);
 }
 
+void RandomGenerator::fillUint32(uint32_t* values, size_t numValues) {
+    for (size_t i = 0; i < numValues; i++) {
+        values[i] = getRandomUint32();
+    }
+}
+
+void RandomGenerator::fillUniformFloat(float* values, size_t numValues, float min, float max) {
+    // The 32-bit values are generated in place and then converted to floats using the upper 24 bits.
+    fillUint32(reinterpret_cast<uint32_t*>(values), numValues);
+    const float scale = (max - min) / 16777216.0f;
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numValues), [&](auto const& r) {
+        for (auto i = r.begin(); i != r.end(); i++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(values, numValues, min, scale) default(none) if(numValues > 65536)
+#endif
+    for (size_t i = 0; i < numValues; i++) {
+#endif
+        uint32_t value;
+        memcpy(&value, values + i, sizeof(uint32_t));
+        values[i] = float(value >> 8u) * scale + min;
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
+void RandomGenerator::fillNormalFloat(float* values, size_t numValues, float mean, float stddev) {
+    const size_t numPairs = (numValues + 1) / 2;
+    std::vector<uint32_t> uniformValues(numPairs * 2);
+    fillUint32(uniformValues.data(), uniformValues.size());
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPairs), [&](auto const& r) {
+        for (auto pairIdx = r.begin(); pairIdx != r.end(); pairIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(values, numValues, numPairs, uniformValues, mean, stddev) default(none) \
+            if(numPairs > 32768)
+#endif
+    for (size_t pairIdx = 0; pairIdx < numPairs; pairIdx++) {
+#endif
+        // u1 is in (0, 1] so that the logarithm is finite.
+        float u1 = float((uniformValues[pairIdx * 2] >> 8u) + 1u) / 16777216.0f;
+        float u2 = float(uniformValues[pairIdx * 2 + 1] >> 8u) / 16777216.0f;
+        float radius = std::sqrt(-2.0f * std::log(u1)) * stddev;
+        float angle = TWO_PI * u2;
+        values[pairIdx * 2] = mean + radius * std::cos(angle);
+        if (pairIdx * 2 + 1 < numValues) {
+            values[pairIdx * 2 + 1] = mean + radius * std::sin(angle);
+        }
+    }
+#ifdef USE_TBB
+    });
+#endif
+}
+
 }
@@ -32,6 +32,7 @@
 #include <ctime>
 #include <cstdint>
 #include <climits>
+#include <limits>
 #include <algorithm>
 #include <vector>
 #include <list>
@@ -47,6 +48,20 @@ public:
     virtual int getRandomIntBetween(int min, int max);
     virtual float getRandomFloatBetween(float min, float max);
 
+    /// Bulk fills. Generators may override fillUint32 with a faster (e.g., vectorized or parallel) implementation.
+    virtual void fillUint32(uint32_t* values, size_t numValues);
+    /// Uniformly distributed values in [min, max).
+    void fillUniformFloat(float* values, size_t numValues, float min = 0.0f, float max = 1.0f);
+    /// Normally distributed values (Box-Muller transform). Consumes two 32-bit values per pair of output values.
+    void fillNormalFloat(float* values, size_t numValues, float mean = 0.0f, float stddev = 1.0f);
+    inline void fillUint32(std::vector<uint32_t>& values) { fillUint32(values.data(), values.size()); }
+    inline void fillUniformFloat(std::vector<float>& values, float min = 0.0f, float max = 1.0f) {
+        fillUniformFloat(values.data(), values.size(), min, max);
+    }
+    inline void fillNormalFloat(std::vector<float>& values, float mean = 0.0f, float stddev = 1.0f) {
+        fillNormalFloat(values.data(), values.size(), mean, stddev);
+    }
+
     // Shuffles the elements in the container
     template <class T>
     void shuffle(std::vector<T>& container) {
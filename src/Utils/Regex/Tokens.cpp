@@ -26,12 +26,75 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "Tokens.hpp"
 #include <regex>
+#include <unordered_map>
+
+#include "Tokens.hpp"
+
+/// Returns the compiled regular expression, which is cached per thread, as constructing std::regex is expensive.
+static const std::regex& getCachedRegex(const std::string& exprStr) {
+    static thread_local std::unordered_map<std::string, std::regex> regexCache;
+    auto it = regexCache.find(exprStr);
+    if (it != regexCache.end()) {
+        return it->second;
+    }
+    // Bound the memory used by applications building many different expressions.
+    if (regexCache.size() >= 64) {
+        regexCache.clear();
+    }
+    return regexCache.emplace(exprStr, std::regex(exprStr)).first->second;
+}
+
+static inline bool isAsciiDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+void getNumberTokenList(std::string_view str, bool allowDegrees, std::vector<std::string_view>& tokens) {
+    const size_t length = str.size();
+    size_t pos = 0;
+    while (pos < length) {
+        // [+-]?(digits|digits?\.digits?|...): As the integer alternative comes first, it always wins if a digit follows
+        // the sign, and the exponent alternative can never match.
+        size_t idx = pos;
+        if (str[idx] == '+' || str[idx] == '-') {
+            idx++;
+        }
+        if (idx < length && isAsciiDigit(str[idx])) {
+            while (idx < length && isAsciiDigit(str[idx])) {
+                idx++;
+            }
+        } else if (idx < length && str[idx] == '.') {
+            idx++;
+            while (idx < length && isAsciiDigit(str[idx])) {
+                idx++;
+            }
+        } else {
+            pos++;
+            continue;
+        }
+        // Optional UTF-8 encoded degree sign.
+        if (allowDegrees && idx + 1 < length && str[idx] == '\xC2' && str[idx + 1] == '\xB0') {
+            idx += 2;
+        }
+        tokens.push_back(str.substr(pos, idx - pos));
+        pos = idx;
+    }
+}
 
 std::vector<std::string> getTokenList(const std::string& str, const std::string& exprStr) {
     std::vector<std::string> tokenList;
-    std::regex expr(exprStr.c_str());
+    bool isNumberExpr = exprStr == NUMBER_REGEX_STRING;
+    if (isNumberExpr || exprStr == NUMBER_AND_DEGREES_REGEX_STRING) {
+        std::vector<std::string_view> tokens;
+        getNumberTokenList(str, !isNumberExpr, tokens);
+        tokenList.reserve(tokens.size());
+        for (const std::string_view& token : tokens) {
+            tokenList.emplace_back(token);
+        }
+        return tokenList;
+    }
+
+    const std::regex& expr = getCachedRegex(exprStr);
     std::regex_token_iterator<std::string::const_iterator> it{str.begin(), str.end(), expr};
     std::regex_token_iterator<std::string::const_iterator> end;
     while (it != end) {
@@ -42,7 +105,7 @@ std::vector<std::string> getTokenList(const std::string& str, const std::string&
 }
 
 bool regexMatches(const std::string& str, const std::string& exprStr) {
-    std::regex regexp(exprStr);
+    const std::regex& regexp = getCachedRegex(exprStr);
     std::cmatch what;
     return std::regex_match(str.c_str(), what, regexp);
 }
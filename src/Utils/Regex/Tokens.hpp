@@ -30,6 +30,7 @@
 #define STRESSLINEVIS_TOKENS_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -52,11 +53,23 @@ const std::string NUMBER_AND_DEGREES_REGEX_STRING =
 
 /**
  * Returns a list containing all tokens in 'str' specified by 'exprStr'.
+ * NUMBER_REGEX_STRING and NUMBER_AND_DEGREES_REGEX_STRING are matched by @see getNumberTokenList without std::regex.
+ * For all other expressions, the compiled std::regex objects are cached per thread.
  * @param str: The string to parse.
  * @param exprStr: A regular expression string describing the structure of a token.
  */
 DLL_OBJECT std::vector<std::string> getTokenList(const std::string& str, const std::string& exprStr);
 
+/**
+ * Appends the tokens matched by NUMBER_REGEX_STRING (or NUMBER_AND_DEGREES_REGEX_STRING if 'allowDegrees' is true) to
+ * 'tokens' in a single linear pass. The results are identical to the ones of std::regex, which means that the first
+ * matching alternative of the expression is used, not the longest one. E.g., "2.5" yields the tokens "2" and ".5".
+ * @param str: The string to parse. The returned tokens point into its memory.
+ * @param allowDegrees: Whether a degree sign may follow the numbers.
+ * @param tokens: The list the tokens are appended to.
+ */
+DLL_OBJECT void getNumberTokenList(std::string_view str, bool allowDegrees, std::vector<std::string_view>& tokens);
+
 /**
  * Tests whether the string 'str' marches the regex string 'exprStr'.
  * @param str: The string to test.
@@ -26,7 +26,12 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <regex>
+#include <algorithm>
+#include <cstdlib>
+#include <clocale>
+#include <cstring>
+#include <limits>
+#include <string_view>
 
 #include <Utils/Convert.hpp>
 #include <Utils/StringUtils.hpp>
@@ -37,53 +42,196 @@
 #include "Tokens.hpp"
 #include "TransformString.hpp"
 
+/*
+ * The parser below reproduces the results of the std::regex based parser used previously, i.e., of
+ * std::regex_search with the expression "\s*(\S+)\s*\(\s*(.+)\s*\)(.*)", without backtracking over
+ * the whole string. Please note that, like with the regular expression, the transform content extends to the last
+ * closing bracket of the line, and everything after the first line break of the remainder is ignored.
+ */
+namespace {
+
+struct TransformMatch {
+    std::string_view type, content, rest;
+};
+
+// The character classes of std::regex in the "C" locale.
+inline bool isRegexSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline bool isRegexLineTerminator(char c) {
+    return c == '\n' || c == '\r';
+}
+
+inline size_t skipSpaces(std::string_view str, size_t idx) {
+    while (idx < str.size() && isRegexSpace(str[idx])) {
+        idx++;
+    }
+    return idx;
+}
+
+inline size_t findLineEnd(std::string_view str, size_t idx) {
+    while (idx < str.size() && !isRegexLineTerminator(str[idx])) {
+        idx++;
+    }
+    return idx;
+}
+
+/// Matches "\s*(.+)\s*\)(.*)" at the position after the opening bracket.
+bool matchTransformContent(std::string_view str, size_t startIdx, TransformMatch& match) {
+    // The leading whitespace is consumed greedily; shorter matches are only tried if the longest one fails.
+    const size_t maxContentStart = skipSpaces(str, startIdx);
+    for (size_t contentStart = maxContentStart + 1; contentStart-- > startIdx; ) {
+        const size_t lineEnd = findLineEnd(str, contentStart);
+        if (lineEnd == contentStart) {
+            continue;
+        }
+        size_t contentEnd = 0, closingIdx = 0;
+        bool found = false;
+        // The content may span the whole line if whitespace (including line breaks) leads to the closing bracket.
+        if (lineEnd < str.size()) {
+            size_t idx = skipSpaces(str, lineEnd);
+            if (idx < str.size() && str[idx] == ')') {
+                contentEnd = lineEnd;
+                closingIdx = idx;
+                found = true;
+            }
+        }
+        // Otherwise, the content ends at the last closing bracket of the line.
+        if (!found) {
+            for (size_t idx = lineEnd; idx-- > contentStart + 1; ) {
+                if (str[idx] == ')') {
+                    contentEnd = idx;
+                    closingIdx = idx;
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (found) {
+            match.content = str.substr(contentStart, contentEnd - contentStart);
+            const size_t restEnd = findLineEnd(str, closingIdx + 1);
+            match.rest = str.substr(closingIdx + 1, restEnd - closingIdx - 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Searches for the leftmost match of "\s*(\S+)\s*\(\s*(.+)\s*\)(.*)".
+bool searchTransform(std::string_view str, TransformMatch& match) {
+    size_t typeStart = skipSpaces(str, 0);
+    while (typeStart < str.size()) {
+        size_t runEnd = typeStart;
+        while (runEnd < str.size() && !isRegexSpace(str[runEnd])) {
+            runEnd++;
+        }
+        // The type is matched greedily: First, the whole non-space run followed by optional whitespace and '(' is
+        // tried, then every opening bracket inside of the run from back to front.
+        size_t openingIdx = skipSpaces(str, runEnd);
+        if (openingIdx < str.size() && str[openingIdx] == '(' && matchTransformContent(str, openingIdx + 1, match)) {
+            match.type = str.substr(typeStart, runEnd - typeStart);
+            return true;
+        }
+        for (size_t typeEnd = runEnd - 1; typeEnd > typeStart; typeEnd--) {
+            if (str[typeEnd] == '(' && matchTransformContent(str, typeEnd + 1, match)) {
+                match.type = str.substr(typeStart, typeEnd - typeStart);
+                return true;
+            }
+        }
+        // Later start positions in the same run only have a subset of the candidates, so they fail as well.
+        typeStart = skipSpaces(str, runEnd);
+    }
+    return false;
+}
+
+/**
+ * Converts a number token like std::stringstream::operator>>(float&) in the "C" locale: Conversion errors result in
+ * zero, overflows in the largest finite value, and trailing characters (e.g., a degree sign) are ignored.
+ */
+float parseNumberToken(std::string_view token) {
+    char buffer[64];
+    std::string tokenString;
+    char* numberString = buffer;
+    if (token.size() < sizeof(buffer)) {
+        memcpy(buffer, token.data(), token.size());
+        buffer[token.size()] = '\0';
+    } else {
+        tokenString = std::string(token);
+        numberString = tokenString.data();
+    }
+    // strtof uses the decimal separator of the current C locale.
+    const char decimalPoint = *localeconv()->decimal_point;
+    if (decimalPoint != '.') {
+        for (char* c = numberString; *c != '\0'; c++) {
+            if (*c == '.') {
+                *c = decimalPoint;
+            }
+        }
+    }
+    char* numberEnd = nullptr;
+    float value = std::strtof(numberString, &numberEnd);
+    if (numberEnd == numberString) {
+        return 0.0f;
+    }
+    if (value == std::numeric_limits<float>::infinity()) {
+        return std::numeric_limits<float>::max();
+    }
+    if (value == -std::numeric_limits<float>::infinity()) {
+        return -std::numeric_limits<float>::max();
+    }
+    return value;
+}
+
+}
+
 glm::mat4 parseTransformString(std::string transformString) {
     glm::mat4 matrix = sgl::matrixIdentity();
 
     // Iterate over all of the concatenated transformations (pattern: "type(content)").
-    // First match: Transform type. Second match: Transform information in the brackets.
-    std::regex transformRegex("\\s*(\\S+)\\s*\\(\\s*(.+)\\s*\\)(.*)");
-    std::smatch what;
-    while (std::regex_search(transformString, what, transformRegex)) {
-        std::string transformType = what[1];
-        std::string transformContent = what[2];
-        transformString = what[3]; // Continue with next part of string
+    std::string_view remainingString = transformString;
+    std::vector<std::string_view> transformData;
+    TransformMatch match;
+    while (searchTransform(remainingString, match)) {
+        std::string_view transformType = match.type;
+        remainingString = match.rest; // Continue with next part of string
 
         // Now split the transform content in the brackets (multiple float values separated by space or commas).
-        std::vector<std::string> transformData = getTokenList(transformContent, NUMBER_AND_DEGREES_REGEX_STRING);
+        transformData.clear();
+        getNumberTokenList(match.content, true, transformData);
 
         if (transformType == "translate") {
-            float x = sgl::fromString<float>(transformData.at(0));
-            float y = sgl::fromString<float>(transformData.at(1));
-            float z = sgl::fromString<float>(transformData.at(1));
+            float x = parseNumberToken(transformData.at(0));
+            float y = parseNumberToken(transformData.at(1));
+            float z = parseNumberToken(transformData.at(1));
             matrix = matrix * sgl::matrixTranslation(glm::vec3(x, y, z));
         } else if (transformType == "scale") {
-            float scaleX = sgl::fromString<float>(transformData.at(0));
+            float scaleX = parseNumberToken(transformData.at(0));
             if (transformData.size() == 1) {
                 matrix = matrix * sgl::matrixScaling(glm::vec3(scaleX, scaleX, scaleX));
             } else {
-                float scaleY = sgl::fromString<float>(transformData.at(1));
-                float scaleZ = sgl::fromString<float>(transformData.at(2));
+                float scaleY = parseNumberToken(transformData.at(1));
+                float scaleZ = parseNumberToken(transformData.at(2));
                 matrix = matrix * sgl::matrixScaling(glm::vec3(scaleX, scaleY, scaleZ));
             }
         } else if (transformType == "rotate") {
             float rotationAngleRadians = 0.0f;
             // Degree or radians?
-            if (sgl::endsWith(transformData.at(0), "°")) {
-                std::string numberString =
-                        transformData.at(0).substr(0, transformData.at(0).find_last_of("°") - 1);
-                rotationAngleRadians = sgl::fromString<float>(numberString) / 180.0f * sgl::PI;
+            std::string_view angleString = transformData.at(0);
+            if (angleString.size() >= 2 && angleString.substr(angleString.size() - 2) == "°") {
+                std::string_view numberString = angleString.substr(0, angleString.size() - 2);
+                rotationAngleRadians = parseNumberToken(numberString) / 180.0f * sgl::PI;
             } else {
-                rotationAngleRadians = sgl::fromString<float>(transformData.at(0));
+                rotationAngleRadians = parseNumberToken(transformData.at(0));
             }
-            float axisX = sgl::fromString<float>(transformData.at(1));
-            float axisY = sgl::fromString<float>(transformData.at(2));
-            float axisZ = sgl::fromString<float>(transformData.at(3));
+            float axisX = parseNumberToken(transformData.at(1));
+            float axisY = parseNumberToken(transformData.at(2));
+            float axisZ = parseNumberToken(transformData.at(3));
             matrix = matrix * glm::rotate(rotationAngleRadians, glm::vec3(axisX, axisY, axisZ));
         } else if (transformType == "matrix") {
             float m[16];
-            for (size_t i = 0; i < transformData.size(); i++) {
-                m[i] = sgl::fromString<float>(transformData.at(i));
+            for (size_t i = 0; i < std::min(transformData.size(), size_t(16)); i++) {
+                m[i] = parseNumberToken(transformData.at(i));
             }
 
             if (transformData.size() == 9) {
@@ -113,8 +261,8 @@ glm::mat4 parseTransformString(std::string transformString) {
             }
         } else if (transformType == "matrixc") {
             float m[16];
-            for (size_t i = 0; i < transformData.size(); i++) {
-                m[i] = sgl::fromString<float>(transformData.at(i));
+            for (size_t i = 0; i < std::min(transformData.size(), size_t(16)); i++) {
+                m[i] = parseNumberToken(transformData.at(i));
             }
 
             if (transformData.size() == 9) {
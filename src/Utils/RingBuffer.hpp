@@ -0,0 +1,541 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_RINGBUFFER_HPP
+#define SGL_RINGBUFFER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_RING_BUFFER_USE_SSE2
+#endif
+
+/*
+ * Bounded ring buffers for passing data between threads without mutexes (e.g., frames, log lines or loaded chunks
+ * between worker and render threads). In contrast to @see CircularQueue, the capacity is fixed on construction.
+ *
+ * - SpscRingBuffer: One producer and one consumer thread. All try* operations are wait-free.
+ * - MpmcRingBuffer: Any number of producer and consumer threads (bounded queue by Dmitry Vyukov, see
+ *   https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue). The try* operations are lock-free.
+ *
+ * Both store the elements in a preallocated array, so T needs to be default constructible and move assignable.
+ * Popped slots keep the moved-from object until they are overwritten.
+ *
+ * The blocking operations (push, pop and the *For variants with a timeout) spin shortly and then back off to yielding
+ * and sleeping. close() makes blocking calls return false instead of waiting forever, e.g., for shutting down a worker.
+ */
+
+namespace sgl {
+
+namespace detail {
+
+/// Spin-then-sleep backoff used by the blocking ring buffer operations.
+class RingBufferBackoff {
+public:
+    void wait() {
+        if (numIterations < 64) {
+#ifdef SGL_RING_BUFFER_USE_SSE2
+            _mm_pause();
+#endif
+        } else if (numIterations < 128) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        numIterations++;
+    }
+
+private:
+    uint32_t numIterations = 0;
+};
+
+inline size_t getRingBufferCapacityPowerOfTwo(size_t capacity) {
+    size_t capacityPowerOfTwo = 2;
+    while (capacityPowerOfTwo < capacity) {
+        capacityPowerOfTwo *= 2;
+    }
+    return capacityPowerOfTwo;
+}
+
+}
+
+/**
+ * Wait-free single-producer/single-consumer ring buffer. Only one thread may call the push functions and only one
+ * thread may call the pop functions at a time.
+ */
+template<class T>
+class SpscRingBuffer {
+public:
+    /// @param capacity The maximum number of elements (rounded up to the next power of two).
+    explicit SpscRingBuffer(size_t capacity = 1024) {
+        queueCapacity = detail::getRingBufferCapacityPowerOfTwo(capacity);
+        mask = queueCapacity - 1;
+        queueData = std::make_unique<T[]>(queueCapacity);
+    }
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    // Producer functions.
+    bool tryPush(const T& value) {
+        return tryEmplace([&value](T& slot) { slot = value; });
+    }
+    bool tryPush(T&& value) {
+        return tryEmplace([&value](T& slot) { slot = std::move(value); });
+    }
+    /**
+     * Pushes as many elements of the passed array as fit into the buffer.
+     * @return The number of elements pushed (0 to count).
+     */
+    size_t tryPushBatch(const T* values, size_t count) {
+        size_t headLocal = head.load(std::memory_order_relaxed);
+        size_t numFree = queueCapacity - (headLocal - tailCached);
+        if (numFree < count) {
+            tailCached = tail.load(std::memory_order_acquire);
+            numFree = queueCapacity - (headLocal - tailCached);
+        }
+        size_t numPushed = count < numFree ? count : numFree;
+        for (size_t i = 0; i < numPushed; i++) {
+            queueData[(headLocal + i) & mask] = values[i];
+        }
+        head.store(headLocal + numPushed, std::memory_order_release);
+        return numPushed;
+    }
+    /// Blocks while the buffer is full. Returns false (without pushing) if the buffer was closed.
+    bool push(T value) {
+        detail::RingBufferBackoff backoff;
+        while (isClosed.load(std::memory_order_acquire) || !tryPush(std::move(value))) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+    /// Blocks until all elements were pushed. Returns the number of pushed elements (less than count if closed).
+    size_t pushBatch(const T* values, size_t count) {
+        detail::RingBufferBackoff backoff;
+        size_t numPushed = 0;
+        while (numPushed < count && !isClosed.load(std::memory_order_acquire)) {
+            size_t numPushedBatch = tryPushBatch(values + numPushed, count - numPushed);
+            numPushed += numPushedBatch;
+            if (numPushedBatch == 0) {
+                backoff.wait();
+            }
+        }
+        return numPushed;
+    }
+    template<class Rep, class Period>
+    bool tryPushFor(T value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto endTime = std::chrono::steady_clock::now() + timeout;
+        detail::RingBufferBackoff backoff;
+        while (isClosed.load(std::memory_order_acquire) || !tryPush(std::move(value))) {
+            if (isClosed.load(std::memory_order_acquire) || std::chrono::steady_clock::now() >= endTime) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+
+    // Consumer functions.
+    bool tryPop(T& value) {
+        size_t tailLocal = tail.load(std::memory_order_relaxed);
+        if (tailLocal == headCached) {
+            headCached = head.load(std::memory_order_acquire);
+            if (tailLocal == headCached) {
+                return false;
+            }
+        }
+        value = std::move(queueData[tailLocal & mask]);
+        tail.store(tailLocal + 1, std::memory_order_release);
+        return true;
+    }
+    /**
+     * Pops up to maxCount elements.
+     * @return The number of elements written to 'values'.
+     */
+    size_t tryPopBatch(T* values, size_t maxCount) {
+        size_t tailLocal = tail.load(std::memory_order_relaxed);
+        size_t numAvailable = headCached - tailLocal;
+        if (numAvailable < maxCount) {
+            headCached = head.load(std::memory_order_acquire);
+            numAvailable = headCached - tailLocal;
+        }
+        size_t numPopped = maxCount < numAvailable ? maxCount : numAvailable;
+        for (size_t i = 0; i < numPopped; i++) {
+            values[i] = std::move(queueData[(tailLocal + i) & mask]);
+        }
+        tail.store(tailLocal + numPopped, std::memory_order_release);
+        return numPopped;
+    }
+    /// Blocks while the buffer is empty. Returns false if the buffer was closed and all elements were popped.
+    bool pop(T& value) {
+        detail::RingBufferBackoff backoff;
+        while (!tryPop(value)) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                // Elements pushed before close() was called still need to be returned.
+                return tryPop(value);
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+    /// Blocks until at least one element is available. Returns 0 if the buffer was closed and is empty.
+    size_t popBatch(T* values, size_t maxCount) {
+        detail::RingBufferBackoff backoff;
+        size_t numPopped;
+        while ((numPopped = tryPopBatch(values, maxCount)) == 0 && maxCount != 0) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return tryPopBatch(values, maxCount);
+            }
+            backoff.wait();
+        }
+        return numPopped;
+    }
+    template<class Rep, class Period>
+    bool tryPopFor(T& value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto endTime = std::chrono::steady_clock::now() + timeout;
+        detail::RingBufferBackoff backoff;
+        while (!tryPop(value)) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return tryPop(value);
+            }
+            if (std::chrono::steady_clock::now() >= endTime) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+
+    /// Makes blocking calls return instead of waiting. Elements already in the buffer can still be popped.
+    void close() { isClosed.store(true, std::memory_order_release); }
+    [[nodiscard]] bool getIsClosed() const { return isClosed.load(std::memory_order_acquire); }
+    /// The size is only a snapshot if other threads are pushing or popping concurrently.
+    [[nodiscard]] size_t sizeApprox() const {
+        size_t tailLocal = tail.load(std::memory_order_acquire);
+        size_t headLocal = head.load(std::memory_order_acquire);
+        return headLocal - tailLocal;
+    }
+    [[nodiscard]] bool emptyApprox() const { return sizeApprox() == 0; }
+    [[nodiscard]] inline size_t capacity() const { return queueCapacity; }
+
+private:
+    template<class F>
+    bool tryEmplace(const F& assignFunctor) {
+        size_t headLocal = head.load(std::memory_order_relaxed);
+        if (headLocal - tailCached == queueCapacity) {
+            tailCached = tail.load(std::memory_order_acquire);
+            if (headLocal - tailCached == queueCapacity) {
+                return false;
+            }
+        }
+        assignFunctor(queueData[headLocal & mask]);
+        head.store(headLocal + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::unique_ptr<T[]> queueData;
+    size_t queueCapacity = 0;
+    size_t mask = 0;
+    std::atomic<bool> isClosed{false};
+
+    // The indices are only ever incremented (wrapping around at SIZE_MAX is fine, as the capacity is a power of two).
+    // Each index and the copy of the other index cached by the same thread share a cache line to avoid false sharing.
+    alignas(64) std::atomic<size_t> head{0}; ///< Written by the producer.
+    size_t tailCached = 0; ///< Producer's copy of 'tail'.
+    alignas(64) std::atomic<size_t> tail{0}; ///< Written by the consumer.
+    size_t headCached = 0; ///< Consumer's copy of 'head'.
+};
+
+/**
+ * Lock-free multi-producer/multi-consumer ring buffer. Each slot has a sequence number telling the producers and
+ * consumers in which round it is free or occupied, so only the enqueue or dequeue position is contended.
+ */
+template<class T>
+class MpmcRingBuffer {
+public:
+    /// @param capacity The maximum number of elements (rounded up to the next power of two).
+    explicit MpmcRingBuffer(size_t capacity = 1024) {
+        queueCapacity = detail::getRingBufferCapacityPowerOfTwo(capacity);
+        mask = queueCapacity - 1;
+        cells = std::make_unique<Cell[]>(queueCapacity);
+        for (size_t i = 0; i < queueCapacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    bool tryPush(const T& value) {
+        return tryPushImpl([&value](T& slot) { slot = value; });
+    }
+    bool tryPush(T&& value) {
+        return tryPushImpl([&value](T& slot) { slot = std::move(value); });
+    }
+    /**
+     * Pushes as many elements of the passed array as fit into the buffer. The elements are enqueued in one contiguous
+     * range, i.e., elements of other producers are not interleaved with them.
+     * @return The number of elements pushed (0 to count).
+     */
+    size_t tryPushBatch(const T* values, size_t count) {
+        if (count == 0) {
+            return 0;
+        }
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        size_t numClaimed;
+        for (;;) {
+            // Count the free slots starting at 'pos'. If all are still free when the CAS succeeds, nobody else can
+            // have claimed them, as a slot is only reused after the enqueue position has passed it.
+            numClaimed = 0;
+            while (numClaimed < count) {
+                size_t seq = cells[(pos + numClaimed) & mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + numClaimed) {
+                    break;
+                }
+                numClaimed++;
+            }
+            if (numClaimed == 0) {
+                size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+                auto diff = intptr_t(seq) - intptr_t(pos);
+                if (diff < 0) {
+                    return 0;
+                }
+                pos = enqueuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (enqueuePos.compare_exchange_weak(pos, pos + numClaimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < numClaimed; i++) {
+            Cell& cell = cells[(pos + i) & mask];
+            cell.data = values[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return numClaimed;
+    }
+    /// Blocks while the buffer is full. Returns false (without pushing) if the buffer was closed.
+    bool push(T value) {
+        detail::RingBufferBackoff backoff;
+        while (isClosed.load(std::memory_order_acquire) || !tryPush(std::move(value))) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+    /// Blocks until all elements were pushed. Returns the number of pushed elements (less than count if closed).
+    size_t pushBatch(const T* values, size_t count) {
+        detail::RingBufferBackoff backoff;
+        size_t numPushed = 0;
+        while (numPushed < count && !isClosed.load(std::memory_order_acquire)) {
+            size_t numPushedBatch = tryPushBatch(values + numPushed, count - numPushed);
+            numPushed += numPushedBatch;
+            if (numPushedBatch == 0) {
+                backoff.wait();
+            }
+        }
+        return numPushed;
+    }
+    template<class Rep, class Period>
+    bool tryPushFor(T value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto endTime = std::chrono::steady_clock::now() + timeout;
+        detail::RingBufferBackoff backoff;
+        while (isClosed.load(std::memory_order_acquire) || !tryPush(std::move(value))) {
+            if (isClosed.load(std::memory_order_acquire) || std::chrono::steady_clock::now() >= endTime) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+
+    bool tryPop(T& value) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->data);
+        cell->sequence.store(pos + queueCapacity, std::memory_order_release);
+        return true;
+    }
+    /**
+     * Pops up to maxCount consecutive elements.
+     * @return The number of elements written to 'values'.
+     */
+    size_t tryPopBatch(T* values, size_t maxCount) {
+        if (maxCount == 0) {
+            return 0;
+        }
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        size_t numClaimed;
+        for (;;) {
+            numClaimed = 0;
+            while (numClaimed < maxCount) {
+                size_t seq = cells[(pos + numClaimed) & mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + numClaimed + 1) {
+                    break;
+                }
+                numClaimed++;
+            }
+            if (numClaimed == 0) {
+                size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+                auto diff = intptr_t(seq) - intptr_t(pos + 1);
+                if (diff < 0) {
+                    return 0;
+                }
+                pos = dequeuePos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (dequeuePos.compare_exchange_weak(pos, pos + numClaimed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < numClaimed; i++) {
+            Cell& cell = cells[(pos + i) & mask];
+            values[i] = std::move(cell.data);
+            cell.sequence.store(pos + i + queueCapacity, std::memory_order_release);
+        }
+        return numClaimed;
+    }
+    /// Blocks while the buffer is empty. Returns false if the buffer was closed and all elements were popped.
+    bool pop(T& value) {
+        detail::RingBufferBackoff backoff;
+        while (!tryPop(value)) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return tryPop(value);
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+    /// Blocks until at least one element is available. Returns 0 if the buffer was closed and is empty.
+    size_t popBatch(T* values, size_t maxCount) {
+        detail::RingBufferBackoff backoff;
+        size_t numPopped;
+        while ((numPopped = tryPopBatch(values, maxCount)) == 0 && maxCount != 0) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return tryPopBatch(values, maxCount);
+            }
+            backoff.wait();
+        }
+        return numPopped;
+    }
+    template<class Rep, class Period>
+    bool tryPopFor(T& value, const std::chrono::duration<Rep, Period>& timeout) {
+        auto endTime = std::chrono::steady_clock::now() + timeout;
+        detail::RingBufferBackoff backoff;
+        while (!tryPop(value)) {
+            if (isClosed.load(std::memory_order_acquire)) {
+                return tryPop(value);
+            }
+            if (std::chrono::steady_clock::now() >= endTime) {
+                return false;
+            }
+            backoff.wait();
+        }
+        return true;
+    }
+
+    /**
+     * Makes blocking calls return instead of waiting. Elements already in the buffer can still be popped.
+     * Elements pushed concurrently with close() may be missed by consumers that have already returned.
+     */
+    void close() { isClosed.store(true, std::memory_order_release); }
+    [[nodiscard]] bool getIsClosed() const { return isClosed.load(std::memory_order_acquire); }
+    /// The size is only a snapshot if other threads are pushing or popping concurrently.
+    [[nodiscard]] size_t sizeApprox() const {
+        size_t dequeuePosLocal = dequeuePos.load(std::memory_order_acquire);
+        size_t enqueuePosLocal = enqueuePos.load(std::memory_order_acquire);
+        auto diff = intptr_t(enqueuePosLocal) - intptr_t(dequeuePosLocal);
+        return diff < 0 ? 0 : size_t(diff);
+    }
+    [[nodiscard]] bool emptyApprox() const { return sizeApprox() == 0; }
+    [[nodiscard]] inline size_t capacity() const { return queueCapacity; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T data{};
+    };
+
+    template<class F>
+    bool tryPushImpl(const F& assignFunctor) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        assignFunctor(cell->data);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::unique_ptr<Cell[]> cells;
+    size_t queueCapacity = 0;
+    size_t mask = 0;
+    std::atomic<bool> isClosed{false};
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) std::atomic<size_t> dequeuePos{0};
+};
+
+}
+
+#endif //SGL_RINGBUFFER_HPP
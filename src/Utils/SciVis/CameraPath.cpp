@@ -28,6 +28,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+
+#ifdef USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
 
 #ifdef USE_GLM
 #define GLM_ENABLE_EXPERIMENTAL
@@ -86,11 +93,13 @@ void CameraPath::fromCirclePath(
                 * glm::length(sceneBoundingBox.getExtent()) + sceneBoundingBox.getCenter() + centerOffset;
         controlPoints.emplace_back(time, cameraPos.x, cameraPos.y, cameraPos.z, sgl::PI + angle, 0.0f);
     }
+    updateInterpolationData();
     update(0.0f);
 }
 
 void CameraPath::fromControlPoints(const std::vector<ControlPoint>& controlPoints) {
     this->controlPoints = controlPoints;
+    updateInterpolationData();
     update(0.0f);
 }
 
@@ -121,6 +130,7 @@ bool CameraPath::fromBinaryFile(const std::string& filename) {
 
     controlPoints.clear();
     stream.readArray(controlPoints);
+    updateInterpolationData();
     update(0.0f);
 
     return true;
@@ -150,41 +160,316 @@ void CameraPath::normalizeToTotalTime(float totalTime) {
     for (int i = 0; i < n; i++) {
         controlPoints.at(i).time *= factor;
     }
+    updateInterpolationData();
+}
+
+void CameraPath::setInterpolation(CameraPathInterpolation interpolationMode) {
+    interpolation = interpolationMode;
+    updateInterpolationData();
+}
+
+void CameraPath::setKochanekBartelsParameters(const KochanekBartelsParameters& parameters) {
+    kochanekBartelsParameters = parameters;
+    updateInterpolationData();
+}
+
+void CameraPath::setUseConstantSpeed(bool _useConstantSpeed) {
+    useConstantSpeed = _useConstantSpeed;
+    updateInterpolationData();
 }
 
 void CameraPath::update(float currentTime) {
-    if (controlPoints.size() == 0) {
+    if (controlPoints.empty()) {
         time = currentTime;
         return;
     }
-    time = fmod(currentTime, controlPoints.back().time);
-
-    // Find either exact control point or two to interpolate between
-    int n = (int)controlPoints.size();
-    for (int i = 0; i < n; i++) {
-        // Perfect match?
-        ControlPoint& currentCtrlPoint = controlPoints.at(i);
-        if (i == n-1 || glm::abs(time - currentCtrlPoint.time) < 0.0001f) {
-            currentTransform = toTransform(currentCtrlPoint.position, currentCtrlPoint.orientation);
-            break;
-        }
-        ControlPoint& nextCtrlPoint = controlPoints.at(i+1);
-        if (time > currentCtrlPoint.time && time < nextCtrlPoint.time) {
-            float percentage = (time - currentCtrlPoint.time) / (nextCtrlPoint.time - currentCtrlPoint.time);
-            glm::vec3 interpPos = glm::mix(currentCtrlPoint.position, nextCtrlPoint.position, percentage);
-            glm::quat interpQuat = glm::slerp(currentCtrlPoint.orientation, nextCtrlPoint.orientation, percentage);
-            currentTransform = toTransform(interpPos, interpQuat);
-            break;
-        }
-    }
+    time = wrapTime(currentTime);
+    currentTransform = evaluate(time);
 }
 
 void CameraPath::resetTime() {
     update(0.0f);
 }
 
+float CameraPath::wrapTime(float currentTime) const {
+    float endTime = getEndTime();
+    if (endTime <= 0.0f) {
+        return 0.0f;
+    }
+    if (currentTime >= 0.0f && currentTime <= endTime) {
+        return currentTime;
+    }
+    float t = std::fmod(currentTime, endTime);
+    return t < 0.0f ? t + endTime : t;
+}
+
+glm::mat4 CameraPath::evaluate(float currentTime) const {
+    if (controlPoints.empty()) {
+        return sgl::matrixIdentity();
+    }
+    if (controlPoints.size() == 1) {
+        return toTransform(controlPoints.front().position, controlPoints.front().orientation);
+    }
+    size_t segmentIdx;
+    float u;
+    computeSegmentParameter(wrapTime(currentTime), segmentIdx, u);
+    return toTransform(evaluatePosition(segmentIdx, u), evaluateOrientation(segmentIdx, u));
+}
+
+size_t CameraPath::getNumFrames(float framesPerSecond) const {
+    if (controlPoints.empty()) {
+        return 0;
+    }
+    return size_t(std::floor(double(getEndTime()) * double(framesPerSecond) + 1e-6)) + 1;
+}
+
+std::vector<glm::mat4> CameraPath::sampleFrameTransforms(
+        float framesPerSecond, size_t firstFrame, size_t numFrames) const {
+    std::vector<glm::mat4> transforms(numFrames);
+
+#ifdef USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numFrames), [&](auto const& r) {
+        for (auto frameIdx = r.begin(); frameIdx != r.end(); frameIdx++) {
+#else
+#if _OPENMP >= 201107
+    #pragma omp parallel for shared(transforms, framesPerSecond, firstFrame, numFrames)
+#endif
+    for (size_t frameIdx = 0; frameIdx < numFrames; frameIdx++) {
+#endif
+        double frameTime = double(firstFrame + frameIdx) / double(framesPerSecond);
+        transforms[frameIdx] = evaluate(float(frameTime));
+    }
+#ifdef USE_TBB
+    });
+#endif
+
+    return transforms;
+}
+
+std::vector<glm::mat4> CameraPath::sampleFrameTransforms(float framesPerSecond) const {
+    return sampleFrameTransforms(framesPerSecond, 0, getNumFrames(framesPerSecond));
+}
+
 glm::mat4 CameraPath::toTransform(const glm::vec3& position, const glm::quat& orientation) {
     return glm::toMat4(orientation) * sgl::matrixTranslation(-position);
 }
 
+
+// Quaternion helpers (constructed per component, as the argument order of the constructors differs for glm::quat).
+static inline glm::quat makeQuat(float x, float y, float z, float w) {
+    glm::quat q;
+    q.x = x;
+    q.y = y;
+    q.z = z;
+    q.w = w;
+    return q;
+}
+
+static inline glm::quat quatConjugate(const glm::quat& q) {
+    return makeQuat(-q.x, -q.y, -q.z, q.w);
+}
+
+static inline glm::quat quatNegate(const glm::quat& q) {
+    return makeQuat(-q.x, -q.y, -q.z, -q.w);
+}
+
+/// Logarithm of a unit quaternion.
+static glm::quat quatLog(const glm::quat& q) {
+    float vectorLength = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    if (vectorLength < 1e-7f) {
+        return makeQuat(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+    float factor = std::atan2(vectorLength, q.w) / vectorLength;
+    return makeQuat(q.x * factor, q.y * factor, q.z * factor, 0.0f);
+}
+
+/// Exponential of a pure quaternion.
+static glm::quat quatExp(const glm::quat& q) {
+    float angle = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    if (angle < 1e-7f) {
+        return makeQuat(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+    float factor = std::sin(angle) / angle;
+    return makeQuat(q.x * factor, q.y * factor, q.z * factor, std::cos(angle));
+}
+
+void CameraPath::updateInterpolationData() {
+    const size_t n = controlPoints.size();
+    orientations.clear();
+    outgoingTangents.clear();
+    incomingTangents.clear();
+    squadControlPoints.clear();
+    arcLengthTable.clear();
+    if (n < 2) {
+        return;
+    }
+
+    // Consecutive quaternions should lie in the same hemisphere for the interpolation to take the shortest arc.
+    orientations.resize(n);
+    orientations.front() = controlPoints.front().orientation;
+    for (size_t i = 1; i < n; i++) {
+        glm::quat q = controlPoints.at(i).orientation;
+        orientations.at(i) = glm::dot(orientations.at(i - 1), q) < 0.0f ? quatNegate(q) : q;
+    }
+
+    // Closed paths (e.g., circle paths) use the wrapped neighbors at the ends for a smooth loop.
+    const ControlPoint& firstPoint = controlPoints.front();
+    const ControlPoint& lastPoint = controlPoints.back();
+    float pathScale = 1.0f + glm::length(firstPoint.position);
+    bool isClosed =
+            n >= 3 && glm::length(lastPoint.position - firstPoint.position) < 1e-5f * pathScale
+            && std::abs(glm::dot(firstPoint.orientation, lastPoint.orientation)) > 1.0f - 1e-6f;
+
+    if (interpolation != CameraPathInterpolation::LINEAR) {
+        KochanekBartelsParameters params;
+        if (interpolation == CameraPathInterpolation::KOCHANEK_BARTELS) {
+            params = kochanekBartelsParameters;
+        }
+        const float t = params.tension, b = params.bias, c = params.continuity;
+        outgoingTangents.resize(n);
+        incomingTangents.resize(n);
+        squadControlPoints.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            const glm::vec3& p = controlPoints.at(i).position;
+            const glm::quat& q = orientations.at(i);
+            glm::vec3 pPrev, pNext;
+            glm::quat qPrev, qNext;
+            float dtPrev, dtNext;
+            if (i > 0) {
+                pPrev = controlPoints.at(i - 1).position;
+                qPrev = orientations.at(i - 1);
+                dtPrev = controlPoints.at(i).time - controlPoints.at(i - 1).time;
+            } else if (isClosed) {
+                pPrev = controlPoints.at(n - 2).position;
+                qPrev = orientations.at(n - 2);
+                dtPrev = controlPoints.at(n - 1).time - controlPoints.at(n - 2).time;
+            } else {
+                pPrev = 2.0f * p - controlPoints.at(1).position;
+                qPrev = q;
+                dtPrev = controlPoints.at(1).time - controlPoints.at(0).time;
+            }
+            if (i + 1 < n) {
+                pNext = controlPoints.at(i + 1).position;
+                qNext = orientations.at(i + 1);
+                dtNext = controlPoints.at(i + 1).time - controlPoints.at(i).time;
+            } else if (isClosed) {
+                pNext = controlPoints.at(1).position;
+                qNext = orientations.at(1);
+                dtNext = controlPoints.at(1).time - controlPoints.at(0).time;
+            } else {
+                pNext = 2.0f * p - controlPoints.at(n - 2).position;
+                qNext = q;
+                dtNext = controlPoints.at(n - 1).time - controlPoints.at(n - 2).time;
+            }
+
+            // Kochanek-Bartels tangents, adjusted for non-uniform spacing of the control points in time.
+            glm::vec3 diffPrev = p - pPrev;
+            glm::vec3 diffNext = pNext - p;
+            glm::vec3 tangentOut =
+                    (1.0f - t) * (1.0f + b) * (1.0f + c) * 0.5f * diffPrev
+                    + (1.0f - t) * (1.0f - b) * (1.0f - c) * 0.5f * diffNext;
+            glm::vec3 tangentIn =
+                    (1.0f - t) * (1.0f + b) * (1.0f - c) * 0.5f * diffPrev
+                    + (1.0f - t) * (1.0f - b) * (1.0f + c) * 0.5f * diffNext;
+            float dtSum = dtPrev + dtNext;
+            if (dtSum > 0.0f) {
+                tangentOut *= 2.0f * dtNext / dtSum;
+                tangentIn *= 2.0f * dtPrev / dtSum;
+            }
+            outgoingTangents.at(i) = tangentOut;
+            incomingTangents.at(i) = tangentIn;
+
+            // Squad: s_i = q_i * exp(-(log(q_i^-1 * q_{i+1}) + log(q_i^-1 * q_{i-1})) / 4).
+            if (glm::dot(q, qPrev) < 0.0f) {
+                qPrev = quatNegate(qPrev);
+            }
+            if (glm::dot(q, qNext) < 0.0f) {
+                qNext = quatNegate(qNext);
+            }
+            glm::quat qInv = quatConjugate(q);
+            glm::quat logNext = quatLog(qInv * qNext);
+            glm::quat logPrev = quatLog(qInv * qPrev);
+            squadControlPoints.at(i) = q * quatExp(makeQuat(
+                    -0.25f * (logNext.x + logPrev.x), -0.25f * (logNext.y + logPrev.y),
+                    -0.25f * (logNext.z + logPrev.z), 0.0f));
+        }
+    }
+
+    if (useConstantSpeed) {
+        arcLengthTable.reserve((n - 1) * NUM_ARC_LENGTH_SAMPLES + 1);
+        arcLengthTable.push_back(0.0f);
+        float arcLength = 0.0f;
+        for (size_t segmentIdx = 0; segmentIdx + 1 < n; segmentIdx++) {
+            glm::vec3 lastPosition = controlPoints.at(segmentIdx).position;
+            for (int j = 1; j <= NUM_ARC_LENGTH_SAMPLES; j++) {
+                glm::vec3 position = evaluatePosition(segmentIdx, float(j) / float(NUM_ARC_LENGTH_SAMPLES));
+                arcLength += glm::length(position - lastPosition);
+                arcLengthTable.push_back(arcLength);
+                lastPosition = position;
+            }
+        }
+    }
+}
+
+size_t CameraPath::findSegment(float t) const {
+    auto it = std::upper_bound(
+            controlPoints.begin(), controlPoints.end(), t,
+            [](float value, const ControlPoint& controlPoint) { return value < controlPoint.time; });
+    size_t idx = it == controlPoints.begin() ? 0 : size_t(it - controlPoints.begin()) - 1;
+    return std::min(idx, controlPoints.size() - 2);
+}
+
+void CameraPath::computeSegmentParameter(float t, size_t& segmentIdx, float& u) const {
+    const size_t numSegments = controlPoints.size() - 1;
+    float startTime = controlPoints.front().time;
+    float endTime = controlPoints.back().time;
+    if (useConstantSpeed && !arcLengthTable.empty() && arcLengthTable.back() > 0.0f && endTime > startTime) {
+        // Map the time linearly to the arc length and invert the piecewise linear arc length table.
+        float timeFraction = std::clamp((t - startTime) / (endTime - startTime), 0.0f, 1.0f);
+        float targetLength = timeFraction * arcLengthTable.back();
+        auto it = std::upper_bound(arcLengthTable.begin(), arcLengthTable.end(), targetLength);
+        size_t sampleIdx = it == arcLengthTable.begin() ? 0 : size_t(it - arcLengthTable.begin()) - 1;
+        sampleIdx = std::min(sampleIdx, arcLengthTable.size() - 2);
+        float sampleLength = arcLengthTable.at(sampleIdx + 1) - arcLengthTable.at(sampleIdx);
+        float sampleFraction =
+                sampleLength > 0.0f ? (targetLength - arcLengthTable.at(sampleIdx)) / sampleLength : 0.0f;
+        float globalParameter = (float(sampleIdx) + sampleFraction) / float(NUM_ARC_LENGTH_SAMPLES);
+        segmentIdx = std::min(size_t(globalParameter), numSegments - 1);
+        u = std::clamp(globalParameter - float(segmentIdx), 0.0f, 1.0f);
+        return;
+    }
+
+    segmentIdx = findSegment(t);
+    float t0 = controlPoints.at(segmentIdx).time;
+    float t1 = controlPoints.at(segmentIdx + 1).time;
+    u = t1 > t0 ? std::clamp((t - t0) / (t1 - t0), 0.0f, 1.0f) : 0.0f;
+}
+
+glm::vec3 CameraPath::evaluatePosition(size_t segmentIdx, float u) const {
+    const glm::vec3& p0 = controlPoints.at(segmentIdx).position;
+    const glm::vec3& p1 = controlPoints.at(segmentIdx + 1).position;
+    if (interpolation == CameraPathInterpolation::LINEAR || outgoingTangents.empty()) {
+        return glm::mix(p0, p1, u);
+    }
+    // Cubic Hermite basis.
+    float u2 = u * u;
+    float u3 = u2 * u;
+    float h00 = 2.0f * u3 - 3.0f * u2 + 1.0f;
+    float h10 = u3 - 2.0f * u2 + u;
+    float h01 = -2.0f * u3 + 3.0f * u2;
+    float h11 = u3 - u2;
+    return h00 * p0 + h10 * outgoingTangents.at(segmentIdx) + h01 * p1 + h11 * incomingTangents.at(segmentIdx + 1);
+}
+
+glm::quat CameraPath::evaluateOrientation(size_t segmentIdx, float u) const {
+    const glm::quat& q0 = orientations.at(segmentIdx);
+    const glm::quat& q1 = orientations.at(segmentIdx + 1);
+    if (interpolation == CameraPathInterpolation::LINEAR || squadControlPoints.empty()) {
+        return glm::slerp(q0, q1, u);
+    }
+    glm::quat slerpOuter = glm::slerp(q0, q1, u);
+    glm::quat slerpInner = glm::slerp(squadControlPoints.at(segmentIdx), squadControlPoints.at(segmentIdx + 1), u);
+    return glm::slerp(slerpOuter, slerpInner, 2.0f * u * (1.0f - u));
+}
+
 }
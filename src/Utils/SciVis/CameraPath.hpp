@@ -63,6 +63,21 @@ public:
  */
 typedef std::function<void(const std::string&, glm::vec3&, float&, float&, float&)> ApplicationCallback;
 
+/**
+ * How the camera position is interpolated between control points. The orientation is interpolated with slerp for
+ * LINEAR and with squad (spherical cubic interpolation) otherwise.
+ */
+enum class CameraPathInterpolation {
+    LINEAR, CATMULL_ROM, KOCHANEK_BARTELS
+};
+
+/// Tension, bias and continuity of Kochanek-Bartels splines (all zero corresponds to Catmull-Rom).
+struct DLL_OBJECT KochanekBartelsParameters {
+    float tension = 0.0f;
+    float bias = 0.0f;
+    float continuity = 0.0f;
+};
+
 class DLL_OBJECT CameraPath {
 public:
     CameraPath() = default;
@@ -80,14 +95,57 @@ public:
     [[nodiscard]] inline float getEndTime() const { return controlPoints.empty() ? 0.0f : controlPoints.back().time; }
     [[nodiscard]] inline bool empty() const { return controlPoints.empty(); }
 
+    // Interpolation settings (the default is the piecewise linear interpolation with slerp).
+    void setInterpolation(CameraPathInterpolation interpolationMode);
+    [[nodiscard]] inline CameraPathInterpolation getInterpolation() const { return interpolation; }
+    void setKochanekBartelsParameters(const KochanekBartelsParameters& parameters);
+    /// Reparameterizes the path by arc length, i.e., the camera moves with constant speed from start to end time.
+    void setUseConstantSpeed(bool useConstantSpeed);
+    [[nodiscard]] inline bool getUseConstantSpeed() const { return useConstantSpeed; }
+
+    /// Evaluates the view matrix at a time (wrapped to [0, end time)) without changing the state of the path.
+    [[nodiscard]] glm::mat4 evaluate(float currentTime) const;
+    /// The number of frames needed for playing back the path once at the passed frame rate.
+    [[nodiscard]] size_t getNumFrames(float framesPerSecond) const;
+    /**
+     * Samples the view matrices of the frames [firstFrame, firstFrame + numFrames) in parallel. Frame i is evaluated
+     * at time i / framesPerSecond (computed in double precision), so the frames of a recording can be distributed over
+     * multiple processes and reproduced exactly.
+     */
+    [[nodiscard]] std::vector<glm::mat4> sampleFrameTransforms(
+            float framesPerSecond, size_t firstFrame, size_t numFrames) const;
+    /// Samples the view matrices of all frames of one playback (@see getNumFrames).
+    [[nodiscard]] std::vector<glm::mat4> sampleFrameTransforms(float framesPerSecond) const;
+
 private:
-    glm::mat4 toTransform(const glm::vec3 &position, const glm::quat &orientation);
+    static glm::mat4 toTransform(const glm::vec3 &position, const glm::quat &orientation);
+    /// Recomputes the tangents, squad control quaternions and the arc length table.
+    void updateInterpolationData();
+    /// Returns the index i of the segment [t_i, t_{i+1}) containing the time (binary search).
+    [[nodiscard]] size_t findSegment(float t) const;
+    /// Returns the segment and the segment parameter in [0, 1] for a time in [0, end time].
+    void computeSegmentParameter(float t, size_t& segmentIdx, float& u) const;
+    [[nodiscard]] glm::vec3 evaluatePosition(size_t segmentIdx, float u) const;
+    [[nodiscard]] glm::quat evaluateOrientation(size_t segmentIdx, float u) const;
+    [[nodiscard]] float wrapTime(float currentTime) const;
 
     const uint32_t CAMERA_PATH_FORMAT_VERSION = 1u;
     glm::mat4 currentTransform{};
     std::vector<ControlPoint> controlPoints;
     float time = 0.0f;
 
+    // Interpolation data.
+    CameraPathInterpolation interpolation = CameraPathInterpolation::LINEAR;
+    KochanekBartelsParameters kochanekBartelsParameters;
+    bool useConstantSpeed = false;
+    std::vector<glm::quat> orientations; ///< Control point orientations with consistent hemispheres.
+    std::vector<glm::vec3> outgoingTangents; ///< Hermite tangent at the start of segment i.
+    std::vector<glm::vec3> incomingTangents; ///< Hermite tangent at the end of segment i - 1.
+    std::vector<glm::quat> squadControlPoints;
+    /// Cumulative arc length at the samples u = j / NUM_ARC_LENGTH_SAMPLES of every segment.
+    std::vector<float> arcLengthTable;
+    static const int NUM_ARC_LENGTH_SAMPLES = 32;
+
     bool useApplicationCallback = false;
     ApplicationCallback applicationCallback;
 };
@@ -0,0 +1,310 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <Utils/Convert.hpp>
+#include <Utils/File/Logfile.hpp>
+#include <Utils/File/CsvWriter.hpp>
+#include <Utils/Json/SimpleJson.hpp>
+
+#include "FrameTimeBenchmark.hpp"
+
+namespace sgl {
+
+static double computePercentile(const std::vector<double>& sortedSamples, double percentile) {
+    double rank = percentile / 100.0 * double(sortedSamples.size() - 1);
+    auto lowerIdx = size_t(std::floor(rank));
+    size_t upperIdx = std::min(lowerIdx + 1, sortedSamples.size() - 1);
+    double fraction = rank - double(lowerIdx);
+    return sortedSamples.at(lowerIdx) + fraction * (sortedSamples.at(upperIdx) - sortedSamples.at(lowerIdx));
+}
+
+FrameTimeStatistics FrameTimeStatistics::compute(std::vector<double> samples, double stutterThresholdFactor) {
+    FrameTimeStatistics statistics;
+    statistics.numSamples = samples.size();
+    if (samples.empty()) {
+        return statistics;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    statistics.mean = sum / double(samples.size());
+    double sumSquaredDiffs = 0.0;
+    for (double sample : samples) {
+        double diff = sample - statistics.mean;
+        sumSquaredDiffs += diff * diff;
+    }
+    if (samples.size() > 1) {
+        statistics.variance = sumSquaredDiffs / double(samples.size() - 1);
+    }
+    statistics.standardDeviation = std::sqrt(statistics.variance);
+    statistics.minimum = samples.front();
+    statistics.maximum = samples.back();
+    statistics.median = computePercentile(samples, 50.0);
+    statistics.percentile90 = computePercentile(samples, 90.0);
+    statistics.percentile95 = computePercentile(samples, 95.0);
+    statistics.percentile99 = computePercentile(samples, 99.0);
+    double stutterThreshold = stutterThresholdFactor * statistics.median;
+    statistics.numStutters = size_t(samples.end() - std::upper_bound(samples.begin(), samples.end(), stutterThreshold));
+    return statistics;
+}
+
+bool FrameTimeBenchmarkSettings::parseCommandLineArguments(int argc, const char** argv) {
+    bool useBenchmark = false;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc && std::strncmp(argv[i + 1], "--", 2) != 0;
+        if (std::strcmp(arg, "--benchmark") == 0) {
+            useBenchmark = true;
+            if (hasValue) {
+                name = argv[++i];
+            }
+        } else if (std::strncmp(arg, "--benchmark-", 12) == 0) {
+            if (!hasValue) {
+                sgl::Logfile::get()->writeError(
+                        std::string() + "Error in FrameTimeBenchmarkSettings::parseCommandLineArguments: "
+                        + "Missing value for argument \"" + arg + "\".", false);
+                continue;
+            }
+            std::string value = argv[++i];
+            if (std::strcmp(arg, "--benchmark-camera-path") == 0) {
+                cameraPathFilename = value;
+            } else if (std::strcmp(arg, "--benchmark-warmup") == 0) {
+                numWarmupIterations = std::max(sgl::fromString<int>(value), 0);
+            } else if (std::strcmp(arg, "--benchmark-iterations") == 0) {
+                numMeasuredIterations = std::max(sgl::fromString<int>(value), 1);
+            } else if (std::strcmp(arg, "--benchmark-fps") == 0) {
+                framesPerSecond = std::max(sgl::fromString<float>(value), 1.0f);
+            } else if (std::strcmp(arg, "--benchmark-stutter-factor") == 0) {
+                stutterThresholdFactor = std::max(sgl::fromString<double>(value), 1.0);
+            } else if (std::strcmp(arg, "--benchmark-json") == 0) {
+                reportFilenameJson = value;
+            } else if (std::strcmp(arg, "--benchmark-csv") == 0) {
+                reportFilenameCsv = value;
+            } else {
+                sgl::Logfile::get()->writeError(
+                        std::string() + "Error in FrameTimeBenchmarkSettings::parseCommandLineArguments: "
+                        + "Unknown argument \"" + arg + "\".", false);
+            }
+        }
+    }
+    return useBenchmark;
+}
+
+void FrameTimeBenchmark::start(const FrameTimeBenchmarkSettings& _settings, size_t _numFramesPerIteration) {
+    settings = _settings;
+    numFramesPerIteration = std::max(_numFramesPerIteration, size_t(1));
+    isRunning = true;
+    iterationIdx = 0;
+    frameIdx = 0;
+    hasLastFrameEnd = false;
+    frameTimesMs.clear();
+    cpuTimesMs.clear();
+    gpuTimesMs.clear();
+    size_t numMeasuredFrames = size_t(settings.numMeasuredIterations) * numFramesPerIteration;
+    frameTimesMs.reserve(numMeasuredFrames);
+    cpuTimesMs.reserve(numMeasuredFrames);
+}
+
+void FrameTimeBenchmark::stop() {
+    isRunning = false;
+}
+
+float FrameTimeBenchmark::getCurrentTime() const {
+    return float(double(frameIdx) / double(settings.framesPerSecond));
+}
+
+void FrameTimeBenchmark::beginFrame() {
+    frameStartTime = std::chrono::steady_clock::now();
+}
+
+void FrameTimeBenchmark::endFrame(double gpuTimeMs) {
+    if (getIsFinished()) {
+        return;
+    }
+    auto frameEndTime = std::chrono::steady_clock::now();
+    if (!getIsWarmup()) {
+        cpuTimesMs.push_back(std::chrono::duration<double, std::milli>(frameEndTime - frameStartTime).count());
+        // The first measured frame is timed relative to the last warm-up frame (if any).
+        auto lastEndTime = hasLastFrameEnd ? lastFrameEndTime : frameStartTime;
+        frameTimesMs.push_back(std::chrono::duration<double, std::milli>(frameEndTime - lastEndTime).count());
+        if (gpuTimeMs >= 0.0) {
+            gpuTimesMs.push_back(gpuTimeMs);
+        }
+    }
+    lastFrameEndTime = frameEndTime;
+    hasLastFrameEnd = true;
+
+    frameIdx++;
+    if (frameIdx >= numFramesPerIteration) {
+        frameIdx = 0;
+        iterationIdx++;
+    }
+}
+
+void FrameTimeBenchmark::setGpuFrameTimes(const std::vector<uint64_t>& gpuTimesNs) {
+    gpuTimesMs.clear();
+    gpuTimesMs.reserve(gpuTimesNs.size());
+    for (uint64_t gpuTimeNs : gpuTimesNs) {
+        gpuTimesMs.push_back(double(gpuTimeNs) * 1e-6);
+    }
+}
+
+void FrameTimeBenchmark::setFrameTimes(
+        const std::vector<uint64_t>& frameTimesNs, const std::vector<uint64_t>& cpuTimesNs) {
+    frameTimesMs.clear();
+    frameTimesMs.reserve(frameTimesNs.size());
+    for (uint64_t frameTimeNs : frameTimesNs) {
+        frameTimesMs.push_back(double(frameTimeNs) * 1e-6);
+    }
+    cpuTimesMs.clear();
+    cpuTimesMs.reserve(cpuTimesNs.size());
+    for (uint64_t cpuTimeNs : cpuTimesNs) {
+        cpuTimesMs.push_back(double(cpuTimeNs) * 1e-6);
+    }
+}
+
+FrameTimeStatistics FrameTimeBenchmark::getFrameTimeStatistics() const {
+    return FrameTimeStatistics::compute(frameTimesMs, settings.stutterThresholdFactor);
+}
+
+FrameTimeStatistics FrameTimeBenchmark::getCpuTimeStatistics() const {
+    return FrameTimeStatistics::compute(cpuTimesMs, settings.stutterThresholdFactor);
+}
+
+FrameTimeStatistics FrameTimeBenchmark::getGpuTimeStatistics() const {
+    return FrameTimeStatistics::compute(gpuTimesMs, settings.stutterThresholdFactor);
+}
+
+static JsonValue statisticsToJson(const FrameTimeStatistics& statistics) {
+    JsonValue statisticsJson;
+    statisticsJson["num_samples"] = uint64_t(statistics.numSamples);
+    statisticsJson["mean"] = statistics.mean;
+    statisticsJson["median"] = statistics.median;
+    statisticsJson["min"] = statistics.minimum;
+    statisticsJson["max"] = statistics.maximum;
+    statisticsJson["variance"] = statistics.variance;
+    statisticsJson["stddev"] = statistics.standardDeviation;
+    statisticsJson["p90"] = statistics.percentile90;
+    statisticsJson["p95"] = statistics.percentile95;
+    statisticsJson["p99"] = statistics.percentile99;
+    statisticsJson["num_stutters"] = uint64_t(statistics.numStutters);
+    return statisticsJson;
+}
+
+static JsonValue samplesToJson(const std::vector<double>& samples) {
+    JsonValue samplesJson(JsonValueType::ARRAY_VALUE);
+    for (size_t i = 0; i < samples.size(); i++) {
+        samplesJson[i] = samples.at(i);
+    }
+    return samplesJson;
+}
+
+bool FrameTimeBenchmark::writeReportJson(const std::string& filename) const {
+    JsonValue settingsJson;
+    settingsJson["camera_path"] = settings.cameraPathFilename;
+    settingsJson["num_warmup_iterations"] = int32_t(settings.numWarmupIterations);
+    settingsJson["num_measured_iterations"] = int32_t(settings.numMeasuredIterations);
+    settingsJson["frames_per_second"] = settings.framesPerSecond;
+    settingsJson["stutter_threshold_factor"] = settings.stutterThresholdFactor;
+    settingsJson["num_frames_per_iteration"] = uint64_t(numFramesPerIteration);
+
+    JsonValue statisticsJson;
+    JsonValue samplesJson;
+    statisticsJson["frame_time"] = statisticsToJson(getFrameTimeStatistics());
+    statisticsJson["cpu_time"] = statisticsToJson(getCpuTimeStatistics());
+    samplesJson["frame_time"] = samplesToJson(frameTimesMs);
+    samplesJson["cpu_time"] = samplesToJson(cpuTimesMs);
+    if (!gpuTimesMs.empty()) {
+        statisticsJson["gpu_time"] = statisticsToJson(getGpuTimeStatistics());
+        samplesJson["gpu_time"] = samplesToJson(gpuTimesMs);
+    }
+
+    JsonValue root;
+    root["name"] = settings.name;
+    root["unit"] = "ms";
+    root["settings"] = settingsJson;
+    root["statistics"] = statisticsJson;
+    root["samples"] = samplesJson;
+    return writeSimpleJson(filename, root, 4);
+}
+
+bool FrameTimeBenchmark::writeReportCsv(const std::string& filename) const {
+    CsvWriter writer;
+    if (!writer.open(filename)) {
+        return false;
+    }
+    writer.writeRow({
+            "name", "metric", "num_samples", "mean", "median", "min", "max", "variance", "stddev",
+            "p90", "p95", "p99", "num_stutters" });
+    auto writeStatisticsRow = [&](const std::string& metric, const FrameTimeStatistics& statistics) {
+        writer.writeRow({
+                settings.name, metric, toStringLocaleC(statistics.numSamples),
+                toStringLocaleC(statistics.mean), toStringLocaleC(statistics.median),
+                toStringLocaleC(statistics.minimum), toStringLocaleC(statistics.maximum),
+                toStringLocaleC(statistics.variance), toStringLocaleC(statistics.standardDeviation),
+                toStringLocaleC(statistics.percentile90), toStringLocaleC(statistics.percentile95),
+                toStringLocaleC(statistics.percentile99), toStringLocaleC(statistics.numStutters) });
+    };
+    writeStatisticsRow("frame_time", getFrameTimeStatistics());
+    writeStatisticsRow("cpu_time", getCpuTimeStatistics());
+    if (!gpuTimesMs.empty()) {
+        writeStatisticsRow("gpu_time", getGpuTimeStatistics());
+    }
+    writer.close();
+    return true;
+}
+
+void FrameTimeBenchmark::writeReports() const {
+    if (!settings.reportFilenameJson.empty() && !writeReportJson(settings.reportFilenameJson)) {
+        sgl::Logfile::get()->writeError(
+                "Error in FrameTimeBenchmark::writeReports: Couldn't write \"" + settings.reportFilenameJson + "\".",
+                false);
+    }
+    if (!settings.reportFilenameCsv.empty() && !writeReportCsv(settings.reportFilenameCsv)) {
+        sgl::Logfile::get()->writeError(
+                "Error in FrameTimeBenchmark::writeReports: Couldn't write \"" + settings.reportFilenameCsv + "\".",
+                false);
+    }
+
+    FrameTimeStatistics frameTimeStatistics = getFrameTimeStatistics();
+    sgl::Logfile::get()->writeInfo(
+            "Benchmark \"" + settings.name + "\": " + std::to_string(frameTimeStatistics.numSamples)
+            + " frames, frame time mean " + toString(frameTimeStatistics.mean, 3) + "ms, median "
+            + toString(frameTimeStatistics.median, 3) + "ms, p99 "
+            + toString(frameTimeStatistics.percentile99, 3) + "ms, "
+            + std::to_string(frameTimeStatistics.numStutters) + " stutters.");
+}
+
+}
@@ -0,0 +1,150 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SGL_FRAMETIMEBENCHMARK_HPP
+#define SGL_FRAMETIMEBENCHMARK_HPP
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+namespace sgl {
+
+/// Summary statistics of a list of frame time samples (in milliseconds).
+struct DLL_OBJECT FrameTimeStatistics {
+    size_t numSamples = 0;
+    double mean = 0.0;
+    double median = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double variance = 0.0; ///< Unbiased sample variance.
+    double standardDeviation = 0.0;
+    double percentile90 = 0.0;
+    double percentile95 = 0.0;
+    double percentile99 = 0.0;
+    size_t numStutters = 0; ///< Samples taking longer than the stutter threshold factor times the median.
+
+    /// Percentiles use linear interpolation between the closest ranks.
+    static FrameTimeStatistics compute(std::vector<double> samples, double stutterThresholdFactor = 2.0);
+};
+
+struct DLL_OBJECT FrameTimeBenchmarkSettings {
+    std::string name = "Benchmark";
+    /// Optional camera path file (@see CameraPath::fromBinaryFile). If empty, the path of the application is used.
+    std::string cameraPathFilename;
+    int numWarmupIterations = 1; ///< Replays of the camera path that are not measured (caches, JIT, clocks).
+    int numMeasuredIterations = 3;
+    float framesPerSecond = 30.0f; ///< Rate at which the camera path is sampled (independent of the wall clock).
+    double stutterThresholdFactor = 2.0; ///< Frames taking longer than this factor times the median are stutters.
+    std::string reportFilenameJson; ///< Not written if empty.
+    std::string reportFilenameCsv; ///< Not written if empty.
+    bool quitWhenFinished = true;
+
+    /**
+     * Parses the benchmark settings from the command line arguments of the application. Recognized arguments:
+     * --benchmark [name], --benchmark-camera-path <file>, --benchmark-warmup <n>, --benchmark-iterations <n>,
+     * --benchmark-fps <fps>, --benchmark-stutter-factor <factor>, --benchmark-json <file>, --benchmark-csv <file>.
+     * @return True if "--benchmark" was passed.
+     */
+    bool parseCommandLineArguments(int argc, const char** argv);
+};
+
+/**
+ * Replays a camera path with a fixed time step a configurable number of warm-up and measured iterations and gathers
+ * per-frame timings. As every frame renders exactly the same camera transform in every run, results are reproducible
+ * and can be compared between runs (e.g., for tracking frame time regressions in CI with a software renderer).
+ *
+ * Usage: @see start, then call @see beginFrame and @see endFrame around each rendered frame and use
+ * @see getCurrentTime for the camera path time of the frame. GPU times can be passed to @see endFrame or, as GPU
+ * timer queries are usually resolved with a delay, all at once with @see setGpuFrameTimes.
+ * The following metrics are reported for the measured frames:
+ * - "frame_time": Wall clock time between the ends of two consecutive frames (including presentation).
+ * - "cpu_time": CPU time between @see beginFrame and @see endFrame.
+ * - "gpu_time": GPU time of the frame, if available.
+ */
+class DLL_OBJECT FrameTimeBenchmark {
+public:
+    void start(const FrameTimeBenchmarkSettings& settings, size_t numFramesPerIteration);
+    void stop();
+
+    [[nodiscard]] inline const FrameTimeBenchmarkSettings& getSettings() const { return settings; }
+    [[nodiscard]] inline bool getIsRunning() const { return isRunning; }
+    /// Whether all iterations have been rendered.
+    [[nodiscard]] inline bool getIsFinished() const { return isRunning && iterationIdx >= getNumIterations(); }
+    [[nodiscard]] inline bool getIsWarmup() const { return iterationIdx < settings.numWarmupIterations; }
+    [[nodiscard]] inline int getIterationIdx() const { return iterationIdx; }
+    [[nodiscard]] inline size_t getFrameIdx() const { return frameIdx; }
+    [[nodiscard]] inline size_t getNumFramesPerIteration() const { return numFramesPerIteration; }
+    /// Camera path time of the current frame.
+    [[nodiscard]] float getCurrentTime() const;
+
+    void beginFrame();
+    /// @param gpuTimeMs The GPU time of the frame or a negative value if not available.
+    void endFrame(double gpuTimeMs = -1.0);
+    /// Sets the GPU times of all measured frames (in nanoseconds, in frame order).
+    void setGpuFrameTimes(const std::vector<uint64_t>& gpuTimesNs);
+    /// Replaces the frame and CPU times of all measured frames (in nanoseconds, in frame order), e.g., by times
+    /// measured by an external tool.
+    void setFrameTimes(const std::vector<uint64_t>& frameTimesNs, const std::vector<uint64_t>& cpuTimesNs);
+
+    [[nodiscard]] FrameTimeStatistics getFrameTimeStatistics() const;
+    [[nodiscard]] FrameTimeStatistics getCpuTimeStatistics() const;
+    [[nodiscard]] FrameTimeStatistics getGpuTimeStatistics() const;
+
+    /// Writes the settings, the statistics of all metrics and the per-frame samples.
+    bool writeReportJson(const std::string& filename) const;
+    /// Writes one row with the statistics per metric.
+    bool writeReportCsv(const std::string& filename) const;
+    /// Writes the reports to the files specified in the settings.
+    void writeReports() const;
+
+private:
+    [[nodiscard]] inline int getNumIterations() const {
+        return settings.numWarmupIterations + settings.numMeasuredIterations;
+    }
+
+    FrameTimeBenchmarkSettings settings;
+    bool isRunning = false;
+    size_t numFramesPerIteration = 0;
+    int iterationIdx = 0;
+    size_t frameIdx = 0;
+
+    bool hasLastFrameEnd = false;
+    std::chrono::time_point<std::chrono::steady_clock> frameStartTime;
+    std::chrono::time_point<std::chrono::steady_clock> lastFrameEndTime;
+
+    // Samples of the measured frames in milliseconds.
+    std::vector<double> frameTimesMs;
+    std::vector<double> cpuTimesMs;
+    std::vector<double> gpuTimesMs;
+};
+
+}
+
+#endif //SGL_FRAMETIMEBENCHMARK_HPP
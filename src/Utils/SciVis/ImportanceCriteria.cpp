@@ -33,42 +33,148 @@
 #include <Math/Geometry/fallback/vec3.hpp>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SGL_IMPORTANCE_CRITERIA_USE_SSE2
+#endif
+
 #ifdef USE_TBB
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 #endif
 
 #include <Math/Math.hpp>
+#include <Math/half/half.hpp>
+#include <Math/half/HalfFloatSimd.hpp>
 #include <Utils/Parallel/Reduction.hpp>
 #include "ImportanceCriteria.hpp"
 
 namespace sgl {
 
-/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
-void packUnorm16Array(const std::vector<float>& floatVector, std::vector<uint16_t>& unormVector) {
-    // LLVM raises the error "capturing a structured binding is not yet supported in OpenMP" with the following line...
-    //auto [minValue, maxValue] = reduceFloatArrayMinMax(floatVector);
-    auto [minValueBinding, maxValueBinding] = reduceFloatArrayMinMax(floatVector);
-    const float minValue = minValueBinding;
-    const float maxValue = maxValueBinding;
-    unormVector.resize(floatVector.size());
+/*
+ * The values are processed in chunks, which are distributed over the threads and vectorized with SSE2 if available.
+ * The quantization gives the same results as the scalar formula
+ * uint16_t(glm::clamp(glm::round((value - minValue) / (maxValue - minValue) * 65535.0f), 0.0f, 65535.0f)), i.e., the
+ * same operations are used in the same order and halfway cases are rounded away from zero. NaN values (and all values
+ * if minValue == maxValue) are mapped to 0.
+ */
+static const size_t PACK_UNORM_CHUNK_SIZE = 65536;
+
+template<class F>
+static void parallelForChunks(size_t numValues, F&& processChunk) {
+    const size_t numChunks = sizeceil(numValues, PACK_UNORM_CHUNK_SIZE);
 #ifdef USE_TBB
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, unormVector.size()), [&](auto const& r) {
-        for (size_t i = r.begin(); i != r.end(); i++) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](auto const& r) {
+        for (auto chunkIdx = r.begin(); chunkIdx != r.end(); chunkIdx++) {
 #else
 #if _OPENMP >= 200805
-    #pragma omp parallel for shared(floatVector, unormVector, minValue, maxValue) default(none)
+    #pragma omp parallel for shared(numChunks, numValues, processChunk) default(none)
 #endif
-    for (size_t i = 0; i < unormVector.size(); i++) {
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
 #endif
-        unormVector.at(i) = uint16_t(glm::clamp(glm::round(
-                (floatVector.at(i) - minValue) / (maxValue - minValue) * 65535.0f), 0.0f, 65535.0f));
+        size_t begin = chunkIdx * size_t(PACK_UNORM_CHUNK_SIZE);
+        size_t end = std::min(begin + size_t(PACK_UNORM_CHUNK_SIZE), numValues);
+        processChunk(begin, end);
     }
 #ifdef USE_TBB
     });
 #endif
 }
 
+static inline uint16_t quantizeUnorm16(float value, float minValue, float valueRange) {
+    float x = (value - minValue) / valueRange * 65535.0f;
+    x = x > 0.0f ? x : 0.0f;
+    x = x < 65535.0f ? x : 65535.0f;
+    auto quantized = uint32_t(x);
+    if (x - float(quantized) >= 0.5f) {
+        quantized++;
+    }
+    return uint16_t(quantized);
+}
+
+#ifdef SGL_IMPORTANCE_CRITERIA_USE_SSE2
+class Unorm16QuantizerSse2 {
+public:
+    Unorm16QuantizerSse2(float minValue, float valueRange) {
+        minValues = _mm_set1_ps(minValue);
+        valueRanges = _mm_set1_ps(valueRange);
+    }
+
+    /// Quantizes 2x4 values and stores them as eight unaligned 16-bit values.
+    inline void quantizeAndStore8(__m128 valuesLo, __m128 valuesHi, uint16_t* dst) const {
+        // SSE2 only has a signed saturating 32-bit to 16-bit pack, so the values are shifted to the signed range.
+        __m128i quantizedLo = _mm_sub_epi32(quantize4(valuesLo), _mm_set1_epi32(32768));
+        __m128i quantizedHi = _mm_sub_epi32(quantize4(valuesHi), _mm_set1_epi32(32768));
+        __m128i packed = _mm_xor_si128(_mm_packs_epi32(quantizedLo, quantizedHi), _mm_set1_epi16(short(0x8000)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+    }
+
+private:
+    inline __m128i quantize4(__m128 values) const {
+        __m128 x = _mm_mul_ps(_mm_div_ps(_mm_sub_ps(values, minValues), valueRanges), _mm_set1_ps(65535.0f));
+        // _mm_max_ps returns the second operand for NaN.
+        x = _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(65535.0f));
+        __m128i quantized = _mm_cvttps_epi32(x);
+        __m128 fraction = _mm_sub_ps(x, _mm_cvtepi32_ps(quantized));
+        // The comparison mask is -1 for the values to round up.
+        __m128i roundUp = _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)));
+        return _mm_sub_epi32(quantized, roundUp);
+    }
+
+    __m128 minValues, valueRanges;
+};
+#endif
+
+void packUnorm16Array(
+        const float* values, size_t numValues, float minValue, float maxValue, uint16_t* unormValues) {
+    const float valueRange = maxValue - minValue;
+    parallelForChunks(numValues, [&](size_t begin, size_t end) {
+        size_t i = begin;
+#ifdef SGL_IMPORTANCE_CRITERIA_USE_SSE2
+        Unorm16QuantizerSse2 quantizer(minValue, valueRange);
+        for (; i + 8 <= end; i += 8) {
+            quantizer.quantizeAndStore8(_mm_loadu_ps(values + i), _mm_loadu_ps(values + i + 4), unormValues + i);
+        }
+#endif
+        for (; i < end; i++) {
+            unormValues[i] = quantizeUnorm16(values[i], minValue, valueRange);
+        }
+    });
+}
+
+void packUnorm16Array(
+        const HalfFloat* values, size_t numValues, float minValue, float maxValue, uint16_t* unormValues) {
+    const float valueRange = maxValue - minValue;
+    parallelForChunks(numValues, [&](size_t begin, size_t end) {
+        size_t i = begin;
+#if defined(SGL_IMPORTANCE_CRITERIA_USE_SSE2) && defined(SGL_HALF_FLOAT_USE_SSE2)
+        Unorm16QuantizerSse2 quantizer(minValue, valueRange);
+        __m128 valuesLo, valuesHi;
+        for (; i + 8 <= end; i += 8) {
+            loadHalfFloat8Sse2(values + i, valuesLo, valuesHi);
+            quantizer.quantizeAndStore8(valuesLo, valuesHi, unormValues + i);
+        }
+#endif
+        for (; i < end; i++) {
+            unormValues[i] = quantizeUnorm16(float(values[i]), minValue, valueRange);
+        }
+    });
+}
+
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
+void packUnorm16Array(const std::vector<float>& floatVector, std::vector<uint16_t>& unormVector) {
+    // The value range is needed before any value can be quantized, so this needs two passes over the data.
+    auto [minValue, maxValue] = reduceFloatArrayMinMax(floatVector);
+    unormVector.resize(floatVector.size());
+    packUnorm16Array(floatVector.data(), floatVector.size(), minValue, maxValue, unormVector.data());
+}
+
+void packUnorm16Array(const HalfFloat* values, size_t numValues, std::vector<uint16_t>& unormVector) {
+    auto [minValue, maxValue] = reduceHalfFloatArrayMinMax(values, numValues);
+    unormVector.resize(numValues);
+    packUnorm16Array(values, numValues, minValue, maxValue, unormVector.data());
+}
+
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
 void packUnorm16ArrayOfArrays(
         const std::vector<std::vector<float>> &floatVector,
@@ -83,20 +189,24 @@ void packUnorm16ArrayOfArrays(
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/unpackUnorm.xhtml
 void unpackUnorm16Array(const uint16_t* unormVector, size_t vectorSize, std::vector<float>& floatVector) {
     floatVector.resize(vectorSize);
-#ifdef USE_TBB
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, vectorSize), [&](auto const& r) {
-        for (size_t i = r.begin(); i != r.end(); i++) {
-#else
-#if _OPENMP >= 200805
-    #pragma omp parallel for shared(floatVector, unormVector, vectorSize) default(none)
-#endif
-    for (size_t i = 0; i < vectorSize; i++) {
+    float* floatValues = floatVector.data();
+    parallelForChunks(vectorSize, [&](size_t begin, size_t end) {
+        size_t i = begin;
+#ifdef SGL_IMPORTANCE_CRITERIA_USE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 maxUnorm = _mm_set1_ps(65535.0f);
+        for (; i + 8 <= end; i += 8) {
+            __m128i unormValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unormVector + i));
+            __m128 valuesLo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(unormValues, zero));
+            __m128 valuesHi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(unormValues, zero));
+            _mm_storeu_ps(floatValues + i, _mm_div_ps(valuesLo, maxUnorm));
+            _mm_storeu_ps(floatValues + i + 4, _mm_div_ps(valuesHi, maxUnorm));
+        }
 #endif
-        floatVector.at(i) = float(unormVector[i]) / 65535.0f;
-    }
-#ifdef USE_TBB
+        for (; i < end; i++) {
+            floatValues[i] = float(unormVector[i]) / 65535.0f;
+        }
     });
-#endif
 }
 
 
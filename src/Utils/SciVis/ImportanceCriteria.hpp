@@ -30,13 +30,29 @@
 #define LINEDENSITYCONTROL_IMPORTANCECRITERIA_HPP
 
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 #include <cfloat>
 
+class HalfFloat;
+
 namespace sgl {
 
-/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
+/**
+ * Normalizes the values to [0, 1] using their minimum and maximum and quantizes them to 16-bit UNORM values.
+ * https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
+ */
 DLL_OBJECT void packUnorm16Array(const std::vector<float>& floatVector, std::vector<uint16_t>& unormVector);
+DLL_OBJECT void packUnorm16Array(const HalfFloat* values, size_t numValues, std::vector<uint16_t>& unormVector);
+
+/**
+ * Variants for a known value range (e.g., from a histogram summary or file metadata), which only need a single pass
+ * over the data. Values outside of [minValue, maxValue] are clamped.
+ */
+DLL_OBJECT void packUnorm16Array(
+        const float* values, size_t numValues, float minValue, float maxValue, uint16_t* unormValues);
+DLL_OBJECT void packUnorm16Array(
+        const HalfFloat* values, size_t numValues, float minValue, float maxValue, uint16_t* unormValues);
 
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/packUnorm.xhtml
 DLL_OBJECT void packUnorm16ArrayOfArrays(
@@ -27,6 +27,7 @@
  */
 
 #include <memory>
+#include <cmath>
 #include <Utils/Timer.hpp>
 #include <Utils/File/Logfile.hpp>
 #include <Utils/File/FileUtils.hpp>
@@ -54,6 +55,7 @@
 #include <Graphics/Vulkan/Utils/Swapchain.hpp>
 #include <Graphics/Vulkan/Utils/Device.hpp>
 #include <Graphics/Vulkan/Utils/ScreenshotReadbackHelper.hpp>
+#include <Graphics/Vulkan/Utils/Timer.hpp>
 #include <Graphics/Vulkan/Image/Image.hpp>
 #include <Graphics/Vulkan/Render/Renderer.hpp>
 #include <Graphics/Vulkan/Render/Data.hpp>
@@ -128,6 +130,11 @@ SciVisApp::SciVisApp(float fovy)
     sgl::FileUtils::get()->ensureDirectoryExists(saveDirectoryCameraPaths);
     setPrintFPS(false);
 
+    if (benchmarkSettings.parseCommandLineArguments(
+            sgl::FileUtils::get()->get_argc(), sgl::FileUtils::get()->get_argv())) {
+        startBenchmark(benchmarkSettings);
+    }
+
 #ifdef SUPPORT_OPENGL
     if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::OPENGL) {
         gammaCorrectionShader = sgl::ShaderManager->getShaderProgram(
@@ -599,6 +606,27 @@ void SciVisApp::preRender() {
     }
 #endif
 
+    benchmarkFrameStarted = benchmark.getIsRunning() && !benchmark.getIsFinished();
+    if (benchmarkFrameStarted) {
+        benchmark.beginFrame();
+#ifdef SUPPORT_VULKAN
+        // GPU times are only queried for the measured frames. vk::Timer::startGPU reads back (with
+        // VK_QUERY_RESULT_WAIT_BIT) the queries of the frame that last used the current swapchain image. The fence of
+        // that frame has already been waited on at this point, so this does normally not stall. The queries of the
+        // last frames in flight are resolved when the benchmark has finished.
+        benchmarkTimeGpu = false;
+        if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::VULKAN && !benchmark.getIsWarmup()
+                && device->getPhysicalDeviceProperties().limits.timestampComputeAndGraphics) {
+            if (!benchmarkTimerVk) {
+                benchmarkTimerVk = std::make_shared<sgl::vk::Timer>(rendererVk);
+                benchmarkTimerVk->setStoreFrameTimeList(true);
+            }
+            benchmarkTimerVk->startGPU("Frame");
+            benchmarkTimeGpu = true;
+        }
+#endif
+    }
+
 #ifdef SUPPORT_WEBGPU
     if (sgl::AppSettings::get()->getRenderSystem() == RenderSystem::WEBGPU && reRender) {
         auto clearColorBg = clearColor.getFloatColorRGBA();
@@ -794,6 +822,16 @@ void SciVisApp::postRender() {
     }
 #endif
 
+    if (benchmarkFrameStarted) {
+#ifdef SUPPORT_VULKAN
+        if (benchmarkTimeGpu) {
+            benchmarkTimerVk->endGPU("Frame");
+        }
+#endif
+        benchmark.endFrame();
+        benchmarkFrameStarted = false;
+    }
+
     isFirstRecordingFrame = false;
 }
 
@@ -1153,9 +1191,84 @@ void SciVisApp::update(float dt) {
     fpsArrayOffset = (fpsArrayOffset + 1) % fpsArray.size();
     fpsArray[fpsArrayOffset] = 1.0f/dt;
     recordingTimeLast = recordingTime;
+
+    // Camera flights, video recordings and benchmarks advance every frame without any user input.
+    if (useCameraFlight || recording || benchmarkPending || benchmark.getIsRunning()) {
+        requestRedraw();
+    }
+}
+
+void SciVisApp::onPipelinedUpdateStart(uint32_t frameStateIndex) {
+    SciVisFrameState& frameState = pipelinedFrameStates[frameStateIndex];
+    frameState.viewMatrix = camera->getViewMatrix();
+    frameState.projectionMatrix = camera->getProjectionMatrix();
+    frameState.recordingTime = recordingTime;
+}
+
+void SciVisApp::startBenchmark(const FrameTimeBenchmarkSettings& settings) {
+    benchmarkSettings = settings;
+    benchmarkPending = true;
+}
+
+void SciVisApp::updateBenchmark() {
+    if (benchmarkPending) {
+        benchmarkPending = false;
+        if (!benchmarkSettings.cameraPathFilename.empty()
+                && !cameraPath.fromBinaryFile(benchmarkSettings.cameraPathFilename)) {
+            sgl::Logfile::get()->writeError(
+                    "Error in SciVisApp::updateBenchmark: Couldn't load the camera path \""
+                    + benchmarkSettings.cameraPathFilename + "\".", false);
+            if (benchmarkSettings.quitWhenFinished) {
+                quit();
+            }
+            return;
+        }
+        useCameraFlight = true;
+        startedCameraFlightPerUI = false;
+        realTimeCameraFlight = false;
+        cameraPath.resetTime();
+        benchmark.start(benchmarkSettings, cameraPath.getNumFrames(benchmarkSettings.framesPerSecond));
+    }
+
+    if (benchmark.getIsFinished()) {
+        finishBenchmark();
+        return;
+    }
+
+    recordingTime = benchmark.getCurrentTime();
+    cameraPath.update(recordingTime);
+    camera->overwriteViewMatrix(cameraPath.getViewMatrix());
+    reRender = true;
+    hasMoved();
+}
+
+void SciVisApp::finishBenchmark() {
+#ifdef SUPPORT_VULKAN
+    if (benchmarkTimerVk) {
+        // Called outside of frame recording, so a single-time command buffer is used for resetting the queries.
+        VkCommandBuffer commandBuffer = device->beginSingleTimeCommands();
+        benchmarkTimerVk->finishGPU(commandBuffer);
+        device->endSingleTimeCommands(commandBuffer);
+        benchmark.setGpuFrameTimes(benchmarkTimerVk->getFrameTimeList("Frame"));
+        benchmarkTimerVk = {};
+    }
+#endif
+    benchmark.writeReports();
+    benchmark.stop();
+    useCameraFlight = false;
+    realTimeCameraFlight = true;
+    recordingTime = 0.0f;
+    if (benchmarkSettings.quitWhenFinished) {
+        quit();
+    }
 }
 
 void SciVisApp::updateCameraFlight(bool hasData, bool& usesNewState) {
+    if ((benchmarkPending || benchmark.getIsRunning()) && hasData) {
+        updateBenchmark();
+        return;
+    }
+
     if (useCameraFlight && hasData) {
         cameraPath.update(recordingTime);
         camera->overwriteViewMatrix(cameraPath.getViewMatrix());
@@ -1196,7 +1309,13 @@ void SciVisApp::updateCameraFlight(bool hasData, bool& usesNewState) {
                     recordingTime = 0.0f;
                 }
             } else {
-                recordingTime += FRAME_TIME_CAMERA_PATH;
+                // Advance by whole frames instead of accumulating the frame time, which would drift for long paths.
+                // The counter is resynchronized if the recording time was changed elsewhere (e.g., reset to zero).
+                if (recordingTime != float(double(cameraPathFrameIdx) * double(FRAME_TIME_CAMERA_PATH))) {
+                    cameraPathFrameIdx = std::llround(double(recordingTime) / double(FRAME_TIME_CAMERA_PATH));
+                }
+                cameraPathFrameIdx++;
+                recordingTime = float(double(cameraPathFrameIdx) * double(FRAME_TIME_CAMERA_PATH));
             }
         }
     }
@@ -1208,6 +1327,8 @@ void SciVisApp::moveCameraKeyboard(float dt) {
         if (cameraMoved) {
             reRender = true;
             hasMoved();
+            // Held keys don't generate new events, so the movement needs to continue in the next frame.
+            requestRedraw();
         }
     }
 }
@@ -31,6 +31,7 @@
 
 #include "Utils/AppLogic.hpp"
 #include <Utils/SciVis/CameraPath.hpp>
+#include <Utils/SciVis/FrameTimeBenchmark.hpp>
 #include <Utils/SciVis/Navigation/CameraNavigator.hpp>
 #include <Graphics/Video/VideoWriter.hpp>
 #include <ImGui/Widgets/CheckpointWindow.hpp>
@@ -70,6 +71,8 @@ class BlitRenderPass;
 typedef std::shared_ptr<BlitRenderPass> BlitRenderPassPtr;
 class ScreenshotReadbackHelper;
 typedef std::shared_ptr<ScreenshotReadbackHelper> ScreenshotReadbackHelperPtr;
+class Timer;
+typedef std::shared_ptr<Timer> TimerPtr;
 }}
 #endif
 
@@ -92,6 +95,13 @@ typedef std::shared_ptr<BlitRenderPass> BlitRenderPassPtr;
 
 namespace sgl {
 
+/// Snapshot of the scene state for @see AppLogic::updatePipelined, which must not access the camera directly.
+struct DLL_OBJECT SciVisFrameState {
+    glm::mat4 viewMatrix = glm::mat4(1.0f);
+    glm::mat4 projectionMatrix = glm::mat4(1.0f);
+    float recordingTime = 0.0f;
+};
+
 /**
  * Derived from AppLogic, but has some helper functions for scientific visualization.
  */
@@ -114,6 +124,9 @@ public:
     void saveScreenshot(const std::string &filename) override;
     void makeScreenshot() override {}
 
+    /// Copies the camera state for the pipelined update. Derived classes overriding this need to call it.
+    void onPipelinedUpdateStart(uint32_t frameStateIndex) override;
+
 protected:
     /// Call pre-render in derived classes before the rendering logic, and post-render afterwards.
     virtual void preRender();
@@ -150,8 +163,20 @@ protected:
 
     /// Implements a simple camera controller using the keyboard and mouse.
     virtual void updateCameraFlight(bool hasData, bool& usesNewState);
+    /**
+     * Replays the camera path with a fixed time step and writes a frame time report when finished.
+     * Benchmarks can also be started with the command line argument "--benchmark" (@see FrameTimeBenchmarkSettings).
+     * The benchmark starts with the first call to @see updateCameraFlight where data is available.
+     */
+    void startBenchmark(const FrameTimeBenchmarkSettings& settings);
+    void updateBenchmark();
+    void finishBenchmark();
     virtual void moveCameraKeyboard(float dt);
     virtual void moveCameraMouse(float dt);
+    /// The scene state for @see updatePipelined (@see AppLogic::setUsePipelinedUpdate).
+    [[nodiscard]] inline const SciVisFrameState& getPipelinedFrameState(uint32_t frameStateIndex) const {
+        return pipelinedFrameStates[frameStateIndex];
+    }
     /// Callback when the camera was moved/rotated.
     virtual void hasMoved() {}
     /// Callback when the camera was reset.
@@ -164,6 +189,7 @@ protected:
     /// Scene data (e.g., camera, main framebuffer, ...).
     sgl::CameraPtr camera;
     sgl::CameraNavigatorPtr cameraNavigator;
+    SciVisFrameState pipelinedFrameStates[NUM_FRAME_STATES];
     CameraNavigationMode cameraNavigationMode = CameraNavigationMode::FIRST_PERSON;
     int turntableMouseButtonIndex = 1;
 
@@ -238,6 +264,14 @@ protected:
 
     // For making performance measurements.
     bool usePerformanceMeasurementMode = false;
+    FrameTimeBenchmark benchmark;
+    FrameTimeBenchmarkSettings benchmarkSettings;
+    bool benchmarkPending = false;
+    bool benchmarkFrameStarted = false;
+#ifdef SUPPORT_VULKAN
+    sgl::vk::TimerPtr benchmarkTimerVk;
+    bool benchmarkTimeGpu = false;
+#endif
 
     // For recording videos.
     bool recording = false;
@@ -257,6 +291,7 @@ protected:
     bool realTimeCameraFlight = true; // Move camera in real elapsed time or camera frame rate?
     std::string saveDirectoryCameraPaths;
     float FRAME_TIME_CAMERA_PATH = 1.0f / float(FRAME_RATE_VIDEOS); ///< Simulate constant frame rate.
+    int64_t cameraPathFrameIdx = 0; ///< Frame index of non-real-time camera flights.
     float CAMERA_PATH_TIME_RECORDING = 30.0f;
     float CAMERA_PATH_TIME_PERFORMANCE_MEASUREMENT = 128.0f; ///< Change if desired.
     float customEndTime = 0.0f; ///< > 0.0 if the camera path should play for a custom amount of time.
@@ -0,0 +1,218 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Math/Math.hpp>
+#include <Graphics/Vector/nanovg/nanovg.h>
+#include <Graphics/Vector/NanoVGRasterizerCpu.hpp>
+#include <Graphics/Texture/Bitmap.hpp>
+
+class NanoVGRasterizerCpuTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        vg = rasterizer.createContext(0);
+        rasterizer.resize(width, height);
+    }
+
+    void beginFrame(const glm::vec4& clearColor) {
+        rasterizer.clear(clearColor);
+        nvgBeginFrame(vg, float(width), float(height), 1.0f);
+    }
+    void endFrame() {
+        nvgEndFrame(vg);
+    }
+
+    [[nodiscard]] const uint8_t* getPixel(int x, int y) const {
+        return rasterizer.getPixels() + (size_t(y) * size_t(width) + size_t(x)) * 4;
+    }
+    static uint8_t toUnorm8(float value) {
+        return uint8_t(value * 255.0f + 0.5f);
+    }
+    void expectPixel(int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) const {
+        const uint8_t* pixel = getPixel(x, y);
+        EXPECT_EQ(pixel[0], r) << "x: " << x << ", y: " << y;
+        EXPECT_EQ(pixel[1], g) << "x: " << x << ", y: " << y;
+        EXPECT_EQ(pixel[2], b) << "x: " << x << ", y: " << y;
+        EXPECT_EQ(pixel[3], a) << "x: " << x << ", y: " << y;
+    }
+
+    void drawRandomScene() {
+        std::mt19937 generator(17);
+        std::uniform_real_distribution<float> posDist(-8.0f, float(width) + 8.0f);
+        std::uniform_real_distribution<float> sizeDist(1.0f, 24.0f);
+        std::uniform_real_distribution<float> colorDist(0.0f, 1.0f);
+        for (int i = 0; i < 64; i++) {
+            NVGcolor color = nvgRGBAf(
+                    colorDist(generator), colorDist(generator), colorDist(generator), colorDist(generator));
+            nvgBeginPath(vg);
+            if (i % 3 == 0) {
+                nvgCircle(vg, posDist(generator), posDist(generator), sizeDist(generator));
+                nvgFillColor(vg, color);
+                nvgFill(vg);
+            } else if (i % 3 == 1) {
+                nvgRoundedRect(
+                        vg, posDist(generator), posDist(generator), sizeDist(generator), sizeDist(generator), 3.0f);
+                nvgFillColor(vg, color);
+                nvgFill(vg);
+            } else {
+                nvgMoveTo(vg, posDist(generator), posDist(generator));
+                nvgLineTo(vg, posDist(generator), posDist(generator));
+                nvgLineTo(vg, posDist(generator), posDist(generator));
+                nvgStrokeWidth(vg, sizeDist(generator) * 0.25f);
+                nvgStrokeColor(vg, color);
+                nvgStroke(vg);
+            }
+        }
+    }
+
+    const int width = 64, height = 48;
+    sgl::NanoVGRasterizerCpu rasterizer;
+    NVGcontext* vg = nullptr;
+};
+
+TEST_F(NanoVGRasterizerCpuTest, ClearColorIsStoredAsIs) {
+    // The clear color is expected to be premultiplied, like for the GPU backends.
+    glm::vec4 clearColor(0.2f, 0.4f, 0.1f, 0.5f);
+    beginFrame(clearColor);
+    endFrame();
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            expectPixel(
+                    x, y, toUnorm8(clearColor.r), toUnorm8(clearColor.g), toUnorm8(clearColor.b),
+                    toUnorm8(clearColor.a));
+        }
+    }
+}
+
+TEST_F(NanoVGRasterizerCpuTest, AxisAlignedRectangle) {
+    beginFrame(glm::vec4(0.0f));
+    nvgBeginPath(vg);
+    nvgRect(vg, 8.0f, 4.0f, 16.0f, 8.0f);
+    nvgFillColor(vg, nvgRGBA(255, 0, 0, 255));
+    nvgFill(vg);
+    // Covers the right half of pixel 40 and the left half of pixel 41.
+    nvgBeginPath(vg);
+    nvgRect(vg, 40.5f, 20.0f, 1.0f, 1.0f);
+    nvgFillColor(vg, nvgRGBA(0, 255, 0, 255));
+    nvgFill(vg);
+    endFrame();
+
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 32; x++) {
+            if (x >= 8 && x < 24 && y >= 4 && y < 12) {
+                expectPixel(x, y, 255, 0, 0, 255);
+            } else {
+                expectPixel(x, y, 0, 0, 0, 0);
+            }
+        }
+    }
+    expectPixel(39, 20, 0, 0, 0, 0);
+    expectPixel(40, 20, 0, 128, 0, 128);
+    expectPixel(41, 20, 0, 128, 0, 128);
+    expectPixel(42, 20, 0, 0, 0, 0);
+    expectPixel(40, 21, 0, 0, 0, 0);
+}
+
+TEST_F(NanoVGRasterizerCpuTest, CircleCoverageMatchesArea) {
+    const float radius = 15.0f;
+    beginFrame(glm::vec4(0.0f));
+    nvgBeginPath(vg);
+    nvgCircle(vg, 31.3f, 23.7f, radius);
+    nvgFillColor(vg, nvgRGBA(255, 255, 255, 255));
+    nvgFill(vg);
+    endFrame();
+
+    double coverageSum = 0.0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            coverageSum += double(getPixel(x, y)[3]) / 255.0;
+        }
+    }
+    // NanoVG approximates the circle by a polygon, which is slightly smaller than the circle.
+    double area = double(sgl::PI) * double(radius) * double(radius);
+    EXPECT_NEAR(coverageSum, area, area * 0.01);
+}
+
+TEST_F(NanoVGRasterizerCpuTest, SourceOverBlending) {
+    beginFrame(glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+    nvgBeginPath(vg);
+    nvgRect(vg, 0.0f, 0.0f, 8.0f, 8.0f);
+    nvgFillColor(vg, nvgRGBAf(1.0f, 0.0f, 0.0f, 0.5f));
+    nvgFill(vg);
+    endFrame();
+    // (0.5, 0, 0, 0.5) + (1 - 0.5) * (0, 0, 1, 1).
+    expectPixel(4, 4, 128, 0, 128, 255);
+    expectPixel(12, 4, 0, 0, 255, 255);
+}
+
+TEST_F(NanoVGRasterizerCpuTest, ResultIndependentOfTileHeight) {
+    std::vector<std::vector<uint8_t>> results;
+    for (int tileHeight : { 1, 7, 32, 64 }) {
+        rasterizer.setTileHeight(tileHeight);
+        beginFrame(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
+        drawRandomScene();
+        endFrame();
+        results.emplace_back(rasterizer.getPixels(), rasterizer.getPixels() + size_t(width) * size_t(height) * 4);
+    }
+    // The edges are clipped at the tile boundaries, which may change the rounding of the coverage slightly.
+    for (size_t i = 1; i < results.size(); i++) {
+        int maxDifference = 0;
+        for (size_t j = 0; j < results.front().size(); j++) {
+            maxDifference = std::max(maxDifference, std::abs(int(results.at(i).at(j)) - int(results.front().at(j))));
+        }
+        EXPECT_LE(maxDifference, 1);
+    }
+}
+
+TEST_F(NanoVGRasterizerCpuTest, CopyToBitmap) {
+    beginFrame(glm::vec4(0.0f));
+    nvgBeginPath(vg);
+    nvgRect(vg, 0.0f, 0.0f, float(width), float(height));
+    nvgFillColor(vg, nvgRGBAf(1.0f, 0.5f, 0.0f, 0.5f));
+    nvgFill(vg);
+    endFrame();
+    expectPixel(0, 0, 128, 64, 0, 128);
+
+    sgl::BitmapPtr bitmapPremultiplied = rasterizer.copyToBitmap(true);
+    ASSERT_EQ(bitmapPremultiplied->getWidth(), width);
+    ASSERT_EQ(bitmapPremultiplied->getHeight(), height);
+    EXPECT_EQ(memcmp(
+            bitmapPremultiplied->getPixels(), rasterizer.getPixels(), size_t(width) * size_t(height) * 4), 0);
+
+    sgl::BitmapPtr bitmapStraight = rasterizer.copyToBitmap(false);
+    const uint8_t* pixel = bitmapStraight->getPixels() + (size_t(height - 1) * size_t(width) + 3) * 4;
+    EXPECT_EQ(pixel[0], 255);
+    EXPECT_EQ(pixel[1], 128);
+    EXPECT_EQ(pixel[2], 0);
+    EXPECT_EQ(pixel[3], 128);
+}
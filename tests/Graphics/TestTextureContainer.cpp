@@ -0,0 +1,283 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <Graphics/Texture/TextureContainer.hpp>
+
+static const uint8_t KTX2_IDENTIFIER[12] = {
+        0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+static const uint32_t DDSD_MIPMAPCOUNT = 0x20000u;
+static const uint32_t DDPF_ALPHAPIXELS = 0x1u;
+static const uint32_t DDPF_FOURCC = 0x4u;
+static const uint32_t DDPF_RGB = 0x40u;
+static const uint32_t DDSCAPS2_CUBEMAP = 0x200u;
+static const uint32_t DDSCAPS2_CUBEMAP_POSITIVEX = 0x400u;
+
+template<class T>
+static void writeValue(std::vector<uint8_t>& data, size_t offset, T value) {
+    if (data.size() < offset + sizeof(T)) {
+        data.resize(offset + sizeof(T));
+    }
+    memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+/// Returns the byte 'byteIdx' of the array layer or cube map face 'sliceIdx' in the mip level 'level'.
+static uint8_t getTestTexelByte(uint32_t level, uint32_t sliceIdx, size_t byteIdx) {
+    return uint8_t(level * 64u + sliceIdx * 16u + uint32_t(byteIdx % 13u));
+}
+
+class TextureContainerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto timeStamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        rootPath = std::filesystem::temp_directory_path() / (
+                std::string("sgl_texture_container_test_")
+                + ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + std::to_string(timeStamp));
+        std::filesystem::create_directories(rootPath);
+    }
+
+    void TearDown() override {
+        std::error_code errorCode;
+        std::filesystem::remove_all(rootPath, errorCode);
+    }
+
+    std::string writeFile(const std::string& name, const std::vector<uint8_t>& data) {
+        std::string filename = (rootPath / name).string();
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), std::streamsize(data.size()));
+        return filename;
+    }
+
+    /// Creates an RGBA8 KTX2 file. The level data is stored in the file starting with the smallest level.
+    static std::vector<uint8_t> createKtx2(
+            uint32_t width, uint32_t height, uint32_t depth, uint32_t numLayers, uint32_t numFaces,
+            uint32_t numLevels, uint32_t numLevelsStored) {
+        std::vector<uint8_t> data(80, 0);
+        memcpy(data.data(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER));
+        writeValue<uint32_t>(data, 12, uint32_t(sgl::TextureContainerFormat::R8G8B8A8_UNORM));
+        writeValue<uint32_t>(data, 16, 1); // typeSize
+        writeValue<uint32_t>(data, 20, width);
+        writeValue<uint32_t>(data, 24, height);
+        writeValue<uint32_t>(data, 28, depth);
+        writeValue<uint32_t>(data, 32, numLayers);
+        writeValue<uint32_t>(data, 36, numFaces);
+        writeValue<uint32_t>(data, 40, numLevels);
+        writeValue<uint32_t>(data, 44, 0); // supercompressionScheme
+        size_t levelIndexOffset = data.size();
+        size_t fileOffset = levelIndexOffset + size_t(numLevelsStored) * 24;
+        data.resize(fileOffset, 0);
+        const uint32_t numSlices = std::max(numLayers, 1u) * numFaces;
+        for (uint32_t i = 0; i < numLevelsStored; i++) {
+            uint32_t level = numLevelsStored - i - 1;
+            size_t levelSize =
+                    size_t(std::max(width >> level, 1u)) * size_t(std::max(height >> level, 1u))
+                    * size_t(std::max(depth >> level, 1u)) * 4 * numSlices;
+            writeValue<uint64_t>(data, levelIndexOffset + level * 24, fileOffset);
+            writeValue<uint64_t>(data, levelIndexOffset + level * 24 + 8, levelSize);
+            writeValue<uint64_t>(data, levelIndexOffset + level * 24 + 16, levelSize);
+            size_t sliceSize = levelSize / numSlices;
+            for (size_t byteIdx = 0; byteIdx < levelSize; byteIdx++) {
+                data.push_back(getTestTexelByte(level, uint32_t(byteIdx / sliceSize), byteIdx % sliceSize));
+            }
+            fileOffset += levelSize;
+        }
+        return data;
+    }
+
+    /// Creates an RGBA8 DDS file, optionally with a DX10 header storing the array size.
+    static std::vector<uint8_t> createDds(
+            uint32_t width, uint32_t height, uint32_t numLevels, bool useDx10Header, uint32_t arraySize,
+            uint32_t numLevelsStored) {
+        std::vector<uint8_t> data(128, 0);
+        memcpy(data.data(), "DDS ", 4);
+        writeValue<uint32_t>(data, 4, 124); // dwSize
+        writeValue<uint32_t>(data, 8, 0x1007u | DDSD_MIPMAPCOUNT); // DDSD_CAPS | HEIGHT | WIDTH | PIXELFORMAT
+        writeValue<uint32_t>(data, 12, height);
+        writeValue<uint32_t>(data, 16, width);
+        writeValue<uint32_t>(data, 28, numLevels);
+        writeValue<uint32_t>(data, 76, 32); // DDS_PIXELFORMAT::dwSize
+        if (useDx10Header) {
+            writeValue<uint32_t>(data, 80, DDPF_FOURCC);
+            memcpy(data.data() + 84, "DX10", 4);
+            writeValue<uint32_t>(data, 128, 28); // DXGI_FORMAT_R8G8B8A8_UNORM
+            writeValue<uint32_t>(data, 132, 3); // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+            writeValue<uint32_t>(data, 136, 0); // miscFlag
+            writeValue<uint32_t>(data, 140, arraySize);
+            writeValue<uint32_t>(data, 144, 0); // miscFlags2
+        } else {
+            writeValue<uint32_t>(data, 80, DDPF_RGB | DDPF_ALPHAPIXELS);
+            writeValue<uint32_t>(data, 88, 32);
+            writeValue<uint32_t>(data, 92, 0xFFu);
+            writeValue<uint32_t>(data, 96, 0xFF00u);
+            writeValue<uint32_t>(data, 100, 0xFF0000u);
+            writeValue<uint32_t>(data, 104, 0xFF000000u);
+        }
+        writeValue<uint32_t>(data, 108, 0x1000u); // DDSCAPS_TEXTURE
+        // DDS files store the complete mip chain of one array layer after another.
+        uint32_t numSlices = numLevelsStored == 0 ? 0u : (useDx10Header ? arraySize : 1u);
+        for (uint32_t sliceIdx = 0; sliceIdx < numSlices; sliceIdx++) {
+            for (uint32_t level = 0; level < numLevelsStored; level++) {
+                size_t sliceSize = size_t(std::max(width >> level, 1u)) * size_t(std::max(height >> level, 1u)) * 4;
+                for (size_t byteIdx = 0; byteIdx < sliceSize; byteIdx++) {
+                    data.push_back(getTestTexelByte(level, sliceIdx, byteIdx));
+                }
+            }
+        }
+        return data;
+    }
+
+    /// Checks that the data read matches the layout documented in TextureContainer.hpp.
+    static void expectTestData(sgl::TextureContainer& textureContainer, uint32_t numSlices) {
+        std::vector<uint8_t> data(textureContainer.getDataSize());
+        ASSERT_TRUE(textureContainer.readData(data.data()));
+        const std::vector<sgl::TextureContainerLevel>& levels = textureContainer.getLevels();
+        for (uint32_t level = 0; level < uint32_t(levels.size()); level++) {
+            const sgl::TextureContainerLevel& levelInfo = levels.at(level);
+            EXPECT_EQ(levelInfo.offset % 16, 0u);
+            ASSERT_LE(levelInfo.offset + levelInfo.size, data.size());
+            size_t sliceSize = size_t(levelInfo.width) * size_t(levelInfo.height) * size_t(levelInfo.depth) * 4;
+            ASSERT_EQ(levelInfo.size, sliceSize * numSlices);
+            bool isEqual = true;
+            for (size_t byteIdx = 0; byteIdx < levelInfo.size && isEqual; byteIdx++) {
+                isEqual = data.at(levelInfo.offset + byteIdx)
+                        == getTestTexelByte(level, uint32_t(byteIdx / sliceSize), byteIdx % sliceSize);
+            }
+            EXPECT_TRUE(isEqual) << "level: " << level;
+        }
+    }
+
+    std::filesystem::path rootPath;
+};
+
+TEST_F(TextureContainerTest, Ktx2MipChain) {
+    std::string filename = writeFile("mip_chain.ktx2", createKtx2(8, 4, 0, 0, 1, 4, 4));
+    sgl::TextureContainer textureContainer;
+    ASSERT_TRUE(textureContainer.open(filename));
+    EXPECT_EQ(textureContainer.getFormat(), sgl::TextureContainerFormat::R8G8B8A8_UNORM);
+    EXPECT_EQ(textureContainer.getNumDimensions(), 2u);
+    EXPECT_EQ(textureContainer.getWidth(), 8u);
+    EXPECT_EQ(textureContainer.getHeight(), 4u);
+    EXPECT_EQ(textureContainer.getNumMipLevels(), 4u);
+    EXPECT_FALSE(textureContainer.getIsArray());
+    const std::vector<sgl::TextureContainerLevel>& levels = textureContainer.getLevels();
+    EXPECT_EQ(levels.at(1).width, 4u);
+    EXPECT_EQ(levels.at(1).height, 2u);
+    EXPECT_EQ(levels.at(3).width, 1u);
+    EXPECT_EQ(levels.at(3).height, 1u);
+    expectTestData(textureContainer, 1);
+}
+
+TEST_F(TextureContainerTest, Ktx2ArrayCubeMap) {
+    std::string filename = writeFile("array_cube.ktx2", createKtx2(4, 4, 0, 2, 6, 3, 3));
+    sgl::TextureContainer textureContainer;
+    ASSERT_TRUE(textureContainer.open(filename));
+    EXPECT_TRUE(textureContainer.getIsArray());
+    EXPECT_TRUE(textureContainer.getIsCubeMap());
+    EXPECT_EQ(textureContainer.getNumArrayLayers(), 2u);
+    expectTestData(textureContainer, 12);
+}
+
+TEST_F(TextureContainerTest, Ktx2RejectsTooManyMipLevels) {
+    // floor(log2(max(8, 4))) + 1 = 4 levels at most.
+    std::string filename = writeFile("too_many_levels.ktx2", createKtx2(8, 4, 0, 0, 1, 5, 5));
+    sgl::TextureContainer textureContainer;
+    EXPECT_FALSE(textureContainer.open(filename));
+}
+
+TEST_F(TextureContainerTest, Ktx2RejectsSizeOverflow) {
+    // 2^32-1 x 2^32-1 texels with 2^32-1 layers overflow 64-bit sizes.
+    std::string filename = writeFile(
+            "overflow.ktx2", createKtx2(0xFFFFFFFFu, 0xFFFFFFFFu, 0, 0xFFFFFFFFu, 1, 1, 0));
+    sgl::TextureContainer textureContainer;
+    EXPECT_FALSE(textureContainer.open(filename));
+}
+
+TEST_F(TextureContainerTest, Ktx2RejectsTruncatedFile) {
+    std::vector<uint8_t> data = createKtx2(8, 4, 0, 0, 1, 4, 4);
+    data.resize(data.size() - 1);
+    std::string filename = writeFile("truncated.ktx2", data);
+    sgl::TextureContainer textureContainer;
+    EXPECT_FALSE(textureContainer.open(filename));
+
+    // The level byte offset must not wrap around when adding the level size.
+    data = createKtx2(8, 4, 0, 0, 1, 1, 1);
+    writeValue<uint64_t>(data, 80, ~uint64_t(0) - 16);
+    filename = writeFile("wrapped_offset.ktx2", data);
+    EXPECT_FALSE(textureContainer.open(filename));
+}
+
+TEST_F(TextureContainerTest, DdsMipChain) {
+    std::string filename = writeFile("mip_chain.dds", createDds(8, 4, 4, false, 1, 4));
+    sgl::TextureContainer textureContainer;
+    ASSERT_TRUE(textureContainer.open(filename));
+    EXPECT_EQ(textureContainer.getFormat(), sgl::TextureContainerFormat::R8G8B8A8_UNORM);
+    EXPECT_EQ(textureContainer.getWidth(), 8u);
+    EXPECT_EQ(textureContainer.getHeight(), 4u);
+    EXPECT_EQ(textureContainer.getNumMipLevels(), 4u);
+    expectTestData(textureContainer, 1);
+}
+
+TEST_F(TextureContainerTest, DdsArrayIsReorderedToLevelMajor) {
+    std::string filename = writeFile("array.dds", createDds(4, 4, 3, true, 3, 3));
+    sgl::TextureContainer textureContainer;
+    ASSERT_TRUE(textureContainer.open(filename));
+    EXPECT_TRUE(textureContainer.getIsArray());
+    EXPECT_EQ(textureContainer.getNumArrayLayers(), 3u);
+    expectTestData(textureContainer, 3);
+}
+
+TEST_F(TextureContainerTest, DdsRejectsInvalidHeaders) {
+    sgl::TextureContainer textureContainer;
+    // floor(log2(4)) + 1 = 3 levels at most.
+    std::string filename = writeFile("too_many_levels.dds", createDds(4, 4, 4, false, 1, 4));
+    EXPECT_FALSE(textureContainer.open(filename));
+
+    // A huge array size must be rejected before allocating file regions for all slices.
+    filename = writeFile("huge_array.dds", createDds(1, 1, 1, true, 0x80000000u, 0));
+    EXPECT_FALSE(textureContainer.open(filename));
+
+    filename = writeFile("overflow.dds", createDds(0xFFFFFFFFu, 0xFFFFFFFFu, 1, true, 0xFFFFFFFFu, 0));
+    EXPECT_FALSE(textureContainer.open(filename));
+
+    std::vector<uint8_t> data = createDds(4, 4, 3, true, 2, 3);
+    data.resize(data.size() - 4);
+    filename = writeFile("truncated.dds", data);
+    EXPECT_FALSE(textureContainer.open(filename));
+
+    data = createDds(4, 4, 1, false, 1, 1);
+    writeValue<uint32_t>(data, 112, DDSCAPS2_CUBEMAP | DDSCAPS2_CUBEMAP_POSITIVEX);
+    filename = writeFile("missing_faces.dds", data);
+    EXPECT_FALSE(textureContainer.open(filename));
+}
@@ -0,0 +1,141 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <ImGui/imgui.h>
+#include <ImGui/ImGuiFileDialog/ImGuiFileDialog.h>
+#include <Utils/Events/EventManager.hpp>
+#include <Utils/File/PathWatchService.hpp>
+
+/*
+ * The file manager of the dialog scans directories on a worker thread and caches the stat infos of the files, so the
+ * tests process the path watch events and the scanned entries until the scan is finished.
+ */
+
+class ImGuiFileDialogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!sgl::PathWatchService::get()->getIsSupported()) {
+            GTEST_SKIP() << "The directory stat cache is only used if the path watch service is supported.";
+        }
+        sgl::PathWatchService::get()->setDebounceTimeMs(50);
+        imguiContext = ImGui::CreateContext();
+        fileDialogInternal.filterManager.ParseFilters(".*");
+        auto timeStamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        rootPath = std::filesystem::temp_directory_path() / (
+                std::string("sgl_file_dialog_test_")
+                + ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + std::to_string(timeStamp));
+        std::filesystem::create_directories(rootPath);
+    }
+
+    void TearDown() override {
+        fileDialogInternal.fileManager.ClearAll();
+        if (imguiContext) {
+            ImGui::DestroyContext(imguiContext);
+        }
+        if (!rootPath.empty()) {
+            std::error_code errorCode;
+            std::filesystem::remove_all(rootPath, errorCode);
+        }
+    }
+
+    /// Scans the passed directory and returns once the scan (and rescans triggered by changes) have finished.
+    void scanDirectory(const std::filesystem::path& path) {
+        IGFD::FileManager& fileManager = fileDialogInternal.fileManager;
+        fileManager.SetCurrentDir(path.string());
+        fileManager.ScanDir(fileDialogInternal, path.string());
+        auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < endTime) {
+            bool wasScanning = fileManager.IsScanningDirectory();
+            sgl::EventManager::get()->update();
+            fileManager.ProcessDirectoryScan(fileDialogInternal);
+            if (!wasScanning && !fileManager.IsScanningDirectory()) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        FAIL() << "Timeout while scanning " << path;
+    }
+
+    /// Processes the path watch events for the passed time, so that the changes reach the stat cache.
+    static void processEvents(int timeMs) {
+        auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeMs);
+        while (std::chrono::steady_clock::now() < endTime) {
+            sgl::EventManager::get()->update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    std::shared_ptr<IGFD::FileInfos> findFile(const std::string& fileName) {
+        IGFD::FileManager& fileManager = fileDialogInternal.fileManager;
+        for (size_t i = 0; i < fileManager.GetFullFileListSize(); i++) {
+            auto fileInfos = fileManager.GetFullFileAt(i);
+            if (fileInfos->fileNameExt == fileName) {
+                return fileInfos;
+            }
+        }
+        return nullptr;
+    }
+
+    static void writeFile(const std::filesystem::path& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    ImGuiContext* imguiContext = nullptr;
+    IGFD::FileDialogInternal fileDialogInternal;
+    std::filesystem::path rootPath;
+};
+
+TEST_F(ImGuiFileDialogTest, RevisitShowsSizeOfRewrittenFile) {
+    std::filesystem::path directoryPath = rootPath / "data";
+    std::filesystem::path otherDirectoryPath = rootPath / "other";
+    std::filesystem::create_directories(directoryPath);
+    std::filesystem::create_directories(otherDirectoryPath);
+    writeFile(directoryPath / "file.txt", "abc");
+
+    scanDirectory(directoryPath);
+    auto fileInfos = findFile("file.txt");
+    ASSERT_NE(fileInfos, nullptr);
+    EXPECT_EQ(fileInfos->fileSize, size_t(3));
+
+    // Rewriting the file in place keeps the mtime of the directory, so the cached entry of the file must be dropped.
+    scanDirectory(otherDirectoryPath);
+    writeFile(directoryPath / "file.txt", "abcdefghijklmnop");
+    processEvents(300);
+
+    scanDirectory(directoryPath);
+    fileInfos = findFile("file.txt");
+    ASSERT_NE(fileInfos, nullptr);
+    EXPECT_EQ(fileInfos->fileSize, size_t(16));
+}
@@ -0,0 +1,168 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <Math/Geometry/AABB3.hpp>
+#include <Math/Geometry/FrustumCulling.hpp>
+
+/*
+ * The planes and bounds only use small dyadic values, so all distances are computed exactly and the batched tests can
+ * be compared with the per-object tests without tolerances.
+ */
+class FrustumCullingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Truncated pyramid along the z axis with inwards pointing normals (unnormalized, like before the
+        // normalization in Camera::updateFrustumPlanes).
+        planes[0] = sgl::Plane(1.0f, 0.0f, 0.5f, 8.0f);
+        planes[1] = sgl::Plane(-1.0f, 0.0f, 0.5f, 8.0f);
+        planes[2] = sgl::Plane(0.0f, 1.0f, 0.5f, 8.0f);
+        planes[3] = sgl::Plane(0.0f, -1.0f, 0.5f, 8.0f);
+        planes[4] = sgl::Plane(0.0f, 0.0f, 1.0f, 4.0f);
+        planes[5] = sgl::Plane(0.0f, 0.0f, -1.0f, 24.0f);
+    }
+
+    // Same test as Camera::isVisible.
+    [[nodiscard]] bool isVisible(const sgl::AABB3& aabb) const {
+        for (const auto& plane : planes) {
+            if (plane.isOutside(aabb)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool isVisible(const sgl::Sphere& sphere) const {
+        for (const auto& plane : planes) {
+            if (plane.getDistance(sphere.center) < -sphere.radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void generateBounds(size_t numBounds, sgl::AABB3Array& aabbs, sgl::SphereArray& spheres) {
+        std::uniform_int_distribution<int> positionDistribution(-128, 128);
+        std::uniform_int_distribution<int> extentDistribution(0, 16);
+        aabbs.clear();
+        spheres.clear();
+        for (size_t i = 0; i < numBounds; i++) {
+            glm::vec3 center(
+                    float(positionDistribution(generator)) * 0.25f,
+                    float(positionDistribution(generator)) * 0.25f,
+                    float(positionDistribution(generator)) * 0.25f);
+            glm::vec3 extent(
+                    float(extentDistribution(generator)) * 0.25f,
+                    float(extentDistribution(generator)) * 0.25f,
+                    float(extentDistribution(generator)) * 0.25f);
+            aabbs.push_back(sgl::AABB3(center - extent, center + extent));
+            spheres.push_back(sgl::Sphere(center, extent.x));
+        }
+    }
+
+    sgl::Plane planes[6];
+    std::mt19937 generator{17};
+};
+
+TEST_F(FrustumCullingTest, EmptyInput) {
+    sgl::AABB3Array aabbs;
+    sgl::SphereArray spheres;
+    std::vector<sgl::FrustumTestResult> results(3, sgl::FrustumTestResult::INSIDE);
+    std::vector<uint32_t> visibleIndices = { 1, 2, 3 };
+    sgl::classifyFrustumVisibility(planes, 6, aabbs, results);
+    EXPECT_TRUE(results.empty());
+    sgl::classifyFrustumVisibility(planes, 6, spheres, results);
+    EXPECT_TRUE(results.empty());
+    sgl::compactVisibleIndices(results, visibleIndices);
+    EXPECT_TRUE(visibleIndices.empty());
+}
+
+TEST_F(FrustumCullingTest, MatchesPerObjectTests) {
+    // Sizes with tails not divisible by the SIMD width and sizes larger than one parallel chunk.
+    const size_t testSizes[] = { 1, 3, 4, 5, 7, 31, 4096, 4099, 20011 };
+    sgl::AABB3Array aabbs, aabbSingle;
+    sgl::SphereArray spheres, sphereSingle;
+    aabbSingle.resize(1);
+    sphereSingle.resize(1);
+    std::vector<sgl::FrustumTestResult> resultsAabb, resultsSphere, resultSingle;
+    std::vector<uint32_t> visibleIndicesAabb, visibleIndicesSphere;
+    for (size_t numBounds : testSizes) {
+        generateBounds(numBounds, aabbs, spheres);
+        sgl::classifyFrustumVisibility(planes, 6, aabbs, resultsAabb);
+        sgl::classifyFrustumVisibility(planes, 6, spheres, resultsSphere);
+        sgl::compactVisibleIndices(resultsAabb, visibleIndicesAabb);
+        sgl::compactVisibleIndices(resultsSphere, visibleIndicesSphere);
+        ASSERT_EQ(resultsAabb.size(), numBounds);
+        ASSERT_EQ(resultsSphere.size(), numBounds);
+
+        std::vector<uint32_t> visibleIndicesAabbReference, visibleIndicesSphereReference;
+        size_t numOutside = 0, numIntersecting = 0, numInside = 0;
+        for (size_t i = 0; i < numBounds; i++) {
+            sgl::AABB3 aabb(
+                    glm::vec3(aabbs.minX[i], aabbs.minY[i], aabbs.minZ[i]),
+                    glm::vec3(aabbs.maxX[i], aabbs.maxY[i], aabbs.maxZ[i]));
+            sgl::Sphere sphere(glm::vec3(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]), spheres.radius[i]);
+            bool isVisibleAabb = isVisible(aabb);
+            bool isVisibleSphere = isVisible(sphere);
+            if (isVisibleAabb) {
+                visibleIndicesAabbReference.push_back(uint32_t(i));
+            }
+            if (isVisibleSphere) {
+                visibleIndicesSphereReference.push_back(uint32_t(i));
+            }
+            ASSERT_EQ(resultsAabb[i] != sgl::FrustumTestResult::OUTSIDE, isVisibleAabb) << "AABB " << i;
+            ASSERT_EQ(resultsSphere[i] != sgl::FrustumTestResult::OUTSIDE, isVisibleSphere) << "Sphere " << i;
+
+            // Arrays with a single element are processed by the scalar path, larger ones mostly by the SIMD path.
+            aabbSingle.set(0, aabb);
+            sgl::classifyFrustumVisibility(planes, 6, aabbSingle, resultSingle);
+            ASSERT_EQ(resultsAabb[i], resultSingle.front()) << "AABB " << i;
+            sphereSingle.set(0, sphere);
+            sgl::classifyFrustumVisibility(planes, 6, sphereSingle, resultSingle);
+            ASSERT_EQ(resultsSphere[i], resultSingle.front()) << "Sphere " << i;
+
+            if (resultsAabb[i] == sgl::FrustumTestResult::OUTSIDE) {
+                numOutside++;
+            } else if (resultsAabb[i] == sgl::FrustumTestResult::INTERSECTING) {
+                numIntersecting++;
+            } else {
+                numInside++;
+            }
+        }
+        EXPECT_EQ(visibleIndicesAabb, visibleIndicesAabbReference);
+        EXPECT_EQ(visibleIndicesSphere, visibleIndicesSphereReference);
+        if (numBounds >= 4096) {
+            EXPECT_GT(numOutside, 0u);
+            EXPECT_GT(numIntersecting, 0u);
+            EXPECT_GT(numInside, 0u);
+        }
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <Math/Geometry/TriangleBvh.hpp>
+
+class TriangleBvhTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 generator(17);
+        std::uniform_real_distribution<float> positionDistribution(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> offsetDistribution(-0.5f, 0.5f);
+        for (uint32_t triangleIdx = 0; triangleIdx < numTriangles; triangleIdx++) {
+            glm::vec3 center(
+                    positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+            for (int i = 0; i < 3; i++) {
+                triangleIndices.push_back(uint32_t(vertexPositions.size()));
+                vertexPositions.emplace_back(
+                        center.x + offsetDistribution(generator),
+                        center.y + offsetDistribution(generator),
+                        center.z + offsetDistribution(generator));
+            }
+        }
+        bvh.build(triangleIndices, vertexPositions);
+
+        std::uniform_real_distribution<float> directionDistribution(-1.0f, 1.0f);
+        for (uint32_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+            glm::vec3 origin(
+                    positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+            glm::vec3 direction(
+                    directionDistribution(generator), directionDistribution(generator), directionDistribution(generator));
+            rays.emplace_back(origin * 1.5f, glm::normalize(direction));
+        }
+    }
+
+    // Reference implementation testing all triangles.
+    [[nodiscard]] sgl::TriangleRayHit intersectBruteForce(const sgl::Ray3& ray, float tMax) const {
+        sgl::TriangleRayHit hit;
+        const glm::vec3& origin = ray.getOrigin();
+        const glm::vec3& direction = ray.getDirection();
+        for (uint32_t triangleIdx = 0; triangleIdx < numTriangles; triangleIdx++) {
+            glm::vec3 v0 = vertexPositions[triangleIndices[triangleIdx * 3]];
+            glm::vec3 e1 = vertexPositions[triangleIndices[triangleIdx * 3 + 1]] - v0;
+            glm::vec3 e2 = vertexPositions[triangleIndices[triangleIdx * 3 + 2]] - v0;
+            glm::vec3 pvec = glm::cross(direction, e2);
+            float det = glm::dot(e1, pvec);
+            if (det == 0.0f) {
+                continue;
+            }
+            glm::vec3 tvec = origin - v0;
+            float u = glm::dot(tvec, pvec) / det;
+            glm::vec3 qvec = glm::cross(tvec, e1);
+            float v = glm::dot(direction, qvec) / det;
+            float t = glm::dot(e2, qvec) / det;
+            if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= 0.0f && t <= tMax && t < hit.t) {
+                hit.t = t;
+                hit.triangleIdx = triangleIdx;
+            }
+        }
+        return hit;
+    }
+
+    const uint32_t numTriangles = 20000;
+    const uint32_t numRays = 2000;
+    std::vector<uint32_t> triangleIndices;
+    std::vector<glm::vec3> vertexPositions;
+    std::vector<sgl::Ray3> rays;
+    sgl::TriangleBvh bvh;
+};
+
+TEST_F(TriangleBvhTest, ClosestHitMatchesBruteForce) {
+    std::vector<sgl::TriangleRayHit> hits;
+    bvh.intersectClosest(rays, hits);
+    ASSERT_EQ(hits.size(), rays.size());
+    int numHits = 0;
+    for (uint32_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+        sgl::TriangleRayHit hitReference = intersectBruteForce(rays[rayIdx], std::numeric_limits<float>::max());
+        ASSERT_EQ(hits[rayIdx].getHasHit(), hitReference.getHasHit());
+        if (hitReference.getHasHit()) {
+            EXPECT_NEAR(hits[rayIdx].t, hitReference.t, 1e-4f * std::max(1.0f, hitReference.t));
+            numHits++;
+        }
+    }
+    EXPECT_GT(numHits, 0);
+}
+
+TEST_F(TriangleBvhTest, AnyHitMatchesBruteForce) {
+    const float tMax = 5.0f;
+    std::vector<uint8_t> occluded;
+    bvh.intersectAny(rays, occluded, 0.0f, tMax);
+    ASSERT_EQ(occluded.size(), rays.size());
+    for (uint32_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+        sgl::TriangleRayHit hitReference = intersectBruteForce(rays[rayIdx], tMax);
+        EXPECT_EQ(occluded[rayIdx] != 0, hitReference.getHasHit());
+    }
+}
+
+TEST_F(TriangleBvhTest, OverlapMatchesBruteForce) {
+    sgl::AABB3 queryAabb(glm::vec3(-2.0f, -3.0f, -1.0f), glm::vec3(4.0f, 1.0f, 2.0f));
+    std::vector<uint32_t> overlapping;
+    bvh.queryOverlap(queryAabb, overlapping);
+    std::sort(overlapping.begin(), overlapping.end());
+
+    std::vector<uint32_t> overlappingReference;
+    for (uint32_t triangleIdx = 0; triangleIdx < numTriangles; triangleIdx++) {
+        sgl::AABB3 triangleAabb;
+        for (int i = 0; i < 3; i++) {
+            triangleAabb.combine(vertexPositions[triangleIndices[triangleIdx * 3 + i]]);
+        }
+        if (triangleAabb.intersects(queryAabb)) {
+            overlappingReference.push_back(triangleIdx);
+        }
+    }
+    EXPECT_FALSE(overlappingReference.empty());
+    EXPECT_EQ(overlapping, overlappingReference);
+}
+
+TEST_F(TriangleBvhTest, ThroughputComparedToBruteForce) {
+    auto startBvh = std::chrono::steady_clock::now();
+    std::vector<sgl::TriangleRayHit> hits;
+    bvh.intersectClosest(rays, hits);
+    auto endBvh = std::chrono::steady_clock::now();
+    for (uint32_t rayIdx = 0; rayIdx < numRays; rayIdx++) {
+        hits[rayIdx] = intersectBruteForce(rays[rayIdx], std::numeric_limits<float>::max());
+    }
+    auto endBruteForce = std::chrono::steady_clock::now();
+    double timeBvh = std::chrono::duration<double>(endBvh - startBvh).count();
+    double timeBruteForce = std::chrono::duration<double>(endBruteForce - endBvh).count();
+    std::cout << "BVH: " << double(numRays) / timeBvh << " rays/s, brute force: "
+              << double(numRays) / timeBruteForce << " rays/s" << std::endl;
+    EXPECT_LT(timeBvh, timeBruteForce);
+}
@@ -0,0 +1,318 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <Utils/Timer.hpp>
+#include <Utils/AppSettings.hpp>
+#include <Utils/AppLogic.hpp>
+#include <Graphics/Window.hpp>
+#include <Input/Mouse.hpp>
+#include <Input/Keyboard.hpp>
+#include <Input/Gamepad.hpp>
+
+/*
+ * The main loop is tested without a real window or renderer. The mock window blocks in waitEvents until it is woken
+ * up or the timeout has passed, and the input devices report no input.
+ */
+
+class MockWindow : public sgl::Window {
+public:
+    [[nodiscard]] sgl::WindowBackend getBackend() const override { return sgl::WindowBackend::NONE; }
+    bool isDebugContext() override { return false; }
+    void initialize(const sgl::WindowSettings& settings, sgl::RenderSystem renderSystem) override {}
+    void toggleFullscreen(bool nativeFullscreen) override {}
+    void setWindowPosition(int x, int y) override {}
+    void serializeSettings(sgl::SettingsFile& settings) override {}
+    sgl::WindowSettings deserializeSettings(const sgl::SettingsFile& settings) override { return windowSettings; }
+    void update() override {}
+    bool processEvents() override { return true; }
+    bool waitEvents(int timeoutMs) override {
+        std::unique_lock<std::mutex> lock(wakeUpMutex);
+        wakeUpCondition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return isWokenUp; });
+        isWokenUp = false;
+        return false;
+    }
+    void wakeUp() override {
+        std::unique_lock<std::mutex> lock(wakeUpMutex);
+        isWokenUp = true;
+        lock.unlock();
+        wakeUpCondition.notify_all();
+    }
+    void clear(const sgl::Color& color) override {}
+    void flip() override {}
+    void saveScreenshot(const char* filename) override {}
+    bool isFullscreen() override { return false; }
+    int getVirtualWidth() override { return 1; }
+    int getVirtualHeight() override { return 1; }
+    int getPixelWidth() override { return 1; }
+    int getPixelHeight() override { return 1; }
+    glm::ivec2 getWindowVirtualResolution() override { return glm::ivec2(1, 1); }
+    glm::ivec2 getWindowPixelResolution() override { return glm::ivec2(1, 1); }
+    glm::ivec2 getWindowPosition() override { return glm::ivec2(0, 0); }
+    [[nodiscard]] const sgl::WindowSettings& getWindowSettings() const override { return windowSettings; }
+    void setWindowVirtualSize(int width, int height) override {}
+    void setWindowPixelSize(int width, int height) override {}
+    int getWidth() override { return 1; }
+    int getHeight() override { return 1; }
+    glm::ivec2 getWindowResolution() override { return glm::ivec2(1, 1); }
+    void setWindowSize(int width, int height) override {}
+#ifdef SUPPORT_OPENGL
+    void* getOpenGLFunctionPointer(const char* functionName) override { return nullptr; }
+#endif
+#ifdef SUPPORT_VULKAN
+    VkSurfaceKHR getVkSurface() override { return VK_NULL_HANDLE; }
+#endif
+#ifdef SUPPORT_WEBGPU
+    WGPUSurface getWebGPUSurface() override { return nullptr; }
+#endif
+
+private:
+    sgl::WindowSettings windowSettings;
+    std::mutex wakeUpMutex;
+    std::condition_variable wakeUpCondition;
+    bool isWokenUp = false;
+};
+
+class MockMouse : public sgl::MouseInterface {
+public:
+    void update(float dt) override {}
+    sgl::Point2 getAxis() override { return sgl::Point2(0, 0); }
+    int getX() override { return 0; }
+    int getY() override { return 0; }
+    sgl::Point2 mouseMovement() override { return sgl::Point2(0, 0); }
+    bool mouseMoved() override { return false; }
+    void warp(const sgl::Point2& windowPosition) override {}
+    bool isButtonDown(int button) override { return false; }
+    bool isButtonUp(int button) override { return true; }
+    bool buttonPressed(int button) override { return false; }
+    bool buttonReleased(int button) override { return false; }
+    float getScrollWheel() override { return 0.0f; }
+};
+
+class MockKeyboard : public sgl::KeyboardInterface {
+public:
+    void update(float dt) override {}
+    bool isKeyDown(int button) override { return false; }
+    bool isKeyUp(int button) override { return true; }
+    bool keyPressed(int button) override { return false; }
+    bool keyReleased(int button) override { return false; }
+    bool isScancodeDown(int button) override { return false; }
+    bool isScancodeUp(int button) override { return true; }
+    bool scancodePressed(int button) override { return false; }
+    bool scancodeReleased(int button) override { return false; }
+    int getNumKeys() override { return 0; }
+    bool getModifier(ImGuiKey modifier) override { return false; }
+#ifdef SUPPORT_SDL
+    SDL_Keymod getModifier() override { return SDL_Keymod(0); }
+#endif
+    const char* getKeyBuffer() const override { return ""; }
+    void clearKeyBuffer() override {}
+    void addToKeyBuffer(const char* str) override {}
+};
+
+class MockGamepad : public sgl::GamepadInterface {
+public:
+    void update(float dt) override {}
+    int getNumGamepads() override { return 0; }
+    const char* getGamepadName(int j) override { return ""; }
+    bool isButtonDown(int button, int gamepadIndex) override { return false; }
+    bool isButtonUp(int button, int gamepadIndex) override { return true; }
+    bool buttonPressed(int button, int gamepadIndex) override { return false; }
+    bool buttonReleased(int button, int gamepadIndex) override { return false; }
+    int getNumButtons(int gamepadIndex) override { return 0; }
+    float axisX(int stickIndex, int gamepadIndex) override { return 0.0f; }
+    float axisY(int stickIndex, int gamepadIndex) override { return 0.0f; }
+    glm::vec2 axis(int stickIndex, int gamepadIndex) override { return glm::vec2(0.0f, 0.0f); }
+    uint8_t getDirectionPad(int dirPadIndex, int gamepadIndex) override { return 0; }
+    uint8_t getDirectionPadPressed(int dirPadIndex, int gamepadIndex) override { return 0; }
+    void rumble(float strength, float time, int gamepadIndex) override {}
+};
+
+/**
+ * Counts the calls of the overridable hooks and quits after a given number of rendered frames or at a given time.
+ * onPipelinedUpdateStart marks its frame state slot as prepared, and updatePipelined checks that the slot it writes was
+ * prepared beforehand, as derived classes copy their input there.
+ */
+class TestAppLogic : public sgl::AppLogic {
+public:
+    void onPipelinedUpdateStart(uint32_t frameStateIndex) override {
+        numPipelinedUpdateStarts++;
+        isFrameStatePrepared[frameStateIndex] = true;
+    }
+    void updatePipelined(float dt, uint32_t frameStateIndex) override {
+        numPipelinedUpdates++;
+        if (!isFrameStatePrepared[frameStateIndex].exchange(false)) {
+            numUnpreparedUpdates++;
+        }
+    }
+    void render() override {
+        numRenderCalls++;
+        auto currentTime = std::chrono::steady_clock::now();
+        renderTimes.push_back(currentTime);
+        if (numRenderCalls >= maxNumFrames || currentTime >= quitTime || quitOnNextFrame) {
+            quit();
+        }
+    }
+
+    int maxNumFrames = std::numeric_limits<int>::max();
+    std::chrono::steady_clock::time_point quitTime = std::chrono::steady_clock::time_point::max();
+    std::atomic<bool> quitOnNextFrame{ false };
+    std::vector<std::chrono::steady_clock::time_point> renderTimes;
+    std::atomic<int> numPipelinedUpdateStarts{ 0 };
+    std::atomic<int> numPipelinedUpdates{ 0 };
+    std::atomic<int> numUnpreparedUpdates{ 0 };
+    std::atomic<int> numRenderCalls{ 0 };
+    std::atomic<bool> isFrameStatePrepared[NUM_FRAME_STATES]{};
+};
+
+class AppLogicTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!sgl::Timer) {
+            sgl::Timer = new sgl::TimerInterface;
+            hasCreatedTimer = true;
+        }
+        oldMouse = sgl::Mouse;
+        oldKeyboard = sgl::Keyboard;
+        oldGamepad = sgl::Gamepad;
+        sgl::Mouse = &mouse;
+        sgl::Keyboard = &keyboard;
+        sgl::Gamepad = &gamepad;
+
+        // The Vulkan path is used without a renderer, so that neither OpenGL nor a swapchain is touched.
+        oldRenderSystem = sgl::AppSettings::get()->getRenderSystem();
+        sgl::AppSettings::get()->setRenderSystem(sgl::RenderSystem::VULKAN);
+        sgl::AppSettings::get()->setMainWindow(&window);
+
+        appLogic = new TestAppLogic;
+        appLogic->setPrintFPS(false);
+    }
+
+    void TearDown() override {
+        delete appLogic;
+        appLogic = nullptr;
+        sgl::AppSettings::get()->setMainWindow(nullptr);
+        sgl::AppSettings::get()->setRenderSystem(oldRenderSystem);
+        sgl::Mouse = oldMouse;
+        sgl::Keyboard = oldKeyboard;
+        sgl::Gamepad = oldGamepad;
+        if (hasCreatedTimer) {
+            delete sgl::Timer;
+            sgl::Timer = nullptr;
+        }
+    }
+
+    MockWindow window;
+    MockMouse mouse;
+    MockKeyboard keyboard;
+    MockGamepad gamepad;
+    TestAppLogic* appLogic = nullptr;
+
+private:
+    bool hasCreatedTimer = false;
+    sgl::RenderSystem oldRenderSystem = sgl::RenderSystem::OPENGL;
+    sgl::MouseInterface* oldMouse = nullptr;
+    sgl::KeyboardInterface* oldKeyboard = nullptr;
+    sgl::GamepadInterface* oldGamepad = nullptr;
+};
+
+TEST_F(AppLogicTest, PipelinedUpdateStartCalledInSynchronousMode) {
+    ASSERT_FALSE(appLogic->getUsePipelinedUpdate());
+    const int numFrames = 8;
+    appLogic->maxNumFrames = numFrames;
+    appLogic->run();
+    EXPECT_EQ(appLogic->numPipelinedUpdateStarts.load(), numFrames);
+    EXPECT_EQ(appLogic->numPipelinedUpdates.load(), numFrames);
+    EXPECT_EQ(appLogic->numUnpreparedUpdates.load(), 0);
+    EXPECT_EQ(appLogic->numRenderCalls.load(), numFrames);
+    EXPECT_EQ(appLogic->getNumRenderedFrames(), uint64_t(numFrames));
+}
+
+TEST_F(AppLogicTest, PipelinedUpdateStartCalledInPipelinedMode) {
+    appLogic->setUsePipelinedUpdate(true);
+    const int numFrames = 8;
+    appLogic->maxNumFrames = numFrames;
+    appLogic->run();
+    // Leaving the main loop waits for the update of the next frame that is still in flight.
+    // The first frame fills its slot synchronously, and every frame starts the update of the following one.
+    EXPECT_EQ(appLogic->numPipelinedUpdateStarts.load(), numFrames + 1);
+    EXPECT_EQ(appLogic->numPipelinedUpdates.load(), numFrames + 1);
+    EXPECT_EQ(appLogic->numUnpreparedUpdates.load(), 0);
+    EXPECT_EQ(appLogic->numRenderCalls.load(), numFrames);
+}
+
+TEST_F(AppLogicTest, OnDemandSchedulingIdlesWithoutEvents) {
+    const float maxIdleLatency = 0.05f;
+    const double runTimeSeconds = 0.5;
+    appLogic->setFrameSchedulingMode(sgl::FrameSchedulingMode::ON_DEMAND);
+    appLogic->setMaxIdleLatency(maxIdleLatency);
+    appLogic->quitTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(int(runTimeSeconds * 1000.0));
+    appLogic->run();
+
+    // Without events, frames are only rendered for the initial redraw request and when the idle latency has passed.
+    // The wake-up of the initial request may end one more wait early. A continuously running loop would render
+    // thousands of frames in the same time.
+    const int maxNumFrames = int(runTimeSeconds / double(maxIdleLatency)) + 3;
+    EXPECT_GE(appLogic->numRenderCalls.load(), 2);
+    EXPECT_LE(appLogic->numRenderCalls.load(), maxNumFrames);
+    EXPECT_EQ(appLogic->getNumRenderedFrames(), uint64_t(appLogic->numRenderCalls.load()));
+    EXPECT_GT(appLogic->getIdleTimeMicroseconds(), uint64_t(runTimeSeconds * 0.5e6));
+}
+
+TEST_F(AppLogicTest, OnDemandSchedulingWakesUpOnRedrawRequest) {
+    const float maxIdleLatency = 2.0f;
+    appLogic->setFrameSchedulingMode(sgl::FrameSchedulingMode::ON_DEMAND);
+    appLogic->setMaxIdleLatency(maxIdleLatency);
+    appLogic->quitTime = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    // The loop quits in the first frame after the request, which must not wait for the idle latency to pass.
+    std::chrono::steady_clock::time_point requestTime;
+    std::thread requestThread([this, &requestTime] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        requestTime = std::chrono::steady_clock::now();
+        appLogic->quitOnNextFrame = true;
+        sgl::AppLogic::requestRedraw();
+    });
+    appLogic->run();
+    requestThread.join();
+
+    // Only the initial redraw request renders frames before the loop becomes idle.
+    ASSERT_GE(appLogic->renderTimes.size(), size_t(2));
+    EXPECT_LE(appLogic->renderTimes.size(), size_t(3));
+    EXPECT_LT(appLogic->renderTimes.front(), requestTime);
+    EXPECT_GE(appLogic->renderTimes.back(), requestTime);
+    auto wakeUpLatency = std::chrono::duration<double>(appLogic->renderTimes.back() - requestTime).count();
+    EXPECT_LT(wakeUpLatency, double(maxIdleLatency) * 0.5);
+}
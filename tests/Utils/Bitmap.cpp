@@ -0,0 +1,422 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <Math/Geometry/Point2.hpp>
+#include <Math/Geometry/Rectangle.hpp>
+#include <Graphics/Texture/Bitmap.hpp>
+
+static sgl::BitmapPtr createRandomBitmap(int width, int height, uint32_t seed) {
+    std::mt19937 generator(seed);
+    sgl::BitmapPtr bitmap(new sgl::Bitmap(width, height));
+    uint8_t* pixels = bitmap->getPixels();
+    for (size_t i = 0; i < size_t(width) * size_t(height) * 4; i++) {
+        pixels[i] = uint8_t(generator());
+    }
+    return bitmap;
+}
+
+// The blending formula Bitmap::blendPixelColor used before it was optimized, i.e., the reference.
+static sgl::Color blendColorReference(const sgl::Color& src, const sgl::Color& dst) {
+    int a = src.getA();
+    int ia = 255 - a;
+    return {
+            uint8_t((int(src.getR()) * a) / 255 + (int(dst.getR()) * ia) / 255),
+            uint8_t((int(src.getG()) * a) / 255 + (int(dst.getG()) * ia) / 255),
+            uint8_t((int(src.getB()) * a) / 255 + (int(dst.getB()) * ia) / 255),
+            uint8_t(a + (int(dst.getA()) * ia) / 255) };
+}
+
+/// Returns the source coordinates of the destination pixel (x, y) of a bitmap of size w x h rotated by 'degree'.
+static void getRotatedSourcePosition(int degree, int w, int h, int x, int y, int& sourceX, int& sourceY) {
+    if (degree == 90) {
+        // (x,y) -> (y,w-x-1)
+        sourceX = w - y - 1;
+        sourceY = x;
+    } else if (degree == 180) {
+        // (x,y) -> (w-x-1,h-y-1)
+        sourceX = w - x - 1;
+        sourceY = h - y - 1;
+    } else {
+        // (x,y) -> (h-y-1,x)
+        sourceX = y;
+        sourceY = h - x - 1;
+    }
+}
+
+/// Counts the pixels of a bitmap rotated by 'degree' that differ from the per-pixel formula.
+static size_t countRotationErrors(const sgl::BitmapPtr& bitmap, const sgl::BitmapPtr& rotatedBitmap, int degree) {
+    int w = bitmap->getWidth(), h = bitmap->getHeight();
+    size_t numErrors = 0;
+    for (int y = 0; y < rotatedBitmap->getHeight(); y++) {
+        for (int x = 0; x < rotatedBitmap->getWidth(); x++) {
+            int sourceX, sourceY;
+            getRotatedSourcePosition(degree, w, h, x, y, sourceX, sourceY);
+            if (rotatedBitmap->getPixelColor(x, y) != bitmap->getPixelColor(sourceX, sourceY)) {
+                numErrors++;
+            }
+        }
+    }
+    return numErrors;
+}
+
+/// Premultiplied alpha average of the 2x2 source block of the destination pixel (x, y) (box filter, factor 2).
+static void computeBoxDownsampleReference(const sgl::BitmapPtr& bitmap, int x, int y, float color[4]) {
+    float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < 4; i++) {
+        sgl::Color c = bitmap->getPixelColor(2 * x + (i & 1), 2 * y + (i >> 1));
+        float alpha = float(c.getA()) / 255.0f;
+        sum[0] += float(c.getR()) * alpha;
+        sum[1] += float(c.getG()) * alpha;
+        sum[2] += float(c.getB()) * alpha;
+        sum[3] += float(c.getA());
+    }
+    float alpha = sum[3] / 4.0f;
+    for (int c = 0; c < 3; c++) {
+        color[c] = alpha > 0.0f ? sum[c] / 4.0f * 255.0f / alpha : 0.0f;
+    }
+    color[3] = alpha;
+}
+
+static size_t countBoxDownsampleErrors(const sgl::BitmapPtr& bitmap, const sgl::BitmapPtr& downsampledBitmap) {
+    size_t numErrors = 0;
+    for (int y = 0; y < downsampledBitmap->getHeight(); y++) {
+        for (int x = 0; x < downsampledBitmap->getWidth(); x++) {
+            float color[4];
+            computeBoxDownsampleReference(bitmap, x, y, color);
+            const uint8_t* pixel = downsampledBitmap->getPixelConst(x, y);
+            // The color channels are reconstructed from 8-bit alpha, so they may be off by one after rounding.
+            for (int c = 0; c < 4; c++) {
+                if (std::abs(float(pixel[c]) - color[c]) > 1.01f) {
+                    numErrors++;
+                    break;
+                }
+            }
+        }
+    }
+    return numErrors;
+}
+
+// Sizes below and above the threshold for processing rows in parallel, with widths that are no multiple of four.
+static const int TEST_SIZES[][2] = { { 1, 1 }, { 7, 3 }, { 37, 23 }, { 613, 411 } };
+
+TEST(BitmapTest, Fill) {
+    for (const auto& size : TEST_SIZES) {
+        sgl::BitmapPtr bitmap = createRandomBitmap(size[0], size[1], 1);
+        sgl::Color color(12, 34, 56, 78);
+        bitmap->fill(color);
+        size_t numErrors = 0;
+        for (int y = 0; y < size[1]; y++) {
+            for (int x = 0; x < size[0]; x++) {
+                numErrors += bitmap->getPixelColor(x, y) != color ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(numErrors, 0u) << size[0] << "x" << size[1];
+    }
+}
+
+TEST(BitmapTest, Colorize) {
+    for (const auto& size : TEST_SIZES) {
+        sgl::BitmapPtr bitmap = createRandomBitmap(size[0], size[1], 2);
+        sgl::BitmapPtr bitmapOld = bitmap->clone();
+        bitmap->colorize(sgl::Color(200, 100, 50, 7));
+        size_t numErrors = 0;
+        for (int y = 0; y < size[1]; y++) {
+            for (int x = 0; x < size[0]; x++) {
+                sgl::Color expected(200, 100, 50, bitmapOld->getPixelColor(x, y).getA());
+                numErrors += bitmap->getPixelColor(x, y) != expected ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(numErrors, 0u) << size[0] << "x" << size[1];
+    }
+}
+
+TEST(BitmapTest, BlitClipped) {
+    sgl::BitmapPtr source = createRandomBitmap(37, 23, 3);
+    const sgl::Point2 positions[] = { { 0, 0 }, { 5, 7 }, { -10, -4 }, { 30, 40 }, { -36, 62 }, { 100, 0 } };
+    for (const sgl::Point2& pos : positions) {
+        sgl::BitmapPtr destination = createRandomBitmap(67, 63, 4);
+        sgl::BitmapPtr destinationOld = destination->clone();
+        source->blit(destination, pos);
+        size_t numErrors = 0;
+        for (int y = 0; y < destination->getHeight(); y++) {
+            for (int x = 0; x < destination->getWidth(); x++) {
+                int sourceX = x - pos.x, sourceY = y - pos.y;
+                bool isInside = sourceX >= 0 && sourceX < source->getWidth()
+                        && sourceY >= 0 && sourceY < source->getHeight();
+                sgl::Color expected = isInside
+                        ? source->getPixelColor(sourceX, sourceY) : destinationOld->getPixelColor(x, y);
+                numErrors += destination->getPixelColor(x, y) != expected ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(numErrors, 0u) << "position (" << pos.x << ", " << pos.y << ")";
+    }
+}
+
+TEST(BitmapTest, BlitRectangle) {
+    // The rows of the source rectangle start at y = 9, which the loop over the rows previously did not account for.
+    sgl::BitmapPtr source = createRandomBitmap(41, 29, 5);
+    sgl::BitmapPtr destination = createRandomBitmap(53, 47, 6);
+    sgl::BitmapPtr destinationOld = destination->clone();
+    sgl::Rectangle sourceRectangle{ 3.0f, 9.0f, 31.0f, 17.0f };
+    sgl::Rectangle destinationRectangle{ 20.0f, 25.0f, 31.0f, 17.0f };
+    source->blit(destination, sourceRectangle, destinationRectangle);
+    size_t numErrors = 0;
+    for (int y = 0; y < destination->getHeight(); y++) {
+        for (int x = 0; x < destination->getWidth(); x++) {
+            int localX = x - 20, localY = y - 25;
+            bool isInside = localX >= 0 && localX < 31 && localY >= 0 && localY < 17;
+            sgl::Color expected = isInside
+                    ? source->getPixelColor(localX + 3, localY + 9) : destinationOld->getPixelColor(x, y);
+            numErrors += destination->getPixelColor(x, y) != expected ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(numErrors, 0u);
+}
+
+TEST(BitmapTest, Rotated) {
+    for (const auto& size : TEST_SIZES) {
+        sgl::BitmapPtr bitmap = createRandomBitmap(size[0], size[1], 7);
+        for (int degree : { 90, 180, 270 }) {
+            sgl::BitmapPtr rotatedBitmap = bitmap->rotated(degree);
+            bool isSwapped = degree != 180;
+            ASSERT_EQ(rotatedBitmap->getWidth(), isSwapped ? size[1] : size[0]);
+            ASSERT_EQ(rotatedBitmap->getHeight(), isSwapped ? size[0] : size[1]);
+            EXPECT_EQ(countRotationErrors(bitmap, rotatedBitmap, degree), 0u)
+                    << size[0] << "x" << size[1] << ", " << degree << " degrees";
+        }
+        // Rotating by 90 and 270 degrees or twice by 180 degrees results in the original bitmap.
+        sgl::BitmapPtr roundTrip = bitmap->rotated(90)->rotated(270);
+        EXPECT_EQ(memcmp(roundTrip->getPixels(), bitmap->getPixels(), size_t(size[0]) * size_t(size[1]) * 4), 0);
+        roundTrip = bitmap->rotated(180)->rotated(180);
+        EXPECT_EQ(memcmp(roundTrip->getPixels(), bitmap->getPixels(), size_t(size[0]) * size_t(size[1]) * 4), 0);
+    }
+}
+
+TEST(BitmapTest, BlendPixelColor) {
+    // All combinations of source alpha and destination values.
+    sgl::BitmapPtr bitmap(new sgl::Bitmap(256, 256));
+    size_t numErrors = 0;
+    for (int value = 0; value < 256; value++) {
+        for (int alpha = 0; alpha < 256; alpha++) {
+            sgl::Color dst(uint8_t(value), uint8_t(255 - value), uint8_t(value / 2), uint8_t(value));
+            sgl::Color src(uint8_t(255 - alpha), uint8_t(alpha), uint8_t(value), uint8_t(alpha));
+            bitmap->setPixelColor(alpha, value, dst);
+            bitmap->blendPixelColor(alpha, value, src);
+            numErrors += bitmap->getPixelColor(alpha, value) != blendColorReference(src, dst) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(numErrors, 0u);
+}
+
+TEST(BitmapTest, BlitBlended) {
+    for (const auto& size : TEST_SIZES) {
+        sgl::BitmapPtr source = createRandomBitmap(size[0], size[1], 8);
+        sgl::BitmapPtr destination = createRandomBitmap(size[0] + 5, size[1] + 2, 9);
+        sgl::BitmapPtr destinationOld = destination->clone();
+        sgl::Point2 pos(3, 1);
+        source->blitBlended(destination, pos);
+        size_t numErrors = 0;
+        for (int y = 0; y < destination->getHeight(); y++) {
+            for (int x = 0; x < destination->getWidth(); x++) {
+                int sourceX = x - pos.x, sourceY = y - pos.y;
+                bool isInside = sourceX >= 0 && sourceX < source->getWidth()
+                        && sourceY >= 0 && sourceY < source->getHeight();
+                sgl::Color expected = isInside
+                        ? blendColorReference(source->getPixelColor(sourceX, sourceY), destinationOld->getPixelColor(x, y))
+                        : destinationOld->getPixelColor(x, y);
+                numErrors += destination->getPixelColor(x, y) != expected ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(numErrors, 0u) << size[0] << "x" << size[1];
+    }
+}
+
+TEST(BitmapTest, BlitWrap) {
+    // Also tests a source that is larger than the destination, so that rows and columns are blended multiple times.
+    const int sourceSizes[][2] = { { 9, 5 }, { 40, 30 }, { 700, 500 } };
+    for (const auto& sourceSize : sourceSizes) {
+        sgl::BitmapPtr source = createRandomBitmap(sourceSize[0], sourceSize[1], 10);
+        sgl::BitmapPtr destination = createRandomBitmap(23, 17, 11);
+        sgl::BitmapPtr reference = destination->clone();
+        const int posX = -7, posY = 12;
+        destination->blitWrap(source, posX, posY);
+        for (int y = 0; y < source->getHeight(); y++) {
+            for (int x = 0; x < source->getWidth(); x++) {
+                int destX = x + posX, destY = y + posY;
+                reference->floorPixelPosition(destX, destY);
+                reference->setPixelColor(destX, destY, blendColorReference(
+                        source->getPixelColor(x, y), reference->getPixelColor(destX, destY)));
+            }
+        }
+        EXPECT_EQ(memcmp(destination->getPixels(), reference->getPixels(), 23 * 17 * 4), 0)
+                << "source size " << sourceSize[0] << "x" << sourceSize[1];
+    }
+}
+
+TEST(BitmapTest, ResizedIdentity) {
+    // At a scale of one, the box and Lanczos filter weights are one for the center pixel and zero elsewhere.
+    sgl::BitmapPtr bitmap = createRandomBitmap(37, 23, 12);
+    sgl::BitmapPtr bitmapOpaque = bitmap->clone();
+    for (int y = 0; y < 23; y++) {
+        for (int x = 0; x < 37; x++) {
+            bitmapOpaque->getPixel(x, y)[3] = 255;
+        }
+    }
+    for (auto filter : { sgl::BitmapResampleFilter::BOX, sgl::BitmapResampleFilter::LANCZOS3 }) {
+        sgl::BitmapPtr resizedBitmap = bitmapOpaque->resized(37, 23, filter);
+        EXPECT_EQ(memcmp(resizedBitmap->getPixels(), bitmapOpaque->getPixels(), 37 * 23 * 4), 0);
+    }
+}
+
+TEST(BitmapTest, ResizedConstant) {
+    // Filtering a constant image results in the same constant for all filters and scales (including upsampling).
+    sgl::BitmapPtr bitmap(new sgl::Bitmap(61, 45));
+    bitmap->fill(sgl::Color(90, 180, 30, 128));
+    const int sizes[][2] = { { 30, 22 }, { 7, 5 }, { 1, 1 }, { 100, 80 } };
+    for (auto filter : { sgl::BitmapResampleFilter::BOX, sgl::BitmapResampleFilter::LANCZOS3 }) {
+        for (const auto& size : sizes) {
+            sgl::BitmapPtr resizedBitmap = bitmap->resized(size[0], size[1], filter);
+            size_t numErrors = 0;
+            for (int y = 0; y < size[1]; y++) {
+                for (int x = 0; x < size[0]; x++) {
+                    const uint8_t* pixel = resizedBitmap->getPixelConst(x, y);
+                    numErrors += std::abs(int(pixel[0]) - 90) > 1 || std::abs(int(pixel[1]) - 180) > 1
+                            || std::abs(int(pixel[2]) - 30) > 1 || pixel[3] != 128 ? 1 : 0;
+                }
+            }
+            EXPECT_EQ(numErrors, 0u) << size[0] << "x" << size[1];
+        }
+    }
+}
+
+TEST(BitmapTest, ResizedBoxHalf) {
+    // A box filter with a factor of two averages 2x2 blocks in premultiplied alpha.
+    sgl::BitmapPtr bitmap = createRandomBitmap(62, 46, 13);
+    sgl::BitmapPtr resizedBitmap = bitmap->resized(31, 23, sgl::BitmapResampleFilter::BOX);
+    EXPECT_EQ(countBoxDownsampleErrors(bitmap, resizedBitmap), 0u);
+}
+
+TEST(BitmapTest, GenerateMipChain) {
+    sgl::BitmapPtr bitmap = createRandomBitmap(64, 16, 14);
+    std::vector<sgl::BitmapPtr> mipLevels = bitmap->generateMipChain();
+    const int expectedSizes[][2] = { { 32, 8 }, { 16, 4 }, { 8, 2 }, { 4, 1 }, { 2, 1 }, { 1, 1 } };
+    ASSERT_EQ(mipLevels.size(), std::size(expectedSizes));
+    sgl::BitmapPtr previousLevel = bitmap;
+    for (size_t level = 0; level < mipLevels.size(); level++) {
+        const sgl::BitmapPtr& mipLevel = mipLevels.at(level);
+        EXPECT_EQ(mipLevel->getWidth(), expectedSizes[level][0]);
+        EXPECT_EQ(mipLevel->getHeight(), expectedSizes[level][1]);
+        // While both dimensions are halved, each texel is the box average of a 2x2 block of the previous level.
+        if (previousLevel->getHeight() > 1) {
+            EXPECT_EQ(countBoxDownsampleErrors(previousLevel, mipLevel), 0u) << "level " << (level + 1);
+        }
+        previousLevel = mipLevel;
+    }
+
+    // Odd sizes are rounded down.
+    mipLevels = createRandomBitmap(13, 6, 15)->generateMipChain(sgl::BitmapResampleFilter::LANCZOS3);
+    ASSERT_EQ(mipLevels.size(), 3u);
+    EXPECT_EQ(mipLevels.at(0)->getWidth(), 6);
+    EXPECT_EQ(mipLevels.at(0)->getHeight(), 3);
+    EXPECT_EQ(mipLevels.at(1)->getWidth(), 3);
+    EXPECT_EQ(mipLevels.at(1)->getHeight(), 1);
+    EXPECT_EQ(mipLevels.at(2)->getWidth(), 1);
+    EXPECT_EQ(mipLevels.at(2)->getHeight(), 1);
+}
+
+TEST(BitmapTest, Benchmark8K) {
+    const int width = 7680, height = 4320;
+    sgl::BitmapPtr bitmap = createRandomBitmap(width, height, 16);
+    sgl::BitmapPtr source = createRandomBitmap(width, height, 17);
+    sgl::BitmapPtr destination = bitmap->clone();
+    auto measureTime = [](auto&& function) {
+        auto startTime = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    };
+
+    double timeFillReference = measureTime([&]() {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                destination->setPixelColor(x, y, sgl::Color(1, 2, 3, 4));
+            }
+        }
+    });
+    double timeFill = measureTime([&]() { destination->fill(sgl::Color(1, 2, 3, 4)); });
+
+    double timeBlit = measureTime([&]() { bitmap->blit(destination, sgl::Point2(0, 0)); });
+    EXPECT_EQ(memcmp(destination->getPixels(), bitmap->getPixels(), size_t(width) * size_t(height) * 4), 0);
+
+    double timeBlendReference = measureTime([&]() {
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                destination->setPixelColor(x, y, blendColorReference(
+                        source->getPixelColor(x, y), destination->getPixelColor(x, y)));
+            }
+        }
+    });
+    sgl::BitmapPtr blendedReference = destination;
+    destination = bitmap->clone();
+    double timeBlend = measureTime([&]() { source->blitBlended(destination, sgl::Point2(0, 0)); });
+    EXPECT_EQ(memcmp(destination->getPixels(), blendedReference->getPixels(), size_t(width) * size_t(height) * 4), 0);
+    blendedReference = {};
+
+    double timeColorize = measureTime([&]() { destination->colorize(sgl::Color(10, 20, 30)); });
+
+    sgl::BitmapPtr rotatedBitmap;
+    double timeRotate90 = measureTime([&]() { rotatedBitmap = bitmap->rotated(90); });
+    EXPECT_EQ(countRotationErrors(bitmap, rotatedBitmap, 90), 0u);
+    double timeRotate180 = measureTime([&]() { rotatedBitmap = bitmap->rotated(180); });
+    EXPECT_EQ(countRotationErrors(bitmap, rotatedBitmap, 180), 0u);
+    rotatedBitmap = {};
+
+    sgl::BitmapPtr resizedBitmap;
+    double timeResizeBox = measureTime([&]() {
+        resizedBitmap = bitmap->resized(width / 2, height / 2, sgl::BitmapResampleFilter::BOX);
+    });
+    EXPECT_EQ(countBoxDownsampleErrors(bitmap, resizedBitmap), 0u);
+    double timeResizeLanczos = measureTime([&]() {
+        resizedBitmap = bitmap->resized(1920, 1080, sgl::BitmapResampleFilter::LANCZOS3);
+    });
+    std::vector<sgl::BitmapPtr> mipLevels;
+    double timeMipChain = measureTime([&]() { mipLevels = bitmap->generateMipChain(); });
+    EXPECT_EQ(mipLevels.size(), 12u);
+
+    std::cout << "Bitmap operations on " << width << "x" << height << " pixels: fill " << timeFillReference
+              << "ms (per pixel) vs. " << timeFill << "ms, blit " << timeBlit << "ms, blend " << timeBlendReference
+              << "ms (per pixel) vs. " << timeBlend << "ms, colorize " << timeColorize << "ms, rotated(90) "
+              << timeRotate90 << "ms, rotated(180) " << timeRotate180 << "ms, resized (box, 1/2) " << timeResizeBox
+              << "ms, resized (Lanczos-3, 1080p) " << timeResizeLanczos << "ms, mip chain " << timeMipChain << "ms"
+              << std::endl;
+}
@@ -0,0 +1,193 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Utils/SciVis/CameraPath.hpp>
+
+static void expectMatricesNear(const glm::mat4& a, const glm::mat4& b, float epsilon) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_NEAR(a[i][j], b[i][j], epsilon) << "element [" << i << "][" << j << "]";
+        }
+    }
+}
+
+static bool getMatricesEqual(const glm::mat4& a, const glm::mat4& b) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            if (a[i][j] != b[i][j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// The view matrix is R * T(-p), so the camera position is p = -R^T * t.
+static glm::vec3 getCameraPosition(const glm::mat4& viewMatrix) {
+    glm::vec3 position(0.0f, 0.0f, 0.0f);
+    for (int k = 0; k < 3; k++) {
+        float value = 0.0f;
+        for (int r = 0; r < 3; r++) {
+            value -= viewMatrix[k][r] * viewMatrix[3][r];
+        }
+        position[k] = value;
+    }
+    return position;
+}
+
+static float getDistance(const glm::vec3& a, const glm::vec3& b) {
+    float dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/// Control points with non-uniform spacing in time and space.
+static std::vector<sgl::ControlPoint> createControlPoints() {
+    return {
+            sgl::ControlPoint(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+            sgl::ControlPoint(1.0f, 1.0f, 0.0f, 0.0f, 0.3f, 0.1f),
+            sgl::ControlPoint(2.5f, 1.0f, 8.0f, 0.0f, 0.9f, -0.2f),
+            sgl::ControlPoint(3.0f, 3.0f, 8.0f, 1.0f, 1.2f, 0.0f),
+            sgl::ControlPoint(5.0f, 3.0f, 8.0f, 4.0f, 2.0f, 0.3f),
+    };
+}
+
+static const sgl::CameraPathInterpolation interpolationModes[] = {
+        sgl::CameraPathInterpolation::LINEAR, sgl::CameraPathInterpolation::CATMULL_ROM,
+        sgl::CameraPathInterpolation::KOCHANEK_BARTELS
+};
+
+TEST(CameraPathTest, InterpolatesControlPoints) {
+    std::vector<sgl::ControlPoint> controlPoints = createControlPoints();
+    for (sgl::CameraPathInterpolation interpolation : interpolationModes) {
+        sgl::CameraPath cameraPath;
+        cameraPath.setInterpolation(interpolation);
+        sgl::KochanekBartelsParameters parameters;
+        parameters.tension = 0.5f;
+        parameters.bias = -0.25f;
+        parameters.continuity = 0.25f;
+        cameraPath.setKochanekBartelsParameters(parameters);
+        cameraPath.fromControlPoints(controlPoints);
+        for (const sgl::ControlPoint& controlPoint : controlPoints) {
+            SCOPED_TRACE("interpolation " + std::to_string(int(interpolation)) + ", time "
+                         + std::to_string(controlPoint.time));
+            // A path with a single control point evaluates to the transform of the control point.
+            sgl::CameraPath singlePointPath;
+            singlePointPath.fromControlPoints({ controlPoint });
+            glm::mat4 viewMatrix = cameraPath.evaluate(controlPoint.time);
+            expectMatricesNear(viewMatrix, singlePointPath.evaluate(0.0f), 1e-4f);
+            EXPECT_LT(getDistance(getCameraPosition(viewMatrix), controlPoint.position), 1e-4f);
+        }
+    }
+}
+
+TEST(CameraPathTest, ConstantSpeedUnderArcLengthParameterization) {
+    std::vector<sgl::ControlPoint> controlPoints = createControlPoints();
+    const int numSamples = 1000;
+    for (sgl::CameraPathInterpolation interpolation : interpolationModes) {
+        SCOPED_TRACE("interpolation " + std::to_string(int(interpolation)));
+        sgl::CameraPath cameraPath;
+        cameraPath.setInterpolation(interpolation);
+        cameraPath.fromControlPoints(controlPoints);
+        const float endTime = cameraPath.getEndTime();
+
+        // Returns the maximum deviation of the distance traveled until time t from t / endTime * total distance.
+        auto computeMaxRelativeDeviation = [&]() {
+            std::vector<float> distances;
+            distances.push_back(0.0f);
+            glm::vec3 lastPosition = getCameraPosition(cameraPath.evaluate(0.0f));
+            for (int i = 1; i <= numSamples; i++) {
+                glm::vec3 position = getCameraPosition(cameraPath.evaluate(endTime * float(i) / float(numSamples)));
+                distances.push_back(distances.back() + getDistance(position, lastPosition));
+                lastPosition = position;
+            }
+            float maxDeviation = 0.0f;
+            for (int i = 0; i <= numSamples; i++) {
+                float expectedDistance = float(i) / float(numSamples) * distances.back();
+                maxDeviation = std::max(maxDeviation, std::abs(distances.at(i) - expectedDistance));
+            }
+            return maxDeviation / distances.back();
+        };
+
+        // The control points are not spaced evenly, so the speed varies without the reparameterization.
+        EXPECT_GT(computeMaxRelativeDeviation(), 0.1f);
+
+        // The arc length table is piecewise linear, so a small deviation remains for the splines.
+        cameraPath.setUseConstantSpeed(true);
+        ASSERT_TRUE(cameraPath.getUseConstantSpeed());
+        EXPECT_LT(computeMaxRelativeDeviation(), 1e-3f);
+
+        // The end points stay fixed.
+        EXPECT_LT(getDistance(getCameraPosition(cameraPath.evaluate(0.0f)), controlPoints.front().position), 1e-4f);
+        EXPECT_LT(getDistance(getCameraPosition(cameraPath.evaluate(endTime)), controlPoints.back().position), 1e-4f);
+    }
+}
+
+TEST(CameraPathTest, NonRealTimeFramesAreDeterministic) {
+    sgl::CameraPath cameraPath;
+    cameraPath.setInterpolation(sgl::CameraPathInterpolation::CATMULL_ROM);
+    cameraPath.fromControlPoints(createControlPoints());
+
+    // Frames at t = 0, 1/30, ..., 5 (the end time is a whole number of frames).
+    const float framesPerSecond = 30.0f;
+    const size_t numFrames = cameraPath.getNumFrames(framesPerSecond);
+    EXPECT_EQ(numFrames, 151u);
+    std::vector<glm::mat4> transforms = cameraPath.sampleFrameTransforms(framesPerSecond);
+    ASSERT_EQ(transforms.size(), numFrames);
+    for (size_t frameIdx = 0; frameIdx < numFrames; frameIdx++) {
+        glm::mat4 expectedTransform = cameraPath.evaluate(float(double(frameIdx) / double(framesPerSecond)));
+        EXPECT_TRUE(getMatricesEqual(transforms.at(frameIdx), expectedTransform)) << "frame " << frameIdx;
+    }
+    EXPECT_LT(getDistance(
+            getCameraPosition(transforms.back()), createControlPoints().back().position), 1e-4f);
+
+    // Sampling the frames in chunks (e.g., distributed over multiple processes) or again gives the same result.
+    const size_t chunkSize = 40;
+    for (size_t firstFrame = 0; firstFrame < numFrames; firstFrame += chunkSize) {
+        size_t numChunkFrames = std::min(chunkSize, numFrames - firstFrame);
+        std::vector<glm::mat4> chunkTransforms = cameraPath.sampleFrameTransforms(
+                framesPerSecond, firstFrame, numChunkFrames);
+        ASSERT_EQ(chunkTransforms.size(), numChunkFrames);
+        for (size_t i = 0; i < numChunkFrames; i++) {
+            EXPECT_TRUE(getMatricesEqual(chunkTransforms.at(i), transforms.at(firstFrame + i)))
+                    << "frame " << (firstFrame + i);
+        }
+    }
+    std::vector<glm::mat4> transformsRepeated = cameraPath.sampleFrameTransforms(framesPerSecond);
+    for (size_t frameIdx = 0; frameIdx < numFrames; frameIdx++) {
+        EXPECT_TRUE(getMatricesEqual(transformsRepeated.at(frameIdx), transforms.at(frameIdx))) << "frame " << frameIdx;
+    }
+
+    // If the end time is not a whole number of frames, the last frame lies before the end time.
+    EXPECT_EQ(cameraPath.getNumFrames(24.1f), size_t(std::floor(5.0 * double(24.1f))) + 1);
+    EXPECT_EQ(cameraPath.getNumFrames(60.0f), 301u);
+    EXPECT_EQ(sgl::CameraPath().getNumFrames(framesPerSecond), 0u);
+}
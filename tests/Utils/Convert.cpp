@@ -0,0 +1,246 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <Utils/Convert.hpp>
+
+// The stream-based implementations that sgl::toString and sgl::fromString used before the std::to_chars fast paths.
+template <class T>
+std::string toStringStream(T obj) {
+    std::ostringstream ostr;
+    ostr << obj;
+    return ostr.str();
+}
+template <class T>
+std::string toStringStream(T obj, int precision, bool fixed, bool scientific) {
+    std::ostringstream ostr;
+    ostr.precision(precision);
+    if (fixed) {
+        ostr << std::fixed;
+    }
+    if (scientific) {
+        ostr << std::scientific;
+    }
+    ostr << obj;
+    return ostr.str();
+}
+template <class T>
+T fromStringStream(const std::string &stringObject) {
+    std::stringstream strstr;
+    strstr << stringObject;
+    T type{};
+    strstr >> type;
+    return type;
+}
+
+template<class T>
+static bool bitwiseEqual(T a, T b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template<class T>
+static T randomFloat(std::mt19937_64& generator) {
+    // Random bit patterns cover all exponents, denormals, infinities and NaNs; random decimals cover typical data.
+    if (generator() % 2 == 0) {
+        using UintType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        auto bits = UintType(generator());
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    return T(std::round(distribution(generator) * 1000.0) / 1000.0);
+}
+
+TEST(ConvertTest, ToStringMatchesStream) {
+    std::mt19937_64 generator(17);
+    for (int i = 0; i < 20000; i++) {
+        auto valueFloat = randomFloat<float>(generator);
+        auto valueDouble = randomFloat<double>(generator);
+        ASSERT_EQ(sgl::toString(valueFloat), toStringStream(valueFloat));
+        ASSERT_EQ(sgl::toString(valueDouble), toStringStream(valueDouble));
+        ASSERT_EQ(sgl::toStringLocaleC(valueDouble), toStringStream(valueDouble));
+        int precision = int(generator() % 12) - 1;
+        bool fixed = generator() % 2 == 0;
+        bool scientific = generator() % 2 == 0;
+        ASSERT_EQ(sgl::toString(valueFloat, precision, fixed, false, scientific),
+                  toStringStream(valueFloat, precision, fixed, scientific));
+        ASSERT_EQ(sgl::toString(valueDouble, precision, fixed, false, scientific),
+                  toStringStream(valueDouble, precision, fixed, scientific));
+
+        auto valueInt64 = int64_t(generator());
+        ASSERT_EQ(sgl::toString(valueInt64), toStringStream(valueInt64));
+        ASSERT_EQ(sgl::toString(uint32_t(valueInt64)), toStringStream(uint32_t(valueInt64)));
+        ASSERT_EQ(sgl::toString(int16_t(valueInt64), 3), toStringStream(int16_t(valueInt64), 3, true, false));
+    }
+    EXPECT_EQ(sgl::toString(1e300, 2, true), toStringStream(1e300, 2, true, false));
+    EXPECT_EQ(sgl::toString(true), "1");
+    EXPECT_EQ(sgl::toString('a'), "a");
+    EXPECT_EQ(sgl::numberToCommaString(-123456789), "-123,456,789");
+}
+
+TEST(ConvertTest, FromStringMatchesStream) {
+    const char* strings[] = {
+            "0", "-0", "1", "+1", "-1", "  42", "42  ", "42abc", "4 2", "007", "0x10", "1e5", "1.5e", "1e+5", "1E-5",
+            ".5", "5.", "-.5", "+-1", "-+1", "++1", "+", "-", ".", "abc", "inf", "-inf", "nan", "1e999", "-1e999",
+            "1e-999", "1e-40", "4294967295", "4294967296", "-2147483648", "-2147483649", "18446744073709551615",
+            "18446744073709551616", "9223372036854775808", "3.4028235e38", "3.4028236e38", "1,5", "\t\n 3.25",
+    };
+    for (const char* str : strings) {
+        SCOPED_TRACE(str);
+        float valueFloat = sgl::fromString<float>(str);
+        float valueFloatStream = fromStringStream<float>(str);
+        EXPECT_TRUE(bitwiseEqual(valueFloat, valueFloatStream));
+        double valueDouble = sgl::fromString<double>(str);
+        double valueDoubleStream = fromStringStream<double>(str);
+        EXPECT_TRUE(bitwiseEqual(valueDouble, valueDoubleStream));
+        EXPECT_EQ(sgl::fromString<int32_t>(str), fromStringStream<int32_t>(str));
+        EXPECT_EQ(sgl::fromString<uint32_t>(str), fromStringStream<uint32_t>(str));
+        EXPECT_EQ(sgl::fromString<int64_t>(str), fromStringStream<int64_t>(str));
+        EXPECT_EQ(sgl::fromString<uint64_t>(str), fromStringStream<uint64_t>(str));
+    }
+
+    std::mt19937_64 generator(23);
+    for (int i = 0; i < 20000; i++) {
+        std::string strFloat = toStringStream(randomFloat<float>(generator), int(generator() % 10), false, false);
+        float valueFloat = sgl::fromString<float>(strFloat);
+        float valueFloatStream = fromStringStream<float>(strFloat);
+        ASSERT_TRUE(bitwiseEqual(valueFloat, valueFloatStream)) << strFloat;
+        std::string strDouble = toStringStream(randomFloat<double>(generator), int(generator() % 18), false, false);
+        double valueDouble = sgl::fromString<double>(strDouble);
+        double valueDoubleStream = fromStringStream<double>(strDouble);
+        ASSERT_TRUE(bitwiseEqual(valueDouble, valueDoubleStream)) << strDouble;
+    }
+}
+
+TEST(ConvertTest, ShortestRoundTrip) {
+    char buffer[sgl::NUMBER_STRING_BUFFER_SIZE];
+    std::mt19937_64 generator(5);
+    for (int i = 0; i < 100000; i++) {
+        auto valueFloat = randomFloat<float>(generator);
+        auto valueDouble = randomFloat<double>(generator);
+        if (!std::isfinite(valueFloat) || !std::isfinite(valueDouble)) {
+            continue;
+        }
+        float valueFloatParsed = 0.0f;
+        char* end = sgl::writeNumber(buffer, buffer + sizeof(buffer), valueFloat);
+        ASSERT_NE(end, nullptr);
+        ASSERT_EQ(sgl::parseNumber(buffer, end, valueFloatParsed), end);
+        ASSERT_TRUE(bitwiseEqual(valueFloat, valueFloatParsed));
+        double valueDoubleParsed = 0.0;
+        end = sgl::writeNumber(buffer, buffer + sizeof(buffer), valueDouble);
+        ASSERT_NE(end, nullptr);
+        ASSERT_EQ(sgl::parseNumber(buffer, end, valueDoubleParsed), end);
+        ASSERT_TRUE(bitwiseEqual(valueDouble, valueDoubleParsed));
+    }
+
+    std::string str;
+    sgl::appendNumber(str, 0.1f);
+    str += ' ';
+    sgl::appendNumber(str, 1.0f / 3.0f);
+    str += ' ';
+    sgl::appendNumber(str, std::numeric_limits<int64_t>::min());
+    str += ' ';
+    sgl::appendNumber(str, -std::numeric_limits<double>::max());
+#ifdef SGL_CONVERT_FLOAT_CHARCONV
+    EXPECT_EQ(str, "0.1 0.33333334 -9223372036854775808 -1.7976931348623157e+308");
+#endif
+    EXPECT_EQ(sgl::writeNumber(buffer, buffer + 2, 123), nullptr);
+}
+
+TEST(ConvertTest, Arrays) {
+    std::vector<float> values = { 1.0f, -2.5f, 0.1f, 1e-20f, 3e30f };
+    std::string str = "v ";
+    sgl::appendNumberArray(str, values);
+    std::vector<float> valuesParsed;
+    EXPECT_EQ(sgl::parseNumberArray(std::string_view(str).substr(2), valuesParsed), values.size());
+    EXPECT_EQ(values, valuesParsed);
+
+    int valuesInt[4];
+    EXPECT_EQ(sgl::parseNumberArray(" 1, 2;-3\t+4\n", valuesInt, 4), 4u);
+    EXPECT_EQ(valuesInt[0] + valuesInt[1] + valuesInt[2] + valuesInt[3], 4);
+    EXPECT_EQ(sgl::parseNumberArray("5 6 x 7", valuesInt, 4), 2u);
+    EXPECT_EQ(sgl::parseNumberArray("1 2 3 4 5", valuesInt, 3), 3u);
+
+    // Arrays larger than the internal buffer of appendNumberArray.
+    std::vector<double> valuesLarge(1000);
+    std::mt19937_64 generator(3);
+    for (auto& value : valuesLarge) {
+        value = std::uniform_real_distribution<double>(-1e6, 1e6)(generator);
+    }
+    std::string strLarge;
+    sgl::appendNumberArray(strLarge, valuesLarge, ',');
+    std::vector<double> valuesLargeParsed;
+    sgl::parseNumberArray(strLarge, valuesLargeParsed);
+    EXPECT_EQ(valuesLarge, valuesLargeParsed);
+
+    double value = 0.0;
+    EXPECT_TRUE(sgl::parseNumber(" 2.5 ", value));
+    EXPECT_EQ(value, 2.5);
+    EXPECT_FALSE(sgl::parseNumber("2.5x", value));
+    EXPECT_FALSE(sgl::parseNumber("", value));
+}
+
+TEST(ConvertTest, Benchmark) {
+    const size_t numValues = 300000;
+    std::mt19937_64 generator(11);
+    std::vector<float> values(numValues);
+    for (auto& value : values) {
+        value = std::uniform_real_distribution<float>(-100.0f, 100.0f)(generator);
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::string strStream;
+    for (float value : values) {
+        strStream += toStringStream(value);
+        strStream += ' ';
+    }
+    std::vector<float> valuesStream;
+    std::istringstream istr(strStream);
+    float valueStream;
+    while (istr >> valueStream) {
+        valuesStream.push_back(valueStream);
+    }
+    double timeStream = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    startTime = std::chrono::steady_clock::now();
+    std::string strCharconv;
+    sgl::appendNumberArray(strCharconv, values);
+    std::vector<float> valuesCharconv;
+    sgl::parseNumberArray(strCharconv, valuesCharconv);
+    double timeCharconv = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    EXPECT_EQ(valuesStream.size(), numValues);
+    EXPECT_EQ(valuesCharconv, values);
+    std::cout << "Writing and parsing " << numValues << " floats: streams " << timeStream * 1e3 << "ms, "
+              << "appendNumberArray/parseNumberArray " << timeCharconv * 1e3 << "ms" << std::endl;
+}
@@ -0,0 +1,190 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <Utils/Convert.hpp>
+#include <Utils/StringUtils.hpp>
+#include <Utils/Json/SimpleJson.hpp>
+#include <Utils/SciVis/FrameTimeBenchmark.hpp>
+
+/*
+ * A fixed sequence of frame times with two stutters: 8 frames at 10ms, one at 25ms and one at 35ms.
+ * Sorted, the percentile p lies at the rank p / 100 * 9 and is linearly interpolated between the closest ranks.
+ */
+static std::vector<double> createFrameTimesMs() {
+    return { 10.0, 10.0, 25.0, 10.0, 10.0, 10.0, 35.0, 10.0, 10.0, 10.0 };
+}
+
+static void expectFixedSequenceStatistics(const sgl::FrameTimeStatistics& statistics) {
+    EXPECT_EQ(statistics.numSamples, 10u);
+    EXPECT_DOUBLE_EQ(statistics.mean, 14.0);
+    EXPECT_DOUBLE_EQ(statistics.median, 10.0);
+    EXPECT_DOUBLE_EQ(statistics.minimum, 10.0);
+    EXPECT_DOUBLE_EQ(statistics.maximum, 35.0);
+    EXPECT_DOUBLE_EQ(statistics.variance, 690.0 / 9.0);
+    EXPECT_DOUBLE_EQ(statistics.standardDeviation, std::sqrt(690.0 / 9.0));
+    EXPECT_DOUBLE_EQ(statistics.percentile90, 26.0);
+    EXPECT_DOUBLE_EQ(statistics.percentile95, 30.5);
+    EXPECT_DOUBLE_EQ(statistics.percentile99, 34.1);
+    EXPECT_EQ(statistics.numStutters, 2u);
+}
+
+TEST(FrameTimeBenchmarkTest, StatisticsOfFixedSequence) {
+    expectFixedSequenceStatistics(sgl::FrameTimeStatistics::compute(createFrameTimesMs()));
+
+    // Only the frame taking longer than three times the median counts as a stutter.
+    EXPECT_EQ(sgl::FrameTimeStatistics::compute(createFrameTimesMs(), 3.0).numStutters, 1u);
+
+    // A frame at exactly the threshold is no stutter.
+    sgl::FrameTimeStatistics statistics = sgl::FrameTimeStatistics::compute({ 10.0, 10.0, 20.0, 10.0 });
+    EXPECT_DOUBLE_EQ(statistics.median, 10.0);
+    EXPECT_EQ(statistics.numStutters, 0u);
+
+    statistics = sgl::FrameTimeStatistics::compute(std::vector<double>(100, 16.0));
+    EXPECT_DOUBLE_EQ(statistics.mean, 16.0);
+    EXPECT_DOUBLE_EQ(statistics.percentile99, 16.0);
+    EXPECT_DOUBLE_EQ(statistics.standardDeviation, 0.0);
+    EXPECT_EQ(statistics.numStutters, 0u);
+
+    statistics = sgl::FrameTimeStatistics::compute({ 12.0 });
+    EXPECT_DOUBLE_EQ(statistics.median, 12.0);
+    EXPECT_DOUBLE_EQ(statistics.percentile99, 12.0);
+    EXPECT_DOUBLE_EQ(statistics.variance, 0.0);
+
+    statistics = sgl::FrameTimeStatistics::compute({});
+    EXPECT_EQ(statistics.numSamples, 0u);
+    EXPECT_EQ(statistics.numStutters, 0u);
+}
+
+TEST(FrameTimeBenchmarkTest, WarmupFramesAreNotMeasured) {
+    sgl::FrameTimeBenchmarkSettings settings;
+    settings.numWarmupIterations = 1;
+    settings.numMeasuredIterations = 2;
+    settings.framesPerSecond = 4.0f;
+    sgl::FrameTimeBenchmark benchmark;
+    const size_t numFramesPerIteration = 5;
+    benchmark.start(settings, numFramesPerIteration);
+
+    for (int iterationIdx = 0; iterationIdx < 3; iterationIdx++) {
+        EXPECT_EQ(benchmark.getIsWarmup(), iterationIdx == 0);
+        for (size_t frameIdx = 0; frameIdx < numFramesPerIteration; frameIdx++) {
+            ASSERT_FALSE(benchmark.getIsFinished());
+            EXPECT_EQ(benchmark.getIterationIdx(), iterationIdx);
+            EXPECT_EQ(benchmark.getFrameIdx(), frameIdx);
+            EXPECT_FLOAT_EQ(benchmark.getCurrentTime(), float(frameIdx) / 4.0f);
+            benchmark.beginFrame();
+            benchmark.endFrame(2.0);
+        }
+    }
+    EXPECT_TRUE(benchmark.getIsFinished());
+    // Frames after the last iteration are ignored.
+    benchmark.beginFrame();
+    benchmark.endFrame(2.0);
+
+    EXPECT_EQ(benchmark.getFrameTimeStatistics().numSamples, 10u);
+    EXPECT_EQ(benchmark.getCpuTimeStatistics().numSamples, 10u);
+    sgl::FrameTimeStatistics gpuTimeStatistics = benchmark.getGpuTimeStatistics();
+    EXPECT_EQ(gpuTimeStatistics.numSamples, 10u);
+    EXPECT_DOUBLE_EQ(gpuTimeStatistics.mean, 2.0);
+    EXPECT_EQ(gpuTimeStatistics.numStutters, 0u);
+}
+
+TEST(FrameTimeBenchmarkTest, ReportOutput) {
+    sgl::FrameTimeBenchmarkSettings settings;
+    settings.name = "FixedSequence";
+    settings.numWarmupIterations = 0;
+    settings.numMeasuredIterations = 1;
+    sgl::FrameTimeBenchmark benchmark;
+    benchmark.start(settings, 10);
+    std::vector<uint64_t> frameTimesNs, cpuTimesNs, gpuTimesNs;
+    for (double frameTimeMs : createFrameTimesMs()) {
+        frameTimesNs.push_back(uint64_t(frameTimeMs * 1e6));
+        cpuTimesNs.push_back(uint64_t(frameTimeMs * 0.5e6));
+        gpuTimesNs.push_back(uint64_t(frameTimeMs * 0.25e6));
+    }
+    benchmark.setFrameTimes(frameTimesNs, cpuTimesNs);
+    benchmark.setGpuFrameTimes(gpuTimesNs);
+    expectFixedSequenceStatistics(benchmark.getFrameTimeStatistics());
+
+    const std::string filenameJson = "FrameTimeBenchmarkTest.json";
+    ASSERT_TRUE(benchmark.writeReportJson(filenameJson));
+    sgl::JsonValue root = sgl::readSimpleJson(filenameJson, true);
+    std::remove(filenameJson.c_str());
+    EXPECT_EQ(root["name"].asString(), "FixedSequence");
+    EXPECT_EQ(root["unit"].asString(), "ms");
+    EXPECT_EQ(root["settings"]["num_frames_per_iteration"].asUint64(), 10u);
+    EXPECT_DOUBLE_EQ(root["settings"]["stutter_threshold_factor"].asDouble(), 2.0);
+    const sgl::JsonValue& frameTimeJson = root["statistics"]["frame_time"];
+    EXPECT_EQ(frameTimeJson["num_samples"].asUint64(), 10u);
+    EXPECT_NEAR(frameTimeJson["mean"].asDouble(), 14.0, 1e-9);
+    EXPECT_NEAR(frameTimeJson["p90"].asDouble(), 26.0, 1e-9);
+    EXPECT_NEAR(frameTimeJson["p99"].asDouble(), 34.1, 1e-9);
+    EXPECT_EQ(frameTimeJson["num_stutters"].asUint64(), 2u);
+    EXPECT_NEAR(root["statistics"]["cpu_time"]["mean"].asDouble(), 7.0, 1e-9);
+    EXPECT_NEAR(root["statistics"]["gpu_time"]["max"].asDouble(), 8.75, 1e-9);
+    const sgl::JsonValue& frameTimeSamplesJson = root["samples"]["frame_time"];
+    ASSERT_EQ(frameTimeSamplesJson.size(), 10u);
+    std::vector<double> frameTimesMs = createFrameTimesMs();
+    for (size_t i = 0; i < frameTimesMs.size(); i++) {
+        EXPECT_NEAR(frameTimeSamplesJson[i].asDouble(), frameTimesMs.at(i), 1e-9) << "frame " << i;
+    }
+
+    const std::string filenameCsv = "FrameTimeBenchmarkTest.csv";
+    ASSERT_TRUE(benchmark.writeReportCsv(filenameCsv));
+    std::ifstream file(filenameCsv);
+    std::vector<std::vector<std::string>> rows;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::vector<std::string> row;
+        sgl::splitString(line, ',', row);
+        rows.push_back(row);
+    }
+    file.close();
+    std::remove(filenameCsv.c_str());
+    ASSERT_EQ(rows.size(), 4u);
+    const std::vector<std::string> header = {
+            "name", "metric", "num_samples", "mean", "median", "min", "max", "variance", "stddev",
+            "p90", "p95", "p99", "num_stutters" };
+    EXPECT_EQ(rows.at(0), header);
+    const std::vector<std::string> metrics = { "frame_time", "cpu_time", "gpu_time" };
+    const double scales[] = { 1.0, 0.5, 0.25 };
+    for (size_t metricIdx = 0; metricIdx < metrics.size(); metricIdx++) {
+        const std::vector<std::string>& row = rows.at(metricIdx + 1);
+        ASSERT_EQ(row.size(), header.size());
+        EXPECT_EQ(row.at(0), "FixedSequence");
+        EXPECT_EQ(row.at(1), metrics.at(metricIdx));
+        EXPECT_EQ(row.at(2), "10");
+        EXPECT_NEAR(sgl::fromString<double>(row.at(3)), 14.0 * scales[metricIdx], 1e-4);
+        EXPECT_NEAR(sgl::fromString<double>(row.at(9)), 26.0 * scales[metricIdx], 1e-4);
+        EXPECT_EQ(row.at(12), "2");
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <vector>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Utils/Parallel/Histogram.hpp>
+#include <Utils/Parallel/HistogramSummary.hpp>
+
+static std::vector<float> generateTestValues(size_t numValues) {
+    std::mt19937 generator(17);
+    std::normal_distribution<float> distributionA(-2.0f, 0.5f);
+    std::normal_distribution<float> distributionB(3.0f, 1.5f);
+    std::uniform_real_distribution<float> distributionC(-4.0f, 8.0f);
+    std::vector<float> values(numValues);
+    for (size_t i = 0; i < numValues; i++) {
+        switch (i % 3) {
+            case 0: values[i] = distributionA(generator); break;
+            case 1: values[i] = distributionB(generator); break;
+            default: values[i] = distributionC(generator); break;
+        }
+    }
+    return values;
+}
+
+class HistogramSummaryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        values = generateTestValues(1000003);
+        auto [minIt, maxIt] = std::minmax_element(values.begin(), values.end());
+        minValue = *minIt;
+        maxValue = *maxIt;
+    }
+
+    /**
+     * Compares the derived histogram with the counts of a direct rescan of the values. The error bounds are
+     * normalized by the largest derived bin, which is recovered from the total number of values.
+     * A small tolerance accounts for values that are rounded into a neighboring bin by the float bin computation.
+     */
+    void expectWithinErrorBound(
+            const sgl::HistogramSummary& summary, int histogramResolution, float minVal, float maxVal) {
+        std::vector<float> histogram, errorBounds;
+        float maxErrorBound = summary.computeHistogram(
+                histogram, histogramResolution, minVal, maxVal, &errorBounds);
+        ASSERT_EQ(int(histogram.size()), histogramResolution);
+        ASSERT_EQ(int(errorBounds.size()), histogramResolution);
+        EXPECT_EQ(maxErrorBound, *std::max_element(errorBounds.begin(), errorBounds.end()));
+
+        std::vector<uint64_t> histogramCounts;
+        ASSERT_TRUE(sgl::computeHistogramCounts(
+                histogramCounts, histogramResolution, ScalarDataFormat::FLOAT,
+                values.data(), values.size(), 1, minVal, maxVal));
+        double histogramSum = std::accumulate(histogram.begin(), histogram.end(), 0.0);
+        ASSERT_GT(histogramSum, 0.0);
+        double histogramMax = double(values.size()) / histogramSum;
+        const double tolerance = 2.0;
+        for (int histIdx = 0; histIdx < histogramResolution; histIdx++) {
+            double derivedCount = double(histogram[histIdx]) * histogramMax;
+            double error = std::abs(derivedCount - double(histogramCounts[histIdx]));
+            EXPECT_LE(error, double(errorBounds[histIdx]) * histogramMax + tolerance)
+                    << "bin " << histIdx << " of " << histogramResolution
+                    << ", range [" << minVal << ", " << maxVal << "]";
+        }
+    }
+
+    std::vector<float> values;
+    float minValue = 0.0f, maxValue = 0.0f;
+};
+
+TEST_F(HistogramSummaryTest, FullRangeMatchesRescan) {
+    sgl::HistogramSummary summary;
+    ASSERT_TRUE(summary.build(ScalarDataFormat::FLOAT, values.data(), values.size(), minValue, maxValue));
+    EXPECT_EQ(summary.getNumValues(), uint64_t(values.size()));
+
+    // The derived bin edges coincide with the fine bin edges, so the histogram is exact.
+    std::vector<float> histogram, histogramReference, errorBounds;
+    float maxErrorBound = summary.computeHistogram(histogram, 256, minValue, maxValue, &errorBounds);
+    EXPECT_EQ(maxErrorBound, 0.0f);
+    ASSERT_TRUE(sgl::computeHistogramStrided(
+            histogramReference, 256, ScalarDataFormat::FLOAT, values.data(), values.size(), 1,
+            minValue, maxValue));
+    for (int histIdx = 0; histIdx < 256; histIdx++) {
+        EXPECT_NEAR(histogram[histIdx], histogramReference[histIdx], 1e-6f) << "bin " << histIdx;
+    }
+
+    // Other resolutions straddle fine bins, but the error stays below the bound used by the GUI.
+    for (int histogramResolution : { 100, 200, 333, 384 }) {
+        expectWithinErrorBound(summary, histogramResolution, minValue, maxValue);
+        EXPECT_LT(summary.computeHistogram(histogram, histogramResolution, minValue, maxValue),
+                  sgl::HistogramSummary::DEFAULT_MAX_ERROR_BOUND) << "resolution " << histogramResolution;
+    }
+}
+
+TEST_F(HistogramSummaryTest, RandomSubRangesMatchRescan) {
+    sgl::HistogramSummary summary;
+    ASSERT_TRUE(summary.build(ScalarDataFormat::FLOAT, values.data(), values.size(), minValue, maxValue));
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> positionDistribution(0.0f, 1.0f);
+    std::uniform_int_distribution<int> resolutionDistribution(2, 512);
+    const float range = maxValue - minValue;
+    for (int i = 0; i < 64; i++) {
+        // Some of the ranges exceed the data range, so that the clamping of the outer bins is tested.
+        float a = minValue + range * (positionDistribution(generator) * 1.2f - 0.1f);
+        float b = minValue + range * (positionDistribution(generator) * 1.2f - 0.1f);
+        if (std::abs(b - a) < range * 1e-3f) {
+            continue;
+        }
+        expectWithinErrorBound(summary, resolutionDistribution(generator), std::min(a, b), std::max(a, b));
+    }
+}
+
+TEST_F(HistogramSummaryTest, CoarseSummaryMatchesRescan) {
+    // With few fine bins, the error bounds are large and must still hold.
+    sgl::HistogramSummary summary;
+    ASSERT_TRUE(summary.build(
+            ScalarDataFormat::FLOAT, values.data(), values.size(), minValue, maxValue, 64));
+    EXPECT_EQ(summary.getNumFineBins(), 64);
+    std::vector<float> histogram;
+    EXPECT_GT(summary.computeHistogram(histogram, 100, minValue, maxValue), 0.0f);
+    for (int histogramResolution : { 7, 64, 100, 256 }) {
+        expectWithinErrorBound(summary, histogramResolution, minValue, maxValue);
+        expectWithinErrorBound(summary, histogramResolution, minValue * 0.5f, maxValue * 0.25f);
+    }
+}
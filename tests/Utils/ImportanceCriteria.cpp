@@ -0,0 +1,176 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <Math/half/half.hpp>
+#include <Utils/Parallel/Reduction.hpp>
+#include <Utils/SciVis/ImportanceCriteria.hpp>
+
+// The serial implementation packUnorm16Array used before, i.e., the reference for the vectorized version.
+static void packUnorm16ArrayReference(
+        const float* values, size_t numValues, float minValue, float maxValue, uint16_t* unormValues) {
+    for (size_t i = 0; i < numValues; i++) {
+        float x = std::round((values[i] - minValue) / (maxValue - minValue) * 65535.0f);
+        unormValues[i] = uint16_t(std::min(std::max(x, 0.0f), 65535.0f));
+    }
+}
+
+static std::vector<float> generateTestValues(size_t numValues) {
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<float> distribution(-3.0f, 5.0f);
+    std::vector<float> values(numValues);
+    for (size_t i = 0; i < numValues; i++) {
+        if (i % 7 == 0) {
+            // Halfway cases for the range [0, 1].
+            values[i] = (float(generator() % 65535u) + 0.5f) / 65535.0f;
+        } else {
+            values[i] = distribution(generator);
+        }
+    }
+    return values;
+}
+
+TEST(ImportanceCriteriaTest, PackUnorm16MatchesReference) {
+    // Odd size, so that the scalar remainder loops are also tested.
+    std::vector<float> values = generateTestValues(1000003);
+    auto [minValue, maxValue] = sgl::reduceFloatArrayMinMax(values);
+    float minValueReference = values.front(), maxValueReference = values.front();
+    for (float value : values) {
+        minValueReference = std::min(minValueReference, value);
+        maxValueReference = std::max(maxValueReference, value);
+    }
+    EXPECT_EQ(minValue, minValueReference);
+    EXPECT_EQ(maxValue, maxValueReference);
+
+    std::vector<uint16_t> unormValues;
+    sgl::packUnorm16Array(values, unormValues);
+    std::vector<uint16_t> unormValuesReference(values.size());
+    packUnorm16ArrayReference(values.data(), values.size(), minValue, maxValue, unormValuesReference.data());
+    EXPECT_EQ(unormValues, unormValuesReference);
+
+    // Known value range with values outside of the range.
+    std::vector<uint16_t> unormValuesRange(values.size());
+    sgl::packUnorm16Array(values.data(), values.size(), 0.0f, 1.0f, unormValuesRange.data());
+    packUnorm16ArrayReference(values.data(), values.size(), 0.0f, 1.0f, unormValuesReference.data());
+    EXPECT_EQ(unormValuesRange, unormValuesReference);
+
+    std::vector<float> valuesUnpacked;
+    sgl::unpackUnorm16Array(unormValues.data(), unormValues.size(), valuesUnpacked);
+    bool isUnpackedEqual = true;
+    for (size_t i = 0; i < values.size(); i++) {
+        isUnpackedEqual = isUnpackedEqual && valuesUnpacked[i] == float(unormValues[i]) / 65535.0f;
+    }
+    EXPECT_TRUE(isUnpackedEqual);
+}
+
+TEST(ImportanceCriteriaTest, PackUnorm16HalfFloat) {
+    // All finite half float values.
+    std::vector<HalfFloat> halfValues;
+    std::vector<float> values;
+    for (uint32_t bits = 0; bits < 65536u; bits++) {
+        HalfFloat halfValue;
+        halfValue.GetBits() = uint16_t(bits);
+        auto value = float(halfValue);
+        if (std::isfinite(value)) {
+            halfValues.push_back(halfValue);
+            values.push_back(value);
+        }
+    }
+    auto [minValue, maxValue] = sgl::reduceHalfFloatArrayMinMax(halfValues.data(), halfValues.size());
+    EXPECT_EQ(minValue, -65504.0f);
+    EXPECT_EQ(maxValue, 65504.0f);
+
+    std::vector<uint16_t> unormValues, unormValuesReference(values.size());
+    sgl::packUnorm16Array(halfValues.data(), halfValues.size(), unormValues);
+    packUnorm16ArrayReference(values.data(), values.size(), minValue, maxValue, unormValuesReference.data());
+    EXPECT_EQ(unormValues, unormValuesReference);
+
+    // A small range, so that the denormal halves result in different UNORM values.
+    std::vector<uint16_t> unormValuesRange(values.size());
+    sgl::packUnorm16Array(halfValues.data(), halfValues.size(), -1e-4f, 1e-4f, unormValuesRange.data());
+    packUnorm16ArrayReference(values.data(), values.size(), -1e-4f, 1e-4f, unormValuesReference.data());
+    EXPECT_EQ(unormValuesRange, unormValuesReference);
+}
+
+TEST(ImportanceCriteriaTest, PackUnorm16Benchmark) {
+    const size_t numValues = size_t(1) << 25;
+    std::vector<float> values = generateTestValues(numValues);
+    std::vector<HalfFloat> halfValues(numValues);
+    for (size_t i = 0; i < numValues; i++) {
+        halfValues[i] = HalfFloat(values[i]);
+    }
+    std::vector<uint16_t> unormValues(numValues), unormValuesReference(numValues);
+
+    auto startTime = std::chrono::steady_clock::now();
+    float minValueReference = std::numeric_limits<float>::max();
+    float maxValueReference = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < numValues; i++) {
+        minValueReference = std::min(minValueReference, values[i]);
+        maxValueReference = std::max(maxValueReference, values[i]);
+    }
+    packUnorm16ArrayReference(
+            values.data(), numValues, minValueReference, maxValueReference, unormValuesReference.data());
+    double timeReference = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    startTime = std::chrono::steady_clock::now();
+    auto [minValue, maxValue] = sgl::reduceFloatArrayMinMax(values.data(), numValues);
+    sgl::packUnorm16Array(values.data(), numValues, minValue, maxValue, unormValues.data());
+    double timeFloat = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    EXPECT_EQ(unormValues, unormValuesReference);
+
+    startTime = std::chrono::steady_clock::now();
+    float minValueHalfReference = std::numeric_limits<float>::max();
+    float maxValueHalfReference = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < numValues; i++) {
+        auto value = float(halfValues[i]);
+        minValueHalfReference = std::min(minValueHalfReference, value);
+        maxValueHalfReference = std::max(maxValueHalfReference, value);
+    }
+    for (size_t i = 0; i < numValues; i++) {
+        float x = std::round(
+                (float(halfValues[i]) - minValueHalfReference) / (maxValueHalfReference - minValueHalfReference)
+                * 65535.0f);
+        unormValuesReference[i] = uint16_t(std::min(std::max(x, 0.0f), 65535.0f));
+    }
+    double timeHalfReference = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    startTime = std::chrono::steady_clock::now();
+    auto [minValueHalf, maxValueHalf] = sgl::reduceHalfFloatArrayMinMax(halfValues.data(), numValues);
+    sgl::packUnorm16Array(halfValues.data(), numValues, minValueHalf, maxValueHalf, unormValues.data());
+    double timeHalf = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    EXPECT_EQ(unormValues, unormValuesReference);
+
+    std::cout << "Normalizing and packing " << numValues << " values: float " << timeReference * 1e3
+              << "ms (serial) vs. " << timeFloat * 1e3 << "ms, FLOAT16 " << timeHalfReference * 1e3
+              << "ms (serial) vs. " << timeHalf * 1e3 << "ms" << std::endl;
+}
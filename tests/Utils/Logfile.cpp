@@ -0,0 +1,147 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <thread>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <Utils/File/Logfile.hpp>
+
+/*
+ * Like the ring buffer tests, the multi-threaded tests are meant to be run with ThreadSanitizer (CMake option
+ * USE_THREAD_SANITIZER).
+ */
+
+static std::string readFileContent(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+}
+
+static void checkMessagesOrdered(const std::string& content, int numThreads, int numMessages) {
+    for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+        // Searching from the last position also checks that the messages of one thread are in order.
+        size_t position = 0;
+        for (int i = 0; i < numMessages; i++) {
+            std::string message = "[" + std::to_string(threadIdx) + ":" + std::to_string(i) + "]";
+            position = content.find(message, position);
+            ASSERT_NE(position, std::string::npos) << message;
+        }
+    }
+}
+
+TEST(LogfileTest, MultiThreadedWrites) {
+    const std::string filename = "LogfileTestMultiThreaded.html";
+    const int numThreads = 8;
+    const int numMessages = 5000;
+    {
+        sgl::Logfile logfile;
+        logfile.setFlushPolicy(sgl::LogFlushPolicy::INTERVAL);
+        logfile.setFlushIntervalMs(1);
+        logfile.createLogfile(filename, "LogfileTest");
+        std::vector<std::thread> threads;
+        for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+            threads.emplace_back([&logfile, threadIdx, numMessages]() {
+                for (int i = 0; i < numMessages; i++) {
+                    logfile.write("[" + std::to_string(threadIdx) + ":" + std::to_string(i) + "]<br>\n");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    std::string content = readFileContent(filename);
+    std::remove(filename.c_str());
+    checkMessagesOrdered(content, numThreads, numMessages);
+    EXPECT_NE(content.find("End of file."), std::string::npos);
+}
+
+TEST(LogfileTest, ExitedThreadsAreDrained) {
+    // The buffers of exited threads are reused by the threads started afterwards; no message may get lost.
+    const std::string filename = "LogfileTestExitedThreads.html";
+    const int numThreads = 32;
+    const int numMessages = 100;
+    {
+        sgl::Logfile logfile;
+        logfile.setFlushPolicy(sgl::LogFlushPolicy::SHUTDOWN);
+        logfile.createLogfile(filename, "LogfileTest");
+        for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+            std::thread thread([&logfile, threadIdx, numMessages]() {
+                for (int i = 0; i < numMessages; i++) {
+                    logfile.write("[" + std::to_string(threadIdx) + ":" + std::to_string(i) + "]<br>\n");
+                }
+            });
+            thread.join();
+        }
+    }
+    std::string content = readFileContent(filename);
+    std::remove(filename.c_str());
+    checkMessagesOrdered(content, numThreads, numMessages);
+}
+
+TEST(LogfileTest, ErrorsAreFlushedImmediately) {
+    const std::string filename = "LogfileTestErrors.html";
+    {
+        sgl::Logfile logfile;
+        logfile.setFlushPolicy(sgl::LogFlushPolicy::ON_ERROR);
+        logfile.createLogfile(filename, "LogfileTest");
+        std::thread thread([&logfile]() {
+            logfile.write("Message before the error.<br>\n");
+        });
+        thread.join();
+        logfile.writeError("Test error message.", false);
+        // The file is read while the log file is still open.
+        std::string content = readFileContent(filename);
+        EXPECT_NE(content.find("Message before the error."), std::string::npos);
+        EXPECT_NE(content.find("Test error message."), std::string::npos);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(LogfileTest, ConsoleOutputIsWrittenOnFlush) {
+    // The console echo is buffered with the file content, so all messages are written once the log file is flushed.
+    const std::string filename = "LogfileTestConsole.html";
+    {
+        sgl::Logfile logfile;
+        logfile.setFlushPolicy(sgl::LogFlushPolicy::SHUTDOWN);
+        logfile.setLogLevel(sgl::LogLevel::DEBUG);
+        logfile.createLogfile(filename, "LogfileTest");
+        testing::internal::CaptureStdout();
+        logfile.writeInfo("Info message 0.");
+        logfile.writeDebug("Debug message 1.");
+        logfile.writeInfo("Info message 2.");
+        logfile.flush();
+        EXPECT_EQ(testing::internal::GetCapturedStdout(), "Info message 0.\nDebug message 1.\nInfo message 2.\n");
+    }
+    std::remove(filename.c_str());
+}
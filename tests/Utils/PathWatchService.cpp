@@ -0,0 +1,197 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Utils/Events/EventManager.hpp>
+#include <Utils/File/PathWatchService.hpp>
+
+/*
+ * The callbacks of the path watch service are dispatched by EventManager::update, so the tests poll the event manager
+ * until the expected number of callbacks has arrived or a timeout is reached.
+ */
+
+class PathWatchServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!sgl::PathWatchService::get()->getIsSupported()) {
+            GTEST_SKIP() << "The path watch service is not supported on this platform.";
+        }
+        sgl::PathWatchService::get()->setDebounceTimeMs(50);
+        auto timeStamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        rootPath = std::filesystem::temp_directory_path() / (
+                std::string("sgl_path_watch_test_")
+                + ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + std::to_string(timeStamp));
+        std::filesystem::create_directories(rootPath);
+    }
+
+    void TearDown() override {
+        for (sgl::PathWatchToken token : tokens) {
+            sgl::PathWatchService::get()->removeWatch(token);
+        }
+        if (!rootPath.empty()) {
+            std::error_code errorCode;
+            std::filesystem::remove_all(rootPath, errorCode);
+        }
+    }
+
+    void addWatch(
+            const std::filesystem::path& path, bool isFolder, bool isRecursive, bool reportFileWrites = false) {
+        sgl::PathWatchToken token = sgl::PathWatchService::get()->addWatch(
+                path.string(), isFolder, isRecursive, [this](const std::vector<std::string>& changedPaths) {
+                    callbackCalls.push_back(changedPaths);
+                }, reportFileWrites);
+        ASSERT_NE(token, 0u);
+        tokens.push_back(token);
+    }
+
+    /// Processes events until 'numCalls' callbacks were received in total or the timeout was reached.
+    bool waitForCallbacks(size_t numCalls, int timeoutMs = 5000) {
+        auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (callbackCalls.size() < numCalls && std::chrono::steady_clock::now() < endTime) {
+            sgl::EventManager::get()->update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        sgl::EventManager::get()->update();
+        return callbackCalls.size() >= numCalls;
+    }
+
+    /// Processes events for the passed time (used for checking that no further callbacks arrive).
+    void processEvents(int timeMs) {
+        auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeMs);
+        while (std::chrono::steady_clock::now() < endTime) {
+            sgl::EventManager::get()->update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    static void writeFile(const std::filesystem::path& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    [[nodiscard]] bool getWasPathReported(size_t callIdx, const std::filesystem::path& path) const {
+        const std::vector<std::string>& changedPaths = callbackCalls.at(callIdx);
+        return std::find(changedPaths.begin(), changedPaths.end(), path.string()) != changedPaths.end();
+    }
+
+    std::filesystem::path rootPath;
+    std::vector<sgl::PathWatchToken> tokens;
+    std::vector<std::vector<std::string>> callbackCalls;
+};
+
+TEST_F(PathWatchServiceTest, BurstIsDebounced) {
+    sgl::PathWatchService::get()->setDebounceTimeMs(200);
+    std::filesystem::path filePath = rootPath / "file.txt";
+    writeFile(filePath, "0");
+    addWatch(filePath, false, false);
+
+    // Ten writes within a fraction of the debounce window result in one callback.
+    for (int i = 1; i <= 10; i++) {
+        writeFile(filePath, std::to_string(i));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(waitForCallbacks(1));
+    processEvents(500);
+    ASSERT_EQ(callbackCalls.size(), 1u);
+    EXPECT_TRUE(getWasPathReported(0, filePath));
+}
+
+TEST_F(PathWatchServiceTest, FolderIgnoresFileContentChanges) {
+    std::filesystem::path filePath = rootPath / "existing.txt";
+    writeFile(filePath, "0");
+    addWatch(rootPath, true, false);
+
+    // Writing to a file in the folder only changes its content, not the content of the folder.
+    writeFile(filePath, "1");
+    processEvents(300);
+    EXPECT_TRUE(callbackCalls.empty());
+
+    std::filesystem::path newFilePath = rootPath / "new.txt";
+    writeFile(newFilePath, "0");
+    ASSERT_TRUE(waitForCallbacks(1));
+    EXPECT_TRUE(getWasPathReported(0, newFilePath));
+}
+
+TEST_F(PathWatchServiceTest, FolderReportsFileWritesIfRequested) {
+    std::filesystem::path filePath = rootPath / "existing.txt";
+    writeFile(filePath, "0");
+    addWatch(rootPath, true, false, true);
+
+    // Rewriting a file in place does not change the folder, but its cached size and date would be outdated.
+    writeFile(filePath, "1");
+    ASSERT_TRUE(waitForCallbacks(1));
+    EXPECT_TRUE(getWasPathReported(0, filePath));
+}
+
+TEST_F(PathWatchServiceTest, RecursiveWatchAddsNewSubdirectories) {
+    std::filesystem::path existingDirectoryPath = rootPath / "existing";
+    std::filesystem::create_directories(existingDirectoryPath);
+    addWatch(rootPath, true, true);
+
+    std::filesystem::path existingFilePath = existingDirectoryPath / "file.txt";
+    writeFile(existingFilePath, "0");
+    ASSERT_TRUE(waitForCallbacks(1));
+    EXPECT_TRUE(getWasPathReported(0, existingFilePath));
+
+    // The watch of the new subdirectory is added when its creation is processed, i.e., before the callback.
+    std::filesystem::path newDirectoryPath = rootPath / "new";
+    std::filesystem::create_directories(newDirectoryPath);
+    ASSERT_TRUE(waitForCallbacks(2));
+    EXPECT_TRUE(getWasPathReported(1, newDirectoryPath));
+
+    std::filesystem::path newFilePath = newDirectoryPath / "file.txt";
+    writeFile(newFilePath, "0");
+    ASSERT_TRUE(waitForCallbacks(3));
+    EXPECT_TRUE(getWasPathReported(2, newFilePath));
+}
+
+TEST_F(PathWatchServiceTest, FileDeletedAndRecreated) {
+    std::filesystem::path filePath = rootPath / "file.txt";
+    writeFile(filePath, "0");
+    addWatch(filePath, false, false);
+
+    std::filesystem::remove(filePath);
+    ASSERT_TRUE(waitForCallbacks(1));
+    EXPECT_TRUE(getWasPathReported(0, filePath));
+
+    // The watch of the file itself is added again when the file is recreated.
+    writeFile(filePath, "1");
+    ASSERT_TRUE(waitForCallbacks(2));
+    EXPECT_TRUE(getWasPathReported(1, filePath));
+
+    writeFile(filePath, "2");
+    ASSERT_TRUE(waitForCallbacks(3));
+    EXPECT_TRUE(getWasPathReported(2, filePath));
+}
@@ -0,0 +1,237 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Utils/Profiler/Profiler.hpp>
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        profiler = sgl::Profiler::get();
+        profiler->setEnabled(true);
+        profiler->collect();
+        profiler->clear();
+    }
+
+    void TearDown() override {
+        profiler->setEnabled(false);
+        profiler->setThreadBufferCapacity(1u << 16u);
+        profiler->collect();
+        profiler->clear();
+    }
+
+    /// Returns the collected events of all threads with the passed zone ID.
+    std::vector<sgl::ProfilerEvent> getZoneEvents(sgl::ProfilerZoneId zoneId) {
+        std::vector<sgl::ProfilerEvent> events;
+        for (const auto& threadEvents : profiler->getCollectedEvents()) {
+            for (const sgl::ProfilerEvent& event : threadEvents.events) {
+                if (event.zoneId == zoneId) {
+                    events.push_back(event);
+                }
+            }
+        }
+        return events;
+    }
+
+    sgl::Profiler* profiler = nullptr;
+};
+
+TEST_F(ProfilerTest, NestedZones) {
+    sgl::ProfilerZoneId outerZoneId = profiler->registerZone("Outer");
+    sgl::ProfilerZoneId innerZoneId = profiler->registerZone("Inner");
+    sgl::ProfilerZoneId innermostZoneId = profiler->registerZone("Innermost");
+    {
+        sgl::ProfilerScope outerScope(outerZoneId);
+        for (int i = 0; i < 2; i++) {
+            sgl::ProfilerScope innerScope(innerZoneId);
+            sgl::ProfilerScope innermostScope(innermostZoneId);
+        }
+    }
+    EXPECT_EQ(sgl::Profiler::threadDepth(), 0u);
+    profiler->collect();
+
+    std::vector<sgl::ProfilerEvent> outerEvents = getZoneEvents(outerZoneId);
+    std::vector<sgl::ProfilerEvent> innerEvents = getZoneEvents(innerZoneId);
+    std::vector<sgl::ProfilerEvent> innermostEvents = getZoneEvents(innermostZoneId);
+    ASSERT_EQ(outerEvents.size(), 1u);
+    ASSERT_EQ(innerEvents.size(), 2u);
+    ASSERT_EQ(innermostEvents.size(), 2u);
+    EXPECT_EQ(outerEvents.front().depth, 0u);
+    for (int i = 0; i < 2; i++) {
+        const sgl::ProfilerEvent& innerEvent = innerEvents.at(i);
+        const sgl::ProfilerEvent& innermostEvent = innermostEvents.at(i);
+        EXPECT_EQ(innerEvent.depth, 1u);
+        EXPECT_EQ(innermostEvent.depth, 2u);
+        // Each zone lies within its parent zone.
+        EXPECT_LE(outerEvents.front().beginNs, innerEvent.beginNs);
+        EXPECT_LE(innerEvent.endNs, outerEvents.front().endNs);
+        EXPECT_LE(innerEvent.beginNs, innermostEvent.beginNs);
+        EXPECT_LE(innermostEvent.endNs, innerEvent.endNs);
+    }
+    EXPECT_LE(innerEvents.at(0).endNs, innerEvents.at(1).beginNs);
+}
+
+TEST_F(ProfilerTest, ThreadsRecordIntoOwnBuffers) {
+    sgl::ProfilerZoneId zoneId = profiler->registerZone("ThreadZone");
+    const int numThreads = 4;
+    const int numEvents = 1000;
+    std::vector<std::thread> threads;
+    for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+        threads.emplace_back([this, zoneId, threadIdx]() {
+            profiler->setThreadName("Worker " + std::to_string(threadIdx));
+            for (int i = 0; i < numEvents; i++) {
+                sgl::ProfilerScope scope(zoneId);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    profiler->collect();
+
+    std::vector<std::string> threadNames;
+    for (const auto& threadEvents : profiler->getCollectedEvents()) {
+        auto numZoneEvents = std::count_if(
+                threadEvents.events.begin(), threadEvents.events.end(), [zoneId](const sgl::ProfilerEvent& event) {
+                    return event.zoneId == zoneId;
+                });
+        if (numZoneEvents == 0) {
+            continue;
+        }
+        EXPECT_EQ(numZoneEvents, numEvents) << threadEvents.threadName;
+        threadNames.push_back(threadEvents.threadName);
+    }
+    std::sort(threadNames.begin(), threadNames.end());
+    ASSERT_EQ(int(threadNames.size()), numThreads);
+    for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+        EXPECT_EQ(threadNames.at(threadIdx), "Worker " + std::to_string(threadIdx));
+    }
+}
+
+TEST_F(ProfilerTest, DroppedEventsAreCounted) {
+    sgl::ProfilerZoneId zoneId = profiler->registerZone("DroppedZone");
+    const size_t capacity = 16;
+    const size_t numEvents = 100;
+    uint64_t numDroppedBefore = profiler->getNumDroppedEvents();
+    profiler->setThreadBufferCapacity(capacity);
+    std::thread thread([this, zoneId]() {
+        for (size_t i = 0; i < numEvents; i++) {
+            profiler->recordEvent(zoneId, i, i + 1, 0);
+        }
+    });
+    thread.join();
+    EXPECT_EQ(profiler->getNumDroppedEvents() - numDroppedBefore, numEvents - capacity);
+
+    // The oldest events are kept. The count of dropped events is retained when the buffer is released.
+    profiler->collect();
+    std::vector<sgl::ProfilerEvent> events = getZoneEvents(zoneId);
+    ASSERT_EQ(events.size(), capacity);
+    for (size_t i = 0; i < capacity; i++) {
+        EXPECT_EQ(events.at(i).beginNs, i);
+    }
+    EXPECT_EQ(profiler->getNumDroppedEvents() - numDroppedBefore, numEvents - capacity);
+}
+
+TEST_F(ProfilerTest, BuffersOfExitedThreadsAreReleased) {
+    sgl::ProfilerZoneId zoneId = profiler->registerZone("ChurnZone");
+    size_t numThreadBuffersBefore = profiler->getNumThreadBuffers();
+    const int numThreads = 64;
+    const int numEvents = 10;
+    for (int round = 0; round < 2; round++) {
+        for (int threadIdx = 0; threadIdx < numThreads; threadIdx++) {
+            std::thread thread([this, zoneId]() {
+                for (int i = 0; i < numEvents; i++) {
+                    sgl::ProfilerScope scope(zoneId);
+                }
+            });
+            thread.join();
+        }
+        EXPECT_EQ(profiler->getNumThreadBuffers(), numThreadBuffersBefore + numThreads);
+        // The events of the exited threads are drained before their buffers are released.
+        profiler->collect();
+        EXPECT_EQ(profiler->getNumThreadBuffers(), numThreadBuffersBefore);
+        EXPECT_EQ(getZoneEvents(zoneId).size(), size_t((round + 1) * numThreads * numEvents));
+    }
+    profiler->clear();
+    EXPECT_TRUE(profiler->getCollectedEvents().empty());
+}
+
+TEST_F(ProfilerTest, ZoneStatistics) {
+    sgl::ProfilerZoneId zoneId = profiler->registerZone("StatisticsZone");
+    // Durations of 1ms, 2ms, ..., 100ms.
+    for (uint64_t i = 1; i <= 100; i++) {
+        profiler->recordEvent(zoneId, 0, i * 1000000, 0);
+    }
+    profiler->collect();
+    sgl::ProfilerZoneStatistics stats = profiler->computeZoneStatistics(zoneId);
+    EXPECT_EQ(stats.name, "StatisticsZone");
+    EXPECT_EQ(stats.numSamples, 100u);
+    EXPECT_DOUBLE_EQ(stats.totalMs, 5050.0);
+    EXPECT_DOUBLE_EQ(stats.minMs, 1.0);
+    EXPECT_DOUBLE_EQ(stats.maxMs, 100.0);
+    EXPECT_DOUBLE_EQ(stats.meanMs, 50.5);
+    EXPECT_DOUBLE_EQ(stats.medianMs, 50.0);
+    EXPECT_DOUBLE_EQ(stats.p95Ms, 95.0);
+    EXPECT_DOUBLE_EQ(stats.p99Ms, 99.0);
+    uint32_t histogramSum = 0;
+    for (uint32_t count : stats.histogram) {
+        histogramSum += count;
+    }
+    EXPECT_EQ(histogramSum, 100u);
+    // 1ms = 1000us lies in [512us, 1024us), i.e., bucket 10; 100ms lies in [65536us, 131072us), i.e., bucket 17.
+    ASSERT_EQ(stats.histogram.size(), 18u);
+    EXPECT_EQ(stats.histogram.at(10), 1u);
+    EXPECT_EQ(stats.histogram.at(17), 35u);
+
+    EXPECT_EQ(profiler->computeZoneStatistics(profiler->registerZone("EmptyZone")).numSamples, 0u);
+}
+
+TEST(ProfilerPercentileTest, NearestRank) {
+    std::vector<uint64_t> values = { 15, 20, 35, 40, 50 };
+    EXPECT_EQ(sgl::computePercentileSorted(values, 0.0), 15u);
+    EXPECT_EQ(sgl::computePercentileSorted(values, 0.05), 15u);
+    EXPECT_EQ(sgl::computePercentileSorted(values, 0.3), 20u);
+    EXPECT_EQ(sgl::computePercentileSorted(values, 0.4), 20u);
+    EXPECT_EQ(sgl::computePercentileSorted(values, 0.5), 35u);
+    EXPECT_EQ(sgl::computePercentileSorted(values, 1.0), 50u);
+
+    std::vector<uint64_t> range(100);
+    for (uint64_t i = 0; i < 100; i++) {
+        range.at(i) = i + 1;
+    }
+    EXPECT_EQ(sgl::computePercentileSorted(range, 0.5), 50u);
+    EXPECT_EQ(sgl::computePercentileSorted(range, 0.95), 95u);
+    EXPECT_EQ(sgl::computePercentileSorted(range, 0.99), 99u);
+
+    EXPECT_EQ(sgl::computePercentileSorted({ 7 }, 0.99), 7u);
+    EXPECT_EQ(sgl::computePercentileSorted({}, 0.5), 0u);
+}
@@ -0,0 +1,114 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <Utils/Random/Philox.hpp>
+
+// Known-answer tests from the Random123 distribution (kat_vectors).
+TEST(PhiloxTest, KnownAnswers) {
+    uint32_t values[4];
+    sgl::PhiloxRandomGenerator::computeBlock(0, 0, 0, values);
+    EXPECT_EQ(values[0], 0x6627e8d5u);
+    EXPECT_EQ(values[1], 0xe169c58du);
+    EXPECT_EQ(values[2], 0xbc57ac4cu);
+    EXPECT_EQ(values[3], 0x9b00dbd8u);
+    sgl::PhiloxRandomGenerator::computeBlock(~uint64_t(0), ~uint64_t(0), ~uint64_t(0), values);
+    EXPECT_EQ(values[0], 0x408f276du);
+    EXPECT_EQ(values[1], 0x41c83b0eu);
+    EXPECT_EQ(values[2], 0xa20bc7c6u);
+    EXPECT_EQ(values[3], 0x6d5451fdu);
+}
+
+TEST(PhiloxTest, BulkFillMatchesSequential) {
+    const size_t numValues = 100003;
+    sgl::PhiloxRandomGenerator generatorSequential(42, 7);
+    std::vector<uint32_t> valuesSequential(numValues);
+    for (size_t i = 0; i < numValues; i++) {
+        valuesSequential[i] = generatorSequential.getRandomUint32();
+    }
+
+    // Fill with unaligned pieces of different sizes; the result must not depend on the split.
+    sgl::PhiloxRandomGenerator generatorBulk(42, 7);
+    std::vector<uint32_t> valuesBulk(numValues);
+    size_t offset = 0;
+    for (size_t pieceSize : { size_t(3), size_t(1), size_t(29), size_t(40000), size_t(17) }) {
+        generatorBulk.fillUint32(valuesBulk.data() + offset, pieceSize);
+        offset += pieceSize;
+    }
+    generatorBulk.fillUint32(valuesBulk.data() + offset, numValues - offset);
+    EXPECT_EQ(valuesSequential, valuesBulk);
+    EXPECT_EQ(generatorBulk.getPosition(), numValues);
+}
+
+TEST(PhiloxTest, JumpAheadAndStreams) {
+    sgl::PhiloxRandomGenerator generator(1234);
+    std::vector<uint32_t> values(1000);
+    generator.fillUint32(values);
+
+    sgl::PhiloxRandomGenerator generatorSkipped(1234);
+    generatorSkipped.skip(777);
+    EXPECT_EQ(generatorSkipped.getRandomUint32(), values[777]);
+
+    sgl::PhiloxRandomGenerator otherStream = generator.getStream(1);
+    std::vector<uint32_t> valuesOtherStream(1000);
+    otherStream.fillUint32(valuesOtherStream);
+    size_t numEqual = 0;
+    for (size_t i = 0; i < values.size(); i++) {
+        numEqual += values[i] == valuesOtherStream[i] ? 1 : 0;
+    }
+    EXPECT_LT(numEqual, size_t(3));
+}
+
+TEST(PhiloxTest, Distributions) {
+    const size_t numValues = 1000001;
+    sgl::PhiloxRandomGenerator generator(5);
+    std::vector<float> values(numValues);
+
+    generator.fillUniformFloat(values, -2.0f, 6.0f);
+    double sum = 0.0;
+    for (float value : values) {
+        ASSERT_GE(value, -2.0f);
+        ASSERT_LT(value, 6.0f);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / double(numValues), 2.0, 0.01);
+
+    generator.fillNormalFloat(values, 1.0f, 3.0f);
+    double mean = 0.0, squaredSum = 0.0;
+    for (float value : values) {
+        ASSERT_TRUE(std::isfinite(value));
+        mean += value;
+    }
+    mean /= double(numValues);
+    for (float value : values) {
+        squaredSum += (value - mean) * (value - mean);
+    }
+    EXPECT_NEAR(mean, 1.0, 0.01);
+    EXPECT_NEAR(std::sqrt(squaredSum / double(numValues)), 3.0, 0.01);
+}
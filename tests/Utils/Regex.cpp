@@ -0,0 +1,262 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <regex>
+#include <random>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include <Utils/Convert.hpp>
+#include <Utils/StringUtils.hpp>
+#include <Math/Math.hpp>
+#include <Math/Geometry/MatrixUtil.hpp>
+#include <Utils/Regex/Tokens.hpp>
+#include <Utils/Regex/TransformString.hpp>
+
+namespace {
+
+std::vector<std::string> getTokenListReference(const std::string& str, const std::string& exprStr) {
+    std::vector<std::string> tokenList;
+    std::regex expr(exprStr.c_str());
+    std::regex_token_iterator<std::string::const_iterator> it{str.begin(), str.end(), expr};
+    std::regex_token_iterator<std::string::const_iterator> end;
+    while (it != end) {
+        tokenList.push_back(*it++);
+    }
+    return tokenList;
+}
+
+glm::mat4 makeMatrix(const float* m, size_t numValues, bool columnMajor) {
+    glm::mat4 matrix = sgl::matrixIdentity();
+    if (numValues == 9) {
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                matrix[i][j] = columnMajor ? m[i * 3 + j] : m[j * 3 + i];
+            }
+        }
+    } else if (numValues == 12) {
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 3; j++) {
+                matrix[i][j] = columnMajor ? m[i * 3 + j] : m[j * 4 + i];
+            }
+        }
+    } else if (numValues == 16) {
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                matrix[i][j] = columnMajor ? m[i * 4 + j] : m[j * 4 + i];
+            }
+        }
+    }
+    return matrix;
+}
+
+// The std::regex based implementation the parser has to reproduce.
+glm::mat4 parseTransformStringReference(std::string transformString) {
+    glm::mat4 matrix = sgl::matrixIdentity();
+    std::regex transformRegex("\\s*(\\S+)\\s*\\(\\s*(.+)\\s*\\)(.*)");
+    std::smatch what;
+    while (std::regex_search(transformString, what, transformRegex)) {
+        std::string transformType = what[1];
+        std::string transformContent = what[2];
+        transformString = what[3];
+        std::vector<std::string> transformData = getTokenListReference(transformContent, NUMBER_AND_DEGREES_REGEX_STRING);
+        if (transformType == "translate") {
+            float x = sgl::fromString<float>(transformData.at(0));
+            float y = sgl::fromString<float>(transformData.at(1));
+            float z = sgl::fromString<float>(transformData.at(1));
+            matrix = matrix * sgl::matrixTranslation(glm::vec3(x, y, z));
+        } else if (transformType == "scale") {
+            float scaleX = sgl::fromString<float>(transformData.at(0));
+            if (transformData.size() == 1) {
+                matrix = matrix * sgl::matrixScaling(glm::vec3(scaleX, scaleX, scaleX));
+            } else {
+                float scaleY = sgl::fromString<float>(transformData.at(1));
+                float scaleZ = sgl::fromString<float>(transformData.at(2));
+                matrix = matrix * sgl::matrixScaling(glm::vec3(scaleX, scaleY, scaleZ));
+            }
+        } else if (transformType == "rotate") {
+            float rotationAngleRadians = 0.0f;
+            if (sgl::endsWith(transformData.at(0), "°")) {
+                std::string numberString =
+                        transformData.at(0).substr(0, transformData.at(0).find_last_of("°") - 1);
+                rotationAngleRadians = sgl::fromString<float>(numberString) / 180.0f * sgl::PI;
+            } else {
+                rotationAngleRadians = sgl::fromString<float>(transformData.at(0));
+            }
+            float axisX = sgl::fromString<float>(transformData.at(1));
+            float axisY = sgl::fromString<float>(transformData.at(2));
+            float axisZ = sgl::fromString<float>(transformData.at(3));
+            matrix = matrix * glm::rotate(rotationAngleRadians, glm::vec3(axisX, axisY, axisZ));
+        } else if (transformType == "matrix" || transformType == "matrixc") {
+            // The previous implementation wrote out of bounds for more than 16 values.
+            float m[16];
+            for (size_t i = 0; i < std::min(transformData.size(), size_t(16)); i++) {
+                m[i] = sgl::fromString<float>(transformData.at(i));
+            }
+            if (transformData.size() == 9 || transformData.size() == 12 || transformData.size() == 16) {
+                matrix = matrix * makeMatrix(m, transformData.size(), transformType == "matrixc");
+            }
+        }
+    }
+    return matrix;
+}
+
+std::string generateRandomString(std::mt19937& generator, int numParts) {
+    static const std::vector<std::string> parts = {
+            "translate", "scale", "rotate", "matrix", "matrixc", "(", "(", ")", ")", " ", "  ", ",", ", ",
+            "\n", "\r", "\t", "0", "1", "25", "007", ".", ".5", "-", "+", "°", "e", "E-2", "x", "3.25", "-.75",
+            "1e3", "99999999999999999999999999999999999999999999", "90°", "1 2 3", "1, 2, 3, 4", "(1 2 3)"
+    };
+    std::uniform_int_distribution<size_t> partDistribution(0, parts.size() - 1);
+    std::string str;
+    for (int i = 0; i < numParts; i++) {
+        str += parts[partDistribution(generator)];
+    }
+    return str;
+}
+
+bool getAreMatricesEqual(const glm::mat4& m0, const glm::mat4& m1) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            if (m0[i][j] != m1[i][j] && !(std::isnan(m0[i][j]) && std::isnan(m1[i][j]))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Generates a synthetic transform file with one transform per line, e.g., "translate(15, -2, 3)".
+ * The lines only contain translate, scale and matrix transforms. Integer values are used, as the number tokenizer
+ * splits values like "2.5" into two tokens (see above).
+ */
+std::vector<std::string> generateTransformLines(std::mt19937& generator, size_t numLines) {
+    std::uniform_int_distribution<int> typeDistribution(0, 2);
+    std::uniform_int_distribution<int> valueDistribution(-1000, 1000);
+    std::vector<std::string> lines;
+    lines.reserve(numLines);
+    for (size_t i = 0; i < numLines; i++) {
+        int type = typeDistribution(generator);
+        int numValues = type == 0 ? 3 : (type == 1 ? 1 : 16);
+        std::string line = type == 0 ? "translate(" : (type == 1 ? "scale(" : "matrix(");
+        for (int valueIdx = 0; valueIdx < numValues; valueIdx++) {
+            if (valueIdx > 0) {
+                line += ", ";
+            }
+            line += sgl::toString(valueDistribution(generator));
+        }
+        line += ")";
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+}
+
+TEST(RegexTest, NumberTokensMatchStdRegex) {
+    std::mt19937 generator(7);
+    for (int i = 0; i < 2000; i++) {
+        std::string str = generateRandomString(generator, 1 + i % 24);
+        EXPECT_EQ(getTokenList(str, NUMBER_REGEX_STRING), getTokenListReference(str, NUMBER_REGEX_STRING)) << str;
+        EXPECT_EQ(
+                getTokenList(str, NUMBER_AND_DEGREES_REGEX_STRING),
+                getTokenListReference(str, NUMBER_AND_DEGREES_REGEX_STRING)) << str;
+    }
+}
+
+TEST(RegexTest, TransformStringMatchesStdRegex) {
+    std::vector<std::string> transformStrings = {
+            "translate(1, 2, 3)", "scale(2)", "scale(1 2 3)", "rotate(90° 0 1 0)", "rotate(1.5, 1, 0, 0)",
+            "matrix(1 2 3 4 5 6 7 8 9)", "matrixc(1 2 3 4 5 6 7 8 9 10 11 12)", "translate(1,2,3) scale(2)",
+            "  scale ( 2 )  ", "scale( )", "scale(2\n)", "scale(\n2)", "a\nscale(2)", "translate(1,2,3)scale(2)"
+    };
+    std::mt19937 generator(11);
+    for (int i = 0; i < 5000; i++) {
+        transformStrings.push_back(generateRandomString(generator, 1 + i % 16));
+    }
+    for (const std::string& transformString : transformStrings) {
+        glm::mat4 matrix, matrixReference;
+        bool threw = false, threwReference = false;
+        try {
+            matrix = parseTransformString(transformString);
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        try {
+            matrixReference = parseTransformStringReference(transformString);
+        } catch (const std::exception&) {
+            threwReference = true;
+        }
+        ASSERT_EQ(threw, threwReference) << transformString;
+        if (!threw) {
+            EXPECT_TRUE(getAreMatricesEqual(matrix, matrixReference)) << transformString;
+        }
+    }
+}
+
+/*
+ * Parses a synthetic transform file. The default number of transforms is reduced to keep the test suite fast; the
+ * environment variable SGL_REGEX_BENCHMARK_NUM_TRANSFORMS can be set to 1000000 to reproduce the reported numbers.
+ * The std::regex reference is only run on a subset of the lines and its time is extrapolated.
+ */
+TEST(RegexTest, TransformStringBenchmark) {
+    size_t numTransforms = 10000;
+    if (const char* numTransformsString = std::getenv("SGL_REGEX_BENCHMARK_NUM_TRANSFORMS")) {
+        numTransforms = std::max(size_t(std::strtoull(numTransformsString, nullptr, 10)), size_t(1));
+    }
+    const size_t numTransformsReference = std::min(numTransforms, size_t(1000));
+    std::mt19937 generator(23);
+    std::vector<std::string> lines = generateTransformLines(generator, numTransforms);
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<glm::mat4> matrices(numTransforms);
+    for (size_t i = 0; i < numTransforms; i++) {
+        matrices[i] = parseTransformString(lines[i]);
+    }
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    startTime = std::chrono::steady_clock::now();
+    std::vector<glm::mat4> matricesReference(numTransformsReference);
+    for (size_t i = 0; i < numTransformsReference; i++) {
+        matricesReference[i] = parseTransformStringReference(lines[i]);
+    }
+    double timeReference = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    for (size_t i = 0; i < numTransformsReference; i++) {
+        EXPECT_TRUE(getAreMatricesEqual(matrices[i], matricesReference[i])) << lines[i];
+    }
+
+    double timeReferenceExtrapolated = timeReference * double(numTransforms) / double(numTransformsReference);
+    std::cout << "Parsing " << numTransforms << " transforms: std::regex " << timeReferenceExtrapolated * 1e3
+              << "ms (extrapolated from " << numTransformsReference << " transforms) vs. " << time * 1e3 << "ms"
+              << std::endl;
+}
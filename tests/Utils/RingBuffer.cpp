@@ -0,0 +1,233 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <thread>
+#include <memory>
+#include <gtest/gtest.h>
+#include <Utils/RingBuffer.hpp>
+
+/*
+ * The stress tests are meant to be run with ThreadSanitizer (CMake option USE_THREAD_SANITIZER), which reports data
+ * races on the slots if the synchronization of the indices is wrong.
+ */
+
+TEST(RingBufferTest, SpscSingleThreaded) {
+    sgl::SpscRingBuffer<int> ringBuffer(5);
+    EXPECT_EQ(ringBuffer.capacity(), 8u);
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(ringBuffer.tryPush(i));
+    }
+    EXPECT_FALSE(ringBuffer.tryPush(8));
+    EXPECT_EQ(ringBuffer.sizeApprox(), 8u);
+
+    int value = -1;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(ringBuffer.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+
+    // The batch wraps around the end of the array and is truncated to the free space.
+    int values[6] = { 8, 9, 10, 11, 12, 13 };
+    EXPECT_EQ(ringBuffer.tryPushBatch(values, 6), 5u);
+    int valuesOut[16];
+    EXPECT_EQ(ringBuffer.tryPopBatch(valuesOut, 16), 8u);
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(valuesOut[i], i + 5);
+    }
+    EXPECT_FALSE(ringBuffer.tryPop(value));
+    EXPECT_TRUE(ringBuffer.emptyApprox());
+}
+
+TEST(RingBufferTest, MpmcSingleThreaded) {
+    sgl::MpmcRingBuffer<int> ringBuffer(8);
+    int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    EXPECT_EQ(ringBuffer.tryPushBatch(values, 3), 3u);
+    EXPECT_EQ(ringBuffer.tryPushBatch(values + 3, 7), 5u);
+    EXPECT_FALSE(ringBuffer.tryPush(10));
+
+    int value = -1;
+    EXPECT_TRUE(ringBuffer.tryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ringBuffer.tryPush(8));
+    int valuesOut[16];
+    EXPECT_EQ(ringBuffer.tryPopBatch(valuesOut, 16), 8u);
+    for (int i = 0; i < 8; i++) {
+        EXPECT_EQ(valuesOut[i], i + 1);
+    }
+    EXPECT_EQ(ringBuffer.tryPopBatch(valuesOut, 16), 0u);
+}
+
+TEST(RingBufferTest, MoveOnlyElements) {
+    sgl::SpscRingBuffer<std::unique_ptr<int>> spscRingBuffer(4);
+    sgl::MpmcRingBuffer<std::unique_ptr<int>> mpmcRingBuffer(4);
+    EXPECT_TRUE(spscRingBuffer.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(mpmcRingBuffer.tryPush(std::make_unique<int>(2)));
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(spscRingBuffer.tryPop(value));
+    EXPECT_EQ(*value, 1);
+    EXPECT_TRUE(mpmcRingBuffer.tryPop(value));
+    EXPECT_EQ(*value, 2);
+}
+
+TEST(RingBufferTest, CloseAndTimeout) {
+    sgl::SpscRingBuffer<int> ringBuffer(4);
+    int value = -1;
+    EXPECT_FALSE(ringBuffer.tryPopFor(value, std::chrono::milliseconds(5)));
+
+    std::thread consumer([&ringBuffer]() {
+        int sum = 0, valueLocal = 0;
+        while (ringBuffer.pop(valueLocal)) {
+            sum += valueLocal;
+        }
+        EXPECT_EQ(sum, 6);
+    });
+    ringBuffer.push(1);
+    ringBuffer.push(2);
+    ringBuffer.push(3);
+    ringBuffer.close();
+    consumer.join();
+    EXPECT_FALSE(ringBuffer.push(4));
+}
+
+TEST(RingBufferTest, SpscStress) {
+    const uint32_t numValues = 200000;
+    sgl::SpscRingBuffer<uint32_t> ringBuffer(64);
+
+    std::thread producer([&ringBuffer]() {
+        uint32_t values[7];
+        uint32_t nextValue = 0;
+        while (nextValue < numValues) {
+            if (nextValue % 3 == 0) {
+                ringBuffer.push(nextValue++);
+            } else {
+                uint32_t count = std::min(uint32_t(7), numValues - nextValue);
+                for (uint32_t i = 0; i < count; i++) {
+                    values[i] = nextValue + i;
+                }
+                ringBuffer.pushBatch(values, count);
+                nextValue += count;
+            }
+        }
+        ringBuffer.close();
+    });
+
+    uint32_t values[16];
+    uint32_t expectedValue = 0;
+    bool isOrdered = true;
+    size_t numPopped;
+    while ((numPopped = ringBuffer.popBatch(values, 16)) != 0) {
+        for (size_t i = 0; i < numPopped; i++) {
+            isOrdered = isOrdered && values[i] == expectedValue;
+            expectedValue++;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(isOrdered);
+    EXPECT_EQ(expectedValue, numValues);
+}
+
+TEST(RingBufferTest, MpmcStress) {
+    const uint32_t numProducers = 4;
+    const uint32_t numConsumers = 4;
+    const uint32_t numValuesPerProducer = 50000;
+    sgl::MpmcRingBuffer<uint32_t> ringBuffer(128);
+
+    // Values are encoded as (producer index << 24) | sequence number.
+    std::vector<std::thread> producers;
+    for (uint32_t producerIdx = 0; producerIdx < numProducers; producerIdx++) {
+        producers.emplace_back([&ringBuffer, producerIdx]() {
+            uint32_t values[5];
+            uint32_t seq = 0;
+            while (seq < numValuesPerProducer) {
+                if (seq % 2 == 0) {
+                    ringBuffer.push((producerIdx << 24u) | seq++);
+                } else {
+                    uint32_t count = std::min(uint32_t(5), numValuesPerProducer - seq);
+                    for (uint32_t i = 0; i < count; i++) {
+                        values[i] = (producerIdx << 24u) | (seq + i);
+                    }
+                    ringBuffer.pushBatch(values, count);
+                    seq += count;
+                }
+            }
+        });
+    }
+
+    std::vector<std::vector<uint32_t>> poppedValues(numConsumers);
+    std::vector<std::thread> consumers;
+    for (uint32_t consumerIdx = 0; consumerIdx < numConsumers; consumerIdx++) {
+        consumers.emplace_back([&ringBuffer, &poppedValues, consumerIdx]() {
+            std::vector<uint32_t>& poppedValuesLocal = poppedValues.at(consumerIdx);
+            uint32_t values[8];
+            for (;;) {
+                if (consumerIdx % 2 == 0) {
+                    uint32_t value;
+                    if (!ringBuffer.pop(value)) {
+                        break;
+                    }
+                    poppedValuesLocal.push_back(value);
+                } else {
+                    size_t numPopped = ringBuffer.popBatch(values, 8);
+                    if (numPopped == 0) {
+                        break;
+                    }
+                    poppedValuesLocal.insert(poppedValuesLocal.end(), values, values + numPopped);
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ringBuffer.close();
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    // Every value needs to be popped exactly once, and each consumer sees the values of a producer in order.
+    std::vector<uint32_t> numPoppedPerValue(numProducers * numValuesPerProducer, 0);
+    bool isOrdered = true;
+    for (const auto& poppedValuesLocal : poppedValues) {
+        std::vector<int64_t> lastSeq(numProducers, -1);
+        for (uint32_t value : poppedValuesLocal) {
+            uint32_t producerIdx = value >> 24u;
+            uint32_t seq = value & 0xFFFFFFu;
+            ASSERT_LT(producerIdx, numProducers);
+            ASSERT_LT(seq, numValuesPerProducer);
+            isOrdered = isOrdered && int64_t(seq) > lastSeq.at(producerIdx);
+            lastSeq.at(producerIdx) = int64_t(seq);
+            numPoppedPerValue.at(producerIdx * numValuesPerProducer + seq)++;
+        }
+    }
+    EXPECT_TRUE(isOrdered);
+    for (uint32_t numPopped : numPoppedPerValue) {
+        ASSERT_EQ(numPopped, 1u);
+    }
+}
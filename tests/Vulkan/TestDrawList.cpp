@@ -0,0 +1,300 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include <Utils/AppSettings.hpp>
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Vulkan/Utils/Instance.hpp>
+#include <Graphics/Vulkan/Utils/Device.hpp>
+#include <Graphics/Vulkan/Buffers/Buffer.hpp>
+#include <Graphics/Vulkan/Buffers/Framebuffer.hpp>
+#include <Graphics/Vulkan/Image/Image.hpp>
+#include <Graphics/Vulkan/Shader/ShaderManager.hpp>
+#include <Graphics/Vulkan/Render/GraphicsPipeline.hpp>
+#include <Graphics/Vulkan/Render/Data.hpp>
+#include <Graphics/Vulkan/Render/DrawList.hpp>
+#include <Graphics/Vulkan/Render/Renderer.hpp>
+
+static const char* SHADER_STRING_FULL_SCREEN_VERTEX = R"(
+#version 450 core
+void main() {
+    vec2 position = vec2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+static const char* SHADER_STRING_UNIFORM_COLOR_FRAGMENT = R"(
+#version 450 core
+layout(binding = 0) uniform ColorBlock {
+    vec4 color;
+};
+layout(location = 0) out vec4 fragColor;
+void main() {
+    fragColor = color;
+}
+)";
+
+class DrawListTestVk : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sgl::Logfile::get()->createLogfile("LogfileDrawListVulkan.html", "TestDrawListVulkan");
+        // No camera matrices are used by the test shaders.
+        sgl::AppSettings::get()->setUseMatrixBlock(false);
+
+        instance = new sgl::vk::Instance;
+        instance->createInstance({}, false);
+        device = new sgl::vk::Device;
+        std::vector<const char*> requiredDeviceExtensions;
+        std::vector<const char*> optionalDeviceExtensions;
+        sgl::vk::DeviceFeatures requestedDeviceFeatures{};
+        device->createDeviceHeadless(
+                instance, requiredDeviceExtensions, optionalDeviceExtensions, requestedDeviceFeatures);
+        std::cout << "Running on " << device->getDeviceName() << std::endl;
+
+        shaderManager = new sgl::vk::ShaderManagerVk(device);
+        renderer = new sgl::vk::Renderer(device);
+        shaderStages = shaderManager->compileShaderStagesFromStringsCached(
+                { "DrawListTest.Vertex", "DrawListTest.Fragment" },
+                { SHADER_STRING_FULL_SCREEN_VERTEX, SHADER_STRING_UNIFORM_COLOR_FRAGMENT });
+        ASSERT_TRUE(shaderStages);
+    }
+
+    void TearDown() override {
+        if (device) {
+            device->waitIdle();
+        }
+        shaderStages = {};
+        delete renderer;
+        delete shaderManager;
+        delete device;
+        delete instance;
+    }
+
+    sgl::vk::ImageViewPtr createRenderTarget() {
+        sgl::vk::ImageSettings imageSettings{};
+        imageSettings.width = imageWidth;
+        imageSettings.height = imageHeight;
+        imageSettings.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageSettings.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        return std::make_shared<sgl::vk::ImageView>(std::make_shared<sgl::vk::Image>(device, imageSettings));
+    }
+
+    sgl::vk::FramebufferPtr createFramebuffer(sgl::vk::ImageViewPtr& renderTarget) {
+        // All draws cover the whole framebuffer, so the old content never needs to be loaded.
+        sgl::vk::AttachmentState attachmentState;
+        attachmentState.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachmentState.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachmentState.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        auto framebuffer = std::make_shared<sgl::vk::Framebuffer>(device, imageWidth, imageHeight);
+        framebuffer->setColorAttachment(renderTarget, 0, attachmentState);
+        return framebuffer;
+    }
+
+    sgl::vk::GraphicsPipelinePtr createGraphicsPipeline(const sgl::vk::FramebufferPtr& framebuffer) {
+        sgl::vk::GraphicsPipelineInfo pipelineInfo(shaderStages);
+        pipelineInfo.setFramebuffer(framebuffer);
+        pipelineInfo.setCullMode(sgl::vk::CullMode::CULL_NONE);
+        return std::make_shared<sgl::vk::GraphicsPipeline>(device, pipelineInfo);
+    }
+
+    sgl::vk::BufferPtr createColorBuffer(const glm::vec4& color) {
+        return std::make_shared<sgl::vk::Buffer>(
+                device, sizeof(glm::vec4), &color,
+                VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_GPU_ONLY);
+    }
+
+    sgl::vk::RasterDataPtr createRasterData(
+            sgl::vk::GraphicsPipelinePtr& graphicsPipeline, const sgl::vk::BufferPtr& colorBuffer) {
+        auto rasterData = std::make_shared<sgl::vk::RasterData>(renderer, graphicsPipeline);
+        rasterData->setUseDescriptorSetCache(true);
+        rasterData->setStaticBuffer(colorBuffer, 0);
+        rasterData->setNumVertices(3);
+        return rasterData;
+    }
+
+    /// Returns the time in milliseconds needed for recording the draw list.
+    double render(sgl::vk::DrawList& drawList, bool useParallelRecording) {
+        renderer->beginCommandBuffer();
+        auto startTime = std::chrono::steady_clock::now();
+        if (useParallelRecording) {
+            renderer->renderParallel(drawList);
+        } else {
+            renderer->render(drawList);
+        }
+        auto endTime = std::chrono::steady_clock::now();
+        renderer->endCommandBuffer();
+        renderer->submitToQueueImmediate();
+        renderer->getFrameCommandBuffers();
+        return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    }
+
+    uint32_t readFirstPixel(const sgl::vk::ImageViewPtr& renderTarget) {
+        auto stagingBuffer = std::make_shared<sgl::vk::Buffer>(
+                device, imageWidth * imageHeight * sizeof(uint32_t), VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VMA_MEMORY_USAGE_GPU_TO_CPU);
+        renderTarget->getImage()->transitionImageLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+        renderTarget->getImage()->copyToBuffer(stagingBuffer);
+        auto* data = reinterpret_cast<uint32_t*>(stagingBuffer->mapMemory());
+        uint32_t pixel = data[0];
+        stagingBuffer->unmapMemory();
+        return pixel;
+    }
+
+    const uint32_t imageWidth = 64;
+    const uint32_t imageHeight = 64;
+    sgl::vk::Instance* instance = nullptr;
+    sgl::vk::Device* device = nullptr;
+    sgl::vk::ShaderManagerVk* shaderManager = nullptr;
+    sgl::vk::Renderer* renderer = nullptr;
+    sgl::vk::ShaderStagesPtr shaderStages;
+};
+
+TEST_F(DrawListTestVk, FramebufferGroups) {
+    sgl::vk::ImageViewPtr renderTargetA = createRenderTarget();
+    sgl::vk::ImageViewPtr renderTargetB = createRenderTarget();
+    sgl::vk::FramebufferPtr framebufferA = createFramebuffer(renderTargetA);
+    sgl::vk::FramebufferPtr framebufferB = createFramebuffer(renderTargetB);
+    sgl::vk::GraphicsPipelinePtr graphicsPipelineA = createGraphicsPipeline(framebufferA);
+    sgl::vk::GraphicsPipelinePtr graphicsPipelineB = createGraphicsPipeline(framebufferB);
+    sgl::vk::BufferPtr colorBufferRed = createColorBuffer(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+    sgl::vk::BufferPtr colorBufferGreen = createColorBuffer(glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+    sgl::vk::BufferPtr colorBufferBlue = createColorBuffer(glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+
+    sgl::vk::DrawList drawList;
+    drawList.setSortMode(sgl::vk::DrawListSortMode::NONE);
+    drawList.add(createRasterData(graphicsPipelineA, colorBufferRed));
+    drawList.add(createRasterData(graphicsPipelineB, colorBufferGreen));
+    drawList.add(createRasterData(graphicsPipelineA, colorBufferBlue));
+
+    // Without sorting, the draw to B must not be moved behind the second draw to A.
+    const std::vector<sgl::vk::DrawListEntry>& entriesNone = drawList.getSortedEntries();
+    ASSERT_EQ(entriesNone.size(), 3u);
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(entriesNone.at(i).order, i);
+        EXPECT_EQ(entriesNone.at(i).framebufferGroup, i);
+    }
+    render(drawList, false);
+    // RGBA8 pixels read as little-endian 32-bit values.
+    EXPECT_EQ(readFirstPixel(renderTargetA), 0xFFFF0000u);
+    EXPECT_EQ(readFirstPixel(renderTargetB), 0xFF00FF00u);
+
+    // When sorting by state, all draws to A are merged into one render pass.
+    drawList.setSortMode(sgl::vk::DrawListSortMode::STATE);
+    const std::vector<sgl::vk::DrawListEntry>& entriesState = drawList.getSortedEntries();
+    EXPECT_EQ(entriesState.at(0).framebuffer, framebufferA);
+    EXPECT_EQ(entriesState.at(1).framebuffer, framebufferA);
+    EXPECT_EQ(entriesState.at(2).framebuffer, framebufferB);
+    EXPECT_EQ(entriesState.at(0).framebufferGroup, 0u);
+    EXPECT_EQ(entriesState.at(1).framebufferGroup, 0u);
+    EXPECT_EQ(entriesState.at(2).framebufferGroup, 1u);
+
+    // Switching back restores the order of the adds.
+    drawList.setSortMode(sgl::vk::DrawListSortMode::NONE);
+    const std::vector<sgl::vk::DrawListEntry>& entriesNoneRestored = drawList.getSortedEntries();
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(entriesNoneRestored.at(i).order, i);
+    }
+}
+
+TEST_F(DrawListTestVk, SortByDescriptorSet) {
+    sgl::vk::ImageViewPtr renderTarget = createRenderTarget();
+    sgl::vk::FramebufferPtr framebuffer = createFramebuffer(renderTarget);
+    sgl::vk::GraphicsPipelinePtr graphicsPipeline = createGraphicsPipeline(framebuffer);
+    std::vector<sgl::vk::BufferPtr> colorBuffers;
+    for (int i = 0; i < 3; i++) {
+        colorBuffers.push_back(createColorBuffer(glm::vec4(float(i) / 2.0f, 0.0f, 0.0f, 1.0f)));
+    }
+
+    // Raster data objects using the same buffer share their descriptor sets via the descriptor set cache.
+    sgl::vk::DrawList drawList;
+    drawList.setSortMode(sgl::vk::DrawListSortMode::STATE);
+    for (int i = 0; i < 12; i++) {
+        drawList.add(createRasterData(graphicsPipeline, colorBuffers.at((i * 5) % 3)));
+    }
+    render(drawList, false);
+    render(drawList, true);
+
+    const std::vector<sgl::vk::DrawListEntry>& entries = drawList.getSortedEntries();
+    ASSERT_EQ(entries.size(), 12u);
+    int numDescriptorSetChanges = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        EXPECT_NE(entries.at(i).descriptorSet, VkDescriptorSet(VK_NULL_HANDLE));
+        if (i > 0 && entries.at(i).descriptorSet != entries.at(i - 1).descriptorSet) {
+            numDescriptorSetChanges++;
+        }
+    }
+    EXPECT_EQ(numDescriptorSetChanges, 2);
+}
+
+TEST_F(DrawListTestVk, ParallelRecordingScaling) {
+    const int numDraws = 20000;
+    const int numIterations = 5;
+    sgl::vk::ImageViewPtr renderTarget = createRenderTarget();
+    sgl::vk::FramebufferPtr framebuffer = createFramebuffer(renderTarget);
+    sgl::vk::GraphicsPipelinePtr graphicsPipeline = createGraphicsPipeline(framebuffer);
+    std::vector<sgl::vk::BufferPtr> colorBuffers;
+    for (int i = 0; i < 16; i++) {
+        colorBuffers.push_back(createColorBuffer(glm::vec4(float(i) / 15.0f, 0.0f, 1.0f, 1.0f)));
+    }
+    sgl::vk::DrawList drawList;
+    drawList.setSortMode(sgl::vk::DrawListSortMode::STATE);
+    for (int i = 0; i < numDraws; i++) {
+        drawList.add(createRasterData(graphicsPipeline, colorBuffers.at(i % 16)));
+    }
+
+    // Warm-up (descriptor set updates, sorting and allocation of the secondary command buffers).
+    render(drawList, false);
+    uint32_t pixelReference = readFirstPixel(renderTarget);
+
+    double timeSerial = 0.0;
+    for (int it = 0; it < numIterations; it++) {
+        timeSerial += render(drawList, false) / double(numIterations);
+    }
+    std::cout << "Recording " << numDraws << " draws: " << timeSerial << "ms (render)" << std::endl;
+
+    auto maxNumPartitions = uint32_t(std::max(std::thread::hardware_concurrency(), 1u));
+    renderer->setMinNumDrawsPerRecordingPartition(1);
+    for (uint32_t numPartitions = 1; numPartitions <= maxNumPartitions; numPartitions *= 2) {
+        renderer->setNumParallelRecordingPartitions(numPartitions);
+        render(drawList, true);
+        double timeParallel = 0.0;
+        for (int it = 0; it < numIterations; it++) {
+            timeParallel += render(drawList, true) / double(numIterations);
+        }
+        EXPECT_EQ(readFirstPixel(renderTarget), pixelReference);
+        std::cout << "Recording " << numDraws << " draws: " << timeParallel << "ms (renderParallel, "
+                  << numPartitions << " partitions)" << std::endl;
+    }
+    renderer->setNumParallelRecordingPartitions(0);
+    renderer->setMinNumDrawsPerRecordingPartition(64);
+}
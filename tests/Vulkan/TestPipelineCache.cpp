@@ -0,0 +1,199 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Vulkan/Utils/Instance.hpp>
+#include <Graphics/Vulkan/Utils/Device.hpp>
+#include <Graphics/Vulkan/Render/PipelineCache.hpp>
+
+/*
+ * Byte offsets in the header of the pipeline cache files (see PipelineCacheFileHeader in PipelineCache.cpp):
+ * magic (8 bytes), file version, vendor ID, device ID, driver version (4 bytes each), pipeline cache UUID,
+ * data size and data hash (8 bytes each).
+ */
+static const size_t FILE_VERSION_OFFSET = 8;
+static const size_t DEVICE_ID_OFFSET = 16;
+static const size_t DRIVER_VERSION_OFFSET = 20;
+static const size_t FILE_HEADER_SIZE = 40 + VK_UUID_SIZE;
+
+class PipelineCacheTestVk : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sgl::Logfile::get()->createLogfile("LogfilePipelineCacheVulkan.html", "TestPipelineCacheVulkan");
+
+        instance = new sgl::vk::Instance;
+        instance->createInstance({}, false);
+        device = new sgl::vk::Device;
+        std::vector<const char*> requiredDeviceExtensions;
+        std::vector<const char*> optionalDeviceExtensions;
+        sgl::vk::DeviceFeatures requestedDeviceFeatures{};
+        device->createDeviceHeadless(
+                instance, requiredDeviceExtensions, optionalDeviceExtensions, requestedDeviceFeatures);
+        std::cout << "Running on " << device->getDeviceName() << std::endl;
+
+        auto timeStamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        directoryPath = std::filesystem::temp_directory_path() / (
+                std::string("sgl_pipeline_cache_test_")
+                + ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_" + std::to_string(timeStamp));
+        filename = (directoryPath / "PipelineCache" / "cache.bin").string();
+    }
+
+    void TearDown() override {
+        std::error_code errorCode;
+        std::filesystem::remove_all(directoryPath, errorCode);
+        delete device;
+        delete instance;
+    }
+
+    static std::vector<char> readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    static void writeFile(const std::string& path, const std::vector<char>& content) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), std::streamsize(content.size()));
+    }
+
+    /// Saves a cache, modifies the file and returns whether a new cache accepts it.
+    bool loadModifiedFile(const std::function<void(std::vector<char>&)>& modifyFile) {
+        sgl::vk::PipelineCache pipelineCache(device);
+        EXPECT_TRUE(pipelineCache.saveToFile(filename));
+        std::vector<char> content = readFile(filename);
+        modifyFile(content);
+        writeFile(filename, content);
+        sgl::vk::PipelineCache loadedPipelineCache(device);
+        bool isLoaded = loadedPipelineCache.loadFromFile(filename);
+        EXPECT_EQ(loadedPipelineCache.getStatistics().loadedDataSize > 0, isLoaded);
+        // A rejected file still leaves a usable (empty) cache behind.
+        EXPECT_NE(loadedPipelineCache.getVkPipelineCache(), VK_NULL_HANDLE);
+        return isLoaded;
+    }
+
+    /// Returns the names of all files in the directory of the cache file.
+    std::vector<std::string> getCacheDirectoryFiles() const {
+        std::vector<std::string> fileNames;
+        for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(filename).parent_path())) {
+            fileNames.push_back(entry.path().filename().string());
+        }
+        return fileNames;
+    }
+
+    sgl::vk::Instance* instance = nullptr;
+    sgl::vk::Device* device = nullptr;
+    std::filesystem::path directoryPath;
+    std::string filename;
+};
+
+TEST_F(PipelineCacheTestVk, SaveLoadRoundTrip) {
+    sgl::vk::PipelineCache pipelineCache(device);
+    EXPECT_FALSE(pipelineCache.save()) << "No file name was set.";
+    // The parent directories of the file are created.
+    ASSERT_TRUE(pipelineCache.saveToFile(filename));
+    std::vector<char> content = readFile(filename);
+    ASSERT_GT(content.size(), FILE_HEADER_SIZE);
+
+    sgl::vk::PipelineCache loadedPipelineCache(device);
+    ASSERT_TRUE(loadedPipelineCache.loadFromFile(filename));
+    EXPECT_EQ(loadedPipelineCache.getFilename(), filename);
+    EXPECT_EQ(loadedPipelineCache.getStatistics().loadedDataSize, content.size() - FILE_HEADER_SIZE);
+
+    // Saving the loaded cache through the stored file name gives a valid file again.
+    ASSERT_TRUE(loadedPipelineCache.save());
+    sgl::vk::PipelineCache reloadedPipelineCache(device);
+    EXPECT_TRUE(reloadedPipelineCache.loadFromFile(filename));
+
+    sgl::vk::PipelineCache missingPipelineCache(device);
+    EXPECT_FALSE(missingPipelineCache.loadFromFile((directoryPath / "missing.bin").string()));
+    EXPECT_EQ(missingPipelineCache.getStatistics().loadedDataSize, 0u);
+}
+
+TEST_F(PipelineCacheTestVk, CorruptedFilesAreRejected) {
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.back() ^= char(0x5A);
+    })) << "Modified cache data";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.resize(content.size() - 1);
+    })) << "Truncated cache data";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.push_back(0);
+    })) << "Trailing bytes";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.resize(FILE_HEADER_SIZE / 2);
+    })) << "Truncated header";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.at(0) = 'X';
+    })) << "Invalid magic";
+}
+
+TEST_F(PipelineCacheTestVk, MismatchedHeadersAreRejected) {
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.at(FILE_VERSION_OFFSET) ^= char(0x01);
+    })) << "File version";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.at(DEVICE_ID_OFFSET) ^= char(0x01);
+    })) << "Device ID";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.at(DRIVER_VERSION_OFFSET) ^= char(0x01);
+    })) << "Driver version";
+    EXPECT_FALSE(loadModifiedFile([](std::vector<char>& content) {
+        content.at(FILE_HEADER_SIZE - 16 - VK_UUID_SIZE) ^= char(0x01);
+    })) << "Pipeline cache UUID";
+    EXPECT_TRUE(loadModifiedFile([](std::vector<char>&) {})) << "Unmodified file";
+}
+
+TEST_F(PipelineCacheTestVk, SaveReplacesFileAtomically) {
+    std::filesystem::create_directories(std::filesystem::path(filename).parent_path());
+    writeFile(filename, std::vector<char>(16, 'x'));
+    sgl::vk::PipelineCache pipelineCache(device);
+    ASSERT_TRUE(pipelineCache.saveToFile(filename));
+    ASSERT_TRUE(pipelineCache.saveToFile(filename));
+    // The old file was replaced, and the temporary files were renamed.
+    EXPECT_EQ(getCacheDirectoryFiles(), std::vector<std::string>{ "cache.bin" });
+    sgl::vk::PipelineCache loadedPipelineCache(device);
+    EXPECT_TRUE(loadedPipelineCache.loadFromFile(filename));
+
+    // If the rename fails (here, as the target is a directory), the temporary file is removed again.
+    std::string directoryFilename = (std::filesystem::path(filename).parent_path() / "directory.bin").string();
+    std::filesystem::create_directories(directoryFilename + "/content");
+    EXPECT_FALSE(pipelineCache.saveToFile(directoryFilename));
+    std::vector<std::string> fileNames = getCacheDirectoryFiles();
+    std::sort(fileNames.begin(), fileNames.end());
+    EXPECT_EQ(fileNames, (std::vector<std::string>{ "cache.bin", "directory.bin" }));
+}
@@ -0,0 +1,181 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Christoph Neuhauser
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include <Utils/File/Logfile.hpp>
+#include <Graphics/Vulkan/Utils/Instance.hpp>
+#include <Graphics/Vulkan/Utils/Device.hpp>
+#include <Graphics/Vulkan/Buffers/Buffer.hpp>
+#include <Graphics/Vulkan/Buffers/UploadManager.hpp>
+
+class UploadManagerTestVk : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sgl::Logfile::get()->createLogfile("LogfileUploadManagerVulkan.html", "TestUploadManagerVulkan");
+
+        instance = new sgl::vk::Instance;
+        instance->createInstance({}, false);
+        device = new sgl::vk::Device;
+        std::vector<const char*> requiredDeviceExtensions;
+        std::vector<const char*> optionalDeviceExtensions;
+        sgl::vk::DeviceFeatures requestedDeviceFeatures{};
+        device->createDeviceHeadless(
+                instance, requiredDeviceExtensions, optionalDeviceExtensions, requestedDeviceFeatures);
+        std::cout << "Running on " << device->getDeviceName() << std::endl;
+    }
+
+    void TearDown() override {
+        if (device) {
+            device->waitIdle();
+        }
+        delete device;
+        delete instance;
+    }
+
+    sgl::vk::BufferPtr createDeviceBuffer(size_t sizeInBytes) {
+        return std::make_shared<sgl::vk::Buffer>(
+                device, sizeInBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VMA_MEMORY_USAGE_GPU_ONLY);
+    }
+
+    /// Copies the content of a device-local buffer to the host.
+    std::vector<uint8_t> readBuffer(const sgl::vk::BufferPtr& buffer) {
+        auto stagingBuffer = std::make_shared<sgl::vk::Buffer>(
+                device, buffer->getSizeInBytes(), VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU);
+        VkCommandBuffer commandBuffer = device->beginSingleTimeCommands();
+        buffer->copyDataTo(stagingBuffer, commandBuffer);
+        device->endSingleTimeCommands(commandBuffer);
+        std::vector<uint8_t> data(buffer->getSizeInBytes());
+        memcpy(data.data(), stagingBuffer->mapMemory(), data.size());
+        stagingBuffer->unmapMemory();
+        return data;
+    }
+
+    static std::vector<uint8_t> createTestData(size_t sizeInBytes, uint32_t seed) {
+        std::vector<uint8_t> data(sizeInBytes);
+        for (size_t i = 0; i < sizeInBytes; i++) {
+            data[i] = uint8_t((i * 31u + seed * 17u + (i >> 8u)) & 0xFFu);
+        }
+        return data;
+    }
+
+    sgl::vk::Instance* instance = nullptr;
+    sgl::vk::Device* device = nullptr;
+};
+
+TEST_F(UploadManagerTestVk, UploadsAreBatched) {
+    sgl::vk::UploadManagerSettings settings;
+    settings.autoFlushThreshold = 0;
+    sgl::vk::UploadManager uploadManager(device, settings);
+
+    const int numBuffers = 16;
+    const size_t bufferSize = 1000;
+    std::vector<sgl::vk::BufferPtr> buffers;
+    std::vector<std::vector<uint8_t>> bufferData;
+    sgl::vk::UploadToken token = 0;
+    for (int i = 0; i < numBuffers; i++) {
+        buffers.push_back(createDeviceBuffer(bufferSize));
+        bufferData.push_back(createTestData(bufferSize, uint32_t(i)));
+        sgl::vk::UploadToken uploadToken = uploadManager.uploadBuffer(
+                buffers.back(), bufferData.back().data(), bufferSize);
+        ASSERT_NE(uploadToken, 0u);
+        if (i > 0) {
+            EXPECT_EQ(uploadToken, token) << "All copies before the flush belong to the same batch.";
+        }
+        token = uploadToken;
+    }
+    EXPECT_FALSE(uploadManager.getIsFinished(token));
+    EXPECT_EQ(uploadManager.flush(), token);
+    uploadManager.wait(token);
+    EXPECT_TRUE(uploadManager.getIsFinished(token));
+    EXPECT_TRUE(uploadManager.getIsFinished(0));
+
+    sgl::vk::UploadManagerStatistics statistics = uploadManager.getStatistics();
+    EXPECT_EQ(statistics.numSubmissions, 1u);
+    EXPECT_EQ(statistics.numBufferCopies, uint64_t(numBuffers));
+    EXPECT_EQ(statistics.numBytesUploaded, uint64_t(numBuffers * bufferSize));
+    for (int i = 0; i < numBuffers; i++) {
+        EXPECT_EQ(readBuffer(buffers.at(i)), bufferData.at(i)) << "buffer " << i;
+    }
+}
+
+TEST_F(UploadManagerTestVk, StagingRingGrows) {
+    sgl::vk::UploadManagerSettings settings;
+    settings.stagingBufferSize = 1024;
+    sgl::vk::UploadManager uploadManager(device, settings);
+    EXPECT_EQ(uploadManager.getStatistics().stagingBufferSize, 1024u);
+
+    const size_t bufferSize = 100000;
+    auto buffer = createDeviceBuffer(bufferSize);
+    std::vector<uint8_t> data = createTestData(bufferSize, 7);
+    sgl::vk::UploadToken token = uploadManager.uploadBuffer(buffer, data.data(), bufferSize);
+    uploadManager.wait(token);
+
+    // The ring grows to the next power of two that holds the upload including its alignment.
+    EXPECT_EQ(uploadManager.getStatistics().stagingBufferSize, 131072u);
+    EXPECT_EQ(readBuffer(buffer), data);
+}
+
+TEST_F(UploadManagerTestVk, TokensCompleteInOrderWhileRingIsReused) {
+    sgl::vk::UploadManagerSettings settings;
+    settings.stagingBufferSize = 64 * 1024;
+    settings.autoFlushThreshold = 16 * 1024;
+    sgl::vk::UploadManager uploadManager(device, settings);
+
+    // The uploads in total are eight times larger than the ring, so its memory needs to be reclaimed repeatedly.
+    const size_t chunkSize = 8 * 1024;
+    const size_t numChunks = 64;
+    auto buffer = createDeviceBuffer(chunkSize * numChunks);
+    std::vector<uint8_t> data = createTestData(chunkSize * numChunks, 3);
+    std::vector<sgl::vk::UploadToken> tokens;
+    for (size_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++) {
+        tokens.push_back(uploadManager.uploadBuffer(
+                buffer, data.data() + chunkIdx * chunkSize, chunkSize, chunkIdx * chunkSize));
+        if (chunkIdx > 0) {
+            EXPECT_GE(tokens.at(chunkIdx), tokens.at(chunkIdx - 1));
+        }
+    }
+
+    // Waiting for a token also means that all earlier batches have completed.
+    sgl::vk::UploadToken middleToken = tokens.at(numChunks / 2);
+    uploadManager.wait(middleToken);
+    for (size_t chunkIdx = 0; chunkIdx <= numChunks / 2; chunkIdx++) {
+        EXPECT_TRUE(uploadManager.getIsFinished(tokens.at(chunkIdx))) << "chunk " << chunkIdx;
+    }
+    uploadManager.waitAll();
+    EXPECT_TRUE(uploadManager.getIsFinished(tokens.back()));
+
+    sgl::vk::UploadManagerStatistics statistics = uploadManager.getStatistics();
+    EXPECT_EQ(statistics.stagingBufferSize, settings.stagingBufferSize);
+    EXPECT_EQ(statistics.numSubmissions, uint64_t(numChunks * chunkSize / settings.autoFlushThreshold));
+    EXPECT_EQ(readBuffer(buffer), data);
+}